@@ -197,3 +197,20 @@ ELSEIF( MSVC )
 
 ENDIF( )
 
+################################################################################
+#
+# OpenMP
+#
+################################################################################
+IF( WITH_OPENMP )
+	FIND_PACKAGE( OpenMP )
+	IF( OPENMP_FOUND )
+		SET( CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${OpenMP_C_FLAGS}" )
+		SET( CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}" )
+		SET( CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${OpenMP_CXX_FLAGS}" )
+		SET( CMAKE_SHARED_LINKER_FLAGS "${CMAKE_SHARED_LINKER_FLAGS} ${OpenMP_CXX_FLAGS}" )
+	ELSE( )
+		MESSAGE( STATUS "OpenMP not found - shooting intervals are integrated sequentially" )
+	ENDIF( )
+ENDIF( WITH_OPENMP )
+
@@ -113,6 +113,10 @@ IF( CMAKE_COMPILER_IS_GNUCC OR CMAKE_COMPILER_IS_GNUCXX OR "${CMAKE_CXX_COMPILER
 	GET_FILENAME_COMPONENT(scriptPath ${CMAKE_CURRENT_LIST_FILE} PATH)
 	SET( CPUINFO "${scriptPath}/cpuInfo.cc" )
 
+	SET( CMAKE_REQUIRED_FLAGS "-fPIC -mavx" )
+	SET( CMAKE_REQUIRED_DEFINITIONS -DTEST=m_bAVX )
+	CHECK_CXX_SOURCE_RUNS( ${CPUINFO} HAS_AVX_EXTENSIONS )
+
 	SET( CMAKE_REQUIRED_FLAGS "-fPIC -msse4.2" )
 	SET( CMAKE_REQUIRED_DEFINITIONS -DTEST=m_bSSE42 )
 	CHECK_CXX_SOURCE_RUNS( ${CPUINFO} HAS_SSE42_EXTENSIONS)
@@ -153,6 +157,11 @@ IF( CMAKE_COMPILER_IS_GNUCC OR CMAKE_COMPILER_IS_GNUCXX OR "${CMAKE_CXX_COMPILER
 		SET (SSE_FLAGS "-mfpmath=sse")
 	ENDIF()
 	
+	# -mavx is only added on request, since it makes the library fault on
+	# machines without AVX (see option WITH_AVX)
+	IF (HAS_AVX_EXTENSIONS AND WITH_AVX)
+		SET(SSE_FLAGS "${SSE_FLAGS} -mavx")
+	ENDIF()
 	IF (HAS_SSE42_EXTENSIONS) 
 		SET(SSE_FLAGS "${SSE_FLAGS} -msse4.2") 
 	ENDIF()
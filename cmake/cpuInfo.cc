@@ -42,6 +42,8 @@ using namespace std ;
 #define ECX_SSSE3_bit    0x200UL      //  9 bit
 #define ECX_SSE41_bit    0x80000UL    // 19 bit
 #define ECX_SSE42_bit    0x100000UL   // 20 bit
+#define ECX_OSXSAVE_bit  0x8000000UL  // 27 bit
+#define ECX_AVX_bit      0x10000000UL // 28 bit
 
 #define ECX_SSE4A_bit    0x40UL       //  6 bit
 #define ECX_SSE5_bit     0x800UL      // 11 bit
@@ -89,6 +91,19 @@ using namespace std ;
   }
 #endif
 
+/* AVX also requires the operating system to save the YMM registers */
+static
+bool
+osSavesYMM() {
+#ifdef _WIN32
+  return ( _xgetbv( 0 ) & 0x6 ) == 0x6 ;
+#else
+  unsigned int eax, edx ;
+  __asm__ ( ".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (0) ) ;
+  return ( eax & 0x6 ) == 0x6 ;
+#endif
+}
+
 static
 void
 info( unsigned long   CPUInfo[4],
@@ -121,6 +136,7 @@ info( bool & m_bMMX,
       bool & m_bSSE42,  
       bool & m_bSSE4a,  
       bool & m_bSSE5,  
+      bool & m_bAVX,
       bool & m_b3Dnow,   
       bool & m_b3DnowExt ) {
 
@@ -134,6 +150,7 @@ info( bool & m_bMMX,
   m_bSSE42    = false ;
   m_bSSE4a    = false ;
   m_bSSE5     = false ;
+  m_bAVX      = false ;
   m_b3Dnow    = false ;
   m_b3DnowExt = false ;
 
@@ -152,6 +169,8 @@ info( bool & m_bMMX,
   if ( EDX_MMXplus_bit  & CPUInfoExt[3] ) m_bMMXplus  = true ;
   if ( ECX_SSE4A_bit    & CPUInfoExt[2] ) m_bSSE4a    = true ;
   if ( ECX_SSE5_bit     & CPUInfoExt[2] ) m_bSSE5     = true ;
+  if ( ( ECX_AVX_bit & ECX ) && ( ECX_OSXSAVE_bit & ECX ) && osSavesYMM() )
+    m_bAVX = true ;
 }
 
 int
@@ -167,6 +186,7 @@ main()
   bool m_bSSE42    ;
   bool m_bSSE4a    ;
   bool m_bSSE5     ;
+  bool m_bAVX      ;
   bool m_b3Dnow    ;
   bool m_b3DnowExt ;
   
@@ -180,6 +200,7 @@ main()
         m_bSSE42,  
         m_bSSE4a,  
         m_bSSE5,  
+        m_bAVX,
         m_b3Dnow,   
         m_b3DnowExt ) ;
   
@@ -0,0 +1,299 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/curve/breakpoints.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Checks that Curve::discretize returns the same values as point-wise
+ *    calls of Curve::evaluate, in particular at the breakpoints between
+ *    two pieces where the curve jumps (pieces are half-open [t_i,t_{i+1})).
+ *    The natural cubic spline (IM_CUBIC) is moreover compared with a
+ *    reference spline and checked for continuity of its value and its
+ *    first and second derivative at the breakpoints.
+ *    Returns a non-zero value if any check fails.
+ */
+
+
+#include <acado_optimal_control.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* counts the grid points at which discretize and evaluate differ */
+static int compareAtGrid( const Curve &c, const Grid &evaluationGrid, const char *name )
+{
+    VariablesGrid discretized;
+    Vector        value;
+
+    if ( c.discretize( evaluationGrid,discretized ) != SUCCESSFUL_RETURN )
+    {
+        acadoPrintf( "%s: discretize failed\n",name );
+        return 1;
+    }
+
+    int nErrors = 0;
+
+    for( uint i=0; i<evaluationGrid.getNumPoints(); ++i )
+    {
+        double t = evaluationGrid.getTime( i );
+
+        if ( c.evaluate( t,value ) != SUCCESSFUL_RETURN )
+        {
+            acadoPrintf( "%s: evaluate failed at t = %e\n",name,t );
+            ++nErrors;
+            continue;
+        }
+
+        for( uint j=0; j<(uint)c.getDim(); ++j )
+            if ( fabs( discretized( i,j ) - value( j ) ) > 1.0e-12 )
+            {
+                acadoPrintf( "%s: t = %e, component %d: discretize %e, evaluate %e\n",
+                             name,t,j,discretized( i,j ),value( j ) );
+                ++nErrors;
+            }
+    }
+
+    return nErrors;
+}
+
+
+/* computes the second derivatives M of the natural cubic spline through
+ * one component of the data by solving the (dense) moment equations */
+static Vector naturalSplineMoments( const VariablesGrid &data, uint component )
+{
+    uint n = data.getNumPoints( );
+
+    Matrix A = zeros( n,n );
+    Vector r = zeros( n );
+
+    A( 0,0 )     = 1.0;
+    A( n-1,n-1 ) = 1.0;
+
+    for( uint i=1; i+1<n; ++i )
+    {
+        double h0 = data.getTime( i )   - data.getTime( i-1 );
+        double h1 = data.getTime( i+1 ) - data.getTime( i );
+
+        A( i,i-1 ) = h0;
+        A( i,i   ) = 2.0*( h0+h1 );
+        A( i,i+1 ) = h1;
+
+        r( i ) = 6.0*( ( data( i+1,component ) - data( i,component ) )/h1
+                     - ( data( i,component ) - data( i-1,component ) )/h0 );
+    }
+
+    return A.getInverse( )*r;
+}
+
+
+/* evaluates the reference spline on the interval [t_i,t_{i+1}] */
+static double naturalSpline( const VariablesGrid &data, uint component,
+                             const Vector &M, uint i, double t )
+{
+    double t0 = data.getTime( i );
+    double t1 = data.getTime( i+1 );
+    double h  = t1 - t0;
+
+    return M( i )  *( t1-t )*( t1-t )*( t1-t )/( 6.0*h )
+         + M( i+1 )*( t-t0 )*( t-t0 )*( t-t0 )/( 6.0*h )
+         + ( data( i,component )  /h - M( i )  *h/6.0 )*( t1-t )
+         + ( data( i+1,component )/h - M( i+1 )*h/6.0 )*( t-t0 );
+}
+
+
+/* compares an IM_CUBIC curve with the reference spline within each interval
+ * and checks the continuity of value, slope and curvature at its breakpoints;
+ * the one-sided four-point differences used for the latter are exact for
+ * cubic pieces, hence only rounding errors remain */
+static int checkCubicSpline( const Curve &c, const VariablesGrid &data, const char *name )
+{
+    const double delta = 1.0e-3;
+
+    int    nErrors = 0;
+    Vector value;
+    double fLeft[4], fRight[4];
+
+    for( uint j=0; j<data.getNumValues( ); ++j )
+    {
+        Vector M = naturalSplineMoments( data,j );
+
+        for( uint i=0; i+1<data.getNumPoints( ); ++i )
+        {
+            double t0 = data.getTime( i );
+            double h  = data.getTime( i+1 ) - t0;
+
+            // values at the data points and inside the interval:
+            for( uint k=0; k<4; ++k )
+            {
+                double t = t0 + 0.25*k*h;
+
+                c.evaluate( t,value );
+
+                if ( fabs( value( j ) - naturalSpline( data,j,M,i,t ) ) > 1.0e-10 )
+                {
+                    acadoPrintf( "%s: t = %e, component %d: curve %e, reference %e\n",
+                                 name,t,j,value( j ),naturalSpline( data,j,M,i,t ) );
+                    ++nErrors;
+                }
+            }
+
+            if ( i == 0 )
+                continue;
+
+            // continuity at the breakpoint t0 between the pieces i-1 and i:
+            for( uint k=0; k<4; ++k )
+            {
+                c.evaluate( t0-k*delta,value );  fLeft [k] = value( j );
+                c.evaluate( t0+k*delta,value );  fRight[k] = value( j );
+            }
+
+            double slopeLeft      =  (  11.0*fLeft [0] - 18.0*fLeft [1] + 9.0*fLeft [2] - 2.0*fLeft [3] )/( 6.0*delta );
+            double slopeRight     = -(  11.0*fRight[0] - 18.0*fRight[1] + 9.0*fRight[2] - 2.0*fRight[3] )/( 6.0*delta );
+            double curvatureLeft  =  (   2.0*fLeft [0] -  5.0*fLeft [1] + 4.0*fLeft [2] -     fLeft [3] )/( delta*delta );
+            double curvatureRight =  (   2.0*fRight[0] -  5.0*fRight[1] + 4.0*fRight[2] -     fRight[3] )/( delta*delta );
+
+            if ( ( fabs( fRight[0] - data( i,j ) ) > 1.0e-12 ) ||
+                 ( fabs( slopeLeft - slopeRight ) > 1.0e-6 ) ||
+                 ( fabs( curvatureLeft - curvatureRight ) > 1.0e-4 ) )
+            {
+                acadoPrintf( "%s: t = %e, component %d not smooth: value %e (data %e), "
+                             "slope %e/%e, curvature %e/%e\n",
+                             name,t0,j,fRight[0],data( i,j ),
+                             slopeLeft,slopeRight,curvatureLeft,curvatureRight );
+                ++nErrors;
+            }
+        }
+    }
+
+    return nErrors;
+}
+
+
+int main( )
+{
+    int nErrors = 0;
+
+
+    // PIECEWISE CONSTANT CURVE BUILT FROM VECTORS:
+    // --------------------------------------------
+    Curve c1;
+
+    Vector v(2);
+    v(0) = 1.0;  v(1) = -1.0;  c1.add( 0.0,0.5,v );
+    v(0) = 2.0;  v(1) = -2.0;  c1.add( 0.5,1.0,v );
+    v(0) = 3.0;  v(1) = -3.0;  c1.add( 1.0,2.0,v );
+
+
+    // PIECEWISE CONSTANT AND LINEAR INTERPOLATION OF SAMPLED DATA:
+    // ------------------------------------------------------------
+    VariablesGrid data( 1,Grid( 0.0,5.0,6 ) );
+
+    data( 0,0 ) = 0.0;
+    data( 1,0 ) = 0.8;
+    data( 2,0 ) = 0.3;
+    data( 3,0 ) = 0.65;
+    data( 4,0 ) = -0.2;
+    data( 5,0 ) = 0.6;
+
+    Curve c2, c3;
+
+    c2.add( data,IM_CONSTANT );
+    c3.add( data,IM_LINEAR   );
+
+
+    // NATURAL CUBIC SPLINES THROUGH EQUIDISTANT AND
+    // NON-EQUIDISTANT SAMPLES WITH TWO COMPONENTS:
+    // ---------------------------------------------
+    Grid unevenGrid( 7 );
+    unevenGrid.setTime( 0,0.0  );
+    unevenGrid.setTime( 1,0.3  );
+    unevenGrid.setTime( 2,0.5  );
+    unevenGrid.setTime( 3,1.4  );
+    unevenGrid.setTime( 4,1.5  );
+    unevenGrid.setTime( 5,2.75 );
+    unevenGrid.setTime( 6,3.0  );
+
+    VariablesGrid unevenData( 2,unevenGrid );
+
+    for( uint i=0; i<unevenData.getNumPoints( ); ++i )
+    {
+        unevenData( i,0 ) = sin( 2.0*unevenGrid.getTime( i ) );
+        unevenData( i,1 ) = ( i%2 == 0 ) ? 1.0 : -0.5*i;
+    }
+
+    Curve c4, c5;
+
+    c4.add( data,IM_CUBIC );
+    c5.add( unevenData,IM_CUBIC );
+
+
+    // EVALUATE ON THE BREAKPOINTS, ON A FINER SORTED GRID
+    // AND ON A GRID THAT CONTAINS EACH BREAKPOINT TWICE:
+    // ---------------------------------------------------
+    Grid breakpoints1( 4 );
+    breakpoints1.setTime( 0,0.0 );
+    breakpoints1.setTime( 1,0.5 );
+    breakpoints1.setTime( 2,1.0 );
+    breakpoints1.setTime( 3,2.0 );
+
+    Grid fine1( 0.0,2.0,41 );
+    Grid fine2( 0.0,5.0,51 );
+
+    Grid twice2( 12 );
+    for( uint i=0; i<6; ++i )
+    {
+        twice2.setTime( 2*i,  (double)i );
+        twice2.setTime( 2*i+1,(double)i );
+    }
+
+    nErrors += compareAtGrid( c1,breakpoints1,"constant pieces, breakpoints" );
+    nErrors += compareAtGrid( c1,fine1,       "constant pieces, fine grid"   );
+    nErrors += compareAtGrid( c2,data.getTimePoints(),"IM_CONSTANT, breakpoints" );
+    nErrors += compareAtGrid( c2,fine2,       "IM_CONSTANT, fine grid"       );
+    nErrors += compareAtGrid( c2,twice2,      "IM_CONSTANT, repeated points" );
+    nErrors += compareAtGrid( c3,data.getTimePoints(),"IM_LINEAR, breakpoints" );
+    nErrors += compareAtGrid( c3,fine2,       "IM_LINEAR, fine grid"         );
+    nErrors += compareAtGrid( c4,data.getTimePoints(),"IM_CUBIC, breakpoints" );
+    nErrors += compareAtGrid( c4,fine2,       "IM_CUBIC, fine grid"          );
+    nErrors += compareAtGrid( c5,unevenGrid,  "IM_CUBIC, uneven breakpoints" );
+
+    nErrors += checkCubicSpline( c4,data,      "IM_CUBIC, equidistant"     );
+    nErrors += checkCubicSpline( c5,unevenData,"IM_CUBIC, non-equidistant" );
+
+
+    if ( nErrors > 0 )
+    {
+        acadoPrintf( "curve checks failed at %d points\n",nErrors );
+        return 1;
+    }
+
+    acadoPrintf( "all curve checks passed\n" );
+
+    return 0;
+}
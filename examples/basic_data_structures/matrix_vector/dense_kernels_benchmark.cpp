@@ -0,0 +1,228 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/dense_kernels_benchmark.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Micro-benchmark of the dense kernels behind the Matrix class for
+ *    square matrices of dimension 4 to 200. The products are compared
+ *    with straightforward triple loops, the factorizations are checked
+ *    via their residuum.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* Straightforward reference implementations. */
+void naiveProduct( const Matrix &A, const Matrix &B, Matrix &C ){
+
+    uint i, j, k;
+
+    C.init( A.getNumRows(), B.getNumCols() );
+    C.setZero();
+
+    for( i = 0; i < A.getNumRows(); i++ )
+        for( j = 0; j < B.getNumCols(); j++ )
+            for( k = 0; k < A.getNumCols(); k++ )
+                C(i,j) += A(i,k) * B(k,j);
+}
+
+
+void naiveTransposedProduct( const Matrix &A, const Matrix &B, Matrix &C ){
+
+    uint i, j, k;
+
+    C.init( A.getNumCols(), B.getNumCols() );
+    C.setZero();
+
+    for( i = 0; i < A.getNumCols(); i++ )
+        for( j = 0; j < B.getNumCols(); j++ )
+            for( k = 0; k < A.getNumRows(); k++ )
+                C(i,j) += A(k,i) * B(k,j);
+}
+
+
+void naiveMatrixVector( const Matrix &A, const Vector &x, Vector &y ){
+
+    uint i, j;
+
+    y.init( A.getNumRows() );
+    y.setZero();
+
+    for( i = 0; i < A.getNumRows(); i++ )
+        for( j = 0; j < A.getNumCols(); j++ )
+            y(i) += A(i,j) * x(j);
+}
+
+
+double maxDeviation( const Matrix &A, const Matrix &B ){
+
+    return (A-B).getNorm( MN_ROW_SUM );
+}
+
+
+int main( ){
+
+    const uint nSizes = 12;
+    const uint sizes[nSizes] = { 4, 8, 12, 16, 24, 32, 48, 64, 96, 128, 160, 200 };
+
+    uint run1, run2, n, nRep;
+    double t0, tKernel, tNaive;
+
+    Matrix A, B, C, CRef, S, L, X;
+    Vector x, y, yRef;
+
+    acadoPrintf( "\n  n  | operation |  kernel [us] |  naive [us] | speed-up | deviation\n" );
+    acadoPrintf( "-----+-----------+--------------+-------------+----------+----------\n" );
+
+    for( run1 = 0; run1 < nSizes; run1++ ){
+
+        n    = sizes[run1];
+        nRep = 1 + 20000000 / (2*n*n*n);
+
+        A.init( n,n );
+        B.init( n,n );
+        x.init( n );
+
+        for( run2 = 0; run2 < n*n; run2++ ){
+            A(run2/n,run2%n) = cos( 1.0 + run2 );
+            B(run2/n,run2%n) = sin( 2.0 + run2 );
+        }
+        for( run2 = 0; run2 < n; run2++ )
+            x(run2) = cos( 3.0*run2 );
+
+
+        // MATRIX-MATRIX PRODUCT:
+        // ----------------------
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            C.setProduct( A, B );
+        tKernel = ( acadoGetTime() - t0 ) / nRep;
+
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            naiveProduct( A, B, CRef );
+        tNaive = ( acadoGetTime() - t0 ) / nRep;
+
+        acadoPrintf( "%4d | A*B       | %12.3f | %11.3f | %8.2f | %.1e\n",
+                     n, 1e6*tKernel, 1e6*tNaive, tNaive/tKernel, maxDeviation( C, CRef ) );
+
+
+        // TRANSPOSED MATRIX-MATRIX PRODUCT:
+        // ---------------------------------
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            C.setTransposedProduct( A, B );
+        tKernel = ( acadoGetTime() - t0 ) / nRep;
+
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            naiveTransposedProduct( A, B, CRef );
+        tNaive = ( acadoGetTime() - t0 ) / nRep;
+
+        acadoPrintf( "%4d | A^B       | %12.3f | %11.3f | %8.2f | %.1e\n",
+                     n, 1e6*tKernel, 1e6*tNaive, tNaive/tKernel, maxDeviation( C, CRef ) );
+
+
+        // SYMMETRIC PRODUCT:
+        // ------------------
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            S = A^A;
+        tKernel = ( acadoGetTime() - t0 ) / nRep;
+
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            naiveTransposedProduct( A, A, CRef );
+        tNaive = ( acadoGetTime() - t0 ) / nRep;
+
+        acadoPrintf( "%4d | A^A       | %12.3f | %11.3f | %8.2f | %.1e\n",
+                     n, 1e6*tKernel, 1e6*tNaive, tNaive/tKernel, maxDeviation( S, CRef ) );
+
+
+        // MATRIX-VECTOR PRODUCT:
+        // ----------------------
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < n*nRep; run2++ )
+            y = A*x;
+        tKernel = ( acadoGetTime() - t0 ) / (n*nRep);
+
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < n*nRep; run2++ )
+            naiveMatrixVector( A, x, yRef );
+        tNaive = ( acadoGetTime() - t0 ) / (n*nRep);
+
+        acadoPrintf( "%4d | A*x       | %12.3f | %11.3f | %8.2f | %.1e\n",
+                     n, 1e6*tKernel, 1e6*tNaive, tNaive/tKernel, (y-yRef).getNorm( VN_LINF ) );
+
+
+        // CHOLESKY DECOMPOSITION AND INVERSES OF A^T*A + n*I AND B + n*I:
+        // ---------------------------------------------------------------
+        for( run2 = 0; run2 < n; run2++ ){
+            S(run2,run2) += n;
+            B(run2,run2) += n;
+        }
+
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            L = S.getCholeskyDecomposition();
+        tKernel = ( acadoGetTime() - t0 ) / nRep;
+
+        naiveProduct( L, L.transpose(), CRef );
+        acadoPrintf( "%4d | chol(S)   | %12.3f |             |          | %.1e\n",
+                     n, 1e6*tKernel, maxDeviation( S, CRef ) );
+
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            X = S.getCholeskyInverse();
+        tKernel = ( acadoGetTime() - t0 ) / nRep;
+
+        C.setIdentity();
+        naiveProduct( S, X, CRef );
+        acadoPrintf( "%4d | inv(S)    | %12.3f |             |          | %.1e\n",
+                     n, 1e6*tKernel, maxDeviation( C, CRef ) );
+
+        t0 = acadoGetTime();
+        for( run2 = 0; run2 < nRep; run2++ )
+            X = B.getInverse();
+        tKernel = ( acadoGetTime() - t0 ) / nRep;
+
+        naiveProduct( B, X, CRef );
+        acadoPrintf( "%4d | inv(B)    | %12.3f |             |          | %.1e\n",
+                     n, 1e6*tKernel, maxDeviation( C, CRef ) );
+
+        acadoPrintf( "-----+-----------+--------------+-------------+----------+----------\n" );
+    }
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file   examples/code_generation/path_constraints_closed_loop.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date   2013
+ *
+ *    Runs the real-time iteration scheme exported by path_constraints.cpp
+ *    in closed loop with the crane model. Returns a non-zero value if the
+ *    nonlinear path constraint is violated at a sampling instant or the
+ *    trolley does not reach its reference.
+ */
+
+
+#include <acado_toolkit.hpp>
+
+
+extern "C"
+{
+#include "./path_constraints_export/acado.h"
+#include "./path_constraints_export/auxiliary_functions.c"
+} // extern "C"
+
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+Vars         vars;
+Params       params;
+
+#ifdef USE_CVXGEN
+Workspace    work;
+Settings     settings;
+#endif
+
+
+int main( )
+{
+	USING_NAMESPACE_ACADO
+
+	// DEFINE THE VARIABLES:
+	// ----------------------------------------------------------
+	DifferentialState   p    ;  // the trolley position
+	DifferentialState   v    ;  // the trolley velocity 
+	DifferentialState   phi  ;  // the excitation angle
+	DifferentialState   omega;  // the angular velocity
+	Control             a    ;  // the acc. of the trolley
+
+	const double     g = 9.81;  // the gravitational constant 
+	const double     b = 0.20;  // the friction coefficient
+	// ----------------------------------------------------------
+
+
+	// DEFINE THE MODEL EQUATIONS:
+	// ----------------------------------------------------------
+	DifferentialEquation f; 
+
+	f << dot( p     )  ==  v                                ;
+	f << dot( v     )  ==  a                                ;
+	f << dot( phi   )  ==  omega                            ;
+	f << dot( omega )  == -g*sin(phi) - a*cos(phi) - b*omega;
+	// ----------------------------------------------------------
+
+	const double hMax = 0.4;    // bound on  |v + 0.5*a*cos(phi)|
+
+
+    // SETTING UP THE (SIMULATED) PROCESS:
+    // -----------------------------------
+	OutputFcn identity;
+	DynamicSystem dynamicSystem( f,identity );
+	Process process( dynamicSystem,INT_RK45 );
+
+
+    // SETTING UP THE MPC CONTROLLER:
+    // ------------------------------
+	ExportedRTIscheme rtiScheme(
+			4, // number of states
+			1, // number of controls
+			10, // number of horizon intervals
+			0.3, // sampling time
+
+			/* Function handlers: */
+			preparationStep,
+			feedbackStep,
+			shiftControls,
+			shiftStates,
+			getAcadoVariablesX,
+			getAcadoVariablesU,
+			getAcadoVariablesXRef,
+			getAcadoVariablesURef );
+
+	#ifdef USE_CVXGEN
+	set_defaults( );
+	#endif
+
+	Vector xuRef(5);
+	xuRef.setZero( );
+
+	VariablesGrid reference;
+	reference.addVector( xuRef,  0.0 );
+	reference.addVector( xuRef, 10.0 );
+
+	StaticReferenceTrajectory referenceTrajectory( reference );
+
+	Controller controller( rtiScheme,referenceTrajectory );
+	controller.set( USE_REFERENCE_PREDICTION,NO );
+
+
+    // SETTING UP THE SIMULATION ENVIRONMENT,  RUN THE EXAMPLE...
+    // ----------------------------------------------------------
+	SimulationEnvironment sim( 0.0,10.0, process,controller );
+
+	Vector x0(4);
+	x0(0) = 1.0;
+	x0(1) = 0.0;
+	x0(2) = 0.0;
+	x0(3) = 0.0;
+
+	sim.init( x0 );
+	sim.run( );
+
+
+    // ... AND CHECK THE PATH CONSTRAINT WHENEVER A NEW CONTROL IS APPLIED
+    // ----------------------------------------------------------
+ 	VariablesGrid diffStates;
+ 	sim.getProcessDifferentialStates( diffStates );
+
+ 	VariablesGrid feedbackControl;
+ 	sim.getFeedbackControl( feedbackControl );
+
+	double hWorst = 0.0;
+
+	for( uint i=0; i<feedbackControl.getNumPoints( ); ++i )
+	{
+		// the constraint is only imposed at the shooting nodes, i.e. when
+		// a new control value is applied
+		if ( ( i > 0 ) && ( acadoIsEqual( feedbackControl( i,0 ),feedbackControl( i-1,0 ) ) == BT_TRUE ) )
+			continue;
+
+		double t     = feedbackControl.getTime( i );
+		Vector xt    = diffStates.getVector( diffStates.getFloorIndex( t ) );
+		double hCurr = xt(1) + 0.5*feedbackControl( i,0 )*cos( xt(2) );
+
+		if ( fabs( hCurr ) > hWorst )
+			hWorst = fabs( hCurr );
+	}
+
+	acadoPrintf( "max |v + 0.5*a*cos(phi)| = %.4f (bound %.4f)\n",hWorst,hMax );
+	acadoPrintf( "final trolley position   = %.4f\n",diffStates( diffStates.getLastIndex( ),0 ) );
+
+	// allow for the linearisation error of the real-time iterations
+	if ( hWorst > hMax + 1.0e-2 )
+		return 1;
+
+	// the constraint must not prevent the crane from reaching its reference
+	if ( fabs( diffStates( diffStates.getLastIndex( ),0 ) ) > 1.0e-1 )
+		return 1;
+
+    return 0;
+}
@@ -0,0 +1,1012 @@
+/*
+ *    This file was auto-generated by ACADO Code Generation Tool.
+ *
+ *    ACADO Code Generation tool is a sub-package of ACADO toolkit --
+ *    A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008 - 2013 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov and Rien Quirynen.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+#include "acado.h"
+
+
+void multiplyQC1( real_t* C1, real_t* QC1 )
+{
+QC1[0] = + C1[0];
+QC1[1] = + C1[1];
+QC1[2] = + C1[2];
+QC1[3] = + C1[3];
+QC1[4] = + C1[4];
+QC1[5] = + C1[5];
+QC1[6] = + C1[6];
+QC1[7] = + C1[7];
+QC1[8] = + C1[8];
+QC1[9] = + C1[9];
+QC1[10] = + C1[10];
+QC1[11] = + C1[11];
+QC1[12] = + C1[12];
+QC1[13] = + C1[13];
+QC1[14] = + C1[14];
+QC1[15] = + C1[15];
+}
+
+void multiplyQE1( real_t* E1, real_t* QE1 )
+{
+QE1[0] = + E1[0];
+QE1[1] = + E1[1];
+QE1[2] = + E1[2];
+QE1[3] = + E1[3];
+QE1[4] = + E1[4];
+QE1[5] = + E1[5];
+QE1[6] = + E1[6];
+QE1[7] = + E1[7];
+QE1[8] = + E1[8];
+QE1[9] = + E1[9];
+QE1[10] = + E1[10];
+QE1[11] = + E1[11];
+QE1[12] = + E1[12];
+QE1[13] = + E1[13];
+QE1[14] = + E1[14];
+QE1[15] = + E1[15];
+QE1[16] = + E1[16];
+QE1[17] = + E1[17];
+QE1[18] = + E1[18];
+QE1[19] = + E1[19];
+QE1[20] = + E1[20];
+QE1[21] = + E1[21];
+QE1[22] = + E1[22];
+QE1[23] = + E1[23];
+QE1[24] = + E1[24];
+QE1[25] = + E1[25];
+QE1[26] = + E1[26];
+QE1[27] = + E1[27];
+QE1[28] = + E1[28];
+QE1[29] = + E1[29];
+QE1[30] = + E1[30];
+QE1[31] = + E1[31];
+QE1[32] = + E1[32];
+QE1[33] = + E1[33];
+QE1[34] = + E1[34];
+QE1[35] = + E1[35];
+QE1[36] = + E1[36];
+QE1[37] = + E1[37];
+QE1[38] = + E1[38];
+QE1[39] = + E1[39];
+}
+
+void multiplyQDX1( real_t* Dx1, real_t* QDx1 )
+{
+QDx1[0] = + Dx1[0];
+QDx1[1] = + Dx1[1];
+QDx1[2] = + Dx1[2];
+QDx1[3] = + Dx1[3];
+}
+
+void multiplyRDU1( real_t* Du1, real_t* RDu1 )
+{
+RDu1[0] = + Du1[0];
+}
+
+void multiplyQC2( real_t* C1, real_t* QC1 )
+{
+QC1[0] = + (real_t)6.0000000000000000e+00*C1[0];
+QC1[1] = + (real_t)6.0000000000000000e+00*C1[1];
+QC1[2] = + (real_t)6.0000000000000000e+00*C1[2];
+QC1[3] = + (real_t)6.0000000000000000e+00*C1[3];
+QC1[4] = + (real_t)6.0000000000000000e+00*C1[4];
+QC1[5] = + (real_t)6.0000000000000000e+00*C1[5];
+QC1[6] = + (real_t)6.0000000000000000e+00*C1[6];
+QC1[7] = + (real_t)6.0000000000000000e+00*C1[7];
+QC1[8] = + (real_t)6.0000000000000000e+00*C1[8];
+QC1[9] = + (real_t)6.0000000000000000e+00*C1[9];
+QC1[10] = + (real_t)6.0000000000000000e+00*C1[10];
+QC1[11] = + (real_t)6.0000000000000000e+00*C1[11];
+QC1[12] = + (real_t)6.0000000000000000e+00*C1[12];
+QC1[13] = + (real_t)6.0000000000000000e+00*C1[13];
+QC1[14] = + (real_t)6.0000000000000000e+00*C1[14];
+QC1[15] = + (real_t)6.0000000000000000e+00*C1[15];
+}
+
+void multiplyQE2( real_t* E1, real_t* QE1 )
+{
+QE1[0] = + (real_t)6.0000000000000000e+00*E1[0];
+QE1[1] = + (real_t)6.0000000000000000e+00*E1[1];
+QE1[2] = + (real_t)6.0000000000000000e+00*E1[2];
+QE1[3] = + (real_t)6.0000000000000000e+00*E1[3];
+QE1[4] = + (real_t)6.0000000000000000e+00*E1[4];
+QE1[5] = + (real_t)6.0000000000000000e+00*E1[5];
+QE1[6] = + (real_t)6.0000000000000000e+00*E1[6];
+QE1[7] = + (real_t)6.0000000000000000e+00*E1[7];
+QE1[8] = + (real_t)6.0000000000000000e+00*E1[8];
+QE1[9] = + (real_t)6.0000000000000000e+00*E1[9];
+QE1[10] = + (real_t)6.0000000000000000e+00*E1[10];
+QE1[11] = + (real_t)6.0000000000000000e+00*E1[11];
+QE1[12] = + (real_t)6.0000000000000000e+00*E1[12];
+QE1[13] = + (real_t)6.0000000000000000e+00*E1[13];
+QE1[14] = + (real_t)6.0000000000000000e+00*E1[14];
+QE1[15] = + (real_t)6.0000000000000000e+00*E1[15];
+QE1[16] = + (real_t)6.0000000000000000e+00*E1[16];
+QE1[17] = + (real_t)6.0000000000000000e+00*E1[17];
+QE1[18] = + (real_t)6.0000000000000000e+00*E1[18];
+QE1[19] = + (real_t)6.0000000000000000e+00*E1[19];
+QE1[20] = + (real_t)6.0000000000000000e+00*E1[20];
+QE1[21] = + (real_t)6.0000000000000000e+00*E1[21];
+QE1[22] = + (real_t)6.0000000000000000e+00*E1[22];
+QE1[23] = + (real_t)6.0000000000000000e+00*E1[23];
+QE1[24] = + (real_t)6.0000000000000000e+00*E1[24];
+QE1[25] = + (real_t)6.0000000000000000e+00*E1[25];
+QE1[26] = + (real_t)6.0000000000000000e+00*E1[26];
+QE1[27] = + (real_t)6.0000000000000000e+00*E1[27];
+QE1[28] = + (real_t)6.0000000000000000e+00*E1[28];
+QE1[29] = + (real_t)6.0000000000000000e+00*E1[29];
+QE1[30] = + (real_t)6.0000000000000000e+00*E1[30];
+QE1[31] = + (real_t)6.0000000000000000e+00*E1[31];
+QE1[32] = + (real_t)6.0000000000000000e+00*E1[32];
+QE1[33] = + (real_t)6.0000000000000000e+00*E1[33];
+QE1[34] = + (real_t)6.0000000000000000e+00*E1[34];
+QE1[35] = + (real_t)6.0000000000000000e+00*E1[35];
+QE1[36] = + (real_t)6.0000000000000000e+00*E1[36];
+QE1[37] = + (real_t)6.0000000000000000e+00*E1[37];
+QE1[38] = + (real_t)6.0000000000000000e+00*E1[38];
+QE1[39] = + (real_t)6.0000000000000000e+00*E1[39];
+}
+
+void multiplyQDX2( real_t* Dx1, real_t* QDx1 )
+{
+QDx1[0] = + (real_t)6.0000000000000000e+00*Dx1[0];
+QDx1[1] = + (real_t)6.0000000000000000e+00*Dx1[1];
+QDx1[2] = + (real_t)6.0000000000000000e+00*Dx1[2];
+QDx1[3] = + (real_t)6.0000000000000000e+00*Dx1[3];
+}
+
+void multiplyC( real_t* Gx, real_t* C1, real_t* C1_new )
+{
+C1_new[0] = + Gx[0]*C1[0] + Gx[1]*C1[4] + Gx[2]*C1[8] + Gx[3]*C1[12];
+C1_new[1] = + Gx[0]*C1[1] + Gx[1]*C1[5] + Gx[2]*C1[9] + Gx[3]*C1[13];
+C1_new[2] = + Gx[0]*C1[2] + Gx[1]*C1[6] + Gx[2]*C1[10] + Gx[3]*C1[14];
+C1_new[3] = + Gx[0]*C1[3] + Gx[1]*C1[7] + Gx[2]*C1[11] + Gx[3]*C1[15];
+C1_new[4] = + Gx[4]*C1[0] + Gx[5]*C1[4] + Gx[6]*C1[8] + Gx[7]*C1[12];
+C1_new[5] = + Gx[4]*C1[1] + Gx[5]*C1[5] + Gx[6]*C1[9] + Gx[7]*C1[13];
+C1_new[6] = + Gx[4]*C1[2] + Gx[5]*C1[6] + Gx[6]*C1[10] + Gx[7]*C1[14];
+C1_new[7] = + Gx[4]*C1[3] + Gx[5]*C1[7] + Gx[6]*C1[11] + Gx[7]*C1[15];
+C1_new[8] = + Gx[8]*C1[0] + Gx[9]*C1[4] + Gx[10]*C1[8] + Gx[11]*C1[12];
+C1_new[9] = + Gx[8]*C1[1] + Gx[9]*C1[5] + Gx[10]*C1[9] + Gx[11]*C1[13];
+C1_new[10] = + Gx[8]*C1[2] + Gx[9]*C1[6] + Gx[10]*C1[10] + Gx[11]*C1[14];
+C1_new[11] = + Gx[8]*C1[3] + Gx[9]*C1[7] + Gx[10]*C1[11] + Gx[11]*C1[15];
+C1_new[12] = + Gx[12]*C1[0] + Gx[13]*C1[4] + Gx[14]*C1[8] + Gx[15]*C1[12];
+C1_new[13] = + Gx[12]*C1[1] + Gx[13]*C1[5] + Gx[14]*C1[9] + Gx[15]*C1[13];
+C1_new[14] = + Gx[12]*C1[2] + Gx[13]*C1[6] + Gx[14]*C1[10] + Gx[15]*C1[14];
+C1_new[15] = + Gx[12]*C1[3] + Gx[13]*C1[7] + Gx[14]*C1[11] + Gx[15]*C1[15];
+}
+
+void multiplyE( real_t* Gx, real_t* E1, real_t* E1_new )
+{
+E1_new[0] = + Gx[0]*E1[0] + Gx[1]*E1[10] + Gx[2]*E1[20] + Gx[3]*E1[30];
+E1_new[1] = + Gx[0]*E1[1] + Gx[1]*E1[11] + Gx[2]*E1[21] + Gx[3]*E1[31];
+E1_new[2] = + Gx[0]*E1[2] + Gx[1]*E1[12] + Gx[2]*E1[22] + Gx[3]*E1[32];
+E1_new[3] = + Gx[0]*E1[3] + Gx[1]*E1[13] + Gx[2]*E1[23] + Gx[3]*E1[33];
+E1_new[4] = + Gx[0]*E1[4] + Gx[1]*E1[14] + Gx[2]*E1[24] + Gx[3]*E1[34];
+E1_new[5] = + Gx[0]*E1[5] + Gx[1]*E1[15] + Gx[2]*E1[25] + Gx[3]*E1[35];
+E1_new[6] = + Gx[0]*E1[6] + Gx[1]*E1[16] + Gx[2]*E1[26] + Gx[3]*E1[36];
+E1_new[7] = + Gx[0]*E1[7] + Gx[1]*E1[17] + Gx[2]*E1[27] + Gx[3]*E1[37];
+E1_new[8] = + Gx[0]*E1[8] + Gx[1]*E1[18] + Gx[2]*E1[28] + Gx[3]*E1[38];
+E1_new[9] = + Gx[0]*E1[9] + Gx[1]*E1[19] + Gx[2]*E1[29] + Gx[3]*E1[39];
+E1_new[10] = + Gx[4]*E1[0] + Gx[5]*E1[10] + Gx[6]*E1[20] + Gx[7]*E1[30];
+E1_new[11] = + Gx[4]*E1[1] + Gx[5]*E1[11] + Gx[6]*E1[21] + Gx[7]*E1[31];
+E1_new[12] = + Gx[4]*E1[2] + Gx[5]*E1[12] + Gx[6]*E1[22] + Gx[7]*E1[32];
+E1_new[13] = + Gx[4]*E1[3] + Gx[5]*E1[13] + Gx[6]*E1[23] + Gx[7]*E1[33];
+E1_new[14] = + Gx[4]*E1[4] + Gx[5]*E1[14] + Gx[6]*E1[24] + Gx[7]*E1[34];
+E1_new[15] = + Gx[4]*E1[5] + Gx[5]*E1[15] + Gx[6]*E1[25] + Gx[7]*E1[35];
+E1_new[16] = + Gx[4]*E1[6] + Gx[5]*E1[16] + Gx[6]*E1[26] + Gx[7]*E1[36];
+E1_new[17] = + Gx[4]*E1[7] + Gx[5]*E1[17] + Gx[6]*E1[27] + Gx[7]*E1[37];
+E1_new[18] = + Gx[4]*E1[8] + Gx[5]*E1[18] + Gx[6]*E1[28] + Gx[7]*E1[38];
+E1_new[19] = + Gx[4]*E1[9] + Gx[5]*E1[19] + Gx[6]*E1[29] + Gx[7]*E1[39];
+E1_new[20] = + Gx[8]*E1[0] + Gx[9]*E1[10] + Gx[10]*E1[20] + Gx[11]*E1[30];
+E1_new[21] = + Gx[8]*E1[1] + Gx[9]*E1[11] + Gx[10]*E1[21] + Gx[11]*E1[31];
+E1_new[22] = + Gx[8]*E1[2] + Gx[9]*E1[12] + Gx[10]*E1[22] + Gx[11]*E1[32];
+E1_new[23] = + Gx[8]*E1[3] + Gx[9]*E1[13] + Gx[10]*E1[23] + Gx[11]*E1[33];
+E1_new[24] = + Gx[8]*E1[4] + Gx[9]*E1[14] + Gx[10]*E1[24] + Gx[11]*E1[34];
+E1_new[25] = + Gx[8]*E1[5] + Gx[9]*E1[15] + Gx[10]*E1[25] + Gx[11]*E1[35];
+E1_new[26] = + Gx[8]*E1[6] + Gx[9]*E1[16] + Gx[10]*E1[26] + Gx[11]*E1[36];
+E1_new[27] = + Gx[8]*E1[7] + Gx[9]*E1[17] + Gx[10]*E1[27] + Gx[11]*E1[37];
+E1_new[28] = + Gx[8]*E1[8] + Gx[9]*E1[18] + Gx[10]*E1[28] + Gx[11]*E1[38];
+E1_new[29] = + Gx[8]*E1[9] + Gx[9]*E1[19] + Gx[10]*E1[29] + Gx[11]*E1[39];
+E1_new[30] = + Gx[12]*E1[0] + Gx[13]*E1[10] + Gx[14]*E1[20] + Gx[15]*E1[30];
+E1_new[31] = + Gx[12]*E1[1] + Gx[13]*E1[11] + Gx[14]*E1[21] + Gx[15]*E1[31];
+E1_new[32] = + Gx[12]*E1[2] + Gx[13]*E1[12] + Gx[14]*E1[22] + Gx[15]*E1[32];
+E1_new[33] = + Gx[12]*E1[3] + Gx[13]*E1[13] + Gx[14]*E1[23] + Gx[15]*E1[33];
+E1_new[34] = + Gx[12]*E1[4] + Gx[13]*E1[14] + Gx[14]*E1[24] + Gx[15]*E1[34];
+E1_new[35] = + Gx[12]*E1[5] + Gx[13]*E1[15] + Gx[14]*E1[25] + Gx[15]*E1[35];
+E1_new[36] = + Gx[12]*E1[6] + Gx[13]*E1[16] + Gx[14]*E1[26] + Gx[15]*E1[36];
+E1_new[37] = + Gx[12]*E1[7] + Gx[13]*E1[17] + Gx[14]*E1[27] + Gx[15]*E1[37];
+E1_new[38] = + Gx[12]*E1[8] + Gx[13]*E1[18] + Gx[14]*E1[28] + Gx[15]*E1[38];
+E1_new[39] = + Gx[12]*E1[9] + Gx[13]*E1[19] + Gx[14]*E1[29] + Gx[15]*E1[39];
+}
+
+void multiplyCD1( real_t* Gx, real_t* d1, real_t* d1_new )
+{
+d1_new[0] = + Gx[0]*d1[0] + Gx[1]*d1[1] + Gx[2]*d1[2] + Gx[3]*d1[3];
+d1_new[1] = + Gx[4]*d1[0] + Gx[5]*d1[1] + Gx[6]*d1[2] + Gx[7]*d1[3];
+d1_new[2] = + Gx[8]*d1[0] + Gx[9]*d1[1] + Gx[10]*d1[2] + Gx[11]*d1[3];
+d1_new[3] = + Gx[12]*d1[0] + Gx[13]*d1[1] + Gx[14]*d1[2] + Gx[15]*d1[3];
+}
+
+void multiplyEU1( real_t* Gu, real_t* u1, real_t* d1_new )
+{
+d1_new[0] += + Gu[0]*u1[0];
+d1_new[1] += + Gu[1]*u1[0];
+d1_new[2] += + Gu[2]*u1[0];
+d1_new[3] += + Gu[3]*u1[0];
+}
+
+void multiplyG1( real_t* E, real_t* QDx, real_t* g1 )
+{
+g1[0] = + E[0]*QDx[0] + E[10]*QDx[1] + E[20]*QDx[2] + E[30]*QDx[3] + E[40]*QDx[4] + E[50]*QDx[5] + E[60]*QDx[6] + E[70]*QDx[7] + E[80]*QDx[8] + E[90]*QDx[9] + E[100]*QDx[10] + E[110]*QDx[11] + E[120]*QDx[12] + E[130]*QDx[13] + E[140]*QDx[14] + E[150]*QDx[15] + E[160]*QDx[16] + E[170]*QDx[17] + E[180]*QDx[18] + E[190]*QDx[19] + E[200]*QDx[20] + E[210]*QDx[21] + E[220]*QDx[22] + E[230]*QDx[23] + E[240]*QDx[24] + E[250]*QDx[25] + E[260]*QDx[26] + E[270]*QDx[27] + E[280]*QDx[28] + E[290]*QDx[29] + E[300]*QDx[30] + E[310]*QDx[31] + E[320]*QDx[32] + E[330]*QDx[33] + E[340]*QDx[34] + E[350]*QDx[35] + E[360]*QDx[36] + E[370]*QDx[37] + E[380]*QDx[38] + E[390]*QDx[39];
+g1[1] = + E[1]*QDx[0] + E[11]*QDx[1] + E[21]*QDx[2] + E[31]*QDx[3] + E[41]*QDx[4] + E[51]*QDx[5] + E[61]*QDx[6] + E[71]*QDx[7] + E[81]*QDx[8] + E[91]*QDx[9] + E[101]*QDx[10] + E[111]*QDx[11] + E[121]*QDx[12] + E[131]*QDx[13] + E[141]*QDx[14] + E[151]*QDx[15] + E[161]*QDx[16] + E[171]*QDx[17] + E[181]*QDx[18] + E[191]*QDx[19] + E[201]*QDx[20] + E[211]*QDx[21] + E[221]*QDx[22] + E[231]*QDx[23] + E[241]*QDx[24] + E[251]*QDx[25] + E[261]*QDx[26] + E[271]*QDx[27] + E[281]*QDx[28] + E[291]*QDx[29] + E[301]*QDx[30] + E[311]*QDx[31] + E[321]*QDx[32] + E[331]*QDx[33] + E[341]*QDx[34] + E[351]*QDx[35] + E[361]*QDx[36] + E[371]*QDx[37] + E[381]*QDx[38] + E[391]*QDx[39];
+g1[2] = + E[2]*QDx[0] + E[12]*QDx[1] + E[22]*QDx[2] + E[32]*QDx[3] + E[42]*QDx[4] + E[52]*QDx[5] + E[62]*QDx[6] + E[72]*QDx[7] + E[82]*QDx[8] + E[92]*QDx[9] + E[102]*QDx[10] + E[112]*QDx[11] + E[122]*QDx[12] + E[132]*QDx[13] + E[142]*QDx[14] + E[152]*QDx[15] + E[162]*QDx[16] + E[172]*QDx[17] + E[182]*QDx[18] + E[192]*QDx[19] + E[202]*QDx[20] + E[212]*QDx[21] + E[222]*QDx[22] + E[232]*QDx[23] + E[242]*QDx[24] + E[252]*QDx[25] + E[262]*QDx[26] + E[272]*QDx[27] + E[282]*QDx[28] + E[292]*QDx[29] + E[302]*QDx[30] + E[312]*QDx[31] + E[322]*QDx[32] + E[332]*QDx[33] + E[342]*QDx[34] + E[352]*QDx[35] + E[362]*QDx[36] + E[372]*QDx[37] + E[382]*QDx[38] + E[392]*QDx[39];
+g1[3] = + E[3]*QDx[0] + E[13]*QDx[1] + E[23]*QDx[2] + E[33]*QDx[3] + E[43]*QDx[4] + E[53]*QDx[5] + E[63]*QDx[6] + E[73]*QDx[7] + E[83]*QDx[8] + E[93]*QDx[9] + E[103]*QDx[10] + E[113]*QDx[11] + E[123]*QDx[12] + E[133]*QDx[13] + E[143]*QDx[14] + E[153]*QDx[15] + E[163]*QDx[16] + E[173]*QDx[17] + E[183]*QDx[18] + E[193]*QDx[19] + E[203]*QDx[20] + E[213]*QDx[21] + E[223]*QDx[22] + E[233]*QDx[23] + E[243]*QDx[24] + E[253]*QDx[25] + E[263]*QDx[26] + E[273]*QDx[27] + E[283]*QDx[28] + E[293]*QDx[29] + E[303]*QDx[30] + E[313]*QDx[31] + E[323]*QDx[32] + E[333]*QDx[33] + E[343]*QDx[34] + E[353]*QDx[35] + E[363]*QDx[36] + E[373]*QDx[37] + E[383]*QDx[38] + E[393]*QDx[39];
+g1[4] = + E[4]*QDx[0] + E[14]*QDx[1] + E[24]*QDx[2] + E[34]*QDx[3] + E[44]*QDx[4] + E[54]*QDx[5] + E[64]*QDx[6] + E[74]*QDx[7] + E[84]*QDx[8] + E[94]*QDx[9] + E[104]*QDx[10] + E[114]*QDx[11] + E[124]*QDx[12] + E[134]*QDx[13] + E[144]*QDx[14] + E[154]*QDx[15] + E[164]*QDx[16] + E[174]*QDx[17] + E[184]*QDx[18] + E[194]*QDx[19] + E[204]*QDx[20] + E[214]*QDx[21] + E[224]*QDx[22] + E[234]*QDx[23] + E[244]*QDx[24] + E[254]*QDx[25] + E[264]*QDx[26] + E[274]*QDx[27] + E[284]*QDx[28] + E[294]*QDx[29] + E[304]*QDx[30] + E[314]*QDx[31] + E[324]*QDx[32] + E[334]*QDx[33] + E[344]*QDx[34] + E[354]*QDx[35] + E[364]*QDx[36] + E[374]*QDx[37] + E[384]*QDx[38] + E[394]*QDx[39];
+g1[5] = + E[5]*QDx[0] + E[15]*QDx[1] + E[25]*QDx[2] + E[35]*QDx[3] + E[45]*QDx[4] + E[55]*QDx[5] + E[65]*QDx[6] + E[75]*QDx[7] + E[85]*QDx[8] + E[95]*QDx[9] + E[105]*QDx[10] + E[115]*QDx[11] + E[125]*QDx[12] + E[135]*QDx[13] + E[145]*QDx[14] + E[155]*QDx[15] + E[165]*QDx[16] + E[175]*QDx[17] + E[185]*QDx[18] + E[195]*QDx[19] + E[205]*QDx[20] + E[215]*QDx[21] + E[225]*QDx[22] + E[235]*QDx[23] + E[245]*QDx[24] + E[255]*QDx[25] + E[265]*QDx[26] + E[275]*QDx[27] + E[285]*QDx[28] + E[295]*QDx[29] + E[305]*QDx[30] + E[315]*QDx[31] + E[325]*QDx[32] + E[335]*QDx[33] + E[345]*QDx[34] + E[355]*QDx[35] + E[365]*QDx[36] + E[375]*QDx[37] + E[385]*QDx[38] + E[395]*QDx[39];
+g1[6] = + E[6]*QDx[0] + E[16]*QDx[1] + E[26]*QDx[2] + E[36]*QDx[3] + E[46]*QDx[4] + E[56]*QDx[5] + E[66]*QDx[6] + E[76]*QDx[7] + E[86]*QDx[8] + E[96]*QDx[9] + E[106]*QDx[10] + E[116]*QDx[11] + E[126]*QDx[12] + E[136]*QDx[13] + E[146]*QDx[14] + E[156]*QDx[15] + E[166]*QDx[16] + E[176]*QDx[17] + E[186]*QDx[18] + E[196]*QDx[19] + E[206]*QDx[20] + E[216]*QDx[21] + E[226]*QDx[22] + E[236]*QDx[23] + E[246]*QDx[24] + E[256]*QDx[25] + E[266]*QDx[26] + E[276]*QDx[27] + E[286]*QDx[28] + E[296]*QDx[29] + E[306]*QDx[30] + E[316]*QDx[31] + E[326]*QDx[32] + E[336]*QDx[33] + E[346]*QDx[34] + E[356]*QDx[35] + E[366]*QDx[36] + E[376]*QDx[37] + E[386]*QDx[38] + E[396]*QDx[39];
+g1[7] = + E[7]*QDx[0] + E[17]*QDx[1] + E[27]*QDx[2] + E[37]*QDx[3] + E[47]*QDx[4] + E[57]*QDx[5] + E[67]*QDx[6] + E[77]*QDx[7] + E[87]*QDx[8] + E[97]*QDx[9] + E[107]*QDx[10] + E[117]*QDx[11] + E[127]*QDx[12] + E[137]*QDx[13] + E[147]*QDx[14] + E[157]*QDx[15] + E[167]*QDx[16] + E[177]*QDx[17] + E[187]*QDx[18] + E[197]*QDx[19] + E[207]*QDx[20] + E[217]*QDx[21] + E[227]*QDx[22] + E[237]*QDx[23] + E[247]*QDx[24] + E[257]*QDx[25] + E[267]*QDx[26] + E[277]*QDx[27] + E[287]*QDx[28] + E[297]*QDx[29] + E[307]*QDx[30] + E[317]*QDx[31] + E[327]*QDx[32] + E[337]*QDx[33] + E[347]*QDx[34] + E[357]*QDx[35] + E[367]*QDx[36] + E[377]*QDx[37] + E[387]*QDx[38] + E[397]*QDx[39];
+g1[8] = + E[8]*QDx[0] + E[18]*QDx[1] + E[28]*QDx[2] + E[38]*QDx[3] + E[48]*QDx[4] + E[58]*QDx[5] + E[68]*QDx[6] + E[78]*QDx[7] + E[88]*QDx[8] + E[98]*QDx[9] + E[108]*QDx[10] + E[118]*QDx[11] + E[128]*QDx[12] + E[138]*QDx[13] + E[148]*QDx[14] + E[158]*QDx[15] + E[168]*QDx[16] + E[178]*QDx[17] + E[188]*QDx[18] + E[198]*QDx[19] + E[208]*QDx[20] + E[218]*QDx[21] + E[228]*QDx[22] + E[238]*QDx[23] + E[248]*QDx[24] + E[258]*QDx[25] + E[268]*QDx[26] + E[278]*QDx[27] + E[288]*QDx[28] + E[298]*QDx[29] + E[308]*QDx[30] + E[318]*QDx[31] + E[328]*QDx[32] + E[338]*QDx[33] + E[348]*QDx[34] + E[358]*QDx[35] + E[368]*QDx[36] + E[378]*QDx[37] + E[388]*QDx[38] + E[398]*QDx[39];
+g1[9] = + E[9]*QDx[0] + E[19]*QDx[1] + E[29]*QDx[2] + E[39]*QDx[3] + E[49]*QDx[4] + E[59]*QDx[5] + E[69]*QDx[6] + E[79]*QDx[7] + E[89]*QDx[8] + E[99]*QDx[9] + E[109]*QDx[10] + E[119]*QDx[11] + E[129]*QDx[12] + E[139]*QDx[13] + E[149]*QDx[14] + E[159]*QDx[15] + E[169]*QDx[16] + E[179]*QDx[17] + E[189]*QDx[18] + E[199]*QDx[19] + E[209]*QDx[20] + E[219]*QDx[21] + E[229]*QDx[22] + E[239]*QDx[23] + E[249]*QDx[24] + E[259]*QDx[25] + E[269]*QDx[26] + E[279]*QDx[27] + E[289]*QDx[28] + E[299]*QDx[29] + E[309]*QDx[30] + E[319]*QDx[31] + E[329]*QDx[32] + E[339]*QDx[33] + E[349]*QDx[34] + E[359]*QDx[35] + E[369]*QDx[36] + E[379]*QDx[37] + E[389]*QDx[38] + E[399]*QDx[39];
+}
+
+void multiplyH01( real_t* C, real_t* QE, real_t* H01 )
+{
+H01[0] = + C[0]*QE[0] + C[4]*QE[10] + C[8]*QE[20] + C[12]*QE[30] + C[16]*QE[40] + C[20]*QE[50] + C[24]*QE[60] + C[28]*QE[70] + C[32]*QE[80] + C[36]*QE[90] + C[40]*QE[100] + C[44]*QE[110] + C[48]*QE[120] + C[52]*QE[130] + C[56]*QE[140] + C[60]*QE[150] + C[64]*QE[160] + C[68]*QE[170] + C[72]*QE[180] + C[76]*QE[190] + C[80]*QE[200] + C[84]*QE[210] + C[88]*QE[220] + C[92]*QE[230] + C[96]*QE[240] + C[100]*QE[250] + C[104]*QE[260] + C[108]*QE[270] + C[112]*QE[280] + C[116]*QE[290] + C[120]*QE[300] + C[124]*QE[310] + C[128]*QE[320] + C[132]*QE[330] + C[136]*QE[340] + C[140]*QE[350] + C[144]*QE[360] + C[148]*QE[370] + C[152]*QE[380] + C[156]*QE[390];
+H01[1] = + C[0]*QE[1] + C[4]*QE[11] + C[8]*QE[21] + C[12]*QE[31] + C[16]*QE[41] + C[20]*QE[51] + C[24]*QE[61] + C[28]*QE[71] + C[32]*QE[81] + C[36]*QE[91] + C[40]*QE[101] + C[44]*QE[111] + C[48]*QE[121] + C[52]*QE[131] + C[56]*QE[141] + C[60]*QE[151] + C[64]*QE[161] + C[68]*QE[171] + C[72]*QE[181] + C[76]*QE[191] + C[80]*QE[201] + C[84]*QE[211] + C[88]*QE[221] + C[92]*QE[231] + C[96]*QE[241] + C[100]*QE[251] + C[104]*QE[261] + C[108]*QE[271] + C[112]*QE[281] + C[116]*QE[291] + C[120]*QE[301] + C[124]*QE[311] + C[128]*QE[321] + C[132]*QE[331] + C[136]*QE[341] + C[140]*QE[351] + C[144]*QE[361] + C[148]*QE[371] + C[152]*QE[381] + C[156]*QE[391];
+H01[2] = + C[0]*QE[2] + C[4]*QE[12] + C[8]*QE[22] + C[12]*QE[32] + C[16]*QE[42] + C[20]*QE[52] + C[24]*QE[62] + C[28]*QE[72] + C[32]*QE[82] + C[36]*QE[92] + C[40]*QE[102] + C[44]*QE[112] + C[48]*QE[122] + C[52]*QE[132] + C[56]*QE[142] + C[60]*QE[152] + C[64]*QE[162] + C[68]*QE[172] + C[72]*QE[182] + C[76]*QE[192] + C[80]*QE[202] + C[84]*QE[212] + C[88]*QE[222] + C[92]*QE[232] + C[96]*QE[242] + C[100]*QE[252] + C[104]*QE[262] + C[108]*QE[272] + C[112]*QE[282] + C[116]*QE[292] + C[120]*QE[302] + C[124]*QE[312] + C[128]*QE[322] + C[132]*QE[332] + C[136]*QE[342] + C[140]*QE[352] + C[144]*QE[362] + C[148]*QE[372] + C[152]*QE[382] + C[156]*QE[392];
+H01[3] = + C[0]*QE[3] + C[4]*QE[13] + C[8]*QE[23] + C[12]*QE[33] + C[16]*QE[43] + C[20]*QE[53] + C[24]*QE[63] + C[28]*QE[73] + C[32]*QE[83] + C[36]*QE[93] + C[40]*QE[103] + C[44]*QE[113] + C[48]*QE[123] + C[52]*QE[133] + C[56]*QE[143] + C[60]*QE[153] + C[64]*QE[163] + C[68]*QE[173] + C[72]*QE[183] + C[76]*QE[193] + C[80]*QE[203] + C[84]*QE[213] + C[88]*QE[223] + C[92]*QE[233] + C[96]*QE[243] + C[100]*QE[253] + C[104]*QE[263] + C[108]*QE[273] + C[112]*QE[283] + C[116]*QE[293] + C[120]*QE[303] + C[124]*QE[313] + C[128]*QE[323] + C[132]*QE[333] + C[136]*QE[343] + C[140]*QE[353] + C[144]*QE[363] + C[148]*QE[373] + C[152]*QE[383] + C[156]*QE[393];
+H01[4] = + C[0]*QE[4] + C[4]*QE[14] + C[8]*QE[24] + C[12]*QE[34] + C[16]*QE[44] + C[20]*QE[54] + C[24]*QE[64] + C[28]*QE[74] + C[32]*QE[84] + C[36]*QE[94] + C[40]*QE[104] + C[44]*QE[114] + C[48]*QE[124] + C[52]*QE[134] + C[56]*QE[144] + C[60]*QE[154] + C[64]*QE[164] + C[68]*QE[174] + C[72]*QE[184] + C[76]*QE[194] + C[80]*QE[204] + C[84]*QE[214] + C[88]*QE[224] + C[92]*QE[234] + C[96]*QE[244] + C[100]*QE[254] + C[104]*QE[264] + C[108]*QE[274] + C[112]*QE[284] + C[116]*QE[294] + C[120]*QE[304] + C[124]*QE[314] + C[128]*QE[324] + C[132]*QE[334] + C[136]*QE[344] + C[140]*QE[354] + C[144]*QE[364] + C[148]*QE[374] + C[152]*QE[384] + C[156]*QE[394];
+H01[5] = + C[0]*QE[5] + C[4]*QE[15] + C[8]*QE[25] + C[12]*QE[35] + C[16]*QE[45] + C[20]*QE[55] + C[24]*QE[65] + C[28]*QE[75] + C[32]*QE[85] + C[36]*QE[95] + C[40]*QE[105] + C[44]*QE[115] + C[48]*QE[125] + C[52]*QE[135] + C[56]*QE[145] + C[60]*QE[155] + C[64]*QE[165] + C[68]*QE[175] + C[72]*QE[185] + C[76]*QE[195] + C[80]*QE[205] + C[84]*QE[215] + C[88]*QE[225] + C[92]*QE[235] + C[96]*QE[245] + C[100]*QE[255] + C[104]*QE[265] + C[108]*QE[275] + C[112]*QE[285] + C[116]*QE[295] + C[120]*QE[305] + C[124]*QE[315] + C[128]*QE[325] + C[132]*QE[335] + C[136]*QE[345] + C[140]*QE[355] + C[144]*QE[365] + C[148]*QE[375] + C[152]*QE[385] + C[156]*QE[395];
+H01[6] = + C[0]*QE[6] + C[4]*QE[16] + C[8]*QE[26] + C[12]*QE[36] + C[16]*QE[46] + C[20]*QE[56] + C[24]*QE[66] + C[28]*QE[76] + C[32]*QE[86] + C[36]*QE[96] + C[40]*QE[106] + C[44]*QE[116] + C[48]*QE[126] + C[52]*QE[136] + C[56]*QE[146] + C[60]*QE[156] + C[64]*QE[166] + C[68]*QE[176] + C[72]*QE[186] + C[76]*QE[196] + C[80]*QE[206] + C[84]*QE[216] + C[88]*QE[226] + C[92]*QE[236] + C[96]*QE[246] + C[100]*QE[256] + C[104]*QE[266] + C[108]*QE[276] + C[112]*QE[286] + C[116]*QE[296] + C[120]*QE[306] + C[124]*QE[316] + C[128]*QE[326] + C[132]*QE[336] + C[136]*QE[346] + C[140]*QE[356] + C[144]*QE[366] + C[148]*QE[376] + C[152]*QE[386] + C[156]*QE[396];
+H01[7] = + C[0]*QE[7] + C[4]*QE[17] + C[8]*QE[27] + C[12]*QE[37] + C[16]*QE[47] + C[20]*QE[57] + C[24]*QE[67] + C[28]*QE[77] + C[32]*QE[87] + C[36]*QE[97] + C[40]*QE[107] + C[44]*QE[117] + C[48]*QE[127] + C[52]*QE[137] + C[56]*QE[147] + C[60]*QE[157] + C[64]*QE[167] + C[68]*QE[177] + C[72]*QE[187] + C[76]*QE[197] + C[80]*QE[207] + C[84]*QE[217] + C[88]*QE[227] + C[92]*QE[237] + C[96]*QE[247] + C[100]*QE[257] + C[104]*QE[267] + C[108]*QE[277] + C[112]*QE[287] + C[116]*QE[297] + C[120]*QE[307] + C[124]*QE[317] + C[128]*QE[327] + C[132]*QE[337] + C[136]*QE[347] + C[140]*QE[357] + C[144]*QE[367] + C[148]*QE[377] + C[152]*QE[387] + C[156]*QE[397];
+H01[8] = + C[0]*QE[8] + C[4]*QE[18] + C[8]*QE[28] + C[12]*QE[38] + C[16]*QE[48] + C[20]*QE[58] + C[24]*QE[68] + C[28]*QE[78] + C[32]*QE[88] + C[36]*QE[98] + C[40]*QE[108] + C[44]*QE[118] + C[48]*QE[128] + C[52]*QE[138] + C[56]*QE[148] + C[60]*QE[158] + C[64]*QE[168] + C[68]*QE[178] + C[72]*QE[188] + C[76]*QE[198] + C[80]*QE[208] + C[84]*QE[218] + C[88]*QE[228] + C[92]*QE[238] + C[96]*QE[248] + C[100]*QE[258] + C[104]*QE[268] + C[108]*QE[278] + C[112]*QE[288] + C[116]*QE[298] + C[120]*QE[308] + C[124]*QE[318] + C[128]*QE[328] + C[132]*QE[338] + C[136]*QE[348] + C[140]*QE[358] + C[144]*QE[368] + C[148]*QE[378] + C[152]*QE[388] + C[156]*QE[398];
+H01[9] = + C[0]*QE[9] + C[4]*QE[19] + C[8]*QE[29] + C[12]*QE[39] + C[16]*QE[49] + C[20]*QE[59] + C[24]*QE[69] + C[28]*QE[79] + C[32]*QE[89] + C[36]*QE[99] + C[40]*QE[109] + C[44]*QE[119] + C[48]*QE[129] + C[52]*QE[139] + C[56]*QE[149] + C[60]*QE[159] + C[64]*QE[169] + C[68]*QE[179] + C[72]*QE[189] + C[76]*QE[199] + C[80]*QE[209] + C[84]*QE[219] + C[88]*QE[229] + C[92]*QE[239] + C[96]*QE[249] + C[100]*QE[259] + C[104]*QE[269] + C[108]*QE[279] + C[112]*QE[289] + C[116]*QE[299] + C[120]*QE[309] + C[124]*QE[319] + C[128]*QE[329] + C[132]*QE[339] + C[136]*QE[349] + C[140]*QE[359] + C[144]*QE[369] + C[148]*QE[379] + C[152]*QE[389] + C[156]*QE[399];
+H01[10] = + C[1]*QE[0] + C[5]*QE[10] + C[9]*QE[20] + C[13]*QE[30] + C[17]*QE[40] + C[21]*QE[50] + C[25]*QE[60] + C[29]*QE[70] + C[33]*QE[80] + C[37]*QE[90] + C[41]*QE[100] + C[45]*QE[110] + C[49]*QE[120] + C[53]*QE[130] + C[57]*QE[140] + C[61]*QE[150] + C[65]*QE[160] + C[69]*QE[170] + C[73]*QE[180] + C[77]*QE[190] + C[81]*QE[200] + C[85]*QE[210] + C[89]*QE[220] + C[93]*QE[230] + C[97]*QE[240] + C[101]*QE[250] + C[105]*QE[260] + C[109]*QE[270] + C[113]*QE[280] + C[117]*QE[290] + C[121]*QE[300] + C[125]*QE[310] + C[129]*QE[320] + C[133]*QE[330] + C[137]*QE[340] + C[141]*QE[350] + C[145]*QE[360] + C[149]*QE[370] + C[153]*QE[380] + C[157]*QE[390];
+H01[11] = + C[1]*QE[1] + C[5]*QE[11] + C[9]*QE[21] + C[13]*QE[31] + C[17]*QE[41] + C[21]*QE[51] + C[25]*QE[61] + C[29]*QE[71] + C[33]*QE[81] + C[37]*QE[91] + C[41]*QE[101] + C[45]*QE[111] + C[49]*QE[121] + C[53]*QE[131] + C[57]*QE[141] + C[61]*QE[151] + C[65]*QE[161] + C[69]*QE[171] + C[73]*QE[181] + C[77]*QE[191] + C[81]*QE[201] + C[85]*QE[211] + C[89]*QE[221] + C[93]*QE[231] + C[97]*QE[241] + C[101]*QE[251] + C[105]*QE[261] + C[109]*QE[271] + C[113]*QE[281] + C[117]*QE[291] + C[121]*QE[301] + C[125]*QE[311] + C[129]*QE[321] + C[133]*QE[331] + C[137]*QE[341] + C[141]*QE[351] + C[145]*QE[361] + C[149]*QE[371] + C[153]*QE[381] + C[157]*QE[391];
+H01[12] = + C[1]*QE[2] + C[5]*QE[12] + C[9]*QE[22] + C[13]*QE[32] + C[17]*QE[42] + C[21]*QE[52] + C[25]*QE[62] + C[29]*QE[72] + C[33]*QE[82] + C[37]*QE[92] + C[41]*QE[102] + C[45]*QE[112] + C[49]*QE[122] + C[53]*QE[132] + C[57]*QE[142] + C[61]*QE[152] + C[65]*QE[162] + C[69]*QE[172] + C[73]*QE[182] + C[77]*QE[192] + C[81]*QE[202] + C[85]*QE[212] + C[89]*QE[222] + C[93]*QE[232] + C[97]*QE[242] + C[101]*QE[252] + C[105]*QE[262] + C[109]*QE[272] + C[113]*QE[282] + C[117]*QE[292] + C[121]*QE[302] + C[125]*QE[312] + C[129]*QE[322] + C[133]*QE[332] + C[137]*QE[342] + C[141]*QE[352] + C[145]*QE[362] + C[149]*QE[372] + C[153]*QE[382] + C[157]*QE[392];
+H01[13] = + C[1]*QE[3] + C[5]*QE[13] + C[9]*QE[23] + C[13]*QE[33] + C[17]*QE[43] + C[21]*QE[53] + C[25]*QE[63] + C[29]*QE[73] + C[33]*QE[83] + C[37]*QE[93] + C[41]*QE[103] + C[45]*QE[113] + C[49]*QE[123] + C[53]*QE[133] + C[57]*QE[143] + C[61]*QE[153] + C[65]*QE[163] + C[69]*QE[173] + C[73]*QE[183] + C[77]*QE[193] + C[81]*QE[203] + C[85]*QE[213] + C[89]*QE[223] + C[93]*QE[233] + C[97]*QE[243] + C[101]*QE[253] + C[105]*QE[263] + C[109]*QE[273] + C[113]*QE[283] + C[117]*QE[293] + C[121]*QE[303] + C[125]*QE[313] + C[129]*QE[323] + C[133]*QE[333] + C[137]*QE[343] + C[141]*QE[353] + C[145]*QE[363] + C[149]*QE[373] + C[153]*QE[383] + C[157]*QE[393];
+H01[14] = + C[1]*QE[4] + C[5]*QE[14] + C[9]*QE[24] + C[13]*QE[34] + C[17]*QE[44] + C[21]*QE[54] + C[25]*QE[64] + C[29]*QE[74] + C[33]*QE[84] + C[37]*QE[94] + C[41]*QE[104] + C[45]*QE[114] + C[49]*QE[124] + C[53]*QE[134] + C[57]*QE[144] + C[61]*QE[154] + C[65]*QE[164] + C[69]*QE[174] + C[73]*QE[184] + C[77]*QE[194] + C[81]*QE[204] + C[85]*QE[214] + C[89]*QE[224] + C[93]*QE[234] + C[97]*QE[244] + C[101]*QE[254] + C[105]*QE[264] + C[109]*QE[274] + C[113]*QE[284] + C[117]*QE[294] + C[121]*QE[304] + C[125]*QE[314] + C[129]*QE[324] + C[133]*QE[334] + C[137]*QE[344] + C[141]*QE[354] + C[145]*QE[364] + C[149]*QE[374] + C[153]*QE[384] + C[157]*QE[394];
+H01[15] = + C[1]*QE[5] + C[5]*QE[15] + C[9]*QE[25] + C[13]*QE[35] + C[17]*QE[45] + C[21]*QE[55] + C[25]*QE[65] + C[29]*QE[75] + C[33]*QE[85] + C[37]*QE[95] + C[41]*QE[105] + C[45]*QE[115] + C[49]*QE[125] + C[53]*QE[135] + C[57]*QE[145] + C[61]*QE[155] + C[65]*QE[165] + C[69]*QE[175] + C[73]*QE[185] + C[77]*QE[195] + C[81]*QE[205] + C[85]*QE[215] + C[89]*QE[225] + C[93]*QE[235] + C[97]*QE[245] + C[101]*QE[255] + C[105]*QE[265] + C[109]*QE[275] + C[113]*QE[285] + C[117]*QE[295] + C[121]*QE[305] + C[125]*QE[315] + C[129]*QE[325] + C[133]*QE[335] + C[137]*QE[345] + C[141]*QE[355] + C[145]*QE[365] + C[149]*QE[375] + C[153]*QE[385] + C[157]*QE[395];
+H01[16] = + C[1]*QE[6] + C[5]*QE[16] + C[9]*QE[26] + C[13]*QE[36] + C[17]*QE[46] + C[21]*QE[56] + C[25]*QE[66] + C[29]*QE[76] + C[33]*QE[86] + C[37]*QE[96] + C[41]*QE[106] + C[45]*QE[116] + C[49]*QE[126] + C[53]*QE[136] + C[57]*QE[146] + C[61]*QE[156] + C[65]*QE[166] + C[69]*QE[176] + C[73]*QE[186] + C[77]*QE[196] + C[81]*QE[206] + C[85]*QE[216] + C[89]*QE[226] + C[93]*QE[236] + C[97]*QE[246] + C[101]*QE[256] + C[105]*QE[266] + C[109]*QE[276] + C[113]*QE[286] + C[117]*QE[296] + C[121]*QE[306] + C[125]*QE[316] + C[129]*QE[326] + C[133]*QE[336] + C[137]*QE[346] + C[141]*QE[356] + C[145]*QE[366] + C[149]*QE[376] + C[153]*QE[386] + C[157]*QE[396];
+H01[17] = + C[1]*QE[7] + C[5]*QE[17] + C[9]*QE[27] + C[13]*QE[37] + C[17]*QE[47] + C[21]*QE[57] + C[25]*QE[67] + C[29]*QE[77] + C[33]*QE[87] + C[37]*QE[97] + C[41]*QE[107] + C[45]*QE[117] + C[49]*QE[127] + C[53]*QE[137] + C[57]*QE[147] + C[61]*QE[157] + C[65]*QE[167] + C[69]*QE[177] + C[73]*QE[187] + C[77]*QE[197] + C[81]*QE[207] + C[85]*QE[217] + C[89]*QE[227] + C[93]*QE[237] + C[97]*QE[247] + C[101]*QE[257] + C[105]*QE[267] + C[109]*QE[277] + C[113]*QE[287] + C[117]*QE[297] + C[121]*QE[307] + C[125]*QE[317] + C[129]*QE[327] + C[133]*QE[337] + C[137]*QE[347] + C[141]*QE[357] + C[145]*QE[367] + C[149]*QE[377] + C[153]*QE[387] + C[157]*QE[397];
+H01[18] = + C[1]*QE[8] + C[5]*QE[18] + C[9]*QE[28] + C[13]*QE[38] + C[17]*QE[48] + C[21]*QE[58] + C[25]*QE[68] + C[29]*QE[78] + C[33]*QE[88] + C[37]*QE[98] + C[41]*QE[108] + C[45]*QE[118] + C[49]*QE[128] + C[53]*QE[138] + C[57]*QE[148] + C[61]*QE[158] + C[65]*QE[168] + C[69]*QE[178] + C[73]*QE[188] + C[77]*QE[198] + C[81]*QE[208] + C[85]*QE[218] + C[89]*QE[228] + C[93]*QE[238] + C[97]*QE[248] + C[101]*QE[258] + C[105]*QE[268] + C[109]*QE[278] + C[113]*QE[288] + C[117]*QE[298] + C[121]*QE[308] + C[125]*QE[318] + C[129]*QE[328] + C[133]*QE[338] + C[137]*QE[348] + C[141]*QE[358] + C[145]*QE[368] + C[149]*QE[378] + C[153]*QE[388] + C[157]*QE[398];
+H01[19] = + C[1]*QE[9] + C[5]*QE[19] + C[9]*QE[29] + C[13]*QE[39] + C[17]*QE[49] + C[21]*QE[59] + C[25]*QE[69] + C[29]*QE[79] + C[33]*QE[89] + C[37]*QE[99] + C[41]*QE[109] + C[45]*QE[119] + C[49]*QE[129] + C[53]*QE[139] + C[57]*QE[149] + C[61]*QE[159] + C[65]*QE[169] + C[69]*QE[179] + C[73]*QE[189] + C[77]*QE[199] + C[81]*QE[209] + C[85]*QE[219] + C[89]*QE[229] + C[93]*QE[239] + C[97]*QE[249] + C[101]*QE[259] + C[105]*QE[269] + C[109]*QE[279] + C[113]*QE[289] + C[117]*QE[299] + C[121]*QE[309] + C[125]*QE[319] + C[129]*QE[329] + C[133]*QE[339] + C[137]*QE[349] + C[141]*QE[359] + C[145]*QE[369] + C[149]*QE[379] + C[153]*QE[389] + C[157]*QE[399];
+H01[20] = + C[2]*QE[0] + C[6]*QE[10] + C[10]*QE[20] + C[14]*QE[30] + C[18]*QE[40] + C[22]*QE[50] + C[26]*QE[60] + C[30]*QE[70] + C[34]*QE[80] + C[38]*QE[90] + C[42]*QE[100] + C[46]*QE[110] + C[50]*QE[120] + C[54]*QE[130] + C[58]*QE[140] + C[62]*QE[150] + C[66]*QE[160] + C[70]*QE[170] + C[74]*QE[180] + C[78]*QE[190] + C[82]*QE[200] + C[86]*QE[210] + C[90]*QE[220] + C[94]*QE[230] + C[98]*QE[240] + C[102]*QE[250] + C[106]*QE[260] + C[110]*QE[270] + C[114]*QE[280] + C[118]*QE[290] + C[122]*QE[300] + C[126]*QE[310] + C[130]*QE[320] + C[134]*QE[330] + C[138]*QE[340] + C[142]*QE[350] + C[146]*QE[360] + C[150]*QE[370] + C[154]*QE[380] + C[158]*QE[390];
+H01[21] = + C[2]*QE[1] + C[6]*QE[11] + C[10]*QE[21] + C[14]*QE[31] + C[18]*QE[41] + C[22]*QE[51] + C[26]*QE[61] + C[30]*QE[71] + C[34]*QE[81] + C[38]*QE[91] + C[42]*QE[101] + C[46]*QE[111] + C[50]*QE[121] + C[54]*QE[131] + C[58]*QE[141] + C[62]*QE[151] + C[66]*QE[161] + C[70]*QE[171] + C[74]*QE[181] + C[78]*QE[191] + C[82]*QE[201] + C[86]*QE[211] + C[90]*QE[221] + C[94]*QE[231] + C[98]*QE[241] + C[102]*QE[251] + C[106]*QE[261] + C[110]*QE[271] + C[114]*QE[281] + C[118]*QE[291] + C[122]*QE[301] + C[126]*QE[311] + C[130]*QE[321] + C[134]*QE[331] + C[138]*QE[341] + C[142]*QE[351] + C[146]*QE[361] + C[150]*QE[371] + C[154]*QE[381] + C[158]*QE[391];
+H01[22] = + C[2]*QE[2] + C[6]*QE[12] + C[10]*QE[22] + C[14]*QE[32] + C[18]*QE[42] + C[22]*QE[52] + C[26]*QE[62] + C[30]*QE[72] + C[34]*QE[82] + C[38]*QE[92] + C[42]*QE[102] + C[46]*QE[112] + C[50]*QE[122] + C[54]*QE[132] + C[58]*QE[142] + C[62]*QE[152] + C[66]*QE[162] + C[70]*QE[172] + C[74]*QE[182] + C[78]*QE[192] + C[82]*QE[202] + C[86]*QE[212] + C[90]*QE[222] + C[94]*QE[232] + C[98]*QE[242] + C[102]*QE[252] + C[106]*QE[262] + C[110]*QE[272] + C[114]*QE[282] + C[118]*QE[292] + C[122]*QE[302] + C[126]*QE[312] + C[130]*QE[322] + C[134]*QE[332] + C[138]*QE[342] + C[142]*QE[352] + C[146]*QE[362] + C[150]*QE[372] + C[154]*QE[382] + C[158]*QE[392];
+H01[23] = + C[2]*QE[3] + C[6]*QE[13] + C[10]*QE[23] + C[14]*QE[33] + C[18]*QE[43] + C[22]*QE[53] + C[26]*QE[63] + C[30]*QE[73] + C[34]*QE[83] + C[38]*QE[93] + C[42]*QE[103] + C[46]*QE[113] + C[50]*QE[123] + C[54]*QE[133] + C[58]*QE[143] + C[62]*QE[153] + C[66]*QE[163] + C[70]*QE[173] + C[74]*QE[183] + C[78]*QE[193] + C[82]*QE[203] + C[86]*QE[213] + C[90]*QE[223] + C[94]*QE[233] + C[98]*QE[243] + C[102]*QE[253] + C[106]*QE[263] + C[110]*QE[273] + C[114]*QE[283] + C[118]*QE[293] + C[122]*QE[303] + C[126]*QE[313] + C[130]*QE[323] + C[134]*QE[333] + C[138]*QE[343] + C[142]*QE[353] + C[146]*QE[363] + C[150]*QE[373] + C[154]*QE[383] + C[158]*QE[393];
+H01[24] = + C[2]*QE[4] + C[6]*QE[14] + C[10]*QE[24] + C[14]*QE[34] + C[18]*QE[44] + C[22]*QE[54] + C[26]*QE[64] + C[30]*QE[74] + C[34]*QE[84] + C[38]*QE[94] + C[42]*QE[104] + C[46]*QE[114] + C[50]*QE[124] + C[54]*QE[134] + C[58]*QE[144] + C[62]*QE[154] + C[66]*QE[164] + C[70]*QE[174] + C[74]*QE[184] + C[78]*QE[194] + C[82]*QE[204] + C[86]*QE[214] + C[90]*QE[224] + C[94]*QE[234] + C[98]*QE[244] + C[102]*QE[254] + C[106]*QE[264] + C[110]*QE[274] + C[114]*QE[284] + C[118]*QE[294] + C[122]*QE[304] + C[126]*QE[314] + C[130]*QE[324] + C[134]*QE[334] + C[138]*QE[344] + C[142]*QE[354] + C[146]*QE[364] + C[150]*QE[374] + C[154]*QE[384] + C[158]*QE[394];
+H01[25] = + C[2]*QE[5] + C[6]*QE[15] + C[10]*QE[25] + C[14]*QE[35] + C[18]*QE[45] + C[22]*QE[55] + C[26]*QE[65] + C[30]*QE[75] + C[34]*QE[85] + C[38]*QE[95] + C[42]*QE[105] + C[46]*QE[115] + C[50]*QE[125] + C[54]*QE[135] + C[58]*QE[145] + C[62]*QE[155] + C[66]*QE[165] + C[70]*QE[175] + C[74]*QE[185] + C[78]*QE[195] + C[82]*QE[205] + C[86]*QE[215] + C[90]*QE[225] + C[94]*QE[235] + C[98]*QE[245] + C[102]*QE[255] + C[106]*QE[265] + C[110]*QE[275] + C[114]*QE[285] + C[118]*QE[295] + C[122]*QE[305] + C[126]*QE[315] + C[130]*QE[325] + C[134]*QE[335] + C[138]*QE[345] + C[142]*QE[355] + C[146]*QE[365] + C[150]*QE[375] + C[154]*QE[385] + C[158]*QE[395];
+H01[26] = + C[2]*QE[6] + C[6]*QE[16] + C[10]*QE[26] + C[14]*QE[36] + C[18]*QE[46] + C[22]*QE[56] + C[26]*QE[66] + C[30]*QE[76] + C[34]*QE[86] + C[38]*QE[96] + C[42]*QE[106] + C[46]*QE[116] + C[50]*QE[126] + C[54]*QE[136] + C[58]*QE[146] + C[62]*QE[156] + C[66]*QE[166] + C[70]*QE[176] + C[74]*QE[186] + C[78]*QE[196] + C[82]*QE[206] + C[86]*QE[216] + C[90]*QE[226] + C[94]*QE[236] + C[98]*QE[246] + C[102]*QE[256] + C[106]*QE[266] + C[110]*QE[276] + C[114]*QE[286] + C[118]*QE[296] + C[122]*QE[306] + C[126]*QE[316] + C[130]*QE[326] + C[134]*QE[336] + C[138]*QE[346] + C[142]*QE[356] + C[146]*QE[366] + C[150]*QE[376] + C[154]*QE[386] + C[158]*QE[396];
+H01[27] = + C[2]*QE[7] + C[6]*QE[17] + C[10]*QE[27] + C[14]*QE[37] + C[18]*QE[47] + C[22]*QE[57] + C[26]*QE[67] + C[30]*QE[77] + C[34]*QE[87] + C[38]*QE[97] + C[42]*QE[107] + C[46]*QE[117] + C[50]*QE[127] + C[54]*QE[137] + C[58]*QE[147] + C[62]*QE[157] + C[66]*QE[167] + C[70]*QE[177] + C[74]*QE[187] + C[78]*QE[197] + C[82]*QE[207] + C[86]*QE[217] + C[90]*QE[227] + C[94]*QE[237] + C[98]*QE[247] + C[102]*QE[257] + C[106]*QE[267] + C[110]*QE[277] + C[114]*QE[287] + C[118]*QE[297] + C[122]*QE[307] + C[126]*QE[317] + C[130]*QE[327] + C[134]*QE[337] + C[138]*QE[347] + C[142]*QE[357] + C[146]*QE[367] + C[150]*QE[377] + C[154]*QE[387] + C[158]*QE[397];
+H01[28] = + C[2]*QE[8] + C[6]*QE[18] + C[10]*QE[28] + C[14]*QE[38] + C[18]*QE[48] + C[22]*QE[58] + C[26]*QE[68] + C[30]*QE[78] + C[34]*QE[88] + C[38]*QE[98] + C[42]*QE[108] + C[46]*QE[118] + C[50]*QE[128] + C[54]*QE[138] + C[58]*QE[148] + C[62]*QE[158] + C[66]*QE[168] + C[70]*QE[178] + C[74]*QE[188] + C[78]*QE[198] + C[82]*QE[208] + C[86]*QE[218] + C[90]*QE[228] + C[94]*QE[238] + C[98]*QE[248] + C[102]*QE[258] + C[106]*QE[268] + C[110]*QE[278] + C[114]*QE[288] + C[118]*QE[298] + C[122]*QE[308] + C[126]*QE[318] + C[130]*QE[328] + C[134]*QE[338] + C[138]*QE[348] + C[142]*QE[358] + C[146]*QE[368] + C[150]*QE[378] + C[154]*QE[388] + C[158]*QE[398];
+H01[29] = + C[2]*QE[9] + C[6]*QE[19] + C[10]*QE[29] + C[14]*QE[39] + C[18]*QE[49] + C[22]*QE[59] + C[26]*QE[69] + C[30]*QE[79] + C[34]*QE[89] + C[38]*QE[99] + C[42]*QE[109] + C[46]*QE[119] + C[50]*QE[129] + C[54]*QE[139] + C[58]*QE[149] + C[62]*QE[159] + C[66]*QE[169] + C[70]*QE[179] + C[74]*QE[189] + C[78]*QE[199] + C[82]*QE[209] + C[86]*QE[219] + C[90]*QE[229] + C[94]*QE[239] + C[98]*QE[249] + C[102]*QE[259] + C[106]*QE[269] + C[110]*QE[279] + C[114]*QE[289] + C[118]*QE[299] + C[122]*QE[309] + C[126]*QE[319] + C[130]*QE[329] + C[134]*QE[339] + C[138]*QE[349] + C[142]*QE[359] + C[146]*QE[369] + C[150]*QE[379] + C[154]*QE[389] + C[158]*QE[399];
+H01[30] = + C[3]*QE[0] + C[7]*QE[10] + C[11]*QE[20] + C[15]*QE[30] + C[19]*QE[40] + C[23]*QE[50] + C[27]*QE[60] + C[31]*QE[70] + C[35]*QE[80] + C[39]*QE[90] + C[43]*QE[100] + C[47]*QE[110] + C[51]*QE[120] + C[55]*QE[130] + C[59]*QE[140] + C[63]*QE[150] + C[67]*QE[160] + C[71]*QE[170] + C[75]*QE[180] + C[79]*QE[190] + C[83]*QE[200] + C[87]*QE[210] + C[91]*QE[220] + C[95]*QE[230] + C[99]*QE[240] + C[103]*QE[250] + C[107]*QE[260] + C[111]*QE[270] + C[115]*QE[280] + C[119]*QE[290] + C[123]*QE[300] + C[127]*QE[310] + C[131]*QE[320] + C[135]*QE[330] + C[139]*QE[340] + C[143]*QE[350] + C[147]*QE[360] + C[151]*QE[370] + C[155]*QE[380] + C[159]*QE[390];
+H01[31] = + C[3]*QE[1] + C[7]*QE[11] + C[11]*QE[21] + C[15]*QE[31] + C[19]*QE[41] + C[23]*QE[51] + C[27]*QE[61] + C[31]*QE[71] + C[35]*QE[81] + C[39]*QE[91] + C[43]*QE[101] + C[47]*QE[111] + C[51]*QE[121] + C[55]*QE[131] + C[59]*QE[141] + C[63]*QE[151] + C[67]*QE[161] + C[71]*QE[171] + C[75]*QE[181] + C[79]*QE[191] + C[83]*QE[201] + C[87]*QE[211] + C[91]*QE[221] + C[95]*QE[231] + C[99]*QE[241] + C[103]*QE[251] + C[107]*QE[261] + C[111]*QE[271] + C[115]*QE[281] + C[119]*QE[291] + C[123]*QE[301] + C[127]*QE[311] + C[131]*QE[321] + C[135]*QE[331] + C[139]*QE[341] + C[143]*QE[351] + C[147]*QE[361] + C[151]*QE[371] + C[155]*QE[381] + C[159]*QE[391];
+H01[32] = + C[3]*QE[2] + C[7]*QE[12] + C[11]*QE[22] + C[15]*QE[32] + C[19]*QE[42] + C[23]*QE[52] + C[27]*QE[62] + C[31]*QE[72] + C[35]*QE[82] + C[39]*QE[92] + C[43]*QE[102] + C[47]*QE[112] + C[51]*QE[122] + C[55]*QE[132] + C[59]*QE[142] + C[63]*QE[152] + C[67]*QE[162] + C[71]*QE[172] + C[75]*QE[182] + C[79]*QE[192] + C[83]*QE[202] + C[87]*QE[212] + C[91]*QE[222] + C[95]*QE[232] + C[99]*QE[242] + C[103]*QE[252] + C[107]*QE[262] + C[111]*QE[272] + C[115]*QE[282] + C[119]*QE[292] + C[123]*QE[302] + C[127]*QE[312] + C[131]*QE[322] + C[135]*QE[332] + C[139]*QE[342] + C[143]*QE[352] + C[147]*QE[362] + C[151]*QE[372] + C[155]*QE[382] + C[159]*QE[392];
+H01[33] = + C[3]*QE[3] + C[7]*QE[13] + C[11]*QE[23] + C[15]*QE[33] + C[19]*QE[43] + C[23]*QE[53] + C[27]*QE[63] + C[31]*QE[73] + C[35]*QE[83] + C[39]*QE[93] + C[43]*QE[103] + C[47]*QE[113] + C[51]*QE[123] + C[55]*QE[133] + C[59]*QE[143] + C[63]*QE[153] + C[67]*QE[163] + C[71]*QE[173] + C[75]*QE[183] + C[79]*QE[193] + C[83]*QE[203] + C[87]*QE[213] + C[91]*QE[223] + C[95]*QE[233] + C[99]*QE[243] + C[103]*QE[253] + C[107]*QE[263] + C[111]*QE[273] + C[115]*QE[283] + C[119]*QE[293] + C[123]*QE[303] + C[127]*QE[313] + C[131]*QE[323] + C[135]*QE[333] + C[139]*QE[343] + C[143]*QE[353] + C[147]*QE[363] + C[151]*QE[373] + C[155]*QE[383] + C[159]*QE[393];
+H01[34] = + C[3]*QE[4] + C[7]*QE[14] + C[11]*QE[24] + C[15]*QE[34] + C[19]*QE[44] + C[23]*QE[54] + C[27]*QE[64] + C[31]*QE[74] + C[35]*QE[84] + C[39]*QE[94] + C[43]*QE[104] + C[47]*QE[114] + C[51]*QE[124] + C[55]*QE[134] + C[59]*QE[144] + C[63]*QE[154] + C[67]*QE[164] + C[71]*QE[174] + C[75]*QE[184] + C[79]*QE[194] + C[83]*QE[204] + C[87]*QE[214] + C[91]*QE[224] + C[95]*QE[234] + C[99]*QE[244] + C[103]*QE[254] + C[107]*QE[264] + C[111]*QE[274] + C[115]*QE[284] + C[119]*QE[294] + C[123]*QE[304] + C[127]*QE[314] + C[131]*QE[324] + C[135]*QE[334] + C[139]*QE[344] + C[143]*QE[354] + C[147]*QE[364] + C[151]*QE[374] + C[155]*QE[384] + C[159]*QE[394];
+H01[35] = + C[3]*QE[5] + C[7]*QE[15] + C[11]*QE[25] + C[15]*QE[35] + C[19]*QE[45] + C[23]*QE[55] + C[27]*QE[65] + C[31]*QE[75] + C[35]*QE[85] + C[39]*QE[95] + C[43]*QE[105] + C[47]*QE[115] + C[51]*QE[125] + C[55]*QE[135] + C[59]*QE[145] + C[63]*QE[155] + C[67]*QE[165] + C[71]*QE[175] + C[75]*QE[185] + C[79]*QE[195] + C[83]*QE[205] + C[87]*QE[215] + C[91]*QE[225] + C[95]*QE[235] + C[99]*QE[245] + C[103]*QE[255] + C[107]*QE[265] + C[111]*QE[275] + C[115]*QE[285] + C[119]*QE[295] + C[123]*QE[305] + C[127]*QE[315] + C[131]*QE[325] + C[135]*QE[335] + C[139]*QE[345] + C[143]*QE[355] + C[147]*QE[365] + C[151]*QE[375] + C[155]*QE[385] + C[159]*QE[395];
+H01[36] = + C[3]*QE[6] + C[7]*QE[16] + C[11]*QE[26] + C[15]*QE[36] + C[19]*QE[46] + C[23]*QE[56] + C[27]*QE[66] + C[31]*QE[76] + C[35]*QE[86] + C[39]*QE[96] + C[43]*QE[106] + C[47]*QE[116] + C[51]*QE[126] + C[55]*QE[136] + C[59]*QE[146] + C[63]*QE[156] + C[67]*QE[166] + C[71]*QE[176] + C[75]*QE[186] + C[79]*QE[196] + C[83]*QE[206] + C[87]*QE[216] + C[91]*QE[226] + C[95]*QE[236] + C[99]*QE[246] + C[103]*QE[256] + C[107]*QE[266] + C[111]*QE[276] + C[115]*QE[286] + C[119]*QE[296] + C[123]*QE[306] + C[127]*QE[316] + C[131]*QE[326] + C[135]*QE[336] + C[139]*QE[346] + C[143]*QE[356] + C[147]*QE[366] + C[151]*QE[376] + C[155]*QE[386] + C[159]*QE[396];
+H01[37] = + C[3]*QE[7] + C[7]*QE[17] + C[11]*QE[27] + C[15]*QE[37] + C[19]*QE[47] + C[23]*QE[57] + C[27]*QE[67] + C[31]*QE[77] + C[35]*QE[87] + C[39]*QE[97] + C[43]*QE[107] + C[47]*QE[117] + C[51]*QE[127] + C[55]*QE[137] + C[59]*QE[147] + C[63]*QE[157] + C[67]*QE[167] + C[71]*QE[177] + C[75]*QE[187] + C[79]*QE[197] + C[83]*QE[207] + C[87]*QE[217] + C[91]*QE[227] + C[95]*QE[237] + C[99]*QE[247] + C[103]*QE[257] + C[107]*QE[267] + C[111]*QE[277] + C[115]*QE[287] + C[119]*QE[297] + C[123]*QE[307] + C[127]*QE[317] + C[131]*QE[327] + C[135]*QE[337] + C[139]*QE[347] + C[143]*QE[357] + C[147]*QE[367] + C[151]*QE[377] + C[155]*QE[387] + C[159]*QE[397];
+H01[38] = + C[3]*QE[8] + C[7]*QE[18] + C[11]*QE[28] + C[15]*QE[38] + C[19]*QE[48] + C[23]*QE[58] + C[27]*QE[68] + C[31]*QE[78] + C[35]*QE[88] + C[39]*QE[98] + C[43]*QE[108] + C[47]*QE[118] + C[51]*QE[128] + C[55]*QE[138] + C[59]*QE[148] + C[63]*QE[158] + C[67]*QE[168] + C[71]*QE[178] + C[75]*QE[188] + C[79]*QE[198] + C[83]*QE[208] + C[87]*QE[218] + C[91]*QE[228] + C[95]*QE[238] + C[99]*QE[248] + C[103]*QE[258] + C[107]*QE[268] + C[111]*QE[278] + C[115]*QE[288] + C[119]*QE[298] + C[123]*QE[308] + C[127]*QE[318] + C[131]*QE[328] + C[135]*QE[338] + C[139]*QE[348] + C[143]*QE[358] + C[147]*QE[368] + C[151]*QE[378] + C[155]*QE[388] + C[159]*QE[398];
+H01[39] = + C[3]*QE[9] + C[7]*QE[19] + C[11]*QE[29] + C[15]*QE[39] + C[19]*QE[49] + C[23]*QE[59] + C[27]*QE[69] + C[31]*QE[79] + C[35]*QE[89] + C[39]*QE[99] + C[43]*QE[109] + C[47]*QE[119] + C[51]*QE[129] + C[55]*QE[139] + C[59]*QE[149] + C[63]*QE[159] + C[67]*QE[169] + C[71]*QE[179] + C[75]*QE[189] + C[79]*QE[199] + C[83]*QE[209] + C[87]*QE[219] + C[91]*QE[229] + C[95]*QE[239] + C[99]*QE[249] + C[103]*QE[259] + C[107]*QE[269] + C[111]*QE[279] + C[115]*QE[289] + C[119]*QE[299] + C[123]*QE[309] + C[127]*QE[319] + C[131]*QE[329] + C[135]*QE[339] + C[139]*QE[349] + C[143]*QE[359] + C[147]*QE[369] + C[151]*QE[379] + C[155]*QE[389] + C[159]*QE[399];
+}
+
+void multiplyH11( real_t* E, real_t* QE, real_t* H11 )
+{
+H11[0] = + E[0]*QE[0] + E[10]*QE[10] + E[20]*QE[20] + E[30]*QE[30] + E[40]*QE[40] + E[50]*QE[50] + E[60]*QE[60] + E[70]*QE[70] + E[80]*QE[80] + E[90]*QE[90] + E[100]*QE[100] + E[110]*QE[110] + E[120]*QE[120] + E[130]*QE[130] + E[140]*QE[140] + E[150]*QE[150] + E[160]*QE[160] + E[170]*QE[170] + E[180]*QE[180] + E[190]*QE[190] + E[200]*QE[200] + E[210]*QE[210] + E[220]*QE[220] + E[230]*QE[230] + E[240]*QE[240] + E[250]*QE[250] + E[260]*QE[260] + E[270]*QE[270] + E[280]*QE[280] + E[290]*QE[290] + E[300]*QE[300] + E[310]*QE[310] + E[320]*QE[320] + E[330]*QE[330] + E[340]*QE[340] + E[350]*QE[350] + E[360]*QE[360] + E[370]*QE[370] + E[380]*QE[380] + E[390]*QE[390];
+H11[1] = + E[0]*QE[1] + E[10]*QE[11] + E[20]*QE[21] + E[30]*QE[31] + E[40]*QE[41] + E[50]*QE[51] + E[60]*QE[61] + E[70]*QE[71] + E[80]*QE[81] + E[90]*QE[91] + E[100]*QE[101] + E[110]*QE[111] + E[120]*QE[121] + E[130]*QE[131] + E[140]*QE[141] + E[150]*QE[151] + E[160]*QE[161] + E[170]*QE[171] + E[180]*QE[181] + E[190]*QE[191] + E[200]*QE[201] + E[210]*QE[211] + E[220]*QE[221] + E[230]*QE[231] + E[240]*QE[241] + E[250]*QE[251] + E[260]*QE[261] + E[270]*QE[271] + E[280]*QE[281] + E[290]*QE[291] + E[300]*QE[301] + E[310]*QE[311] + E[320]*QE[321] + E[330]*QE[331] + E[340]*QE[341] + E[350]*QE[351] + E[360]*QE[361] + E[370]*QE[371] + E[380]*QE[381] + E[390]*QE[391];
+H11[2] = + E[0]*QE[2] + E[10]*QE[12] + E[20]*QE[22] + E[30]*QE[32] + E[40]*QE[42] + E[50]*QE[52] + E[60]*QE[62] + E[70]*QE[72] + E[80]*QE[82] + E[90]*QE[92] + E[100]*QE[102] + E[110]*QE[112] + E[120]*QE[122] + E[130]*QE[132] + E[140]*QE[142] + E[150]*QE[152] + E[160]*QE[162] + E[170]*QE[172] + E[180]*QE[182] + E[190]*QE[192] + E[200]*QE[202] + E[210]*QE[212] + E[220]*QE[222] + E[230]*QE[232] + E[240]*QE[242] + E[250]*QE[252] + E[260]*QE[262] + E[270]*QE[272] + E[280]*QE[282] + E[290]*QE[292] + E[300]*QE[302] + E[310]*QE[312] + E[320]*QE[322] + E[330]*QE[332] + E[340]*QE[342] + E[350]*QE[352] + E[360]*QE[362] + E[370]*QE[372] + E[380]*QE[382] + E[390]*QE[392];
+H11[3] = + E[0]*QE[3] + E[10]*QE[13] + E[20]*QE[23] + E[30]*QE[33] + E[40]*QE[43] + E[50]*QE[53] + E[60]*QE[63] + E[70]*QE[73] + E[80]*QE[83] + E[90]*QE[93] + E[100]*QE[103] + E[110]*QE[113] + E[120]*QE[123] + E[130]*QE[133] + E[140]*QE[143] + E[150]*QE[153] + E[160]*QE[163] + E[170]*QE[173] + E[180]*QE[183] + E[190]*QE[193] + E[200]*QE[203] + E[210]*QE[213] + E[220]*QE[223] + E[230]*QE[233] + E[240]*QE[243] + E[250]*QE[253] + E[260]*QE[263] + E[270]*QE[273] + E[280]*QE[283] + E[290]*QE[293] + E[300]*QE[303] + E[310]*QE[313] + E[320]*QE[323] + E[330]*QE[333] + E[340]*QE[343] + E[350]*QE[353] + E[360]*QE[363] + E[370]*QE[373] + E[380]*QE[383] + E[390]*QE[393];
+H11[4] = + E[0]*QE[4] + E[10]*QE[14] + E[20]*QE[24] + E[30]*QE[34] + E[40]*QE[44] + E[50]*QE[54] + E[60]*QE[64] + E[70]*QE[74] + E[80]*QE[84] + E[90]*QE[94] + E[100]*QE[104] + E[110]*QE[114] + E[120]*QE[124] + E[130]*QE[134] + E[140]*QE[144] + E[150]*QE[154] + E[160]*QE[164] + E[170]*QE[174] + E[180]*QE[184] + E[190]*QE[194] + E[200]*QE[204] + E[210]*QE[214] + E[220]*QE[224] + E[230]*QE[234] + E[240]*QE[244] + E[250]*QE[254] + E[260]*QE[264] + E[270]*QE[274] + E[280]*QE[284] + E[290]*QE[294] + E[300]*QE[304] + E[310]*QE[314] + E[320]*QE[324] + E[330]*QE[334] + E[340]*QE[344] + E[350]*QE[354] + E[360]*QE[364] + E[370]*QE[374] + E[380]*QE[384] + E[390]*QE[394];
+H11[5] = + E[0]*QE[5] + E[10]*QE[15] + E[20]*QE[25] + E[30]*QE[35] + E[40]*QE[45] + E[50]*QE[55] + E[60]*QE[65] + E[70]*QE[75] + E[80]*QE[85] + E[90]*QE[95] + E[100]*QE[105] + E[110]*QE[115] + E[120]*QE[125] + E[130]*QE[135] + E[140]*QE[145] + E[150]*QE[155] + E[160]*QE[165] + E[170]*QE[175] + E[180]*QE[185] + E[190]*QE[195] + E[200]*QE[205] + E[210]*QE[215] + E[220]*QE[225] + E[230]*QE[235] + E[240]*QE[245] + E[250]*QE[255] + E[260]*QE[265] + E[270]*QE[275] + E[280]*QE[285] + E[290]*QE[295] + E[300]*QE[305] + E[310]*QE[315] + E[320]*QE[325] + E[330]*QE[335] + E[340]*QE[345] + E[350]*QE[355] + E[360]*QE[365] + E[370]*QE[375] + E[380]*QE[385] + E[390]*QE[395];
+H11[6] = + E[0]*QE[6] + E[10]*QE[16] + E[20]*QE[26] + E[30]*QE[36] + E[40]*QE[46] + E[50]*QE[56] + E[60]*QE[66] + E[70]*QE[76] + E[80]*QE[86] + E[90]*QE[96] + E[100]*QE[106] + E[110]*QE[116] + E[120]*QE[126] + E[130]*QE[136] + E[140]*QE[146] + E[150]*QE[156] + E[160]*QE[166] + E[170]*QE[176] + E[180]*QE[186] + E[190]*QE[196] + E[200]*QE[206] + E[210]*QE[216] + E[220]*QE[226] + E[230]*QE[236] + E[240]*QE[246] + E[250]*QE[256] + E[260]*QE[266] + E[270]*QE[276] + E[280]*QE[286] + E[290]*QE[296] + E[300]*QE[306] + E[310]*QE[316] + E[320]*QE[326] + E[330]*QE[336] + E[340]*QE[346] + E[350]*QE[356] + E[360]*QE[366] + E[370]*QE[376] + E[380]*QE[386] + E[390]*QE[396];
+H11[7] = + E[0]*QE[7] + E[10]*QE[17] + E[20]*QE[27] + E[30]*QE[37] + E[40]*QE[47] + E[50]*QE[57] + E[60]*QE[67] + E[70]*QE[77] + E[80]*QE[87] + E[90]*QE[97] + E[100]*QE[107] + E[110]*QE[117] + E[120]*QE[127] + E[130]*QE[137] + E[140]*QE[147] + E[150]*QE[157] + E[160]*QE[167] + E[170]*QE[177] + E[180]*QE[187] + E[190]*QE[197] + E[200]*QE[207] + E[210]*QE[217] + E[220]*QE[227] + E[230]*QE[237] + E[240]*QE[247] + E[250]*QE[257] + E[260]*QE[267] + E[270]*QE[277] + E[280]*QE[287] + E[290]*QE[297] + E[300]*QE[307] + E[310]*QE[317] + E[320]*QE[327] + E[330]*QE[337] + E[340]*QE[347] + E[350]*QE[357] + E[360]*QE[367] + E[370]*QE[377] + E[380]*QE[387] + E[390]*QE[397];
+H11[8] = + E[0]*QE[8] + E[10]*QE[18] + E[20]*QE[28] + E[30]*QE[38] + E[40]*QE[48] + E[50]*QE[58] + E[60]*QE[68] + E[70]*QE[78] + E[80]*QE[88] + E[90]*QE[98] + E[100]*QE[108] + E[110]*QE[118] + E[120]*QE[128] + E[130]*QE[138] + E[140]*QE[148] + E[150]*QE[158] + E[160]*QE[168] + E[170]*QE[178] + E[180]*QE[188] + E[190]*QE[198] + E[200]*QE[208] + E[210]*QE[218] + E[220]*QE[228] + E[230]*QE[238] + E[240]*QE[248] + E[250]*QE[258] + E[260]*QE[268] + E[270]*QE[278] + E[280]*QE[288] + E[290]*QE[298] + E[300]*QE[308] + E[310]*QE[318] + E[320]*QE[328] + E[330]*QE[338] + E[340]*QE[348] + E[350]*QE[358] + E[360]*QE[368] + E[370]*QE[378] + E[380]*QE[388] + E[390]*QE[398];
+H11[9] = + E[0]*QE[9] + E[10]*QE[19] + E[20]*QE[29] + E[30]*QE[39] + E[40]*QE[49] + E[50]*QE[59] + E[60]*QE[69] + E[70]*QE[79] + E[80]*QE[89] + E[90]*QE[99] + E[100]*QE[109] + E[110]*QE[119] + E[120]*QE[129] + E[130]*QE[139] + E[140]*QE[149] + E[150]*QE[159] + E[160]*QE[169] + E[170]*QE[179] + E[180]*QE[189] + E[190]*QE[199] + E[200]*QE[209] + E[210]*QE[219] + E[220]*QE[229] + E[230]*QE[239] + E[240]*QE[249] + E[250]*QE[259] + E[260]*QE[269] + E[270]*QE[279] + E[280]*QE[289] + E[290]*QE[299] + E[300]*QE[309] + E[310]*QE[319] + E[320]*QE[329] + E[330]*QE[339] + E[340]*QE[349] + E[350]*QE[359] + E[360]*QE[369] + E[370]*QE[379] + E[380]*QE[389] + E[390]*QE[399];
+H11[10] = + E[1]*QE[0] + E[11]*QE[10] + E[21]*QE[20] + E[31]*QE[30] + E[41]*QE[40] + E[51]*QE[50] + E[61]*QE[60] + E[71]*QE[70] + E[81]*QE[80] + E[91]*QE[90] + E[101]*QE[100] + E[111]*QE[110] + E[121]*QE[120] + E[131]*QE[130] + E[141]*QE[140] + E[151]*QE[150] + E[161]*QE[160] + E[171]*QE[170] + E[181]*QE[180] + E[191]*QE[190] + E[201]*QE[200] + E[211]*QE[210] + E[221]*QE[220] + E[231]*QE[230] + E[241]*QE[240] + E[251]*QE[250] + E[261]*QE[260] + E[271]*QE[270] + E[281]*QE[280] + E[291]*QE[290] + E[301]*QE[300] + E[311]*QE[310] + E[321]*QE[320] + E[331]*QE[330] + E[341]*QE[340] + E[351]*QE[350] + E[361]*QE[360] + E[371]*QE[370] + E[381]*QE[380] + E[391]*QE[390];
+H11[11] = + E[1]*QE[1] + E[11]*QE[11] + E[21]*QE[21] + E[31]*QE[31] + E[41]*QE[41] + E[51]*QE[51] + E[61]*QE[61] + E[71]*QE[71] + E[81]*QE[81] + E[91]*QE[91] + E[101]*QE[101] + E[111]*QE[111] + E[121]*QE[121] + E[131]*QE[131] + E[141]*QE[141] + E[151]*QE[151] + E[161]*QE[161] + E[171]*QE[171] + E[181]*QE[181] + E[191]*QE[191] + E[201]*QE[201] + E[211]*QE[211] + E[221]*QE[221] + E[231]*QE[231] + E[241]*QE[241] + E[251]*QE[251] + E[261]*QE[261] + E[271]*QE[271] + E[281]*QE[281] + E[291]*QE[291] + E[301]*QE[301] + E[311]*QE[311] + E[321]*QE[321] + E[331]*QE[331] + E[341]*QE[341] + E[351]*QE[351] + E[361]*QE[361] + E[371]*QE[371] + E[381]*QE[381] + E[391]*QE[391];
+H11[12] = + E[1]*QE[2] + E[11]*QE[12] + E[21]*QE[22] + E[31]*QE[32] + E[41]*QE[42] + E[51]*QE[52] + E[61]*QE[62] + E[71]*QE[72] + E[81]*QE[82] + E[91]*QE[92] + E[101]*QE[102] + E[111]*QE[112] + E[121]*QE[122] + E[131]*QE[132] + E[141]*QE[142] + E[151]*QE[152] + E[161]*QE[162] + E[171]*QE[172] + E[181]*QE[182] + E[191]*QE[192] + E[201]*QE[202] + E[211]*QE[212] + E[221]*QE[222] + E[231]*QE[232] + E[241]*QE[242] + E[251]*QE[252] + E[261]*QE[262] + E[271]*QE[272] + E[281]*QE[282] + E[291]*QE[292] + E[301]*QE[302] + E[311]*QE[312] + E[321]*QE[322] + E[331]*QE[332] + E[341]*QE[342] + E[351]*QE[352] + E[361]*QE[362] + E[371]*QE[372] + E[381]*QE[382] + E[391]*QE[392];
+H11[13] = + E[1]*QE[3] + E[11]*QE[13] + E[21]*QE[23] + E[31]*QE[33] + E[41]*QE[43] + E[51]*QE[53] + E[61]*QE[63] + E[71]*QE[73] + E[81]*QE[83] + E[91]*QE[93] + E[101]*QE[103] + E[111]*QE[113] + E[121]*QE[123] + E[131]*QE[133] + E[141]*QE[143] + E[151]*QE[153] + E[161]*QE[163] + E[171]*QE[173] + E[181]*QE[183] + E[191]*QE[193] + E[201]*QE[203] + E[211]*QE[213] + E[221]*QE[223] + E[231]*QE[233] + E[241]*QE[243] + E[251]*QE[253] + E[261]*QE[263] + E[271]*QE[273] + E[281]*QE[283] + E[291]*QE[293] + E[301]*QE[303] + E[311]*QE[313] + E[321]*QE[323] + E[331]*QE[333] + E[341]*QE[343] + E[351]*QE[353] + E[361]*QE[363] + E[371]*QE[373] + E[381]*QE[383] + E[391]*QE[393];
+H11[14] = + E[1]*QE[4] + E[11]*QE[14] + E[21]*QE[24] + E[31]*QE[34] + E[41]*QE[44] + E[51]*QE[54] + E[61]*QE[64] + E[71]*QE[74] + E[81]*QE[84] + E[91]*QE[94] + E[101]*QE[104] + E[111]*QE[114] + E[121]*QE[124] + E[131]*QE[134] + E[141]*QE[144] + E[151]*QE[154] + E[161]*QE[164] + E[171]*QE[174] + E[181]*QE[184] + E[191]*QE[194] + E[201]*QE[204] + E[211]*QE[214] + E[221]*QE[224] + E[231]*QE[234] + E[241]*QE[244] + E[251]*QE[254] + E[261]*QE[264] + E[271]*QE[274] + E[281]*QE[284] + E[291]*QE[294] + E[301]*QE[304] + E[311]*QE[314] + E[321]*QE[324] + E[331]*QE[334] + E[341]*QE[344] + E[351]*QE[354] + E[361]*QE[364] + E[371]*QE[374] + E[381]*QE[384] + E[391]*QE[394];
+H11[15] = + E[1]*QE[5] + E[11]*QE[15] + E[21]*QE[25] + E[31]*QE[35] + E[41]*QE[45] + E[51]*QE[55] + E[61]*QE[65] + E[71]*QE[75] + E[81]*QE[85] + E[91]*QE[95] + E[101]*QE[105] + E[111]*QE[115] + E[121]*QE[125] + E[131]*QE[135] + E[141]*QE[145] + E[151]*QE[155] + E[161]*QE[165] + E[171]*QE[175] + E[181]*QE[185] + E[191]*QE[195] + E[201]*QE[205] + E[211]*QE[215] + E[221]*QE[225] + E[231]*QE[235] + E[241]*QE[245] + E[251]*QE[255] + E[261]*QE[265] + E[271]*QE[275] + E[281]*QE[285] + E[291]*QE[295] + E[301]*QE[305] + E[311]*QE[315] + E[321]*QE[325] + E[331]*QE[335] + E[341]*QE[345] + E[351]*QE[355] + E[361]*QE[365] + E[371]*QE[375] + E[381]*QE[385] + E[391]*QE[395];
+H11[16] = + E[1]*QE[6] + E[11]*QE[16] + E[21]*QE[26] + E[31]*QE[36] + E[41]*QE[46] + E[51]*QE[56] + E[61]*QE[66] + E[71]*QE[76] + E[81]*QE[86] + E[91]*QE[96] + E[101]*QE[106] + E[111]*QE[116] + E[121]*QE[126] + E[131]*QE[136] + E[141]*QE[146] + E[151]*QE[156] + E[161]*QE[166] + E[171]*QE[176] + E[181]*QE[186] + E[191]*QE[196] + E[201]*QE[206] + E[211]*QE[216] + E[221]*QE[226] + E[231]*QE[236] + E[241]*QE[246] + E[251]*QE[256] + E[261]*QE[266] + E[271]*QE[276] + E[281]*QE[286] + E[291]*QE[296] + E[301]*QE[306] + E[311]*QE[316] + E[321]*QE[326] + E[331]*QE[336] + E[341]*QE[346] + E[351]*QE[356] + E[361]*QE[366] + E[371]*QE[376] + E[381]*QE[386] + E[391]*QE[396];
+H11[17] = + E[1]*QE[7] + E[11]*QE[17] + E[21]*QE[27] + E[31]*QE[37] + E[41]*QE[47] + E[51]*QE[57] + E[61]*QE[67] + E[71]*QE[77] + E[81]*QE[87] + E[91]*QE[97] + E[101]*QE[107] + E[111]*QE[117] + E[121]*QE[127] + E[131]*QE[137] + E[141]*QE[147] + E[151]*QE[157] + E[161]*QE[167] + E[171]*QE[177] + E[181]*QE[187] + E[191]*QE[197] + E[201]*QE[207] + E[211]*QE[217] + E[221]*QE[227] + E[231]*QE[237] + E[241]*QE[247] + E[251]*QE[257] + E[261]*QE[267] + E[271]*QE[277] + E[281]*QE[287] + E[291]*QE[297] + E[301]*QE[307] + E[311]*QE[317] + E[321]*QE[327] + E[331]*QE[337] + E[341]*QE[347] + E[351]*QE[357] + E[361]*QE[367] + E[371]*QE[377] + E[381]*QE[387] + E[391]*QE[397];
+H11[18] = + E[1]*QE[8] + E[11]*QE[18] + E[21]*QE[28] + E[31]*QE[38] + E[41]*QE[48] + E[51]*QE[58] + E[61]*QE[68] + E[71]*QE[78] + E[81]*QE[88] + E[91]*QE[98] + E[101]*QE[108] + E[111]*QE[118] + E[121]*QE[128] + E[131]*QE[138] + E[141]*QE[148] + E[151]*QE[158] + E[161]*QE[168] + E[171]*QE[178] + E[181]*QE[188] + E[191]*QE[198] + E[201]*QE[208] + E[211]*QE[218] + E[221]*QE[228] + E[231]*QE[238] + E[241]*QE[248] + E[251]*QE[258] + E[261]*QE[268] + E[271]*QE[278] + E[281]*QE[288] + E[291]*QE[298] + E[301]*QE[308] + E[311]*QE[318] + E[321]*QE[328] + E[331]*QE[338] + E[341]*QE[348] + E[351]*QE[358] + E[361]*QE[368] + E[371]*QE[378] + E[381]*QE[388] + E[391]*QE[398];
+H11[19] = + E[1]*QE[9] + E[11]*QE[19] + E[21]*QE[29] + E[31]*QE[39] + E[41]*QE[49] + E[51]*QE[59] + E[61]*QE[69] + E[71]*QE[79] + E[81]*QE[89] + E[91]*QE[99] + E[101]*QE[109] + E[111]*QE[119] + E[121]*QE[129] + E[131]*QE[139] + E[141]*QE[149] + E[151]*QE[159] + E[161]*QE[169] + E[171]*QE[179] + E[181]*QE[189] + E[191]*QE[199] + E[201]*QE[209] + E[211]*QE[219] + E[221]*QE[229] + E[231]*QE[239] + E[241]*QE[249] + E[251]*QE[259] + E[261]*QE[269] + E[271]*QE[279] + E[281]*QE[289] + E[291]*QE[299] + E[301]*QE[309] + E[311]*QE[319] + E[321]*QE[329] + E[331]*QE[339] + E[341]*QE[349] + E[351]*QE[359] + E[361]*QE[369] + E[371]*QE[379] + E[381]*QE[389] + E[391]*QE[399];
+H11[20] = + E[2]*QE[0] + E[12]*QE[10] + E[22]*QE[20] + E[32]*QE[30] + E[42]*QE[40] + E[52]*QE[50] + E[62]*QE[60] + E[72]*QE[70] + E[82]*QE[80] + E[92]*QE[90] + E[102]*QE[100] + E[112]*QE[110] + E[122]*QE[120] + E[132]*QE[130] + E[142]*QE[140] + E[152]*QE[150] + E[162]*QE[160] + E[172]*QE[170] + E[182]*QE[180] + E[192]*QE[190] + E[202]*QE[200] + E[212]*QE[210] + E[222]*QE[220] + E[232]*QE[230] + E[242]*QE[240] + E[252]*QE[250] + E[262]*QE[260] + E[272]*QE[270] + E[282]*QE[280] + E[292]*QE[290] + E[302]*QE[300] + E[312]*QE[310] + E[322]*QE[320] + E[332]*QE[330] + E[342]*QE[340] + E[352]*QE[350] + E[362]*QE[360] + E[372]*QE[370] + E[382]*QE[380] + E[392]*QE[390];
+H11[21] = + E[2]*QE[1] + E[12]*QE[11] + E[22]*QE[21] + E[32]*QE[31] + E[42]*QE[41] + E[52]*QE[51] + E[62]*QE[61] + E[72]*QE[71] + E[82]*QE[81] + E[92]*QE[91] + E[102]*QE[101] + E[112]*QE[111] + E[122]*QE[121] + E[132]*QE[131] + E[142]*QE[141] + E[152]*QE[151] + E[162]*QE[161] + E[172]*QE[171] + E[182]*QE[181] + E[192]*QE[191] + E[202]*QE[201] + E[212]*QE[211] + E[222]*QE[221] + E[232]*QE[231] + E[242]*QE[241] + E[252]*QE[251] + E[262]*QE[261] + E[272]*QE[271] + E[282]*QE[281] + E[292]*QE[291] + E[302]*QE[301] + E[312]*QE[311] + E[322]*QE[321] + E[332]*QE[331] + E[342]*QE[341] + E[352]*QE[351] + E[362]*QE[361] + E[372]*QE[371] + E[382]*QE[381] + E[392]*QE[391];
+H11[22] = + E[2]*QE[2] + E[12]*QE[12] + E[22]*QE[22] + E[32]*QE[32] + E[42]*QE[42] + E[52]*QE[52] + E[62]*QE[62] + E[72]*QE[72] + E[82]*QE[82] + E[92]*QE[92] + E[102]*QE[102] + E[112]*QE[112] + E[122]*QE[122] + E[132]*QE[132] + E[142]*QE[142] + E[152]*QE[152] + E[162]*QE[162] + E[172]*QE[172] + E[182]*QE[182] + E[192]*QE[192] + E[202]*QE[202] + E[212]*QE[212] + E[222]*QE[222] + E[232]*QE[232] + E[242]*QE[242] + E[252]*QE[252] + E[262]*QE[262] + E[272]*QE[272] + E[282]*QE[282] + E[292]*QE[292] + E[302]*QE[302] + E[312]*QE[312] + E[322]*QE[322] + E[332]*QE[332] + E[342]*QE[342] + E[352]*QE[352] + E[362]*QE[362] + E[372]*QE[372] + E[382]*QE[382] + E[392]*QE[392];
+H11[23] = + E[2]*QE[3] + E[12]*QE[13] + E[22]*QE[23] + E[32]*QE[33] + E[42]*QE[43] + E[52]*QE[53] + E[62]*QE[63] + E[72]*QE[73] + E[82]*QE[83] + E[92]*QE[93] + E[102]*QE[103] + E[112]*QE[113] + E[122]*QE[123] + E[132]*QE[133] + E[142]*QE[143] + E[152]*QE[153] + E[162]*QE[163] + E[172]*QE[173] + E[182]*QE[183] + E[192]*QE[193] + E[202]*QE[203] + E[212]*QE[213] + E[222]*QE[223] + E[232]*QE[233] + E[242]*QE[243] + E[252]*QE[253] + E[262]*QE[263] + E[272]*QE[273] + E[282]*QE[283] + E[292]*QE[293] + E[302]*QE[303] + E[312]*QE[313] + E[322]*QE[323] + E[332]*QE[333] + E[342]*QE[343] + E[352]*QE[353] + E[362]*QE[363] + E[372]*QE[373] + E[382]*QE[383] + E[392]*QE[393];
+H11[24] = + E[2]*QE[4] + E[12]*QE[14] + E[22]*QE[24] + E[32]*QE[34] + E[42]*QE[44] + E[52]*QE[54] + E[62]*QE[64] + E[72]*QE[74] + E[82]*QE[84] + E[92]*QE[94] + E[102]*QE[104] + E[112]*QE[114] + E[122]*QE[124] + E[132]*QE[134] + E[142]*QE[144] + E[152]*QE[154] + E[162]*QE[164] + E[172]*QE[174] + E[182]*QE[184] + E[192]*QE[194] + E[202]*QE[204] + E[212]*QE[214] + E[222]*QE[224] + E[232]*QE[234] + E[242]*QE[244] + E[252]*QE[254] + E[262]*QE[264] + E[272]*QE[274] + E[282]*QE[284] + E[292]*QE[294] + E[302]*QE[304] + E[312]*QE[314] + E[322]*QE[324] + E[332]*QE[334] + E[342]*QE[344] + E[352]*QE[354] + E[362]*QE[364] + E[372]*QE[374] + E[382]*QE[384] + E[392]*QE[394];
+H11[25] = + E[2]*QE[5] + E[12]*QE[15] + E[22]*QE[25] + E[32]*QE[35] + E[42]*QE[45] + E[52]*QE[55] + E[62]*QE[65] + E[72]*QE[75] + E[82]*QE[85] + E[92]*QE[95] + E[102]*QE[105] + E[112]*QE[115] + E[122]*QE[125] + E[132]*QE[135] + E[142]*QE[145] + E[152]*QE[155] + E[162]*QE[165] + E[172]*QE[175] + E[182]*QE[185] + E[192]*QE[195] + E[202]*QE[205] + E[212]*QE[215] + E[222]*QE[225] + E[232]*QE[235] + E[242]*QE[245] + E[252]*QE[255] + E[262]*QE[265] + E[272]*QE[275] + E[282]*QE[285] + E[292]*QE[295] + E[302]*QE[305] + E[312]*QE[315] + E[322]*QE[325] + E[332]*QE[335] + E[342]*QE[345] + E[352]*QE[355] + E[362]*QE[365] + E[372]*QE[375] + E[382]*QE[385] + E[392]*QE[395];
+H11[26] = + E[2]*QE[6] + E[12]*QE[16] + E[22]*QE[26] + E[32]*QE[36] + E[42]*QE[46] + E[52]*QE[56] + E[62]*QE[66] + E[72]*QE[76] + E[82]*QE[86] + E[92]*QE[96] + E[102]*QE[106] + E[112]*QE[116] + E[122]*QE[126] + E[132]*QE[136] + E[142]*QE[146] + E[152]*QE[156] + E[162]*QE[166] + E[172]*QE[176] + E[182]*QE[186] + E[192]*QE[196] + E[202]*QE[206] + E[212]*QE[216] + E[222]*QE[226] + E[232]*QE[236] + E[242]*QE[246] + E[252]*QE[256] + E[262]*QE[266] + E[272]*QE[276] + E[282]*QE[286] + E[292]*QE[296] + E[302]*QE[306] + E[312]*QE[316] + E[322]*QE[326] + E[332]*QE[336] + E[342]*QE[346] + E[352]*QE[356] + E[362]*QE[366] + E[372]*QE[376] + E[382]*QE[386] + E[392]*QE[396];
+H11[27] = + E[2]*QE[7] + E[12]*QE[17] + E[22]*QE[27] + E[32]*QE[37] + E[42]*QE[47] + E[52]*QE[57] + E[62]*QE[67] + E[72]*QE[77] + E[82]*QE[87] + E[92]*QE[97] + E[102]*QE[107] + E[112]*QE[117] + E[122]*QE[127] + E[132]*QE[137] + E[142]*QE[147] + E[152]*QE[157] + E[162]*QE[167] + E[172]*QE[177] + E[182]*QE[187] + E[192]*QE[197] + E[202]*QE[207] + E[212]*QE[217] + E[222]*QE[227] + E[232]*QE[237] + E[242]*QE[247] + E[252]*QE[257] + E[262]*QE[267] + E[272]*QE[277] + E[282]*QE[287] + E[292]*QE[297] + E[302]*QE[307] + E[312]*QE[317] + E[322]*QE[327] + E[332]*QE[337] + E[342]*QE[347] + E[352]*QE[357] + E[362]*QE[367] + E[372]*QE[377] + E[382]*QE[387] + E[392]*QE[397];
+H11[28] = + E[2]*QE[8] + E[12]*QE[18] + E[22]*QE[28] + E[32]*QE[38] + E[42]*QE[48] + E[52]*QE[58] + E[62]*QE[68] + E[72]*QE[78] + E[82]*QE[88] + E[92]*QE[98] + E[102]*QE[108] + E[112]*QE[118] + E[122]*QE[128] + E[132]*QE[138] + E[142]*QE[148] + E[152]*QE[158] + E[162]*QE[168] + E[172]*QE[178] + E[182]*QE[188] + E[192]*QE[198] + E[202]*QE[208] + E[212]*QE[218] + E[222]*QE[228] + E[232]*QE[238] + E[242]*QE[248] + E[252]*QE[258] + E[262]*QE[268] + E[272]*QE[278] + E[282]*QE[288] + E[292]*QE[298] + E[302]*QE[308] + E[312]*QE[318] + E[322]*QE[328] + E[332]*QE[338] + E[342]*QE[348] + E[352]*QE[358] + E[362]*QE[368] + E[372]*QE[378] + E[382]*QE[388] + E[392]*QE[398];
+H11[29] = + E[2]*QE[9] + E[12]*QE[19] + E[22]*QE[29] + E[32]*QE[39] + E[42]*QE[49] + E[52]*QE[59] + E[62]*QE[69] + E[72]*QE[79] + E[82]*QE[89] + E[92]*QE[99] + E[102]*QE[109] + E[112]*QE[119] + E[122]*QE[129] + E[132]*QE[139] + E[142]*QE[149] + E[152]*QE[159] + E[162]*QE[169] + E[172]*QE[179] + E[182]*QE[189] + E[192]*QE[199] + E[202]*QE[209] + E[212]*QE[219] + E[222]*QE[229] + E[232]*QE[239] + E[242]*QE[249] + E[252]*QE[259] + E[262]*QE[269] + E[272]*QE[279] + E[282]*QE[289] + E[292]*QE[299] + E[302]*QE[309] + E[312]*QE[319] + E[322]*QE[329] + E[332]*QE[339] + E[342]*QE[349] + E[352]*QE[359] + E[362]*QE[369] + E[372]*QE[379] + E[382]*QE[389] + E[392]*QE[399];
+H11[30] = + E[3]*QE[0] + E[13]*QE[10] + E[23]*QE[20] + E[33]*QE[30] + E[43]*QE[40] + E[53]*QE[50] + E[63]*QE[60] + E[73]*QE[70] + E[83]*QE[80] + E[93]*QE[90] + E[103]*QE[100] + E[113]*QE[110] + E[123]*QE[120] + E[133]*QE[130] + E[143]*QE[140] + E[153]*QE[150] + E[163]*QE[160] + E[173]*QE[170] + E[183]*QE[180] + E[193]*QE[190] + E[203]*QE[200] + E[213]*QE[210] + E[223]*QE[220] + E[233]*QE[230] + E[243]*QE[240] + E[253]*QE[250] + E[263]*QE[260] + E[273]*QE[270] + E[283]*QE[280] + E[293]*QE[290] + E[303]*QE[300] + E[313]*QE[310] + E[323]*QE[320] + E[333]*QE[330] + E[343]*QE[340] + E[353]*QE[350] + E[363]*QE[360] + E[373]*QE[370] + E[383]*QE[380] + E[393]*QE[390];
+H11[31] = + E[3]*QE[1] + E[13]*QE[11] + E[23]*QE[21] + E[33]*QE[31] + E[43]*QE[41] + E[53]*QE[51] + E[63]*QE[61] + E[73]*QE[71] + E[83]*QE[81] + E[93]*QE[91] + E[103]*QE[101] + E[113]*QE[111] + E[123]*QE[121] + E[133]*QE[131] + E[143]*QE[141] + E[153]*QE[151] + E[163]*QE[161] + E[173]*QE[171] + E[183]*QE[181] + E[193]*QE[191] + E[203]*QE[201] + E[213]*QE[211] + E[223]*QE[221] + E[233]*QE[231] + E[243]*QE[241] + E[253]*QE[251] + E[263]*QE[261] + E[273]*QE[271] + E[283]*QE[281] + E[293]*QE[291] + E[303]*QE[301] + E[313]*QE[311] + E[323]*QE[321] + E[333]*QE[331] + E[343]*QE[341] + E[353]*QE[351] + E[363]*QE[361] + E[373]*QE[371] + E[383]*QE[381] + E[393]*QE[391];
+H11[32] = + E[3]*QE[2] + E[13]*QE[12] + E[23]*QE[22] + E[33]*QE[32] + E[43]*QE[42] + E[53]*QE[52] + E[63]*QE[62] + E[73]*QE[72] + E[83]*QE[82] + E[93]*QE[92] + E[103]*QE[102] + E[113]*QE[112] + E[123]*QE[122] + E[133]*QE[132] + E[143]*QE[142] + E[153]*QE[152] + E[163]*QE[162] + E[173]*QE[172] + E[183]*QE[182] + E[193]*QE[192] + E[203]*QE[202] + E[213]*QE[212] + E[223]*QE[222] + E[233]*QE[232] + E[243]*QE[242] + E[253]*QE[252] + E[263]*QE[262] + E[273]*QE[272] + E[283]*QE[282] + E[293]*QE[292] + E[303]*QE[302] + E[313]*QE[312] + E[323]*QE[322] + E[333]*QE[332] + E[343]*QE[342] + E[353]*QE[352] + E[363]*QE[362] + E[373]*QE[372] + E[383]*QE[382] + E[393]*QE[392];
+H11[33] = + E[3]*QE[3] + E[13]*QE[13] + E[23]*QE[23] + E[33]*QE[33] + E[43]*QE[43] + E[53]*QE[53] + E[63]*QE[63] + E[73]*QE[73] + E[83]*QE[83] + E[93]*QE[93] + E[103]*QE[103] + E[113]*QE[113] + E[123]*QE[123] + E[133]*QE[133] + E[143]*QE[143] + E[153]*QE[153] + E[163]*QE[163] + E[173]*QE[173] + E[183]*QE[183] + E[193]*QE[193] + E[203]*QE[203] + E[213]*QE[213] + E[223]*QE[223] + E[233]*QE[233] + E[243]*QE[243] + E[253]*QE[253] + E[263]*QE[263] + E[273]*QE[273] + E[283]*QE[283] + E[293]*QE[293] + E[303]*QE[303] + E[313]*QE[313] + E[323]*QE[323] + E[333]*QE[333] + E[343]*QE[343] + E[353]*QE[353] + E[363]*QE[363] + E[373]*QE[373] + E[383]*QE[383] + E[393]*QE[393];
+H11[34] = + E[3]*QE[4] + E[13]*QE[14] + E[23]*QE[24] + E[33]*QE[34] + E[43]*QE[44] + E[53]*QE[54] + E[63]*QE[64] + E[73]*QE[74] + E[83]*QE[84] + E[93]*QE[94] + E[103]*QE[104] + E[113]*QE[114] + E[123]*QE[124] + E[133]*QE[134] + E[143]*QE[144] + E[153]*QE[154] + E[163]*QE[164] + E[173]*QE[174] + E[183]*QE[184] + E[193]*QE[194] + E[203]*QE[204] + E[213]*QE[214] + E[223]*QE[224] + E[233]*QE[234] + E[243]*QE[244] + E[253]*QE[254] + E[263]*QE[264] + E[273]*QE[274] + E[283]*QE[284] + E[293]*QE[294] + E[303]*QE[304] + E[313]*QE[314] + E[323]*QE[324] + E[333]*QE[334] + E[343]*QE[344] + E[353]*QE[354] + E[363]*QE[364] + E[373]*QE[374] + E[383]*QE[384] + E[393]*QE[394];
+H11[35] = + E[3]*QE[5] + E[13]*QE[15] + E[23]*QE[25] + E[33]*QE[35] + E[43]*QE[45] + E[53]*QE[55] + E[63]*QE[65] + E[73]*QE[75] + E[83]*QE[85] + E[93]*QE[95] + E[103]*QE[105] + E[113]*QE[115] + E[123]*QE[125] + E[133]*QE[135] + E[143]*QE[145] + E[153]*QE[155] + E[163]*QE[165] + E[173]*QE[175] + E[183]*QE[185] + E[193]*QE[195] + E[203]*QE[205] + E[213]*QE[215] + E[223]*QE[225] + E[233]*QE[235] + E[243]*QE[245] + E[253]*QE[255] + E[263]*QE[265] + E[273]*QE[275] + E[283]*QE[285] + E[293]*QE[295] + E[303]*QE[305] + E[313]*QE[315] + E[323]*QE[325] + E[333]*QE[335] + E[343]*QE[345] + E[353]*QE[355] + E[363]*QE[365] + E[373]*QE[375] + E[383]*QE[385] + E[393]*QE[395];
+H11[36] = + E[3]*QE[6] + E[13]*QE[16] + E[23]*QE[26] + E[33]*QE[36] + E[43]*QE[46] + E[53]*QE[56] + E[63]*QE[66] + E[73]*QE[76] + E[83]*QE[86] + E[93]*QE[96] + E[103]*QE[106] + E[113]*QE[116] + E[123]*QE[126] + E[133]*QE[136] + E[143]*QE[146] + E[153]*QE[156] + E[163]*QE[166] + E[173]*QE[176] + E[183]*QE[186] + E[193]*QE[196] + E[203]*QE[206] + E[213]*QE[216] + E[223]*QE[226] + E[233]*QE[236] + E[243]*QE[246] + E[253]*QE[256] + E[263]*QE[266] + E[273]*QE[276] + E[283]*QE[286] + E[293]*QE[296] + E[303]*QE[306] + E[313]*QE[316] + E[323]*QE[326] + E[333]*QE[336] + E[343]*QE[346] + E[353]*QE[356] + E[363]*QE[366] + E[373]*QE[376] + E[383]*QE[386] + E[393]*QE[396];
+H11[37] = + E[3]*QE[7] + E[13]*QE[17] + E[23]*QE[27] + E[33]*QE[37] + E[43]*QE[47] + E[53]*QE[57] + E[63]*QE[67] + E[73]*QE[77] + E[83]*QE[87] + E[93]*QE[97] + E[103]*QE[107] + E[113]*QE[117] + E[123]*QE[127] + E[133]*QE[137] + E[143]*QE[147] + E[153]*QE[157] + E[163]*QE[167] + E[173]*QE[177] + E[183]*QE[187] + E[193]*QE[197] + E[203]*QE[207] + E[213]*QE[217] + E[223]*QE[227] + E[233]*QE[237] + E[243]*QE[247] + E[253]*QE[257] + E[263]*QE[267] + E[273]*QE[277] + E[283]*QE[287] + E[293]*QE[297] + E[303]*QE[307] + E[313]*QE[317] + E[323]*QE[327] + E[333]*QE[337] + E[343]*QE[347] + E[353]*QE[357] + E[363]*QE[367] + E[373]*QE[377] + E[383]*QE[387] + E[393]*QE[397];
+H11[38] = + E[3]*QE[8] + E[13]*QE[18] + E[23]*QE[28] + E[33]*QE[38] + E[43]*QE[48] + E[53]*QE[58] + E[63]*QE[68] + E[73]*QE[78] + E[83]*QE[88] + E[93]*QE[98] + E[103]*QE[108] + E[113]*QE[118] + E[123]*QE[128] + E[133]*QE[138] + E[143]*QE[148] + E[153]*QE[158] + E[163]*QE[168] + E[173]*QE[178] + E[183]*QE[188] + E[193]*QE[198] + E[203]*QE[208] + E[213]*QE[218] + E[223]*QE[228] + E[233]*QE[238] + E[243]*QE[248] + E[253]*QE[258] + E[263]*QE[268] + E[273]*QE[278] + E[283]*QE[288] + E[293]*QE[298] + E[303]*QE[308] + E[313]*QE[318] + E[323]*QE[328] + E[333]*QE[338] + E[343]*QE[348] + E[353]*QE[358] + E[363]*QE[368] + E[373]*QE[378] + E[383]*QE[388] + E[393]*QE[398];
+H11[39] = + E[3]*QE[9] + E[13]*QE[19] + E[23]*QE[29] + E[33]*QE[39] + E[43]*QE[49] + E[53]*QE[59] + E[63]*QE[69] + E[73]*QE[79] + E[83]*QE[89] + E[93]*QE[99] + E[103]*QE[109] + E[113]*QE[119] + E[123]*QE[129] + E[133]*QE[139] + E[143]*QE[149] + E[153]*QE[159] + E[163]*QE[169] + E[173]*QE[179] + E[183]*QE[189] + E[193]*QE[199] + E[203]*QE[209] + E[213]*QE[219] + E[223]*QE[229] + E[233]*QE[239] + E[243]*QE[249] + E[253]*QE[259] + E[263]*QE[269] + E[273]*QE[279] + E[283]*QE[289] + E[293]*QE[299] + E[303]*QE[309] + E[313]*QE[319] + E[323]*QE[329] + E[333]*QE[339] + E[343]*QE[349] + E[353]*QE[359] + E[363]*QE[369] + E[373]*QE[379] + E[383]*QE[389] + E[393]*QE[399];
+H11[40] = + E[4]*QE[0] + E[14]*QE[10] + E[24]*QE[20] + E[34]*QE[30] + E[44]*QE[40] + E[54]*QE[50] + E[64]*QE[60] + E[74]*QE[70] + E[84]*QE[80] + E[94]*QE[90] + E[104]*QE[100] + E[114]*QE[110] + E[124]*QE[120] + E[134]*QE[130] + E[144]*QE[140] + E[154]*QE[150] + E[164]*QE[160] + E[174]*QE[170] + E[184]*QE[180] + E[194]*QE[190] + E[204]*QE[200] + E[214]*QE[210] + E[224]*QE[220] + E[234]*QE[230] + E[244]*QE[240] + E[254]*QE[250] + E[264]*QE[260] + E[274]*QE[270] + E[284]*QE[280] + E[294]*QE[290] + E[304]*QE[300] + E[314]*QE[310] + E[324]*QE[320] + E[334]*QE[330] + E[344]*QE[340] + E[354]*QE[350] + E[364]*QE[360] + E[374]*QE[370] + E[384]*QE[380] + E[394]*QE[390];
+H11[41] = + E[4]*QE[1] + E[14]*QE[11] + E[24]*QE[21] + E[34]*QE[31] + E[44]*QE[41] + E[54]*QE[51] + E[64]*QE[61] + E[74]*QE[71] + E[84]*QE[81] + E[94]*QE[91] + E[104]*QE[101] + E[114]*QE[111] + E[124]*QE[121] + E[134]*QE[131] + E[144]*QE[141] + E[154]*QE[151] + E[164]*QE[161] + E[174]*QE[171] + E[184]*QE[181] + E[194]*QE[191] + E[204]*QE[201] + E[214]*QE[211] + E[224]*QE[221] + E[234]*QE[231] + E[244]*QE[241] + E[254]*QE[251] + E[264]*QE[261] + E[274]*QE[271] + E[284]*QE[281] + E[294]*QE[291] + E[304]*QE[301] + E[314]*QE[311] + E[324]*QE[321] + E[334]*QE[331] + E[344]*QE[341] + E[354]*QE[351] + E[364]*QE[361] + E[374]*QE[371] + E[384]*QE[381] + E[394]*QE[391];
+H11[42] = + E[4]*QE[2] + E[14]*QE[12] + E[24]*QE[22] + E[34]*QE[32] + E[44]*QE[42] + E[54]*QE[52] + E[64]*QE[62] + E[74]*QE[72] + E[84]*QE[82] + E[94]*QE[92] + E[104]*QE[102] + E[114]*QE[112] + E[124]*QE[122] + E[134]*QE[132] + E[144]*QE[142] + E[154]*QE[152] + E[164]*QE[162] + E[174]*QE[172] + E[184]*QE[182] + E[194]*QE[192] + E[204]*QE[202] + E[214]*QE[212] + E[224]*QE[222] + E[234]*QE[232] + E[244]*QE[242] + E[254]*QE[252] + E[264]*QE[262] + E[274]*QE[272] + E[284]*QE[282] + E[294]*QE[292] + E[304]*QE[302] + E[314]*QE[312] + E[324]*QE[322] + E[334]*QE[332] + E[344]*QE[342] + E[354]*QE[352] + E[364]*QE[362] + E[374]*QE[372] + E[384]*QE[382] + E[394]*QE[392];
+H11[43] = + E[4]*QE[3] + E[14]*QE[13] + E[24]*QE[23] + E[34]*QE[33] + E[44]*QE[43] + E[54]*QE[53] + E[64]*QE[63] + E[74]*QE[73] + E[84]*QE[83] + E[94]*QE[93] + E[104]*QE[103] + E[114]*QE[113] + E[124]*QE[123] + E[134]*QE[133] + E[144]*QE[143] + E[154]*QE[153] + E[164]*QE[163] + E[174]*QE[173] + E[184]*QE[183] + E[194]*QE[193] + E[204]*QE[203] + E[214]*QE[213] + E[224]*QE[223] + E[234]*QE[233] + E[244]*QE[243] + E[254]*QE[253] + E[264]*QE[263] + E[274]*QE[273] + E[284]*QE[283] + E[294]*QE[293] + E[304]*QE[303] + E[314]*QE[313] + E[324]*QE[323] + E[334]*QE[333] + E[344]*QE[343] + E[354]*QE[353] + E[364]*QE[363] + E[374]*QE[373] + E[384]*QE[383] + E[394]*QE[393];
+H11[44] = + E[4]*QE[4] + E[14]*QE[14] + E[24]*QE[24] + E[34]*QE[34] + E[44]*QE[44] + E[54]*QE[54] + E[64]*QE[64] + E[74]*QE[74] + E[84]*QE[84] + E[94]*QE[94] + E[104]*QE[104] + E[114]*QE[114] + E[124]*QE[124] + E[134]*QE[134] + E[144]*QE[144] + E[154]*QE[154] + E[164]*QE[164] + E[174]*QE[174] + E[184]*QE[184] + E[194]*QE[194] + E[204]*QE[204] + E[214]*QE[214] + E[224]*QE[224] + E[234]*QE[234] + E[244]*QE[244] + E[254]*QE[254] + E[264]*QE[264] + E[274]*QE[274] + E[284]*QE[284] + E[294]*QE[294] + E[304]*QE[304] + E[314]*QE[314] + E[324]*QE[324] + E[334]*QE[334] + E[344]*QE[344] + E[354]*QE[354] + E[364]*QE[364] + E[374]*QE[374] + E[384]*QE[384] + E[394]*QE[394];
+H11[45] = + E[4]*QE[5] + E[14]*QE[15] + E[24]*QE[25] + E[34]*QE[35] + E[44]*QE[45] + E[54]*QE[55] + E[64]*QE[65] + E[74]*QE[75] + E[84]*QE[85] + E[94]*QE[95] + E[104]*QE[105] + E[114]*QE[115] + E[124]*QE[125] + E[134]*QE[135] + E[144]*QE[145] + E[154]*QE[155] + E[164]*QE[165] + E[174]*QE[175] + E[184]*QE[185] + E[194]*QE[195] + E[204]*QE[205] + E[214]*QE[215] + E[224]*QE[225] + E[234]*QE[235] + E[244]*QE[245] + E[254]*QE[255] + E[264]*QE[265] + E[274]*QE[275] + E[284]*QE[285] + E[294]*QE[295] + E[304]*QE[305] + E[314]*QE[315] + E[324]*QE[325] + E[334]*QE[335] + E[344]*QE[345] + E[354]*QE[355] + E[364]*QE[365] + E[374]*QE[375] + E[384]*QE[385] + E[394]*QE[395];
+H11[46] = + E[4]*QE[6] + E[14]*QE[16] + E[24]*QE[26] + E[34]*QE[36] + E[44]*QE[46] + E[54]*QE[56] + E[64]*QE[66] + E[74]*QE[76] + E[84]*QE[86] + E[94]*QE[96] + E[104]*QE[106] + E[114]*QE[116] + E[124]*QE[126] + E[134]*QE[136] + E[144]*QE[146] + E[154]*QE[156] + E[164]*QE[166] + E[174]*QE[176] + E[184]*QE[186] + E[194]*QE[196] + E[204]*QE[206] + E[214]*QE[216] + E[224]*QE[226] + E[234]*QE[236] + E[244]*QE[246] + E[254]*QE[256] + E[264]*QE[266] + E[274]*QE[276] + E[284]*QE[286] + E[294]*QE[296] + E[304]*QE[306] + E[314]*QE[316] + E[324]*QE[326] + E[334]*QE[336] + E[344]*QE[346] + E[354]*QE[356] + E[364]*QE[366] + E[374]*QE[376] + E[384]*QE[386] + E[394]*QE[396];
+H11[47] = + E[4]*QE[7] + E[14]*QE[17] + E[24]*QE[27] + E[34]*QE[37] + E[44]*QE[47] + E[54]*QE[57] + E[64]*QE[67] + E[74]*QE[77] + E[84]*QE[87] + E[94]*QE[97] + E[104]*QE[107] + E[114]*QE[117] + E[124]*QE[127] + E[134]*QE[137] + E[144]*QE[147] + E[154]*QE[157] + E[164]*QE[167] + E[174]*QE[177] + E[184]*QE[187] + E[194]*QE[197] + E[204]*QE[207] + E[214]*QE[217] + E[224]*QE[227] + E[234]*QE[237] + E[244]*QE[247] + E[254]*QE[257] + E[264]*QE[267] + E[274]*QE[277] + E[284]*QE[287] + E[294]*QE[297] + E[304]*QE[307] + E[314]*QE[317] + E[324]*QE[327] + E[334]*QE[337] + E[344]*QE[347] + E[354]*QE[357] + E[364]*QE[367] + E[374]*QE[377] + E[384]*QE[387] + E[394]*QE[397];
+H11[48] = + E[4]*QE[8] + E[14]*QE[18] + E[24]*QE[28] + E[34]*QE[38] + E[44]*QE[48] + E[54]*QE[58] + E[64]*QE[68] + E[74]*QE[78] + E[84]*QE[88] + E[94]*QE[98] + E[104]*QE[108] + E[114]*QE[118] + E[124]*QE[128] + E[134]*QE[138] + E[144]*QE[148] + E[154]*QE[158] + E[164]*QE[168] + E[174]*QE[178] + E[184]*QE[188] + E[194]*QE[198] + E[204]*QE[208] + E[214]*QE[218] + E[224]*QE[228] + E[234]*QE[238] + E[244]*QE[248] + E[254]*QE[258] + E[264]*QE[268] + E[274]*QE[278] + E[284]*QE[288] + E[294]*QE[298] + E[304]*QE[308] + E[314]*QE[318] + E[324]*QE[328] + E[334]*QE[338] + E[344]*QE[348] + E[354]*QE[358] + E[364]*QE[368] + E[374]*QE[378] + E[384]*QE[388] + E[394]*QE[398];
+H11[49] = + E[4]*QE[9] + E[14]*QE[19] + E[24]*QE[29] + E[34]*QE[39] + E[44]*QE[49] + E[54]*QE[59] + E[64]*QE[69] + E[74]*QE[79] + E[84]*QE[89] + E[94]*QE[99] + E[104]*QE[109] + E[114]*QE[119] + E[124]*QE[129] + E[134]*QE[139] + E[144]*QE[149] + E[154]*QE[159] + E[164]*QE[169] + E[174]*QE[179] + E[184]*QE[189] + E[194]*QE[199] + E[204]*QE[209] + E[214]*QE[219] + E[224]*QE[229] + E[234]*QE[239] + E[244]*QE[249] + E[254]*QE[259] + E[264]*QE[269] + E[274]*QE[279] + E[284]*QE[289] + E[294]*QE[299] + E[304]*QE[309] + E[314]*QE[319] + E[324]*QE[329] + E[334]*QE[339] + E[344]*QE[349] + E[354]*QE[359] + E[364]*QE[369] + E[374]*QE[379] + E[384]*QE[389] + E[394]*QE[399];
+H11[50] = + E[5]*QE[0] + E[15]*QE[10] + E[25]*QE[20] + E[35]*QE[30] + E[45]*QE[40] + E[55]*QE[50] + E[65]*QE[60] + E[75]*QE[70] + E[85]*QE[80] + E[95]*QE[90] + E[105]*QE[100] + E[115]*QE[110] + E[125]*QE[120] + E[135]*QE[130] + E[145]*QE[140] + E[155]*QE[150] + E[165]*QE[160] + E[175]*QE[170] + E[185]*QE[180] + E[195]*QE[190] + E[205]*QE[200] + E[215]*QE[210] + E[225]*QE[220] + E[235]*QE[230] + E[245]*QE[240] + E[255]*QE[250] + E[265]*QE[260] + E[275]*QE[270] + E[285]*QE[280] + E[295]*QE[290] + E[305]*QE[300] + E[315]*QE[310] + E[325]*QE[320] + E[335]*QE[330] + E[345]*QE[340] + E[355]*QE[350] + E[365]*QE[360] + E[375]*QE[370] + E[385]*QE[380] + E[395]*QE[390];
+H11[51] = + E[5]*QE[1] + E[15]*QE[11] + E[25]*QE[21] + E[35]*QE[31] + E[45]*QE[41] + E[55]*QE[51] + E[65]*QE[61] + E[75]*QE[71] + E[85]*QE[81] + E[95]*QE[91] + E[105]*QE[101] + E[115]*QE[111] + E[125]*QE[121] + E[135]*QE[131] + E[145]*QE[141] + E[155]*QE[151] + E[165]*QE[161] + E[175]*QE[171] + E[185]*QE[181] + E[195]*QE[191] + E[205]*QE[201] + E[215]*QE[211] + E[225]*QE[221] + E[235]*QE[231] + E[245]*QE[241] + E[255]*QE[251] + E[265]*QE[261] + E[275]*QE[271] + E[285]*QE[281] + E[295]*QE[291] + E[305]*QE[301] + E[315]*QE[311] + E[325]*QE[321] + E[335]*QE[331] + E[345]*QE[341] + E[355]*QE[351] + E[365]*QE[361] + E[375]*QE[371] + E[385]*QE[381] + E[395]*QE[391];
+H11[52] = + E[5]*QE[2] + E[15]*QE[12] + E[25]*QE[22] + E[35]*QE[32] + E[45]*QE[42] + E[55]*QE[52] + E[65]*QE[62] + E[75]*QE[72] + E[85]*QE[82] + E[95]*QE[92] + E[105]*QE[102] + E[115]*QE[112] + E[125]*QE[122] + E[135]*QE[132] + E[145]*QE[142] + E[155]*QE[152] + E[165]*QE[162] + E[175]*QE[172] + E[185]*QE[182] + E[195]*QE[192] + E[205]*QE[202] + E[215]*QE[212] + E[225]*QE[222] + E[235]*QE[232] + E[245]*QE[242] + E[255]*QE[252] + E[265]*QE[262] + E[275]*QE[272] + E[285]*QE[282] + E[295]*QE[292] + E[305]*QE[302] + E[315]*QE[312] + E[325]*QE[322] + E[335]*QE[332] + E[345]*QE[342] + E[355]*QE[352] + E[365]*QE[362] + E[375]*QE[372] + E[385]*QE[382] + E[395]*QE[392];
+H11[53] = + E[5]*QE[3] + E[15]*QE[13] + E[25]*QE[23] + E[35]*QE[33] + E[45]*QE[43] + E[55]*QE[53] + E[65]*QE[63] + E[75]*QE[73] + E[85]*QE[83] + E[95]*QE[93] + E[105]*QE[103] + E[115]*QE[113] + E[125]*QE[123] + E[135]*QE[133] + E[145]*QE[143] + E[155]*QE[153] + E[165]*QE[163] + E[175]*QE[173] + E[185]*QE[183] + E[195]*QE[193] + E[205]*QE[203] + E[215]*QE[213] + E[225]*QE[223] + E[235]*QE[233] + E[245]*QE[243] + E[255]*QE[253] + E[265]*QE[263] + E[275]*QE[273] + E[285]*QE[283] + E[295]*QE[293] + E[305]*QE[303] + E[315]*QE[313] + E[325]*QE[323] + E[335]*QE[333] + E[345]*QE[343] + E[355]*QE[353] + E[365]*QE[363] + E[375]*QE[373] + E[385]*QE[383] + E[395]*QE[393];
+H11[54] = + E[5]*QE[4] + E[15]*QE[14] + E[25]*QE[24] + E[35]*QE[34] + E[45]*QE[44] + E[55]*QE[54] + E[65]*QE[64] + E[75]*QE[74] + E[85]*QE[84] + E[95]*QE[94] + E[105]*QE[104] + E[115]*QE[114] + E[125]*QE[124] + E[135]*QE[134] + E[145]*QE[144] + E[155]*QE[154] + E[165]*QE[164] + E[175]*QE[174] + E[185]*QE[184] + E[195]*QE[194] + E[205]*QE[204] + E[215]*QE[214] + E[225]*QE[224] + E[235]*QE[234] + E[245]*QE[244] + E[255]*QE[254] + E[265]*QE[264] + E[275]*QE[274] + E[285]*QE[284] + E[295]*QE[294] + E[305]*QE[304] + E[315]*QE[314] + E[325]*QE[324] + E[335]*QE[334] + E[345]*QE[344] + E[355]*QE[354] + E[365]*QE[364] + E[375]*QE[374] + E[385]*QE[384] + E[395]*QE[394];
+H11[55] = + E[5]*QE[5] + E[15]*QE[15] + E[25]*QE[25] + E[35]*QE[35] + E[45]*QE[45] + E[55]*QE[55] + E[65]*QE[65] + E[75]*QE[75] + E[85]*QE[85] + E[95]*QE[95] + E[105]*QE[105] + E[115]*QE[115] + E[125]*QE[125] + E[135]*QE[135] + E[145]*QE[145] + E[155]*QE[155] + E[165]*QE[165] + E[175]*QE[175] + E[185]*QE[185] + E[195]*QE[195] + E[205]*QE[205] + E[215]*QE[215] + E[225]*QE[225] + E[235]*QE[235] + E[245]*QE[245] + E[255]*QE[255] + E[265]*QE[265] + E[275]*QE[275] + E[285]*QE[285] + E[295]*QE[295] + E[305]*QE[305] + E[315]*QE[315] + E[325]*QE[325] + E[335]*QE[335] + E[345]*QE[345] + E[355]*QE[355] + E[365]*QE[365] + E[375]*QE[375] + E[385]*QE[385] + E[395]*QE[395];
+H11[56] = + E[5]*QE[6] + E[15]*QE[16] + E[25]*QE[26] + E[35]*QE[36] + E[45]*QE[46] + E[55]*QE[56] + E[65]*QE[66] + E[75]*QE[76] + E[85]*QE[86] + E[95]*QE[96] + E[105]*QE[106] + E[115]*QE[116] + E[125]*QE[126] + E[135]*QE[136] + E[145]*QE[146] + E[155]*QE[156] + E[165]*QE[166] + E[175]*QE[176] + E[185]*QE[186] + E[195]*QE[196] + E[205]*QE[206] + E[215]*QE[216] + E[225]*QE[226] + E[235]*QE[236] + E[245]*QE[246] + E[255]*QE[256] + E[265]*QE[266] + E[275]*QE[276] + E[285]*QE[286] + E[295]*QE[296] + E[305]*QE[306] + E[315]*QE[316] + E[325]*QE[326] + E[335]*QE[336] + E[345]*QE[346] + E[355]*QE[356] + E[365]*QE[366] + E[375]*QE[376] + E[385]*QE[386] + E[395]*QE[396];
+H11[57] = + E[5]*QE[7] + E[15]*QE[17] + E[25]*QE[27] + E[35]*QE[37] + E[45]*QE[47] + E[55]*QE[57] + E[65]*QE[67] + E[75]*QE[77] + E[85]*QE[87] + E[95]*QE[97] + E[105]*QE[107] + E[115]*QE[117] + E[125]*QE[127] + E[135]*QE[137] + E[145]*QE[147] + E[155]*QE[157] + E[165]*QE[167] + E[175]*QE[177] + E[185]*QE[187] + E[195]*QE[197] + E[205]*QE[207] + E[215]*QE[217] + E[225]*QE[227] + E[235]*QE[237] + E[245]*QE[247] + E[255]*QE[257] + E[265]*QE[267] + E[275]*QE[277] + E[285]*QE[287] + E[295]*QE[297] + E[305]*QE[307] + E[315]*QE[317] + E[325]*QE[327] + E[335]*QE[337] + E[345]*QE[347] + E[355]*QE[357] + E[365]*QE[367] + E[375]*QE[377] + E[385]*QE[387] + E[395]*QE[397];
+H11[58] = + E[5]*QE[8] + E[15]*QE[18] + E[25]*QE[28] + E[35]*QE[38] + E[45]*QE[48] + E[55]*QE[58] + E[65]*QE[68] + E[75]*QE[78] + E[85]*QE[88] + E[95]*QE[98] + E[105]*QE[108] + E[115]*QE[118] + E[125]*QE[128] + E[135]*QE[138] + E[145]*QE[148] + E[155]*QE[158] + E[165]*QE[168] + E[175]*QE[178] + E[185]*QE[188] + E[195]*QE[198] + E[205]*QE[208] + E[215]*QE[218] + E[225]*QE[228] + E[235]*QE[238] + E[245]*QE[248] + E[255]*QE[258] + E[265]*QE[268] + E[275]*QE[278] + E[285]*QE[288] + E[295]*QE[298] + E[305]*QE[308] + E[315]*QE[318] + E[325]*QE[328] + E[335]*QE[338] + E[345]*QE[348] + E[355]*QE[358] + E[365]*QE[368] + E[375]*QE[378] + E[385]*QE[388] + E[395]*QE[398];
+H11[59] = + E[5]*QE[9] + E[15]*QE[19] + E[25]*QE[29] + E[35]*QE[39] + E[45]*QE[49] + E[55]*QE[59] + E[65]*QE[69] + E[75]*QE[79] + E[85]*QE[89] + E[95]*QE[99] + E[105]*QE[109] + E[115]*QE[119] + E[125]*QE[129] + E[135]*QE[139] + E[145]*QE[149] + E[155]*QE[159] + E[165]*QE[169] + E[175]*QE[179] + E[185]*QE[189] + E[195]*QE[199] + E[205]*QE[209] + E[215]*QE[219] + E[225]*QE[229] + E[235]*QE[239] + E[245]*QE[249] + E[255]*QE[259] + E[265]*QE[269] + E[275]*QE[279] + E[285]*QE[289] + E[295]*QE[299] + E[305]*QE[309] + E[315]*QE[319] + E[325]*QE[329] + E[335]*QE[339] + E[345]*QE[349] + E[355]*QE[359] + E[365]*QE[369] + E[375]*QE[379] + E[385]*QE[389] + E[395]*QE[399];
+H11[60] = + E[6]*QE[0] + E[16]*QE[10] + E[26]*QE[20] + E[36]*QE[30] + E[46]*QE[40] + E[56]*QE[50] + E[66]*QE[60] + E[76]*QE[70] + E[86]*QE[80] + E[96]*QE[90] + E[106]*QE[100] + E[116]*QE[110] + E[126]*QE[120] + E[136]*QE[130] + E[146]*QE[140] + E[156]*QE[150] + E[166]*QE[160] + E[176]*QE[170] + E[186]*QE[180] + E[196]*QE[190] + E[206]*QE[200] + E[216]*QE[210] + E[226]*QE[220] + E[236]*QE[230] + E[246]*QE[240] + E[256]*QE[250] + E[266]*QE[260] + E[276]*QE[270] + E[286]*QE[280] + E[296]*QE[290] + E[306]*QE[300] + E[316]*QE[310] + E[326]*QE[320] + E[336]*QE[330] + E[346]*QE[340] + E[356]*QE[350] + E[366]*QE[360] + E[376]*QE[370] + E[386]*QE[380] + E[396]*QE[390];
+H11[61] = + E[6]*QE[1] + E[16]*QE[11] + E[26]*QE[21] + E[36]*QE[31] + E[46]*QE[41] + E[56]*QE[51] + E[66]*QE[61] + E[76]*QE[71] + E[86]*QE[81] + E[96]*QE[91] + E[106]*QE[101] + E[116]*QE[111] + E[126]*QE[121] + E[136]*QE[131] + E[146]*QE[141] + E[156]*QE[151] + E[166]*QE[161] + E[176]*QE[171] + E[186]*QE[181] + E[196]*QE[191] + E[206]*QE[201] + E[216]*QE[211] + E[226]*QE[221] + E[236]*QE[231] + E[246]*QE[241] + E[256]*QE[251] + E[266]*QE[261] + E[276]*QE[271] + E[286]*QE[281] + E[296]*QE[291] + E[306]*QE[301] + E[316]*QE[311] + E[326]*QE[321] + E[336]*QE[331] + E[346]*QE[341] + E[356]*QE[351] + E[366]*QE[361] + E[376]*QE[371] + E[386]*QE[381] + E[396]*QE[391];
+H11[62] = + E[6]*QE[2] + E[16]*QE[12] + E[26]*QE[22] + E[36]*QE[32] + E[46]*QE[42] + E[56]*QE[52] + E[66]*QE[62] + E[76]*QE[72] + E[86]*QE[82] + E[96]*QE[92] + E[106]*QE[102] + E[116]*QE[112] + E[126]*QE[122] + E[136]*QE[132] + E[146]*QE[142] + E[156]*QE[152] + E[166]*QE[162] + E[176]*QE[172] + E[186]*QE[182] + E[196]*QE[192] + E[206]*QE[202] + E[216]*QE[212] + E[226]*QE[222] + E[236]*QE[232] + E[246]*QE[242] + E[256]*QE[252] + E[266]*QE[262] + E[276]*QE[272] + E[286]*QE[282] + E[296]*QE[292] + E[306]*QE[302] + E[316]*QE[312] + E[326]*QE[322] + E[336]*QE[332] + E[346]*QE[342] + E[356]*QE[352] + E[366]*QE[362] + E[376]*QE[372] + E[386]*QE[382] + E[396]*QE[392];
+H11[63] = + E[6]*QE[3] + E[16]*QE[13] + E[26]*QE[23] + E[36]*QE[33] + E[46]*QE[43] + E[56]*QE[53] + E[66]*QE[63] + E[76]*QE[73] + E[86]*QE[83] + E[96]*QE[93] + E[106]*QE[103] + E[116]*QE[113] + E[126]*QE[123] + E[136]*QE[133] + E[146]*QE[143] + E[156]*QE[153] + E[166]*QE[163] + E[176]*QE[173] + E[186]*QE[183] + E[196]*QE[193] + E[206]*QE[203] + E[216]*QE[213] + E[226]*QE[223] + E[236]*QE[233] + E[246]*QE[243] + E[256]*QE[253] + E[266]*QE[263] + E[276]*QE[273] + E[286]*QE[283] + E[296]*QE[293] + E[306]*QE[303] + E[316]*QE[313] + E[326]*QE[323] + E[336]*QE[333] + E[346]*QE[343] + E[356]*QE[353] + E[366]*QE[363] + E[376]*QE[373] + E[386]*QE[383] + E[396]*QE[393];
+H11[64] = + E[6]*QE[4] + E[16]*QE[14] + E[26]*QE[24] + E[36]*QE[34] + E[46]*QE[44] + E[56]*QE[54] + E[66]*QE[64] + E[76]*QE[74] + E[86]*QE[84] + E[96]*QE[94] + E[106]*QE[104] + E[116]*QE[114] + E[126]*QE[124] + E[136]*QE[134] + E[146]*QE[144] + E[156]*QE[154] + E[166]*QE[164] + E[176]*QE[174] + E[186]*QE[184] + E[196]*QE[194] + E[206]*QE[204] + E[216]*QE[214] + E[226]*QE[224] + E[236]*QE[234] + E[246]*QE[244] + E[256]*QE[254] + E[266]*QE[264] + E[276]*QE[274] + E[286]*QE[284] + E[296]*QE[294] + E[306]*QE[304] + E[316]*QE[314] + E[326]*QE[324] + E[336]*QE[334] + E[346]*QE[344] + E[356]*QE[354] + E[366]*QE[364] + E[376]*QE[374] + E[386]*QE[384] + E[396]*QE[394];
+H11[65] = + E[6]*QE[5] + E[16]*QE[15] + E[26]*QE[25] + E[36]*QE[35] + E[46]*QE[45] + E[56]*QE[55] + E[66]*QE[65] + E[76]*QE[75] + E[86]*QE[85] + E[96]*QE[95] + E[106]*QE[105] + E[116]*QE[115] + E[126]*QE[125] + E[136]*QE[135] + E[146]*QE[145] + E[156]*QE[155] + E[166]*QE[165] + E[176]*QE[175] + E[186]*QE[185] + E[196]*QE[195] + E[206]*QE[205] + E[216]*QE[215] + E[226]*QE[225] + E[236]*QE[235] + E[246]*QE[245] + E[256]*QE[255] + E[266]*QE[265] + E[276]*QE[275] + E[286]*QE[285] + E[296]*QE[295] + E[306]*QE[305] + E[316]*QE[315] + E[326]*QE[325] + E[336]*QE[335] + E[346]*QE[345] + E[356]*QE[355] + E[366]*QE[365] + E[376]*QE[375] + E[386]*QE[385] + E[396]*QE[395];
+H11[66] = + E[6]*QE[6] + E[16]*QE[16] + E[26]*QE[26] + E[36]*QE[36] + E[46]*QE[46] + E[56]*QE[56] + E[66]*QE[66] + E[76]*QE[76] + E[86]*QE[86] + E[96]*QE[96] + E[106]*QE[106] + E[116]*QE[116] + E[126]*QE[126] + E[136]*QE[136] + E[146]*QE[146] + E[156]*QE[156] + E[166]*QE[166] + E[176]*QE[176] + E[186]*QE[186] + E[196]*QE[196] + E[206]*QE[206] + E[216]*QE[216] + E[226]*QE[226] + E[236]*QE[236] + E[246]*QE[246] + E[256]*QE[256] + E[266]*QE[266] + E[276]*QE[276] + E[286]*QE[286] + E[296]*QE[296] + E[306]*QE[306] + E[316]*QE[316] + E[326]*QE[326] + E[336]*QE[336] + E[346]*QE[346] + E[356]*QE[356] + E[366]*QE[366] + E[376]*QE[376] + E[386]*QE[386] + E[396]*QE[396];
+H11[67] = + E[6]*QE[7] + E[16]*QE[17] + E[26]*QE[27] + E[36]*QE[37] + E[46]*QE[47] + E[56]*QE[57] + E[66]*QE[67] + E[76]*QE[77] + E[86]*QE[87] + E[96]*QE[97] + E[106]*QE[107] + E[116]*QE[117] + E[126]*QE[127] + E[136]*QE[137] + E[146]*QE[147] + E[156]*QE[157] + E[166]*QE[167] + E[176]*QE[177] + E[186]*QE[187] + E[196]*QE[197] + E[206]*QE[207] + E[216]*QE[217] + E[226]*QE[227] + E[236]*QE[237] + E[246]*QE[247] + E[256]*QE[257] + E[266]*QE[267] + E[276]*QE[277] + E[286]*QE[287] + E[296]*QE[297] + E[306]*QE[307] + E[316]*QE[317] + E[326]*QE[327] + E[336]*QE[337] + E[346]*QE[347] + E[356]*QE[357] + E[366]*QE[367] + E[376]*QE[377] + E[386]*QE[387] + E[396]*QE[397];
+H11[68] = + E[6]*QE[8] + E[16]*QE[18] + E[26]*QE[28] + E[36]*QE[38] + E[46]*QE[48] + E[56]*QE[58] + E[66]*QE[68] + E[76]*QE[78] + E[86]*QE[88] + E[96]*QE[98] + E[106]*QE[108] + E[116]*QE[118] + E[126]*QE[128] + E[136]*QE[138] + E[146]*QE[148] + E[156]*QE[158] + E[166]*QE[168] + E[176]*QE[178] + E[186]*QE[188] + E[196]*QE[198] + E[206]*QE[208] + E[216]*QE[218] + E[226]*QE[228] + E[236]*QE[238] + E[246]*QE[248] + E[256]*QE[258] + E[266]*QE[268] + E[276]*QE[278] + E[286]*QE[288] + E[296]*QE[298] + E[306]*QE[308] + E[316]*QE[318] + E[326]*QE[328] + E[336]*QE[338] + E[346]*QE[348] + E[356]*QE[358] + E[366]*QE[368] + E[376]*QE[378] + E[386]*QE[388] + E[396]*QE[398];
+H11[69] = + E[6]*QE[9] + E[16]*QE[19] + E[26]*QE[29] + E[36]*QE[39] + E[46]*QE[49] + E[56]*QE[59] + E[66]*QE[69] + E[76]*QE[79] + E[86]*QE[89] + E[96]*QE[99] + E[106]*QE[109] + E[116]*QE[119] + E[126]*QE[129] + E[136]*QE[139] + E[146]*QE[149] + E[156]*QE[159] + E[166]*QE[169] + E[176]*QE[179] + E[186]*QE[189] + E[196]*QE[199] + E[206]*QE[209] + E[216]*QE[219] + E[226]*QE[229] + E[236]*QE[239] + E[246]*QE[249] + E[256]*QE[259] + E[266]*QE[269] + E[276]*QE[279] + E[286]*QE[289] + E[296]*QE[299] + E[306]*QE[309] + E[316]*QE[319] + E[326]*QE[329] + E[336]*QE[339] + E[346]*QE[349] + E[356]*QE[359] + E[366]*QE[369] + E[376]*QE[379] + E[386]*QE[389] + E[396]*QE[399];
+H11[70] = + E[7]*QE[0] + E[17]*QE[10] + E[27]*QE[20] + E[37]*QE[30] + E[47]*QE[40] + E[57]*QE[50] + E[67]*QE[60] + E[77]*QE[70] + E[87]*QE[80] + E[97]*QE[90] + E[107]*QE[100] + E[117]*QE[110] + E[127]*QE[120] + E[137]*QE[130] + E[147]*QE[140] + E[157]*QE[150] + E[167]*QE[160] + E[177]*QE[170] + E[187]*QE[180] + E[197]*QE[190] + E[207]*QE[200] + E[217]*QE[210] + E[227]*QE[220] + E[237]*QE[230] + E[247]*QE[240] + E[257]*QE[250] + E[267]*QE[260] + E[277]*QE[270] + E[287]*QE[280] + E[297]*QE[290] + E[307]*QE[300] + E[317]*QE[310] + E[327]*QE[320] + E[337]*QE[330] + E[347]*QE[340] + E[357]*QE[350] + E[367]*QE[360] + E[377]*QE[370] + E[387]*QE[380] + E[397]*QE[390];
+H11[71] = + E[7]*QE[1] + E[17]*QE[11] + E[27]*QE[21] + E[37]*QE[31] + E[47]*QE[41] + E[57]*QE[51] + E[67]*QE[61] + E[77]*QE[71] + E[87]*QE[81] + E[97]*QE[91] + E[107]*QE[101] + E[117]*QE[111] + E[127]*QE[121] + E[137]*QE[131] + E[147]*QE[141] + E[157]*QE[151] + E[167]*QE[161] + E[177]*QE[171] + E[187]*QE[181] + E[197]*QE[191] + E[207]*QE[201] + E[217]*QE[211] + E[227]*QE[221] + E[237]*QE[231] + E[247]*QE[241] + E[257]*QE[251] + E[267]*QE[261] + E[277]*QE[271] + E[287]*QE[281] + E[297]*QE[291] + E[307]*QE[301] + E[317]*QE[311] + E[327]*QE[321] + E[337]*QE[331] + E[347]*QE[341] + E[357]*QE[351] + E[367]*QE[361] + E[377]*QE[371] + E[387]*QE[381] + E[397]*QE[391];
+H11[72] = + E[7]*QE[2] + E[17]*QE[12] + E[27]*QE[22] + E[37]*QE[32] + E[47]*QE[42] + E[57]*QE[52] + E[67]*QE[62] + E[77]*QE[72] + E[87]*QE[82] + E[97]*QE[92] + E[107]*QE[102] + E[117]*QE[112] + E[127]*QE[122] + E[137]*QE[132] + E[147]*QE[142] + E[157]*QE[152] + E[167]*QE[162] + E[177]*QE[172] + E[187]*QE[182] + E[197]*QE[192] + E[207]*QE[202] + E[217]*QE[212] + E[227]*QE[222] + E[237]*QE[232] + E[247]*QE[242] + E[257]*QE[252] + E[267]*QE[262] + E[277]*QE[272] + E[287]*QE[282] + E[297]*QE[292] + E[307]*QE[302] + E[317]*QE[312] + E[327]*QE[322] + E[337]*QE[332] + E[347]*QE[342] + E[357]*QE[352] + E[367]*QE[362] + E[377]*QE[372] + E[387]*QE[382] + E[397]*QE[392];
+H11[73] = + E[7]*QE[3] + E[17]*QE[13] + E[27]*QE[23] + E[37]*QE[33] + E[47]*QE[43] + E[57]*QE[53] + E[67]*QE[63] + E[77]*QE[73] + E[87]*QE[83] + E[97]*QE[93] + E[107]*QE[103] + E[117]*QE[113] + E[127]*QE[123] + E[137]*QE[133] + E[147]*QE[143] + E[157]*QE[153] + E[167]*QE[163] + E[177]*QE[173] + E[187]*QE[183] + E[197]*QE[193] + E[207]*QE[203] + E[217]*QE[213] + E[227]*QE[223] + E[237]*QE[233] + E[247]*QE[243] + E[257]*QE[253] + E[267]*QE[263] + E[277]*QE[273] + E[287]*QE[283] + E[297]*QE[293] + E[307]*QE[303] + E[317]*QE[313] + E[327]*QE[323] + E[337]*QE[333] + E[347]*QE[343] + E[357]*QE[353] + E[367]*QE[363] + E[377]*QE[373] + E[387]*QE[383] + E[397]*QE[393];
+H11[74] = + E[7]*QE[4] + E[17]*QE[14] + E[27]*QE[24] + E[37]*QE[34] + E[47]*QE[44] + E[57]*QE[54] + E[67]*QE[64] + E[77]*QE[74] + E[87]*QE[84] + E[97]*QE[94] + E[107]*QE[104] + E[117]*QE[114] + E[127]*QE[124] + E[137]*QE[134] + E[147]*QE[144] + E[157]*QE[154] + E[167]*QE[164] + E[177]*QE[174] + E[187]*QE[184] + E[197]*QE[194] + E[207]*QE[204] + E[217]*QE[214] + E[227]*QE[224] + E[237]*QE[234] + E[247]*QE[244] + E[257]*QE[254] + E[267]*QE[264] + E[277]*QE[274] + E[287]*QE[284] + E[297]*QE[294] + E[307]*QE[304] + E[317]*QE[314] + E[327]*QE[324] + E[337]*QE[334] + E[347]*QE[344] + E[357]*QE[354] + E[367]*QE[364] + E[377]*QE[374] + E[387]*QE[384] + E[397]*QE[394];
+H11[75] = + E[7]*QE[5] + E[17]*QE[15] + E[27]*QE[25] + E[37]*QE[35] + E[47]*QE[45] + E[57]*QE[55] + E[67]*QE[65] + E[77]*QE[75] + E[87]*QE[85] + E[97]*QE[95] + E[107]*QE[105] + E[117]*QE[115] + E[127]*QE[125] + E[137]*QE[135] + E[147]*QE[145] + E[157]*QE[155] + E[167]*QE[165] + E[177]*QE[175] + E[187]*QE[185] + E[197]*QE[195] + E[207]*QE[205] + E[217]*QE[215] + E[227]*QE[225] + E[237]*QE[235] + E[247]*QE[245] + E[257]*QE[255] + E[267]*QE[265] + E[277]*QE[275] + E[287]*QE[285] + E[297]*QE[295] + E[307]*QE[305] + E[317]*QE[315] + E[327]*QE[325] + E[337]*QE[335] + E[347]*QE[345] + E[357]*QE[355] + E[367]*QE[365] + E[377]*QE[375] + E[387]*QE[385] + E[397]*QE[395];
+H11[76] = + E[7]*QE[6] + E[17]*QE[16] + E[27]*QE[26] + E[37]*QE[36] + E[47]*QE[46] + E[57]*QE[56] + E[67]*QE[66] + E[77]*QE[76] + E[87]*QE[86] + E[97]*QE[96] + E[107]*QE[106] + E[117]*QE[116] + E[127]*QE[126] + E[137]*QE[136] + E[147]*QE[146] + E[157]*QE[156] + E[167]*QE[166] + E[177]*QE[176] + E[187]*QE[186] + E[197]*QE[196] + E[207]*QE[206] + E[217]*QE[216] + E[227]*QE[226] + E[237]*QE[236] + E[247]*QE[246] + E[257]*QE[256] + E[267]*QE[266] + E[277]*QE[276] + E[287]*QE[286] + E[297]*QE[296] + E[307]*QE[306] + E[317]*QE[316] + E[327]*QE[326] + E[337]*QE[336] + E[347]*QE[346] + E[357]*QE[356] + E[367]*QE[366] + E[377]*QE[376] + E[387]*QE[386] + E[397]*QE[396];
+H11[77] = + E[7]*QE[7] + E[17]*QE[17] + E[27]*QE[27] + E[37]*QE[37] + E[47]*QE[47] + E[57]*QE[57] + E[67]*QE[67] + E[77]*QE[77] + E[87]*QE[87] + E[97]*QE[97] + E[107]*QE[107] + E[117]*QE[117] + E[127]*QE[127] + E[137]*QE[137] + E[147]*QE[147] + E[157]*QE[157] + E[167]*QE[167] + E[177]*QE[177] + E[187]*QE[187] + E[197]*QE[197] + E[207]*QE[207] + E[217]*QE[217] + E[227]*QE[227] + E[237]*QE[237] + E[247]*QE[247] + E[257]*QE[257] + E[267]*QE[267] + E[277]*QE[277] + E[287]*QE[287] + E[297]*QE[297] + E[307]*QE[307] + E[317]*QE[317] + E[327]*QE[327] + E[337]*QE[337] + E[347]*QE[347] + E[357]*QE[357] + E[367]*QE[367] + E[377]*QE[377] + E[387]*QE[387] + E[397]*QE[397];
+H11[78] = + E[7]*QE[8] + E[17]*QE[18] + E[27]*QE[28] + E[37]*QE[38] + E[47]*QE[48] + E[57]*QE[58] + E[67]*QE[68] + E[77]*QE[78] + E[87]*QE[88] + E[97]*QE[98] + E[107]*QE[108] + E[117]*QE[118] + E[127]*QE[128] + E[137]*QE[138] + E[147]*QE[148] + E[157]*QE[158] + E[167]*QE[168] + E[177]*QE[178] + E[187]*QE[188] + E[197]*QE[198] + E[207]*QE[208] + E[217]*QE[218] + E[227]*QE[228] + E[237]*QE[238] + E[247]*QE[248] + E[257]*QE[258] + E[267]*QE[268] + E[277]*QE[278] + E[287]*QE[288] + E[297]*QE[298] + E[307]*QE[308] + E[317]*QE[318] + E[327]*QE[328] + E[337]*QE[338] + E[347]*QE[348] + E[357]*QE[358] + E[367]*QE[368] + E[377]*QE[378] + E[387]*QE[388] + E[397]*QE[398];
+H11[79] = + E[7]*QE[9] + E[17]*QE[19] + E[27]*QE[29] + E[37]*QE[39] + E[47]*QE[49] + E[57]*QE[59] + E[67]*QE[69] + E[77]*QE[79] + E[87]*QE[89] + E[97]*QE[99] + E[107]*QE[109] + E[117]*QE[119] + E[127]*QE[129] + E[137]*QE[139] + E[147]*QE[149] + E[157]*QE[159] + E[167]*QE[169] + E[177]*QE[179] + E[187]*QE[189] + E[197]*QE[199] + E[207]*QE[209] + E[217]*QE[219] + E[227]*QE[229] + E[237]*QE[239] + E[247]*QE[249] + E[257]*QE[259] + E[267]*QE[269] + E[277]*QE[279] + E[287]*QE[289] + E[297]*QE[299] + E[307]*QE[309] + E[317]*QE[319] + E[327]*QE[329] + E[337]*QE[339] + E[347]*QE[349] + E[357]*QE[359] + E[367]*QE[369] + E[377]*QE[379] + E[387]*QE[389] + E[397]*QE[399];
+H11[80] = + E[8]*QE[0] + E[18]*QE[10] + E[28]*QE[20] + E[38]*QE[30] + E[48]*QE[40] + E[58]*QE[50] + E[68]*QE[60] + E[78]*QE[70] + E[88]*QE[80] + E[98]*QE[90] + E[108]*QE[100] + E[118]*QE[110] + E[128]*QE[120] + E[138]*QE[130] + E[148]*QE[140] + E[158]*QE[150] + E[168]*QE[160] + E[178]*QE[170] + E[188]*QE[180] + E[198]*QE[190] + E[208]*QE[200] + E[218]*QE[210] + E[228]*QE[220] + E[238]*QE[230] + E[248]*QE[240] + E[258]*QE[250] + E[268]*QE[260] + E[278]*QE[270] + E[288]*QE[280] + E[298]*QE[290] + E[308]*QE[300] + E[318]*QE[310] + E[328]*QE[320] + E[338]*QE[330] + E[348]*QE[340] + E[358]*QE[350] + E[368]*QE[360] + E[378]*QE[370] + E[388]*QE[380] + E[398]*QE[390];
+H11[81] = + E[8]*QE[1] + E[18]*QE[11] + E[28]*QE[21] + E[38]*QE[31] + E[48]*QE[41] + E[58]*QE[51] + E[68]*QE[61] + E[78]*QE[71] + E[88]*QE[81] + E[98]*QE[91] + E[108]*QE[101] + E[118]*QE[111] + E[128]*QE[121] + E[138]*QE[131] + E[148]*QE[141] + E[158]*QE[151] + E[168]*QE[161] + E[178]*QE[171] + E[188]*QE[181] + E[198]*QE[191] + E[208]*QE[201] + E[218]*QE[211] + E[228]*QE[221] + E[238]*QE[231] + E[248]*QE[241] + E[258]*QE[251] + E[268]*QE[261] + E[278]*QE[271] + E[288]*QE[281] + E[298]*QE[291] + E[308]*QE[301] + E[318]*QE[311] + E[328]*QE[321] + E[338]*QE[331] + E[348]*QE[341] + E[358]*QE[351] + E[368]*QE[361] + E[378]*QE[371] + E[388]*QE[381] + E[398]*QE[391];
+H11[82] = + E[8]*QE[2] + E[18]*QE[12] + E[28]*QE[22] + E[38]*QE[32] + E[48]*QE[42] + E[58]*QE[52] + E[68]*QE[62] + E[78]*QE[72] + E[88]*QE[82] + E[98]*QE[92] + E[108]*QE[102] + E[118]*QE[112] + E[128]*QE[122] + E[138]*QE[132] + E[148]*QE[142] + E[158]*QE[152] + E[168]*QE[162] + E[178]*QE[172] + E[188]*QE[182] + E[198]*QE[192] + E[208]*QE[202] + E[218]*QE[212] + E[228]*QE[222] + E[238]*QE[232] + E[248]*QE[242] + E[258]*QE[252] + E[268]*QE[262] + E[278]*QE[272] + E[288]*QE[282] + E[298]*QE[292] + E[308]*QE[302] + E[318]*QE[312] + E[328]*QE[322] + E[338]*QE[332] + E[348]*QE[342] + E[358]*QE[352] + E[368]*QE[362] + E[378]*QE[372] + E[388]*QE[382] + E[398]*QE[392];
+H11[83] = + E[8]*QE[3] + E[18]*QE[13] + E[28]*QE[23] + E[38]*QE[33] + E[48]*QE[43] + E[58]*QE[53] + E[68]*QE[63] + E[78]*QE[73] + E[88]*QE[83] + E[98]*QE[93] + E[108]*QE[103] + E[118]*QE[113] + E[128]*QE[123] + E[138]*QE[133] + E[148]*QE[143] + E[158]*QE[153] + E[168]*QE[163] + E[178]*QE[173] + E[188]*QE[183] + E[198]*QE[193] + E[208]*QE[203] + E[218]*QE[213] + E[228]*QE[223] + E[238]*QE[233] + E[248]*QE[243] + E[258]*QE[253] + E[268]*QE[263] + E[278]*QE[273] + E[288]*QE[283] + E[298]*QE[293] + E[308]*QE[303] + E[318]*QE[313] + E[328]*QE[323] + E[338]*QE[333] + E[348]*QE[343] + E[358]*QE[353] + E[368]*QE[363] + E[378]*QE[373] + E[388]*QE[383] + E[398]*QE[393];
+H11[84] = + E[8]*QE[4] + E[18]*QE[14] + E[28]*QE[24] + E[38]*QE[34] + E[48]*QE[44] + E[58]*QE[54] + E[68]*QE[64] + E[78]*QE[74] + E[88]*QE[84] + E[98]*QE[94] + E[108]*QE[104] + E[118]*QE[114] + E[128]*QE[124] + E[138]*QE[134] + E[148]*QE[144] + E[158]*QE[154] + E[168]*QE[164] + E[178]*QE[174] + E[188]*QE[184] + E[198]*QE[194] + E[208]*QE[204] + E[218]*QE[214] + E[228]*QE[224] + E[238]*QE[234] + E[248]*QE[244] + E[258]*QE[254] + E[268]*QE[264] + E[278]*QE[274] + E[288]*QE[284] + E[298]*QE[294] + E[308]*QE[304] + E[318]*QE[314] + E[328]*QE[324] + E[338]*QE[334] + E[348]*QE[344] + E[358]*QE[354] + E[368]*QE[364] + E[378]*QE[374] + E[388]*QE[384] + E[398]*QE[394];
+H11[85] = + E[8]*QE[5] + E[18]*QE[15] + E[28]*QE[25] + E[38]*QE[35] + E[48]*QE[45] + E[58]*QE[55] + E[68]*QE[65] + E[78]*QE[75] + E[88]*QE[85] + E[98]*QE[95] + E[108]*QE[105] + E[118]*QE[115] + E[128]*QE[125] + E[138]*QE[135] + E[148]*QE[145] + E[158]*QE[155] + E[168]*QE[165] + E[178]*QE[175] + E[188]*QE[185] + E[198]*QE[195] + E[208]*QE[205] + E[218]*QE[215] + E[228]*QE[225] + E[238]*QE[235] + E[248]*QE[245] + E[258]*QE[255] + E[268]*QE[265] + E[278]*QE[275] + E[288]*QE[285] + E[298]*QE[295] + E[308]*QE[305] + E[318]*QE[315] + E[328]*QE[325] + E[338]*QE[335] + E[348]*QE[345] + E[358]*QE[355] + E[368]*QE[365] + E[378]*QE[375] + E[388]*QE[385] + E[398]*QE[395];
+H11[86] = + E[8]*QE[6] + E[18]*QE[16] + E[28]*QE[26] + E[38]*QE[36] + E[48]*QE[46] + E[58]*QE[56] + E[68]*QE[66] + E[78]*QE[76] + E[88]*QE[86] + E[98]*QE[96] + E[108]*QE[106] + E[118]*QE[116] + E[128]*QE[126] + E[138]*QE[136] + E[148]*QE[146] + E[158]*QE[156] + E[168]*QE[166] + E[178]*QE[176] + E[188]*QE[186] + E[198]*QE[196] + E[208]*QE[206] + E[218]*QE[216] + E[228]*QE[226] + E[238]*QE[236] + E[248]*QE[246] + E[258]*QE[256] + E[268]*QE[266] + E[278]*QE[276] + E[288]*QE[286] + E[298]*QE[296] + E[308]*QE[306] + E[318]*QE[316] + E[328]*QE[326] + E[338]*QE[336] + E[348]*QE[346] + E[358]*QE[356] + E[368]*QE[366] + E[378]*QE[376] + E[388]*QE[386] + E[398]*QE[396];
+H11[87] = + E[8]*QE[7] + E[18]*QE[17] + E[28]*QE[27] + E[38]*QE[37] + E[48]*QE[47] + E[58]*QE[57] + E[68]*QE[67] + E[78]*QE[77] + E[88]*QE[87] + E[98]*QE[97] + E[108]*QE[107] + E[118]*QE[117] + E[128]*QE[127] + E[138]*QE[137] + E[148]*QE[147] + E[158]*QE[157] + E[168]*QE[167] + E[178]*QE[177] + E[188]*QE[187] + E[198]*QE[197] + E[208]*QE[207] + E[218]*QE[217] + E[228]*QE[227] + E[238]*QE[237] + E[248]*QE[247] + E[258]*QE[257] + E[268]*QE[267] + E[278]*QE[277] + E[288]*QE[287] + E[298]*QE[297] + E[308]*QE[307] + E[318]*QE[317] + E[328]*QE[327] + E[338]*QE[337] + E[348]*QE[347] + E[358]*QE[357] + E[368]*QE[367] + E[378]*QE[377] + E[388]*QE[387] + E[398]*QE[397];
+H11[88] = + E[8]*QE[8] + E[18]*QE[18] + E[28]*QE[28] + E[38]*QE[38] + E[48]*QE[48] + E[58]*QE[58] + E[68]*QE[68] + E[78]*QE[78] + E[88]*QE[88] + E[98]*QE[98] + E[108]*QE[108] + E[118]*QE[118] + E[128]*QE[128] + E[138]*QE[138] + E[148]*QE[148] + E[158]*QE[158] + E[168]*QE[168] + E[178]*QE[178] + E[188]*QE[188] + E[198]*QE[198] + E[208]*QE[208] + E[218]*QE[218] + E[228]*QE[228] + E[238]*QE[238] + E[248]*QE[248] + E[258]*QE[258] + E[268]*QE[268] + E[278]*QE[278] + E[288]*QE[288] + E[298]*QE[298] + E[308]*QE[308] + E[318]*QE[318] + E[328]*QE[328] + E[338]*QE[338] + E[348]*QE[348] + E[358]*QE[358] + E[368]*QE[368] + E[378]*QE[378] + E[388]*QE[388] + E[398]*QE[398];
+H11[89] = + E[8]*QE[9] + E[18]*QE[19] + E[28]*QE[29] + E[38]*QE[39] + E[48]*QE[49] + E[58]*QE[59] + E[68]*QE[69] + E[78]*QE[79] + E[88]*QE[89] + E[98]*QE[99] + E[108]*QE[109] + E[118]*QE[119] + E[128]*QE[129] + E[138]*QE[139] + E[148]*QE[149] + E[158]*QE[159] + E[168]*QE[169] + E[178]*QE[179] + E[188]*QE[189] + E[198]*QE[199] + E[208]*QE[209] + E[218]*QE[219] + E[228]*QE[229] + E[238]*QE[239] + E[248]*QE[249] + E[258]*QE[259] + E[268]*QE[269] + E[278]*QE[279] + E[288]*QE[289] + E[298]*QE[299] + E[308]*QE[309] + E[318]*QE[319] + E[328]*QE[329] + E[338]*QE[339] + E[348]*QE[349] + E[358]*QE[359] + E[368]*QE[369] + E[378]*QE[379] + E[388]*QE[389] + E[398]*QE[399];
+H11[90] = + E[9]*QE[0] + E[19]*QE[10] + E[29]*QE[20] + E[39]*QE[30] + E[49]*QE[40] + E[59]*QE[50] + E[69]*QE[60] + E[79]*QE[70] + E[89]*QE[80] + E[99]*QE[90] + E[109]*QE[100] + E[119]*QE[110] + E[129]*QE[120] + E[139]*QE[130] + E[149]*QE[140] + E[159]*QE[150] + E[169]*QE[160] + E[179]*QE[170] + E[189]*QE[180] + E[199]*QE[190] + E[209]*QE[200] + E[219]*QE[210] + E[229]*QE[220] + E[239]*QE[230] + E[249]*QE[240] + E[259]*QE[250] + E[269]*QE[260] + E[279]*QE[270] + E[289]*QE[280] + E[299]*QE[290] + E[309]*QE[300] + E[319]*QE[310] + E[329]*QE[320] + E[339]*QE[330] + E[349]*QE[340] + E[359]*QE[350] + E[369]*QE[360] + E[379]*QE[370] + E[389]*QE[380] + E[399]*QE[390];
+H11[91] = + E[9]*QE[1] + E[19]*QE[11] + E[29]*QE[21] + E[39]*QE[31] + E[49]*QE[41] + E[59]*QE[51] + E[69]*QE[61] + E[79]*QE[71] + E[89]*QE[81] + E[99]*QE[91] + E[109]*QE[101] + E[119]*QE[111] + E[129]*QE[121] + E[139]*QE[131] + E[149]*QE[141] + E[159]*QE[151] + E[169]*QE[161] + E[179]*QE[171] + E[189]*QE[181] + E[199]*QE[191] + E[209]*QE[201] + E[219]*QE[211] + E[229]*QE[221] + E[239]*QE[231] + E[249]*QE[241] + E[259]*QE[251] + E[269]*QE[261] + E[279]*QE[271] + E[289]*QE[281] + E[299]*QE[291] + E[309]*QE[301] + E[319]*QE[311] + E[329]*QE[321] + E[339]*QE[331] + E[349]*QE[341] + E[359]*QE[351] + E[369]*QE[361] + E[379]*QE[371] + E[389]*QE[381] + E[399]*QE[391];
+H11[92] = + E[9]*QE[2] + E[19]*QE[12] + E[29]*QE[22] + E[39]*QE[32] + E[49]*QE[42] + E[59]*QE[52] + E[69]*QE[62] + E[79]*QE[72] + E[89]*QE[82] + E[99]*QE[92] + E[109]*QE[102] + E[119]*QE[112] + E[129]*QE[122] + E[139]*QE[132] + E[149]*QE[142] + E[159]*QE[152] + E[169]*QE[162] + E[179]*QE[172] + E[189]*QE[182] + E[199]*QE[192] + E[209]*QE[202] + E[219]*QE[212] + E[229]*QE[222] + E[239]*QE[232] + E[249]*QE[242] + E[259]*QE[252] + E[269]*QE[262] + E[279]*QE[272] + E[289]*QE[282] + E[299]*QE[292] + E[309]*QE[302] + E[319]*QE[312] + E[329]*QE[322] + E[339]*QE[332] + E[349]*QE[342] + E[359]*QE[352] + E[369]*QE[362] + E[379]*QE[372] + E[389]*QE[382] + E[399]*QE[392];
+H11[93] = + E[9]*QE[3] + E[19]*QE[13] + E[29]*QE[23] + E[39]*QE[33] + E[49]*QE[43] + E[59]*QE[53] + E[69]*QE[63] + E[79]*QE[73] + E[89]*QE[83] + E[99]*QE[93] + E[109]*QE[103] + E[119]*QE[113] + E[129]*QE[123] + E[139]*QE[133] + E[149]*QE[143] + E[159]*QE[153] + E[169]*QE[163] + E[179]*QE[173] + E[189]*QE[183] + E[199]*QE[193] + E[209]*QE[203] + E[219]*QE[213] + E[229]*QE[223] + E[239]*QE[233] + E[249]*QE[243] + E[259]*QE[253] + E[269]*QE[263] + E[279]*QE[273] + E[289]*QE[283] + E[299]*QE[293] + E[309]*QE[303] + E[319]*QE[313] + E[329]*QE[323] + E[339]*QE[333] + E[349]*QE[343] + E[359]*QE[353] + E[369]*QE[363] + E[379]*QE[373] + E[389]*QE[383] + E[399]*QE[393];
+H11[94] = + E[9]*QE[4] + E[19]*QE[14] + E[29]*QE[24] + E[39]*QE[34] + E[49]*QE[44] + E[59]*QE[54] + E[69]*QE[64] + E[79]*QE[74] + E[89]*QE[84] + E[99]*QE[94] + E[109]*QE[104] + E[119]*QE[114] + E[129]*QE[124] + E[139]*QE[134] + E[149]*QE[144] + E[159]*QE[154] + E[169]*QE[164] + E[179]*QE[174] + E[189]*QE[184] + E[199]*QE[194] + E[209]*QE[204] + E[219]*QE[214] + E[229]*QE[224] + E[239]*QE[234] + E[249]*QE[244] + E[259]*QE[254] + E[269]*QE[264] + E[279]*QE[274] + E[289]*QE[284] + E[299]*QE[294] + E[309]*QE[304] + E[319]*QE[314] + E[329]*QE[324] + E[339]*QE[334] + E[349]*QE[344] + E[359]*QE[354] + E[369]*QE[364] + E[379]*QE[374] + E[389]*QE[384] + E[399]*QE[394];
+H11[95] = + E[9]*QE[5] + E[19]*QE[15] + E[29]*QE[25] + E[39]*QE[35] + E[49]*QE[45] + E[59]*QE[55] + E[69]*QE[65] + E[79]*QE[75] + E[89]*QE[85] + E[99]*QE[95] + E[109]*QE[105] + E[119]*QE[115] + E[129]*QE[125] + E[139]*QE[135] + E[149]*QE[145] + E[159]*QE[155] + E[169]*QE[165] + E[179]*QE[175] + E[189]*QE[185] + E[199]*QE[195] + E[209]*QE[205] + E[219]*QE[215] + E[229]*QE[225] + E[239]*QE[235] + E[249]*QE[245] + E[259]*QE[255] + E[269]*QE[265] + E[279]*QE[275] + E[289]*QE[285] + E[299]*QE[295] + E[309]*QE[305] + E[319]*QE[315] + E[329]*QE[325] + E[339]*QE[335] + E[349]*QE[345] + E[359]*QE[355] + E[369]*QE[365] + E[379]*QE[375] + E[389]*QE[385] + E[399]*QE[395];
+H11[96] = + E[9]*QE[6] + E[19]*QE[16] + E[29]*QE[26] + E[39]*QE[36] + E[49]*QE[46] + E[59]*QE[56] + E[69]*QE[66] + E[79]*QE[76] + E[89]*QE[86] + E[99]*QE[96] + E[109]*QE[106] + E[119]*QE[116] + E[129]*QE[126] + E[139]*QE[136] + E[149]*QE[146] + E[159]*QE[156] + E[169]*QE[166] + E[179]*QE[176] + E[189]*QE[186] + E[199]*QE[196] + E[209]*QE[206] + E[219]*QE[216] + E[229]*QE[226] + E[239]*QE[236] + E[249]*QE[246] + E[259]*QE[256] + E[269]*QE[266] + E[279]*QE[276] + E[289]*QE[286] + E[299]*QE[296] + E[309]*QE[306] + E[319]*QE[316] + E[329]*QE[326] + E[339]*QE[336] + E[349]*QE[346] + E[359]*QE[356] + E[369]*QE[366] + E[379]*QE[376] + E[389]*QE[386] + E[399]*QE[396];
+H11[97] = + E[9]*QE[7] + E[19]*QE[17] + E[29]*QE[27] + E[39]*QE[37] + E[49]*QE[47] + E[59]*QE[57] + E[69]*QE[67] + E[79]*QE[77] + E[89]*QE[87] + E[99]*QE[97] + E[109]*QE[107] + E[119]*QE[117] + E[129]*QE[127] + E[139]*QE[137] + E[149]*QE[147] + E[159]*QE[157] + E[169]*QE[167] + E[179]*QE[177] + E[189]*QE[187] + E[199]*QE[197] + E[209]*QE[207] + E[219]*QE[217] + E[229]*QE[227] + E[239]*QE[237] + E[249]*QE[247] + E[259]*QE[257] + E[269]*QE[267] + E[279]*QE[277] + E[289]*QE[287] + E[299]*QE[297] + E[309]*QE[307] + E[319]*QE[317] + E[329]*QE[327] + E[339]*QE[337] + E[349]*QE[347] + E[359]*QE[357] + E[369]*QE[367] + E[379]*QE[377] + E[389]*QE[387] + E[399]*QE[397];
+H11[98] = + E[9]*QE[8] + E[19]*QE[18] + E[29]*QE[28] + E[39]*QE[38] + E[49]*QE[48] + E[59]*QE[58] + E[69]*QE[68] + E[79]*QE[78] + E[89]*QE[88] + E[99]*QE[98] + E[109]*QE[108] + E[119]*QE[118] + E[129]*QE[128] + E[139]*QE[138] + E[149]*QE[148] + E[159]*QE[158] + E[169]*QE[168] + E[179]*QE[178] + E[189]*QE[188] + E[199]*QE[198] + E[209]*QE[208] + E[219]*QE[218] + E[229]*QE[228] + E[239]*QE[238] + E[249]*QE[248] + E[259]*QE[258] + E[269]*QE[268] + E[279]*QE[278] + E[289]*QE[288] + E[299]*QE[298] + E[309]*QE[308] + E[319]*QE[318] + E[329]*QE[328] + E[339]*QE[338] + E[349]*QE[348] + E[359]*QE[358] + E[369]*QE[368] + E[379]*QE[378] + E[389]*QE[388] + E[399]*QE[398];
+H11[99] = + E[9]*QE[9] + E[19]*QE[19] + E[29]*QE[29] + E[39]*QE[39] + E[49]*QE[49] + E[59]*QE[59] + E[69]*QE[69] + E[79]*QE[79] + E[89]*QE[89] + E[99]*QE[99] + E[109]*QE[109] + E[119]*QE[119] + E[129]*QE[129] + E[139]*QE[139] + E[149]*QE[149] + E[159]*QE[159] + E[169]*QE[169] + E[179]*QE[179] + E[189]*QE[189] + E[199]*QE[199] + E[209]*QE[209] + E[219]*QE[219] + E[229]*QE[229] + E[239]*QE[239] + E[249]*QE[249] + E[259]*QE[259] + E[269]*QE[269] + E[279]*QE[279] + E[289]*QE[289] + E[299]*QE[299] + E[309]*QE[309] + E[319]*QE[319] + E[329]*QE[329] + E[339]*QE[339] + E[349]*QE[349] + E[359]*QE[359] + E[369]*QE[369] + E[379]*QE[379] + E[389]*QE[389] + E[399]*QE[399];
+}
+
+void condense1( int index, real_t* yy )
+{
+acadoWorkspace.Dx[index * 4] = acadoVariables.x[index * 4 + 4] - acadoVariables.xRef[index * 4];
+acadoWorkspace.Dx[index * 4 + 1] = acadoVariables.x[index * 4 + 5] - acadoVariables.xRef[index * 4 + 1];
+acadoWorkspace.Dx[index * 4 + 2] = acadoVariables.x[index * 4 + 6] - acadoVariables.xRef[index * 4 + 2];
+acadoWorkspace.Dx[index * 4 + 3] = acadoVariables.x[index * 4 + 7] - acadoVariables.xRef[index * 4 + 3];
+acadoWorkspace.Du[index] = yy[24] - acadoVariables.uRef[index];
+acadoWorkspace.Gx[0] = yy[4];
+acadoWorkspace.Gx[1] = yy[5];
+acadoWorkspace.Gx[2] = yy[6];
+acadoWorkspace.Gx[3] = yy[7];
+acadoWorkspace.Gx[4] = yy[8];
+acadoWorkspace.Gx[5] = yy[9];
+acadoWorkspace.Gx[6] = yy[10];
+acadoWorkspace.Gx[7] = yy[11];
+acadoWorkspace.Gx[8] = yy[12];
+acadoWorkspace.Gx[9] = yy[13];
+acadoWorkspace.Gx[10] = yy[14];
+acadoWorkspace.Gx[11] = yy[15];
+acadoWorkspace.Gx[12] = yy[16];
+acadoWorkspace.Gx[13] = yy[17];
+acadoWorkspace.Gx[14] = yy[18];
+acadoWorkspace.Gx[15] = yy[19];
+acadoWorkspace.Gu[0] = yy[20];
+acadoWorkspace.Gu[1] = yy[21];
+acadoWorkspace.Gu[2] = yy[22];
+acadoWorkspace.Gu[3] = yy[23];
+if( index != 0 ){
+multiplyCD1( acadoWorkspace.Gx, &(acadoWorkspace.d[ index * 4-4 ]), &(acadoWorkspace.d[ index * 4 ]) );
+acadoWorkspace.d[index * 4] += acadoWorkspace.residuum[index * 4];
+acadoWorkspace.d[index * 4 + 1] += acadoWorkspace.residuum[index * 4 + 1];
+acadoWorkspace.d[index * 4 + 2] += acadoWorkspace.residuum[index * 4 + 2];
+acadoWorkspace.d[index * 4 + 3] += acadoWorkspace.residuum[index * 4 + 3];
+multiplyC( acadoWorkspace.Gx, &(acadoWorkspace.C[ index * 16-16 ]), &(acadoWorkspace.C[ index * 16 ]) );
+multiplyE( acadoWorkspace.Gx, &(acadoWorkspace.E[ index * 40-40 ]), &(acadoWorkspace.E[ index * 40 ]) );
+}
+else{
+acadoWorkspace.d[0] = acadoWorkspace.residuum[0];
+acadoWorkspace.d[1] = acadoWorkspace.residuum[1];
+acadoWorkspace.d[2] = acadoWorkspace.residuum[2];
+acadoWorkspace.d[3] = acadoWorkspace.residuum[3];
+acadoWorkspace.C[0] = acadoWorkspace.Gx[0];
+acadoWorkspace.C[1] = acadoWorkspace.Gx[1];
+acadoWorkspace.C[2] = acadoWorkspace.Gx[2];
+acadoWorkspace.C[3] = acadoWorkspace.Gx[3];
+acadoWorkspace.C[4] = acadoWorkspace.Gx[4];
+acadoWorkspace.C[5] = acadoWorkspace.Gx[5];
+acadoWorkspace.C[6] = acadoWorkspace.Gx[6];
+acadoWorkspace.C[7] = acadoWorkspace.Gx[7];
+acadoWorkspace.C[8] = acadoWorkspace.Gx[8];
+acadoWorkspace.C[9] = acadoWorkspace.Gx[9];
+acadoWorkspace.C[10] = acadoWorkspace.Gx[10];
+acadoWorkspace.C[11] = acadoWorkspace.Gx[11];
+acadoWorkspace.C[12] = acadoWorkspace.Gx[12];
+acadoWorkspace.C[13] = acadoWorkspace.Gx[13];
+acadoWorkspace.C[14] = acadoWorkspace.Gx[14];
+acadoWorkspace.C[15] = acadoWorkspace.Gx[15];
+}
+acadoWorkspace.E[index * 41] = acadoWorkspace.Gu[0];
+acadoWorkspace.E[index * 41 + 10] = acadoWorkspace.Gu[1];
+acadoWorkspace.E[index * 41 + 20] = acadoWorkspace.Gu[2];
+acadoWorkspace.E[index * 41 + 30] = acadoWorkspace.Gu[3];
+}
+
+void condense2(  )
+{
+multiplyQC1( acadoWorkspace.C, acadoWorkspace.QC );
+multiplyQE1( acadoWorkspace.E, acadoWorkspace.QE );
+multiplyQDX1( acadoWorkspace.Dx, acadoWorkspace.QDx );
+multiplyRDU1( acadoWorkspace.Du, acadoWorkspace.RDu );
+multiplyQC1( &(acadoWorkspace.C[ 16 ]), &(acadoWorkspace.QC[ 16 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 40 ]), &(acadoWorkspace.QE[ 40 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 4 ]), &(acadoWorkspace.QDx[ 4 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 1 ]), &(acadoWorkspace.RDu[ 1 ]) );
+multiplyQC1( &(acadoWorkspace.C[ 32 ]), &(acadoWorkspace.QC[ 32 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 80 ]), &(acadoWorkspace.QE[ 80 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 8 ]), &(acadoWorkspace.QDx[ 8 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 2 ]), &(acadoWorkspace.RDu[ 2 ]) );
+multiplyQC1( &(acadoWorkspace.C[ 48 ]), &(acadoWorkspace.QC[ 48 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 120 ]), &(acadoWorkspace.QE[ 120 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 12 ]), &(acadoWorkspace.QDx[ 12 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 3 ]), &(acadoWorkspace.RDu[ 3 ]) );
+multiplyQC1( &(acadoWorkspace.C[ 64 ]), &(acadoWorkspace.QC[ 64 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 160 ]), &(acadoWorkspace.QE[ 160 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 16 ]), &(acadoWorkspace.QDx[ 16 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 4 ]), &(acadoWorkspace.RDu[ 4 ]) );
+multiplyQC1( &(acadoWorkspace.C[ 80 ]), &(acadoWorkspace.QC[ 80 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 200 ]), &(acadoWorkspace.QE[ 200 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 20 ]), &(acadoWorkspace.QDx[ 20 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 5 ]), &(acadoWorkspace.RDu[ 5 ]) );
+multiplyQC1( &(acadoWorkspace.C[ 96 ]), &(acadoWorkspace.QC[ 96 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 240 ]), &(acadoWorkspace.QE[ 240 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 24 ]), &(acadoWorkspace.QDx[ 24 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 6 ]), &(acadoWorkspace.RDu[ 6 ]) );
+multiplyQC1( &(acadoWorkspace.C[ 112 ]), &(acadoWorkspace.QC[ 112 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 280 ]), &(acadoWorkspace.QE[ 280 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 28 ]), &(acadoWorkspace.QDx[ 28 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 7 ]), &(acadoWorkspace.RDu[ 7 ]) );
+multiplyQC1( &(acadoWorkspace.C[ 128 ]), &(acadoWorkspace.QC[ 128 ]) );
+multiplyQE1( &(acadoWorkspace.E[ 320 ]), &(acadoWorkspace.QE[ 320 ]) );
+multiplyQDX1( &(acadoWorkspace.Dx[ 32 ]), &(acadoWorkspace.QDx[ 32 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 8 ]), &(acadoWorkspace.RDu[ 8 ]) );
+multiplyQC2( &(acadoWorkspace.C[ 144 ]), &(acadoWorkspace.QC[ 144 ]) );
+multiplyQE2( &(acadoWorkspace.E[ 360 ]), &(acadoWorkspace.QE[ 360 ]) );
+multiplyQDX2( &(acadoWorkspace.Dx[ 36 ]), &(acadoWorkspace.QDx[ 36 ]) );
+multiplyRDU1( &(acadoWorkspace.Du[ 9 ]), &(acadoWorkspace.RDu[ 9 ]) );
+acadoWorkspace.Dx[0] = acadoWorkspace.Dx[0] + acadoWorkspace.d[0];
+acadoWorkspace.Dx[1] = acadoWorkspace.Dx[1] + acadoWorkspace.d[1];
+acadoWorkspace.Dx[2] = acadoWorkspace.Dx[2] + acadoWorkspace.d[2];
+acadoWorkspace.Dx[3] = acadoWorkspace.Dx[3] + acadoWorkspace.d[3];
+acadoWorkspace.Dx[4] = acadoWorkspace.Dx[4] + acadoWorkspace.d[4];
+acadoWorkspace.Dx[5] = acadoWorkspace.Dx[5] + acadoWorkspace.d[5];
+acadoWorkspace.Dx[6] = acadoWorkspace.Dx[6] + acadoWorkspace.d[6];
+acadoWorkspace.Dx[7] = acadoWorkspace.Dx[7] + acadoWorkspace.d[7];
+acadoWorkspace.Dx[8] = acadoWorkspace.Dx[8] + acadoWorkspace.d[8];
+acadoWorkspace.Dx[9] = acadoWorkspace.Dx[9] + acadoWorkspace.d[9];
+acadoWorkspace.Dx[10] = acadoWorkspace.Dx[10] + acadoWorkspace.d[10];
+acadoWorkspace.Dx[11] = acadoWorkspace.Dx[11] + acadoWorkspace.d[11];
+acadoWorkspace.Dx[12] = acadoWorkspace.Dx[12] + acadoWorkspace.d[12];
+acadoWorkspace.Dx[13] = acadoWorkspace.Dx[13] + acadoWorkspace.d[13];
+acadoWorkspace.Dx[14] = acadoWorkspace.Dx[14] + acadoWorkspace.d[14];
+acadoWorkspace.Dx[15] = acadoWorkspace.Dx[15] + acadoWorkspace.d[15];
+acadoWorkspace.Dx[16] = acadoWorkspace.Dx[16] + acadoWorkspace.d[16];
+acadoWorkspace.Dx[17] = acadoWorkspace.Dx[17] + acadoWorkspace.d[17];
+acadoWorkspace.Dx[18] = acadoWorkspace.Dx[18] + acadoWorkspace.d[18];
+acadoWorkspace.Dx[19] = acadoWorkspace.Dx[19] + acadoWorkspace.d[19];
+acadoWorkspace.Dx[20] = acadoWorkspace.Dx[20] + acadoWorkspace.d[20];
+acadoWorkspace.Dx[21] = acadoWorkspace.Dx[21] + acadoWorkspace.d[21];
+acadoWorkspace.Dx[22] = acadoWorkspace.Dx[22] + acadoWorkspace.d[22];
+acadoWorkspace.Dx[23] = acadoWorkspace.Dx[23] + acadoWorkspace.d[23];
+acadoWorkspace.Dx[24] = acadoWorkspace.Dx[24] + acadoWorkspace.d[24];
+acadoWorkspace.Dx[25] = acadoWorkspace.Dx[25] + acadoWorkspace.d[25];
+acadoWorkspace.Dx[26] = acadoWorkspace.Dx[26] + acadoWorkspace.d[26];
+acadoWorkspace.Dx[27] = acadoWorkspace.Dx[27] + acadoWorkspace.d[27];
+acadoWorkspace.Dx[28] = acadoWorkspace.Dx[28] + acadoWorkspace.d[28];
+acadoWorkspace.Dx[29] = acadoWorkspace.Dx[29] + acadoWorkspace.d[29];
+acadoWorkspace.Dx[30] = acadoWorkspace.Dx[30] + acadoWorkspace.d[30];
+acadoWorkspace.Dx[31] = acadoWorkspace.Dx[31] + acadoWorkspace.d[31];
+acadoWorkspace.Dx[32] = acadoWorkspace.Dx[32] + acadoWorkspace.d[32];
+acadoWorkspace.Dx[33] = acadoWorkspace.Dx[33] + acadoWorkspace.d[33];
+acadoWorkspace.Dx[34] = acadoWorkspace.Dx[34] + acadoWorkspace.d[34];
+acadoWorkspace.Dx[35] = acadoWorkspace.Dx[35] + acadoWorkspace.d[35];
+acadoWorkspace.Dx[36] = acadoWorkspace.Dx[36] + acadoWorkspace.d[36];
+acadoWorkspace.Dx[37] = acadoWorkspace.Dx[37] + acadoWorkspace.d[37];
+acadoWorkspace.Dx[38] = acadoWorkspace.Dx[38] + acadoWorkspace.d[38];
+acadoWorkspace.Dx[39] = acadoWorkspace.Dx[39] + acadoWorkspace.d[39];
+multiplyG1( acadoWorkspace.QE, acadoWorkspace.Dx, acadoWorkspace.g1 );
+acadoWorkspace.g1[0] += acadoWorkspace.RDu[0];
+acadoWorkspace.g1[1] += acadoWorkspace.RDu[1];
+acadoWorkspace.g1[2] += acadoWorkspace.RDu[2];
+acadoWorkspace.g1[3] += acadoWorkspace.RDu[3];
+acadoWorkspace.g1[4] += acadoWorkspace.RDu[4];
+acadoWorkspace.g1[5] += acadoWorkspace.RDu[5];
+acadoWorkspace.g1[6] += acadoWorkspace.RDu[6];
+acadoWorkspace.g1[7] += acadoWorkspace.RDu[7];
+acadoWorkspace.g1[8] += acadoWorkspace.RDu[8];
+acadoWorkspace.g1[9] += acadoWorkspace.RDu[9];
+multiplyH01( acadoWorkspace.C, acadoWorkspace.QE, acadoWorkspace.H01 );
+multiplyH11( acadoWorkspace.E, acadoWorkspace.QE, acadoWorkspace.H11 );
+acadoWorkspace.H11[0] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[11] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[22] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[33] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[44] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[55] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[66] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[77] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[88] += (real_t)1.0000000000000000e+00;
+acadoWorkspace.H11[99] += (real_t)1.0000000000000000e+00;
+}
+
+void expand(  )
+{
+acadoWorkspace.d[0] += + acadoWorkspace.C[0]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[1]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[2]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[3]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[1] += + acadoWorkspace.C[4]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[5]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[6]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[7]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[2] += + acadoWorkspace.C[8]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[9]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[10]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[11]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[3] += + acadoWorkspace.C[12]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[13]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[14]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[15]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[4] += + acadoWorkspace.C[16]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[17]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[18]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[19]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[5] += + acadoWorkspace.C[20]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[21]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[22]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[23]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[6] += + acadoWorkspace.C[24]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[25]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[26]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[27]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[7] += + acadoWorkspace.C[28]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[29]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[30]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[31]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[8] += + acadoWorkspace.C[32]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[33]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[34]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[35]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[9] += + acadoWorkspace.C[36]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[37]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[38]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[39]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[10] += + acadoWorkspace.C[40]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[41]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[42]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[43]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[11] += + acadoWorkspace.C[44]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[45]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[46]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[47]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[12] += + acadoWorkspace.C[48]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[49]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[50]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[51]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[13] += + acadoWorkspace.C[52]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[53]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[54]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[55]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[14] += + acadoWorkspace.C[56]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[57]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[58]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[59]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[15] += + acadoWorkspace.C[60]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[61]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[62]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[63]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[16] += + acadoWorkspace.C[64]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[65]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[66]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[67]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[17] += + acadoWorkspace.C[68]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[69]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[70]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[71]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[18] += + acadoWorkspace.C[72]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[73]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[74]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[75]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[19] += + acadoWorkspace.C[76]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[77]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[78]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[79]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[20] += + acadoWorkspace.C[80]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[81]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[82]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[83]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[21] += + acadoWorkspace.C[84]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[85]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[86]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[87]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[22] += + acadoWorkspace.C[88]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[89]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[90]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[91]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[23] += + acadoWorkspace.C[92]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[93]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[94]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[95]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[24] += + acadoWorkspace.C[96]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[97]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[98]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[99]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[25] += + acadoWorkspace.C[100]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[101]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[102]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[103]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[26] += + acadoWorkspace.C[104]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[105]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[106]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[107]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[27] += + acadoWorkspace.C[108]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[109]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[110]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[111]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[28] += + acadoWorkspace.C[112]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[113]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[114]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[115]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[29] += + acadoWorkspace.C[116]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[117]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[118]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[119]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[30] += + acadoWorkspace.C[120]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[121]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[122]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[123]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[31] += + acadoWorkspace.C[124]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[125]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[126]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[127]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[32] += + acadoWorkspace.C[128]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[129]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[130]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[131]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[33] += + acadoWorkspace.C[132]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[133]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[134]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[135]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[34] += + acadoWorkspace.C[136]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[137]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[138]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[139]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[35] += + acadoWorkspace.C[140]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[141]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[142]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[143]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[36] += + acadoWorkspace.C[144]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[145]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[146]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[147]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[37] += + acadoWorkspace.C[148]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[149]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[150]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[151]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[38] += + acadoWorkspace.C[152]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[153]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[154]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[155]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[39] += + acadoWorkspace.C[156]*acadoWorkspace.deltaX0[0] + acadoWorkspace.C[157]*acadoWorkspace.deltaX0[1] + acadoWorkspace.C[158]*acadoWorkspace.deltaX0[2] + acadoWorkspace.C[159]*acadoWorkspace.deltaX0[3];
+acadoWorkspace.d[0] += + acadoWorkspace.E[0]*vars.x[0] + acadoWorkspace.E[1]*vars.x[1] + acadoWorkspace.E[2]*vars.x[2] + acadoWorkspace.E[3]*vars.x[3] + acadoWorkspace.E[4]*vars.x[4] + acadoWorkspace.E[5]*vars.x[5] + acadoWorkspace.E[6]*vars.x[6] + acadoWorkspace.E[7]*vars.x[7] + acadoWorkspace.E[8]*vars.x[8] + acadoWorkspace.E[9]*vars.x[9];
+acadoWorkspace.d[1] += + acadoWorkspace.E[10]*vars.x[0] + acadoWorkspace.E[11]*vars.x[1] + acadoWorkspace.E[12]*vars.x[2] + acadoWorkspace.E[13]*vars.x[3] + acadoWorkspace.E[14]*vars.x[4] + acadoWorkspace.E[15]*vars.x[5] + acadoWorkspace.E[16]*vars.x[6] + acadoWorkspace.E[17]*vars.x[7] + acadoWorkspace.E[18]*vars.x[8] + acadoWorkspace.E[19]*vars.x[9];
+acadoWorkspace.d[2] += + acadoWorkspace.E[20]*vars.x[0] + acadoWorkspace.E[21]*vars.x[1] + acadoWorkspace.E[22]*vars.x[2] + acadoWorkspace.E[23]*vars.x[3] + acadoWorkspace.E[24]*vars.x[4] + acadoWorkspace.E[25]*vars.x[5] + acadoWorkspace.E[26]*vars.x[6] + acadoWorkspace.E[27]*vars.x[7] + acadoWorkspace.E[28]*vars.x[8] + acadoWorkspace.E[29]*vars.x[9];
+acadoWorkspace.d[3] += + acadoWorkspace.E[30]*vars.x[0] + acadoWorkspace.E[31]*vars.x[1] + acadoWorkspace.E[32]*vars.x[2] + acadoWorkspace.E[33]*vars.x[3] + acadoWorkspace.E[34]*vars.x[4] + acadoWorkspace.E[35]*vars.x[5] + acadoWorkspace.E[36]*vars.x[6] + acadoWorkspace.E[37]*vars.x[7] + acadoWorkspace.E[38]*vars.x[8] + acadoWorkspace.E[39]*vars.x[9];
+acadoWorkspace.d[4] += + acadoWorkspace.E[40]*vars.x[0] + acadoWorkspace.E[41]*vars.x[1] + acadoWorkspace.E[42]*vars.x[2] + acadoWorkspace.E[43]*vars.x[3] + acadoWorkspace.E[44]*vars.x[4] + acadoWorkspace.E[45]*vars.x[5] + acadoWorkspace.E[46]*vars.x[6] + acadoWorkspace.E[47]*vars.x[7] + acadoWorkspace.E[48]*vars.x[8] + acadoWorkspace.E[49]*vars.x[9];
+acadoWorkspace.d[5] += + acadoWorkspace.E[50]*vars.x[0] + acadoWorkspace.E[51]*vars.x[1] + acadoWorkspace.E[52]*vars.x[2] + acadoWorkspace.E[53]*vars.x[3] + acadoWorkspace.E[54]*vars.x[4] + acadoWorkspace.E[55]*vars.x[5] + acadoWorkspace.E[56]*vars.x[6] + acadoWorkspace.E[57]*vars.x[7] + acadoWorkspace.E[58]*vars.x[8] + acadoWorkspace.E[59]*vars.x[9];
+acadoWorkspace.d[6] += + acadoWorkspace.E[60]*vars.x[0] + acadoWorkspace.E[61]*vars.x[1] + acadoWorkspace.E[62]*vars.x[2] + acadoWorkspace.E[63]*vars.x[3] + acadoWorkspace.E[64]*vars.x[4] + acadoWorkspace.E[65]*vars.x[5] + acadoWorkspace.E[66]*vars.x[6] + acadoWorkspace.E[67]*vars.x[7] + acadoWorkspace.E[68]*vars.x[8] + acadoWorkspace.E[69]*vars.x[9];
+acadoWorkspace.d[7] += + acadoWorkspace.E[70]*vars.x[0] + acadoWorkspace.E[71]*vars.x[1] + acadoWorkspace.E[72]*vars.x[2] + acadoWorkspace.E[73]*vars.x[3] + acadoWorkspace.E[74]*vars.x[4] + acadoWorkspace.E[75]*vars.x[5] + acadoWorkspace.E[76]*vars.x[6] + acadoWorkspace.E[77]*vars.x[7] + acadoWorkspace.E[78]*vars.x[8] + acadoWorkspace.E[79]*vars.x[9];
+acadoWorkspace.d[8] += + acadoWorkspace.E[80]*vars.x[0] + acadoWorkspace.E[81]*vars.x[1] + acadoWorkspace.E[82]*vars.x[2] + acadoWorkspace.E[83]*vars.x[3] + acadoWorkspace.E[84]*vars.x[4] + acadoWorkspace.E[85]*vars.x[5] + acadoWorkspace.E[86]*vars.x[6] + acadoWorkspace.E[87]*vars.x[7] + acadoWorkspace.E[88]*vars.x[8] + acadoWorkspace.E[89]*vars.x[9];
+acadoWorkspace.d[9] += + acadoWorkspace.E[90]*vars.x[0] + acadoWorkspace.E[91]*vars.x[1] + acadoWorkspace.E[92]*vars.x[2] + acadoWorkspace.E[93]*vars.x[3] + acadoWorkspace.E[94]*vars.x[4] + acadoWorkspace.E[95]*vars.x[5] + acadoWorkspace.E[96]*vars.x[6] + acadoWorkspace.E[97]*vars.x[7] + acadoWorkspace.E[98]*vars.x[8] + acadoWorkspace.E[99]*vars.x[9];
+acadoWorkspace.d[10] += + acadoWorkspace.E[100]*vars.x[0] + acadoWorkspace.E[101]*vars.x[1] + acadoWorkspace.E[102]*vars.x[2] + acadoWorkspace.E[103]*vars.x[3] + acadoWorkspace.E[104]*vars.x[4] + acadoWorkspace.E[105]*vars.x[5] + acadoWorkspace.E[106]*vars.x[6] + acadoWorkspace.E[107]*vars.x[7] + acadoWorkspace.E[108]*vars.x[8] + acadoWorkspace.E[109]*vars.x[9];
+acadoWorkspace.d[11] += + acadoWorkspace.E[110]*vars.x[0] + acadoWorkspace.E[111]*vars.x[1] + acadoWorkspace.E[112]*vars.x[2] + acadoWorkspace.E[113]*vars.x[3] + acadoWorkspace.E[114]*vars.x[4] + acadoWorkspace.E[115]*vars.x[5] + acadoWorkspace.E[116]*vars.x[6] + acadoWorkspace.E[117]*vars.x[7] + acadoWorkspace.E[118]*vars.x[8] + acadoWorkspace.E[119]*vars.x[9];
+acadoWorkspace.d[12] += + acadoWorkspace.E[120]*vars.x[0] + acadoWorkspace.E[121]*vars.x[1] + acadoWorkspace.E[122]*vars.x[2] + acadoWorkspace.E[123]*vars.x[3] + acadoWorkspace.E[124]*vars.x[4] + acadoWorkspace.E[125]*vars.x[5] + acadoWorkspace.E[126]*vars.x[6] + acadoWorkspace.E[127]*vars.x[7] + acadoWorkspace.E[128]*vars.x[8] + acadoWorkspace.E[129]*vars.x[9];
+acadoWorkspace.d[13] += + acadoWorkspace.E[130]*vars.x[0] + acadoWorkspace.E[131]*vars.x[1] + acadoWorkspace.E[132]*vars.x[2] + acadoWorkspace.E[133]*vars.x[3] + acadoWorkspace.E[134]*vars.x[4] + acadoWorkspace.E[135]*vars.x[5] + acadoWorkspace.E[136]*vars.x[6] + acadoWorkspace.E[137]*vars.x[7] + acadoWorkspace.E[138]*vars.x[8] + acadoWorkspace.E[139]*vars.x[9];
+acadoWorkspace.d[14] += + acadoWorkspace.E[140]*vars.x[0] + acadoWorkspace.E[141]*vars.x[1] + acadoWorkspace.E[142]*vars.x[2] + acadoWorkspace.E[143]*vars.x[3] + acadoWorkspace.E[144]*vars.x[4] + acadoWorkspace.E[145]*vars.x[5] + acadoWorkspace.E[146]*vars.x[6] + acadoWorkspace.E[147]*vars.x[7] + acadoWorkspace.E[148]*vars.x[8] + acadoWorkspace.E[149]*vars.x[9];
+acadoWorkspace.d[15] += + acadoWorkspace.E[150]*vars.x[0] + acadoWorkspace.E[151]*vars.x[1] + acadoWorkspace.E[152]*vars.x[2] + acadoWorkspace.E[153]*vars.x[3] + acadoWorkspace.E[154]*vars.x[4] + acadoWorkspace.E[155]*vars.x[5] + acadoWorkspace.E[156]*vars.x[6] + acadoWorkspace.E[157]*vars.x[7] + acadoWorkspace.E[158]*vars.x[8] + acadoWorkspace.E[159]*vars.x[9];
+acadoWorkspace.d[16] += + acadoWorkspace.E[160]*vars.x[0] + acadoWorkspace.E[161]*vars.x[1] + acadoWorkspace.E[162]*vars.x[2] + acadoWorkspace.E[163]*vars.x[3] + acadoWorkspace.E[164]*vars.x[4] + acadoWorkspace.E[165]*vars.x[5] + acadoWorkspace.E[166]*vars.x[6] + acadoWorkspace.E[167]*vars.x[7] + acadoWorkspace.E[168]*vars.x[8] + acadoWorkspace.E[169]*vars.x[9];
+acadoWorkspace.d[17] += + acadoWorkspace.E[170]*vars.x[0] + acadoWorkspace.E[171]*vars.x[1] + acadoWorkspace.E[172]*vars.x[2] + acadoWorkspace.E[173]*vars.x[3] + acadoWorkspace.E[174]*vars.x[4] + acadoWorkspace.E[175]*vars.x[5] + acadoWorkspace.E[176]*vars.x[6] + acadoWorkspace.E[177]*vars.x[7] + acadoWorkspace.E[178]*vars.x[8] + acadoWorkspace.E[179]*vars.x[9];
+acadoWorkspace.d[18] += + acadoWorkspace.E[180]*vars.x[0] + acadoWorkspace.E[181]*vars.x[1] + acadoWorkspace.E[182]*vars.x[2] + acadoWorkspace.E[183]*vars.x[3] + acadoWorkspace.E[184]*vars.x[4] + acadoWorkspace.E[185]*vars.x[5] + acadoWorkspace.E[186]*vars.x[6] + acadoWorkspace.E[187]*vars.x[7] + acadoWorkspace.E[188]*vars.x[8] + acadoWorkspace.E[189]*vars.x[9];
+acadoWorkspace.d[19] += + acadoWorkspace.E[190]*vars.x[0] + acadoWorkspace.E[191]*vars.x[1] + acadoWorkspace.E[192]*vars.x[2] + acadoWorkspace.E[193]*vars.x[3] + acadoWorkspace.E[194]*vars.x[4] + acadoWorkspace.E[195]*vars.x[5] + acadoWorkspace.E[196]*vars.x[6] + acadoWorkspace.E[197]*vars.x[7] + acadoWorkspace.E[198]*vars.x[8] + acadoWorkspace.E[199]*vars.x[9];
+acadoWorkspace.d[20] += + acadoWorkspace.E[200]*vars.x[0] + acadoWorkspace.E[201]*vars.x[1] + acadoWorkspace.E[202]*vars.x[2] + acadoWorkspace.E[203]*vars.x[3] + acadoWorkspace.E[204]*vars.x[4] + acadoWorkspace.E[205]*vars.x[5] + acadoWorkspace.E[206]*vars.x[6] + acadoWorkspace.E[207]*vars.x[7] + acadoWorkspace.E[208]*vars.x[8] + acadoWorkspace.E[209]*vars.x[9];
+acadoWorkspace.d[21] += + acadoWorkspace.E[210]*vars.x[0] + acadoWorkspace.E[211]*vars.x[1] + acadoWorkspace.E[212]*vars.x[2] + acadoWorkspace.E[213]*vars.x[3] + acadoWorkspace.E[214]*vars.x[4] + acadoWorkspace.E[215]*vars.x[5] + acadoWorkspace.E[216]*vars.x[6] + acadoWorkspace.E[217]*vars.x[7] + acadoWorkspace.E[218]*vars.x[8] + acadoWorkspace.E[219]*vars.x[9];
+acadoWorkspace.d[22] += + acadoWorkspace.E[220]*vars.x[0] + acadoWorkspace.E[221]*vars.x[1] + acadoWorkspace.E[222]*vars.x[2] + acadoWorkspace.E[223]*vars.x[3] + acadoWorkspace.E[224]*vars.x[4] + acadoWorkspace.E[225]*vars.x[5] + acadoWorkspace.E[226]*vars.x[6] + acadoWorkspace.E[227]*vars.x[7] + acadoWorkspace.E[228]*vars.x[8] + acadoWorkspace.E[229]*vars.x[9];
+acadoWorkspace.d[23] += + acadoWorkspace.E[230]*vars.x[0] + acadoWorkspace.E[231]*vars.x[1] + acadoWorkspace.E[232]*vars.x[2] + acadoWorkspace.E[233]*vars.x[3] + acadoWorkspace.E[234]*vars.x[4] + acadoWorkspace.E[235]*vars.x[5] + acadoWorkspace.E[236]*vars.x[6] + acadoWorkspace.E[237]*vars.x[7] + acadoWorkspace.E[238]*vars.x[8] + acadoWorkspace.E[239]*vars.x[9];
+acadoWorkspace.d[24] += + acadoWorkspace.E[240]*vars.x[0] + acadoWorkspace.E[241]*vars.x[1] + acadoWorkspace.E[242]*vars.x[2] + acadoWorkspace.E[243]*vars.x[3] + acadoWorkspace.E[244]*vars.x[4] + acadoWorkspace.E[245]*vars.x[5] + acadoWorkspace.E[246]*vars.x[6] + acadoWorkspace.E[247]*vars.x[7] + acadoWorkspace.E[248]*vars.x[8] + acadoWorkspace.E[249]*vars.x[9];
+acadoWorkspace.d[25] += + acadoWorkspace.E[250]*vars.x[0] + acadoWorkspace.E[251]*vars.x[1] + acadoWorkspace.E[252]*vars.x[2] + acadoWorkspace.E[253]*vars.x[3] + acadoWorkspace.E[254]*vars.x[4] + acadoWorkspace.E[255]*vars.x[5] + acadoWorkspace.E[256]*vars.x[6] + acadoWorkspace.E[257]*vars.x[7] + acadoWorkspace.E[258]*vars.x[8] + acadoWorkspace.E[259]*vars.x[9];
+acadoWorkspace.d[26] += + acadoWorkspace.E[260]*vars.x[0] + acadoWorkspace.E[261]*vars.x[1] + acadoWorkspace.E[262]*vars.x[2] + acadoWorkspace.E[263]*vars.x[3] + acadoWorkspace.E[264]*vars.x[4] + acadoWorkspace.E[265]*vars.x[5] + acadoWorkspace.E[266]*vars.x[6] + acadoWorkspace.E[267]*vars.x[7] + acadoWorkspace.E[268]*vars.x[8] + acadoWorkspace.E[269]*vars.x[9];
+acadoWorkspace.d[27] += + acadoWorkspace.E[270]*vars.x[0] + acadoWorkspace.E[271]*vars.x[1] + acadoWorkspace.E[272]*vars.x[2] + acadoWorkspace.E[273]*vars.x[3] + acadoWorkspace.E[274]*vars.x[4] + acadoWorkspace.E[275]*vars.x[5] + acadoWorkspace.E[276]*vars.x[6] + acadoWorkspace.E[277]*vars.x[7] + acadoWorkspace.E[278]*vars.x[8] + acadoWorkspace.E[279]*vars.x[9];
+acadoWorkspace.d[28] += + acadoWorkspace.E[280]*vars.x[0] + acadoWorkspace.E[281]*vars.x[1] + acadoWorkspace.E[282]*vars.x[2] + acadoWorkspace.E[283]*vars.x[3] + acadoWorkspace.E[284]*vars.x[4] + acadoWorkspace.E[285]*vars.x[5] + acadoWorkspace.E[286]*vars.x[6] + acadoWorkspace.E[287]*vars.x[7] + acadoWorkspace.E[288]*vars.x[8] + acadoWorkspace.E[289]*vars.x[9];
+acadoWorkspace.d[29] += + acadoWorkspace.E[290]*vars.x[0] + acadoWorkspace.E[291]*vars.x[1] + acadoWorkspace.E[292]*vars.x[2] + acadoWorkspace.E[293]*vars.x[3] + acadoWorkspace.E[294]*vars.x[4] + acadoWorkspace.E[295]*vars.x[5] + acadoWorkspace.E[296]*vars.x[6] + acadoWorkspace.E[297]*vars.x[7] + acadoWorkspace.E[298]*vars.x[8] + acadoWorkspace.E[299]*vars.x[9];
+acadoWorkspace.d[30] += + acadoWorkspace.E[300]*vars.x[0] + acadoWorkspace.E[301]*vars.x[1] + acadoWorkspace.E[302]*vars.x[2] + acadoWorkspace.E[303]*vars.x[3] + acadoWorkspace.E[304]*vars.x[4] + acadoWorkspace.E[305]*vars.x[5] + acadoWorkspace.E[306]*vars.x[6] + acadoWorkspace.E[307]*vars.x[7] + acadoWorkspace.E[308]*vars.x[8] + acadoWorkspace.E[309]*vars.x[9];
+acadoWorkspace.d[31] += + acadoWorkspace.E[310]*vars.x[0] + acadoWorkspace.E[311]*vars.x[1] + acadoWorkspace.E[312]*vars.x[2] + acadoWorkspace.E[313]*vars.x[3] + acadoWorkspace.E[314]*vars.x[4] + acadoWorkspace.E[315]*vars.x[5] + acadoWorkspace.E[316]*vars.x[6] + acadoWorkspace.E[317]*vars.x[7] + acadoWorkspace.E[318]*vars.x[8] + acadoWorkspace.E[319]*vars.x[9];
+acadoWorkspace.d[32] += + acadoWorkspace.E[320]*vars.x[0] + acadoWorkspace.E[321]*vars.x[1] + acadoWorkspace.E[322]*vars.x[2] + acadoWorkspace.E[323]*vars.x[3] + acadoWorkspace.E[324]*vars.x[4] + acadoWorkspace.E[325]*vars.x[5] + acadoWorkspace.E[326]*vars.x[6] + acadoWorkspace.E[327]*vars.x[7] + acadoWorkspace.E[328]*vars.x[8] + acadoWorkspace.E[329]*vars.x[9];
+acadoWorkspace.d[33] += + acadoWorkspace.E[330]*vars.x[0] + acadoWorkspace.E[331]*vars.x[1] + acadoWorkspace.E[332]*vars.x[2] + acadoWorkspace.E[333]*vars.x[3] + acadoWorkspace.E[334]*vars.x[4] + acadoWorkspace.E[335]*vars.x[5] + acadoWorkspace.E[336]*vars.x[6] + acadoWorkspace.E[337]*vars.x[7] + acadoWorkspace.E[338]*vars.x[8] + acadoWorkspace.E[339]*vars.x[9];
+acadoWorkspace.d[34] += + acadoWorkspace.E[340]*vars.x[0] + acadoWorkspace.E[341]*vars.x[1] + acadoWorkspace.E[342]*vars.x[2] + acadoWorkspace.E[343]*vars.x[3] + acadoWorkspace.E[344]*vars.x[4] + acadoWorkspace.E[345]*vars.x[5] + acadoWorkspace.E[346]*vars.x[6] + acadoWorkspace.E[347]*vars.x[7] + acadoWorkspace.E[348]*vars.x[8] + acadoWorkspace.E[349]*vars.x[9];
+acadoWorkspace.d[35] += + acadoWorkspace.E[350]*vars.x[0] + acadoWorkspace.E[351]*vars.x[1] + acadoWorkspace.E[352]*vars.x[2] + acadoWorkspace.E[353]*vars.x[3] + acadoWorkspace.E[354]*vars.x[4] + acadoWorkspace.E[355]*vars.x[5] + acadoWorkspace.E[356]*vars.x[6] + acadoWorkspace.E[357]*vars.x[7] + acadoWorkspace.E[358]*vars.x[8] + acadoWorkspace.E[359]*vars.x[9];
+acadoWorkspace.d[36] += + acadoWorkspace.E[360]*vars.x[0] + acadoWorkspace.E[361]*vars.x[1] + acadoWorkspace.E[362]*vars.x[2] + acadoWorkspace.E[363]*vars.x[3] + acadoWorkspace.E[364]*vars.x[4] + acadoWorkspace.E[365]*vars.x[5] + acadoWorkspace.E[366]*vars.x[6] + acadoWorkspace.E[367]*vars.x[7] + acadoWorkspace.E[368]*vars.x[8] + acadoWorkspace.E[369]*vars.x[9];
+acadoWorkspace.d[37] += + acadoWorkspace.E[370]*vars.x[0] + acadoWorkspace.E[371]*vars.x[1] + acadoWorkspace.E[372]*vars.x[2] + acadoWorkspace.E[373]*vars.x[3] + acadoWorkspace.E[374]*vars.x[4] + acadoWorkspace.E[375]*vars.x[5] + acadoWorkspace.E[376]*vars.x[6] + acadoWorkspace.E[377]*vars.x[7] + acadoWorkspace.E[378]*vars.x[8] + acadoWorkspace.E[379]*vars.x[9];
+acadoWorkspace.d[38] += + acadoWorkspace.E[380]*vars.x[0] + acadoWorkspace.E[381]*vars.x[1] + acadoWorkspace.E[382]*vars.x[2] + acadoWorkspace.E[383]*vars.x[3] + acadoWorkspace.E[384]*vars.x[4] + acadoWorkspace.E[385]*vars.x[5] + acadoWorkspace.E[386]*vars.x[6] + acadoWorkspace.E[387]*vars.x[7] + acadoWorkspace.E[388]*vars.x[8] + acadoWorkspace.E[389]*vars.x[9];
+acadoWorkspace.d[39] += + acadoWorkspace.E[390]*vars.x[0] + acadoWorkspace.E[391]*vars.x[1] + acadoWorkspace.E[392]*vars.x[2] + acadoWorkspace.E[393]*vars.x[3] + acadoWorkspace.E[394]*vars.x[4] + acadoWorkspace.E[395]*vars.x[5] + acadoWorkspace.E[396]*vars.x[6] + acadoWorkspace.E[397]*vars.x[7] + acadoWorkspace.E[398]*vars.x[8] + acadoWorkspace.E[399]*vars.x[9];
+acadoVariables.x[4] += acadoWorkspace.d[0];
+acadoVariables.x[5] += acadoWorkspace.d[1];
+acadoVariables.x[6] += acadoWorkspace.d[2];
+acadoVariables.x[7] += acadoWorkspace.d[3];
+acadoVariables.x[8] += acadoWorkspace.d[4];
+acadoVariables.x[9] += acadoWorkspace.d[5];
+acadoVariables.x[10] += acadoWorkspace.d[6];
+acadoVariables.x[11] += acadoWorkspace.d[7];
+acadoVariables.x[12] += acadoWorkspace.d[8];
+acadoVariables.x[13] += acadoWorkspace.d[9];
+acadoVariables.x[14] += acadoWorkspace.d[10];
+acadoVariables.x[15] += acadoWorkspace.d[11];
+acadoVariables.x[16] += acadoWorkspace.d[12];
+acadoVariables.x[17] += acadoWorkspace.d[13];
+acadoVariables.x[18] += acadoWorkspace.d[14];
+acadoVariables.x[19] += acadoWorkspace.d[15];
+acadoVariables.x[20] += acadoWorkspace.d[16];
+acadoVariables.x[21] += acadoWorkspace.d[17];
+acadoVariables.x[22] += acadoWorkspace.d[18];
+acadoVariables.x[23] += acadoWorkspace.d[19];
+acadoVariables.x[24] += acadoWorkspace.d[20];
+acadoVariables.x[25] += acadoWorkspace.d[21];
+acadoVariables.x[26] += acadoWorkspace.d[22];
+acadoVariables.x[27] += acadoWorkspace.d[23];
+acadoVariables.x[28] += acadoWorkspace.d[24];
+acadoVariables.x[29] += acadoWorkspace.d[25];
+acadoVariables.x[30] += acadoWorkspace.d[26];
+acadoVariables.x[31] += acadoWorkspace.d[27];
+acadoVariables.x[32] += acadoWorkspace.d[28];
+acadoVariables.x[33] += acadoWorkspace.d[29];
+acadoVariables.x[34] += acadoWorkspace.d[30];
+acadoVariables.x[35] += acadoWorkspace.d[31];
+acadoVariables.x[36] += acadoWorkspace.d[32];
+acadoVariables.x[37] += acadoWorkspace.d[33];
+acadoVariables.x[38] += acadoWorkspace.d[34];
+acadoVariables.x[39] += acadoWorkspace.d[35];
+acadoVariables.x[40] += acadoWorkspace.d[36];
+acadoVariables.x[41] += acadoWorkspace.d[37];
+acadoVariables.x[42] += acadoWorkspace.d[38];
+acadoVariables.x[43] += acadoWorkspace.d[39];
+}
+
+void setupQP(  )
+{
+int reset;
+int run1;
+acadoWorkspace.E[1] = 0.0000000000000000e+00;
+acadoWorkspace.E[11] = 0.0000000000000000e+00;
+acadoWorkspace.E[21] = 0.0000000000000000e+00;
+acadoWorkspace.E[31] = 0.0000000000000000e+00;
+acadoWorkspace.E[2] = 0.0000000000000000e+00;
+acadoWorkspace.E[12] = 0.0000000000000000e+00;
+acadoWorkspace.E[22] = 0.0000000000000000e+00;
+acadoWorkspace.E[32] = 0.0000000000000000e+00;
+acadoWorkspace.E[3] = 0.0000000000000000e+00;
+acadoWorkspace.E[13] = 0.0000000000000000e+00;
+acadoWorkspace.E[23] = 0.0000000000000000e+00;
+acadoWorkspace.E[33] = 0.0000000000000000e+00;
+acadoWorkspace.E[4] = 0.0000000000000000e+00;
+acadoWorkspace.E[14] = 0.0000000000000000e+00;
+acadoWorkspace.E[24] = 0.0000000000000000e+00;
+acadoWorkspace.E[34] = 0.0000000000000000e+00;
+acadoWorkspace.E[5] = 0.0000000000000000e+00;
+acadoWorkspace.E[15] = 0.0000000000000000e+00;
+acadoWorkspace.E[25] = 0.0000000000000000e+00;
+acadoWorkspace.E[35] = 0.0000000000000000e+00;
+acadoWorkspace.E[6] = 0.0000000000000000e+00;
+acadoWorkspace.E[16] = 0.0000000000000000e+00;
+acadoWorkspace.E[26] = 0.0000000000000000e+00;
+acadoWorkspace.E[36] = 0.0000000000000000e+00;
+acadoWorkspace.E[7] = 0.0000000000000000e+00;
+acadoWorkspace.E[17] = 0.0000000000000000e+00;
+acadoWorkspace.E[27] = 0.0000000000000000e+00;
+acadoWorkspace.E[37] = 0.0000000000000000e+00;
+acadoWorkspace.E[8] = 0.0000000000000000e+00;
+acadoWorkspace.E[18] = 0.0000000000000000e+00;
+acadoWorkspace.E[28] = 0.0000000000000000e+00;
+acadoWorkspace.E[38] = 0.0000000000000000e+00;
+acadoWorkspace.E[9] = 0.0000000000000000e+00;
+acadoWorkspace.E[19] = 0.0000000000000000e+00;
+acadoWorkspace.E[29] = 0.0000000000000000e+00;
+acadoWorkspace.E[39] = 0.0000000000000000e+00;
+acadoWorkspace.E[42] = 0.0000000000000000e+00;
+acadoWorkspace.E[52] = 0.0000000000000000e+00;
+acadoWorkspace.E[62] = 0.0000000000000000e+00;
+acadoWorkspace.E[72] = 0.0000000000000000e+00;
+acadoWorkspace.E[43] = 0.0000000000000000e+00;
+acadoWorkspace.E[53] = 0.0000000000000000e+00;
+acadoWorkspace.E[63] = 0.0000000000000000e+00;
+acadoWorkspace.E[73] = 0.0000000000000000e+00;
+acadoWorkspace.E[44] = 0.0000000000000000e+00;
+acadoWorkspace.E[54] = 0.0000000000000000e+00;
+acadoWorkspace.E[64] = 0.0000000000000000e+00;
+acadoWorkspace.E[74] = 0.0000000000000000e+00;
+acadoWorkspace.E[45] = 0.0000000000000000e+00;
+acadoWorkspace.E[55] = 0.0000000000000000e+00;
+acadoWorkspace.E[65] = 0.0000000000000000e+00;
+acadoWorkspace.E[75] = 0.0000000000000000e+00;
+acadoWorkspace.E[46] = 0.0000000000000000e+00;
+acadoWorkspace.E[56] = 0.0000000000000000e+00;
+acadoWorkspace.E[66] = 0.0000000000000000e+00;
+acadoWorkspace.E[76] = 0.0000000000000000e+00;
+acadoWorkspace.E[47] = 0.0000000000000000e+00;
+acadoWorkspace.E[57] = 0.0000000000000000e+00;
+acadoWorkspace.E[67] = 0.0000000000000000e+00;
+acadoWorkspace.E[77] = 0.0000000000000000e+00;
+acadoWorkspace.E[48] = 0.0000000000000000e+00;
+acadoWorkspace.E[58] = 0.0000000000000000e+00;
+acadoWorkspace.E[68] = 0.0000000000000000e+00;
+acadoWorkspace.E[78] = 0.0000000000000000e+00;
+acadoWorkspace.E[49] = 0.0000000000000000e+00;
+acadoWorkspace.E[59] = 0.0000000000000000e+00;
+acadoWorkspace.E[69] = 0.0000000000000000e+00;
+acadoWorkspace.E[79] = 0.0000000000000000e+00;
+acadoWorkspace.E[83] = 0.0000000000000000e+00;
+acadoWorkspace.E[93] = 0.0000000000000000e+00;
+acadoWorkspace.E[103] = 0.0000000000000000e+00;
+acadoWorkspace.E[113] = 0.0000000000000000e+00;
+acadoWorkspace.E[84] = 0.0000000000000000e+00;
+acadoWorkspace.E[94] = 0.0000000000000000e+00;
+acadoWorkspace.E[104] = 0.0000000000000000e+00;
+acadoWorkspace.E[114] = 0.0000000000000000e+00;
+acadoWorkspace.E[85] = 0.0000000000000000e+00;
+acadoWorkspace.E[95] = 0.0000000000000000e+00;
+acadoWorkspace.E[105] = 0.0000000000000000e+00;
+acadoWorkspace.E[115] = 0.0000000000000000e+00;
+acadoWorkspace.E[86] = 0.0000000000000000e+00;
+acadoWorkspace.E[96] = 0.0000000000000000e+00;
+acadoWorkspace.E[106] = 0.0000000000000000e+00;
+acadoWorkspace.E[116] = 0.0000000000000000e+00;
+acadoWorkspace.E[87] = 0.0000000000000000e+00;
+acadoWorkspace.E[97] = 0.0000000000000000e+00;
+acadoWorkspace.E[107] = 0.0000000000000000e+00;
+acadoWorkspace.E[117] = 0.0000000000000000e+00;
+acadoWorkspace.E[88] = 0.0000000000000000e+00;
+acadoWorkspace.E[98] = 0.0000000000000000e+00;
+acadoWorkspace.E[108] = 0.0000000000000000e+00;
+acadoWorkspace.E[118] = 0.0000000000000000e+00;
+acadoWorkspace.E[89] = 0.0000000000000000e+00;
+acadoWorkspace.E[99] = 0.0000000000000000e+00;
+acadoWorkspace.E[109] = 0.0000000000000000e+00;
+acadoWorkspace.E[119] = 0.0000000000000000e+00;
+acadoWorkspace.E[124] = 0.0000000000000000e+00;
+acadoWorkspace.E[134] = 0.0000000000000000e+00;
+acadoWorkspace.E[144] = 0.0000000000000000e+00;
+acadoWorkspace.E[154] = 0.0000000000000000e+00;
+acadoWorkspace.E[125] = 0.0000000000000000e+00;
+acadoWorkspace.E[135] = 0.0000000000000000e+00;
+acadoWorkspace.E[145] = 0.0000000000000000e+00;
+acadoWorkspace.E[155] = 0.0000000000000000e+00;
+acadoWorkspace.E[126] = 0.0000000000000000e+00;
+acadoWorkspace.E[136] = 0.0000000000000000e+00;
+acadoWorkspace.E[146] = 0.0000000000000000e+00;
+acadoWorkspace.E[156] = 0.0000000000000000e+00;
+acadoWorkspace.E[127] = 0.0000000000000000e+00;
+acadoWorkspace.E[137] = 0.0000000000000000e+00;
+acadoWorkspace.E[147] = 0.0000000000000000e+00;
+acadoWorkspace.E[157] = 0.0000000000000000e+00;
+acadoWorkspace.E[128] = 0.0000000000000000e+00;
+acadoWorkspace.E[138] = 0.0000000000000000e+00;
+acadoWorkspace.E[148] = 0.0000000000000000e+00;
+acadoWorkspace.E[158] = 0.0000000000000000e+00;
+acadoWorkspace.E[129] = 0.0000000000000000e+00;
+acadoWorkspace.E[139] = 0.0000000000000000e+00;
+acadoWorkspace.E[149] = 0.0000000000000000e+00;
+acadoWorkspace.E[159] = 0.0000000000000000e+00;
+acadoWorkspace.E[165] = 0.0000000000000000e+00;
+acadoWorkspace.E[175] = 0.0000000000000000e+00;
+acadoWorkspace.E[185] = 0.0000000000000000e+00;
+acadoWorkspace.E[195] = 0.0000000000000000e+00;
+acadoWorkspace.E[166] = 0.0000000000000000e+00;
+acadoWorkspace.E[176] = 0.0000000000000000e+00;
+acadoWorkspace.E[186] = 0.0000000000000000e+00;
+acadoWorkspace.E[196] = 0.0000000000000000e+00;
+acadoWorkspace.E[167] = 0.0000000000000000e+00;
+acadoWorkspace.E[177] = 0.0000000000000000e+00;
+acadoWorkspace.E[187] = 0.0000000000000000e+00;
+acadoWorkspace.E[197] = 0.0000000000000000e+00;
+acadoWorkspace.E[168] = 0.0000000000000000e+00;
+acadoWorkspace.E[178] = 0.0000000000000000e+00;
+acadoWorkspace.E[188] = 0.0000000000000000e+00;
+acadoWorkspace.E[198] = 0.0000000000000000e+00;
+acadoWorkspace.E[169] = 0.0000000000000000e+00;
+acadoWorkspace.E[179] = 0.0000000000000000e+00;
+acadoWorkspace.E[189] = 0.0000000000000000e+00;
+acadoWorkspace.E[199] = 0.0000000000000000e+00;
+acadoWorkspace.E[206] = 0.0000000000000000e+00;
+acadoWorkspace.E[216] = 0.0000000000000000e+00;
+acadoWorkspace.E[226] = 0.0000000000000000e+00;
+acadoWorkspace.E[236] = 0.0000000000000000e+00;
+acadoWorkspace.E[207] = 0.0000000000000000e+00;
+acadoWorkspace.E[217] = 0.0000000000000000e+00;
+acadoWorkspace.E[227] = 0.0000000000000000e+00;
+acadoWorkspace.E[237] = 0.0000000000000000e+00;
+acadoWorkspace.E[208] = 0.0000000000000000e+00;
+acadoWorkspace.E[218] = 0.0000000000000000e+00;
+acadoWorkspace.E[228] = 0.0000000000000000e+00;
+acadoWorkspace.E[238] = 0.0000000000000000e+00;
+acadoWorkspace.E[209] = 0.0000000000000000e+00;
+acadoWorkspace.E[219] = 0.0000000000000000e+00;
+acadoWorkspace.E[229] = 0.0000000000000000e+00;
+acadoWorkspace.E[239] = 0.0000000000000000e+00;
+acadoWorkspace.E[247] = 0.0000000000000000e+00;
+acadoWorkspace.E[257] = 0.0000000000000000e+00;
+acadoWorkspace.E[267] = 0.0000000000000000e+00;
+acadoWorkspace.E[277] = 0.0000000000000000e+00;
+acadoWorkspace.E[248] = 0.0000000000000000e+00;
+acadoWorkspace.E[258] = 0.0000000000000000e+00;
+acadoWorkspace.E[268] = 0.0000000000000000e+00;
+acadoWorkspace.E[278] = 0.0000000000000000e+00;
+acadoWorkspace.E[249] = 0.0000000000000000e+00;
+acadoWorkspace.E[259] = 0.0000000000000000e+00;
+acadoWorkspace.E[269] = 0.0000000000000000e+00;
+acadoWorkspace.E[279] = 0.0000000000000000e+00;
+acadoWorkspace.E[288] = 0.0000000000000000e+00;
+acadoWorkspace.E[298] = 0.0000000000000000e+00;
+acadoWorkspace.E[308] = 0.0000000000000000e+00;
+acadoWorkspace.E[318] = 0.0000000000000000e+00;
+acadoWorkspace.E[289] = 0.0000000000000000e+00;
+acadoWorkspace.E[299] = 0.0000000000000000e+00;
+acadoWorkspace.E[309] = 0.0000000000000000e+00;
+acadoWorkspace.E[319] = 0.0000000000000000e+00;
+acadoWorkspace.E[329] = 0.0000000000000000e+00;
+acadoWorkspace.E[339] = 0.0000000000000000e+00;
+acadoWorkspace.E[349] = 0.0000000000000000e+00;
+acadoWorkspace.E[359] = 0.0000000000000000e+00;
+
+reset = 1;
+for (run1 = 0; run1 < 10; ++run1)
+{
+acadoWorkspace.state[run1 * 25] = acadoVariables.x[run1 * 4];
+acadoWorkspace.state[run1 * 25 + 1] = acadoVariables.x[run1 * 4 + 1];
+acadoWorkspace.state[run1 * 25 + 2] = acadoVariables.x[run1 * 4 + 2];
+acadoWorkspace.state[run1 * 25 + 3] = acadoVariables.x[run1 * 4 + 3];
+acadoWorkspace.state[run1 * 25 + 24] = acadoVariables.u[run1];
+
+integrate( &(acadoWorkspace.state[ run1 * 25 ]), reset );
+acadoWorkspace.residuum[run1 * 4] = acadoWorkspace.state[run1 * 25] - acadoVariables.x[run1 * 4 + 4];
+acadoWorkspace.residuum[run1 * 4 + 1] = acadoWorkspace.state[run1 * 25 + 1] - acadoVariables.x[run1 * 4 + 5];
+acadoWorkspace.residuum[run1 * 4 + 2] = acadoWorkspace.state[run1 * 25 + 2] - acadoVariables.x[run1 * 4 + 6];
+acadoWorkspace.residuum[run1 * 4 + 3] = acadoWorkspace.state[run1 * 25 + 3] - acadoVariables.x[run1 * 4 + 7];
+}
+
+for (run1 = 0; run1 < 10; ++run1)
+{
+condense1( run1, &(acadoWorkspace.state[ run1 * 25 ]) );
+}
+
+condense2(  );
+}
+
+real_t getObjectiveValue(  )
+{
+real_t tmp;
+/** Row vector of size: 4 */
+real_t tmpDx[ 4 ];
+
+/** Column vector of size: 1 */
+real_t tmpDu[ 1 ];
+
+tmp = 0.0000000000000000e+00;
+
+tmpDx[0] = + acadoWorkspace.Dx[0];
+tmpDx[1] = + acadoWorkspace.Dx[1];
+tmpDx[2] = + acadoWorkspace.Dx[2];
+tmpDx[3] = + acadoWorkspace.Dx[3];
+tmp += + acadoWorkspace.Dx[0]*tmpDx[0] + acadoWorkspace.Dx[1]*tmpDx[1] + acadoWorkspace.Dx[2]*tmpDx[2] + acadoWorkspace.Dx[3]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[4];
+tmpDx[1] = + acadoWorkspace.Dx[5];
+tmpDx[2] = + acadoWorkspace.Dx[6];
+tmpDx[3] = + acadoWorkspace.Dx[7];
+tmp += + acadoWorkspace.Dx[4]*tmpDx[0] + acadoWorkspace.Dx[5]*tmpDx[1] + acadoWorkspace.Dx[6]*tmpDx[2] + acadoWorkspace.Dx[7]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[8];
+tmpDx[1] = + acadoWorkspace.Dx[9];
+tmpDx[2] = + acadoWorkspace.Dx[10];
+tmpDx[3] = + acadoWorkspace.Dx[11];
+tmp += + acadoWorkspace.Dx[8]*tmpDx[0] + acadoWorkspace.Dx[9]*tmpDx[1] + acadoWorkspace.Dx[10]*tmpDx[2] + acadoWorkspace.Dx[11]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[12];
+tmpDx[1] = + acadoWorkspace.Dx[13];
+tmpDx[2] = + acadoWorkspace.Dx[14];
+tmpDx[3] = + acadoWorkspace.Dx[15];
+tmp += + acadoWorkspace.Dx[12]*tmpDx[0] + acadoWorkspace.Dx[13]*tmpDx[1] + acadoWorkspace.Dx[14]*tmpDx[2] + acadoWorkspace.Dx[15]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[16];
+tmpDx[1] = + acadoWorkspace.Dx[17];
+tmpDx[2] = + acadoWorkspace.Dx[18];
+tmpDx[3] = + acadoWorkspace.Dx[19];
+tmp += + acadoWorkspace.Dx[16]*tmpDx[0] + acadoWorkspace.Dx[17]*tmpDx[1] + acadoWorkspace.Dx[18]*tmpDx[2] + acadoWorkspace.Dx[19]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[20];
+tmpDx[1] = + acadoWorkspace.Dx[21];
+tmpDx[2] = + acadoWorkspace.Dx[22];
+tmpDx[3] = + acadoWorkspace.Dx[23];
+tmp += + acadoWorkspace.Dx[20]*tmpDx[0] + acadoWorkspace.Dx[21]*tmpDx[1] + acadoWorkspace.Dx[22]*tmpDx[2] + acadoWorkspace.Dx[23]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[24];
+tmpDx[1] = + acadoWorkspace.Dx[25];
+tmpDx[2] = + acadoWorkspace.Dx[26];
+tmpDx[3] = + acadoWorkspace.Dx[27];
+tmp += + acadoWorkspace.Dx[24]*tmpDx[0] + acadoWorkspace.Dx[25]*tmpDx[1] + acadoWorkspace.Dx[26]*tmpDx[2] + acadoWorkspace.Dx[27]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[28];
+tmpDx[1] = + acadoWorkspace.Dx[29];
+tmpDx[2] = + acadoWorkspace.Dx[30];
+tmpDx[3] = + acadoWorkspace.Dx[31];
+tmp += + acadoWorkspace.Dx[28]*tmpDx[0] + acadoWorkspace.Dx[29]*tmpDx[1] + acadoWorkspace.Dx[30]*tmpDx[2] + acadoWorkspace.Dx[31]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[32];
+tmpDx[1] = + acadoWorkspace.Dx[33];
+tmpDx[2] = + acadoWorkspace.Dx[34];
+tmpDx[3] = + acadoWorkspace.Dx[35];
+tmp += + acadoWorkspace.Dx[32]*tmpDx[0] + acadoWorkspace.Dx[33]*tmpDx[1] + acadoWorkspace.Dx[34]*tmpDx[2] + acadoWorkspace.Dx[35]*tmpDx[3];
+tmpDx[0] = + acadoWorkspace.Dx[36];
+tmpDx[1] = + acadoWorkspace.Dx[37];
+tmpDx[2] = + acadoWorkspace.Dx[38];
+tmpDx[3] = + acadoWorkspace.Dx[39];
+tmp += + acadoWorkspace.Dx[36]*tmpDx[0] + acadoWorkspace.Dx[37]*tmpDx[1] + acadoWorkspace.Dx[38]*tmpDx[2] + acadoWorkspace.Dx[39]*tmpDx[3];
+
+tmpDu[0] = + acadoWorkspace.Du[0];
+tmp += + acadoWorkspace.Du[0]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[1];
+tmp += + acadoWorkspace.Du[1]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[2];
+tmp += + acadoWorkspace.Du[2]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[3];
+tmp += + acadoWorkspace.Du[3]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[4];
+tmp += + acadoWorkspace.Du[4]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[5];
+tmp += + acadoWorkspace.Du[5]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[6];
+tmp += + acadoWorkspace.Du[6]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[7];
+tmp += + acadoWorkspace.Du[7]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[8];
+tmp += + acadoWorkspace.Du[8]*tmpDu[0];
+tmpDu[0] = + acadoWorkspace.Du[9];
+tmp += + acadoWorkspace.Du[9]*tmpDu[0];
+
+tmp = + tmp*(real_t)5.0000000000000000e-01;
+return tmp;
+}
+
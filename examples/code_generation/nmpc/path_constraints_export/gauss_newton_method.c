@@ -0,0 +1,539 @@
+/*
+ *    This file was auto-generated by ACADO Code Generation Tool.
+ *
+ *    ACADO Code Generation tool is a sub-package of ACADO toolkit --
+ *    A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008 - 2013 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov and Rien Quirynen.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+#include "acado.h"
+
+
+void evaluatePathConstraints( real_t *acado_x, real_t *acado_f ){
+real_t *acado_xd = acado_x;
+real_t *acado_u  = acado_x + 4;
+
+/* COMPUTE INTERMEDIATE STATES: */
+/* ---------------------------- */
+
+/* COMPUTE OUTPUT: */
+/* --------------- */
+acado_f[0] = (acado_xd[1]+(((real_t)(0.5)*acado_u[0])*(cos(acado_xd[2]))));
+acado_f[1] = (real_t)(0.);
+acado_f[2] = (real_t)(1.);
+acado_f[3] = (((real_t)(0.5)*acado_u[0])*((real_t)(-1.)*(sin(acado_xd[2]))));
+acado_f[4] = (real_t)(0.);
+acado_f[5] = ((cos(acado_xd[2]))*(real_t)(0.5));
+}
+
+void condensePathConstraints(  )
+{
+acadoWorkspace.conValueIn[0] = acadoVariables.x[0];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[1];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[2];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[3];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[0];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[0] = acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[0] = acadoWorkspace.conValueOut[1];
+acadoWorkspace.conHxC[1] = acadoWorkspace.conValueOut[2];
+acadoWorkspace.conHxC[2] = acadoWorkspace.conValueOut[3];
+acadoWorkspace.conHxC[3] = acadoWorkspace.conValueOut[4];
+params.A[0] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[4];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[5];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[6];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[7];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[1];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[1] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[0] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[1] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[2] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[3] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[4] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[0] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[4] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[8] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[12];
+acadoWorkspace.conHxC[5] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[1] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[5] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[9] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[13];
+acadoWorkspace.conHxC[6] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[2] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[6] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[10] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[14];
+acadoWorkspace.conHxC[7] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[3] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[7] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[11] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[15];
+params.A[10] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[0] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[10] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[20] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[30];
+params.A[11] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[8];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[9];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[10];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[11];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[2];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[2] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[4] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[5] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[6] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[7] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[8] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[16] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[20] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[24] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[28];
+acadoWorkspace.conHxC[9] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[17] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[21] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[25] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[29];
+acadoWorkspace.conHxC[10] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[18] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[22] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[26] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[30];
+acadoWorkspace.conHxC[11] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[19] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[23] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[27] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[31];
+params.A[20] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[40] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[50] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[60] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[70];
+params.A[21] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[41] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[51] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[61] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[71];
+params.A[22] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[12];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[13];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[14];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[15];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[3];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[3] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[8] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[9] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[10] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[11] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[12] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[32] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[36] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[40] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[44];
+acadoWorkspace.conHxC[13] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[33] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[37] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[41] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[45];
+acadoWorkspace.conHxC[14] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[34] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[38] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[42] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[46];
+acadoWorkspace.conHxC[15] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[35] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[39] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[43] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[47];
+params.A[30] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[80] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[90] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[100] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[110];
+params.A[31] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[81] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[91] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[101] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[111];
+params.A[32] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[82] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[92] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[102] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[112];
+params.A[33] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[16];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[17];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[18];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[19];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[4];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[4] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[12] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[13] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[14] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[15] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[16] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[48] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[52] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[56] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[60];
+acadoWorkspace.conHxC[17] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[49] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[53] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[57] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[61];
+acadoWorkspace.conHxC[18] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[50] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[54] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[58] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[62];
+acadoWorkspace.conHxC[19] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[51] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[55] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[59] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[63];
+params.A[40] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[120] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[130] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[140] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[150];
+params.A[41] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[121] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[131] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[141] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[151];
+params.A[42] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[122] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[132] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[142] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[152];
+params.A[43] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[123] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[133] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[143] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[153];
+params.A[44] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[20];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[21];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[22];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[23];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[5];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[5] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[16] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[17] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[18] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[19] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[20] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[64] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[68] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[72] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[76];
+acadoWorkspace.conHxC[21] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[65] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[69] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[73] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[77];
+acadoWorkspace.conHxC[22] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[66] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[70] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[74] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[78];
+acadoWorkspace.conHxC[23] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[67] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[71] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[75] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[79];
+params.A[50] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[160] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[170] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[180] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[190];
+params.A[51] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[161] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[171] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[181] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[191];
+params.A[52] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[162] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[172] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[182] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[192];
+params.A[53] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[163] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[173] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[183] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[193];
+params.A[54] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[164] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[174] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[184] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[194];
+params.A[55] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[24];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[25];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[26];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[27];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[6];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[6] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[20] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[21] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[22] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[23] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[24] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[80] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[84] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[88] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[92];
+acadoWorkspace.conHxC[25] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[81] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[85] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[89] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[93];
+acadoWorkspace.conHxC[26] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[82] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[86] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[90] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[94];
+acadoWorkspace.conHxC[27] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[83] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[87] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[91] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[95];
+params.A[60] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[200] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[210] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[220] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[230];
+params.A[61] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[201] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[211] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[221] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[231];
+params.A[62] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[202] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[212] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[222] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[232];
+params.A[63] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[203] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[213] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[223] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[233];
+params.A[64] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[204] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[214] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[224] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[234];
+params.A[65] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[205] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[215] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[225] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[235];
+params.A[66] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[28];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[29];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[30];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[31];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[7];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[7] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[24] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[25] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[26] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[27] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[28] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[96] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[100] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[104] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[108];
+acadoWorkspace.conHxC[29] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[97] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[101] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[105] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[109];
+acadoWorkspace.conHxC[30] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[98] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[102] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[106] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[110];
+acadoWorkspace.conHxC[31] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[99] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[103] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[107] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[111];
+params.A[70] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[240] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[250] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[260] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[270];
+params.A[71] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[241] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[251] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[261] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[271];
+params.A[72] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[242] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[252] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[262] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[272];
+params.A[73] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[243] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[253] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[263] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[273];
+params.A[74] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[244] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[254] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[264] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[274];
+params.A[75] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[245] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[255] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[265] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[275];
+params.A[76] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[246] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[256] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[266] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[276];
+params.A[77] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[32];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[33];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[34];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[35];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[8];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[8] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[28] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[29] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[30] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[31] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[32] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[112] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[116] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[120] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[124];
+acadoWorkspace.conHxC[33] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[113] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[117] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[121] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[125];
+acadoWorkspace.conHxC[34] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[114] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[118] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[122] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[126];
+acadoWorkspace.conHxC[35] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[115] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[119] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[123] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[127];
+params.A[80] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[280] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[290] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[300] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[310];
+params.A[81] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[281] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[291] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[301] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[311];
+params.A[82] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[282] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[292] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[302] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[312];
+params.A[83] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[283] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[293] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[303] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[313];
+params.A[84] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[284] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[294] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[304] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[314];
+params.A[85] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[285] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[295] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[305] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[315];
+params.A[86] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[286] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[296] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[306] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[316];
+params.A[87] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[287] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[297] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[307] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[317];
+params.A[88] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[36];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[37];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[38];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[39];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[9];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[9] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[32] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[33] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[34] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[35] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[36] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[128] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[132] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[136] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[140];
+acadoWorkspace.conHxC[37] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[129] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[133] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[137] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[141];
+acadoWorkspace.conHxC[38] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[130] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[134] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[138] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[142];
+acadoWorkspace.conHxC[39] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[131] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[135] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[139] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[143];
+params.A[90] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[320] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[330] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[340] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[350];
+params.A[91] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[321] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[331] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[341] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[351];
+params.A[92] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[322] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[332] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[342] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[352];
+params.A[93] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[323] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[333] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[343] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[353];
+params.A[94] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[324] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[334] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[344] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[354];
+params.A[95] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[325] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[335] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[345] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[355];
+params.A[96] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[326] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[336] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[346] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[356];
+params.A[97] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[327] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[337] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[347] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[357];
+params.A[98] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[328] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[338] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[348] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[358];
+params.A[99] = acadoWorkspace.conValueOut[5];
+
+acadoWorkspace.conValueIn[0] = acadoVariables.x[40];
+acadoWorkspace.conValueIn[1] = acadoVariables.x[41];
+acadoWorkspace.conValueIn[2] = acadoVariables.x[42];
+acadoWorkspace.conValueIn[3] = acadoVariables.x[43];
+acadoWorkspace.conValueIn[4] = acadoVariables.u[9];
+evaluatePathConstraints( acadoWorkspace.conValueIn, acadoWorkspace.conValueOut );
+acadoWorkspace.conRes[10] = - acadoWorkspace.conValueOut[1]*acadoWorkspace.d[36] - acadoWorkspace.conValueOut[2]*acadoWorkspace.d[37] - acadoWorkspace.conValueOut[3]*acadoWorkspace.d[38] - acadoWorkspace.conValueOut[4]*acadoWorkspace.d[39] + acadoWorkspace.conValueOut[0];
+acadoWorkspace.conHxC[40] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[144] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[148] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[152] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[156];
+acadoWorkspace.conHxC[41] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[145] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[149] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[153] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[157];
+acadoWorkspace.conHxC[42] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[146] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[150] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[154] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[158];
+acadoWorkspace.conHxC[43] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.C[147] + acadoWorkspace.conValueOut[2]*acadoWorkspace.C[151] + acadoWorkspace.conValueOut[3]*acadoWorkspace.C[155] + acadoWorkspace.conValueOut[4]*acadoWorkspace.C[159];
+params.A[100] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[360] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[370] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[380] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[390];
+params.A[101] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[361] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[371] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[381] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[391];
+params.A[102] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[362] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[372] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[382] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[392];
+params.A[103] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[363] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[373] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[383] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[393];
+params.A[104] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[364] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[374] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[384] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[394];
+params.A[105] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[365] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[375] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[385] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[395];
+params.A[106] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[366] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[376] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[386] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[396];
+params.A[107] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[367] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[377] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[387] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[397];
+params.A[108] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[368] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[378] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[388] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[398];
+params.A[109] = + acadoWorkspace.conValueOut[1]*acadoWorkspace.E[369] + acadoWorkspace.conValueOut[2]*acadoWorkspace.E[379] + acadoWorkspace.conValueOut[3]*acadoWorkspace.E[389] + acadoWorkspace.conValueOut[4]*acadoWorkspace.E[399];
+params.A[109] += acadoWorkspace.conValueOut[5];
+
+}
+
+void preparationStep(  )
+{
+setupQP(  );
+condensePathConstraints(  );
+}
+
+void initialValueEmbedding(  )
+{
+params.lb[0] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[0];
+params.lb[1] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[1];
+params.lb[2] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[2];
+params.lb[3] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[3];
+params.lb[4] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[4];
+params.lb[5] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[5];
+params.lb[6] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[6];
+params.lb[7] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[7];
+params.lb[8] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[8];
+params.lb[9] = (real_t)-1.0000000000000000e+00 - acadoVariables.u[9];
+params.ub[0] = (real_t)1.0000000000000000e+00 - acadoVariables.u[0];
+params.ub[1] = (real_t)1.0000000000000000e+00 - acadoVariables.u[1];
+params.ub[2] = (real_t)1.0000000000000000e+00 - acadoVariables.u[2];
+params.ub[3] = (real_t)1.0000000000000000e+00 - acadoVariables.u[3];
+params.ub[4] = (real_t)1.0000000000000000e+00 - acadoVariables.u[4];
+params.ub[5] = (real_t)1.0000000000000000e+00 - acadoVariables.u[5];
+params.ub[6] = (real_t)1.0000000000000000e+00 - acadoVariables.u[6];
+params.ub[7] = (real_t)1.0000000000000000e+00 - acadoVariables.u[7];
+params.ub[8] = (real_t)1.0000000000000000e+00 - acadoVariables.u[8];
+params.ub[9] = (real_t)1.0000000000000000e+00 - acadoVariables.u[9];
+params.g[0] = + acadoWorkspace.H01[0]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[10]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[20]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[30]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[0];
+params.g[1] = + acadoWorkspace.H01[1]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[11]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[21]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[31]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[1];
+params.g[2] = + acadoWorkspace.H01[2]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[12]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[22]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[32]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[2];
+params.g[3] = + acadoWorkspace.H01[3]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[13]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[23]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[33]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[3];
+params.g[4] = + acadoWorkspace.H01[4]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[14]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[24]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[34]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[4];
+params.g[5] = + acadoWorkspace.H01[5]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[15]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[25]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[35]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[5];
+params.g[6] = + acadoWorkspace.H01[6]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[16]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[26]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[36]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[6];
+params.g[7] = + acadoWorkspace.H01[7]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[17]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[27]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[37]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[7];
+params.g[8] = + acadoWorkspace.H01[8]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[18]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[28]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[38]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[8];
+params.g[9] = + acadoWorkspace.H01[9]*acadoWorkspace.deltaX0[0] + acadoWorkspace.H01[19]*acadoWorkspace.deltaX0[1] + acadoWorkspace.H01[29]*acadoWorkspace.deltaX0[2] + acadoWorkspace.H01[39]*acadoWorkspace.deltaX0[3] + acadoWorkspace.g1[9];
+
+params.lbA[0] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[0];
+params.lbA[1] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[1];
+params.lbA[2] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[2];
+params.lbA[3] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[3];
+params.lbA[4] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[4];
+params.lbA[5] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[5];
+params.lbA[6] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[6];
+params.lbA[7] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[7];
+params.lbA[8] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[8];
+params.lbA[9] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[9];
+params.lbA[10] = (real_t)-4.0000000000000002e-01 - acadoWorkspace.conRes[10];
+params.ubA[0] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[0];
+params.ubA[1] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[1];
+params.ubA[2] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[2];
+params.ubA[3] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[3];
+params.ubA[4] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[4];
+params.ubA[5] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[5];
+params.ubA[6] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[6];
+params.ubA[7] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[7];
+params.ubA[8] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[8];
+params.ubA[9] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[9];
+params.ubA[10] = (real_t)4.0000000000000002e-01 - acadoWorkspace.conRes[10];
+params.lbA[0] -= + acadoWorkspace.conHxC[0]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[1]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[2]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[3]*acadoWorkspace.deltaX0[3];
+params.lbA[1] -= + acadoWorkspace.conHxC[4]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[5]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[6]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[7]*acadoWorkspace.deltaX0[3];
+params.lbA[2] -= + acadoWorkspace.conHxC[8]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[9]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[10]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[11]*acadoWorkspace.deltaX0[3];
+params.lbA[3] -= + acadoWorkspace.conHxC[12]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[13]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[14]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[15]*acadoWorkspace.deltaX0[3];
+params.lbA[4] -= + acadoWorkspace.conHxC[16]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[17]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[18]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[19]*acadoWorkspace.deltaX0[3];
+params.lbA[5] -= + acadoWorkspace.conHxC[20]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[21]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[22]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[23]*acadoWorkspace.deltaX0[3];
+params.lbA[6] -= + acadoWorkspace.conHxC[24]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[25]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[26]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[27]*acadoWorkspace.deltaX0[3];
+params.lbA[7] -= + acadoWorkspace.conHxC[28]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[29]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[30]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[31]*acadoWorkspace.deltaX0[3];
+params.lbA[8] -= + acadoWorkspace.conHxC[32]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[33]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[34]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[35]*acadoWorkspace.deltaX0[3];
+params.lbA[9] -= + acadoWorkspace.conHxC[36]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[37]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[38]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[39]*acadoWorkspace.deltaX0[3];
+params.lbA[10] -= + acadoWorkspace.conHxC[40]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[41]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[42]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[43]*acadoWorkspace.deltaX0[3];
+params.ubA[0] -= + acadoWorkspace.conHxC[0]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[1]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[2]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[3]*acadoWorkspace.deltaX0[3];
+params.ubA[1] -= + acadoWorkspace.conHxC[4]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[5]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[6]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[7]*acadoWorkspace.deltaX0[3];
+params.ubA[2] -= + acadoWorkspace.conHxC[8]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[9]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[10]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[11]*acadoWorkspace.deltaX0[3];
+params.ubA[3] -= + acadoWorkspace.conHxC[12]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[13]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[14]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[15]*acadoWorkspace.deltaX0[3];
+params.ubA[4] -= + acadoWorkspace.conHxC[16]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[17]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[18]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[19]*acadoWorkspace.deltaX0[3];
+params.ubA[5] -= + acadoWorkspace.conHxC[20]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[21]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[22]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[23]*acadoWorkspace.deltaX0[3];
+params.ubA[6] -= + acadoWorkspace.conHxC[24]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[25]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[26]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[27]*acadoWorkspace.deltaX0[3];
+params.ubA[7] -= + acadoWorkspace.conHxC[28]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[29]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[30]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[31]*acadoWorkspace.deltaX0[3];
+params.ubA[8] -= + acadoWorkspace.conHxC[32]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[33]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[34]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[35]*acadoWorkspace.deltaX0[3];
+params.ubA[9] -= + acadoWorkspace.conHxC[36]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[37]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[38]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[39]*acadoWorkspace.deltaX0[3];
+params.ubA[10] -= + acadoWorkspace.conHxC[40]*acadoWorkspace.deltaX0[0] + acadoWorkspace.conHxC[41]*acadoWorkspace.deltaX0[1] + acadoWorkspace.conHxC[42]*acadoWorkspace.deltaX0[2] + acadoWorkspace.conHxC[43]*acadoWorkspace.deltaX0[3];
+
+params.H[0] = acadoWorkspace.H11[0];
+params.H[1] = acadoWorkspace.H11[1];
+params.H[2] = acadoWorkspace.H11[2];
+params.H[3] = acadoWorkspace.H11[3];
+params.H[4] = acadoWorkspace.H11[4];
+params.H[5] = acadoWorkspace.H11[5];
+params.H[6] = acadoWorkspace.H11[6];
+params.H[7] = acadoWorkspace.H11[7];
+params.H[8] = acadoWorkspace.H11[8];
+params.H[9] = acadoWorkspace.H11[9];
+params.H[10] = acadoWorkspace.H11[10];
+params.H[11] = acadoWorkspace.H11[11];
+params.H[12] = acadoWorkspace.H11[12];
+params.H[13] = acadoWorkspace.H11[13];
+params.H[14] = acadoWorkspace.H11[14];
+params.H[15] = acadoWorkspace.H11[15];
+params.H[16] = acadoWorkspace.H11[16];
+params.H[17] = acadoWorkspace.H11[17];
+params.H[18] = acadoWorkspace.H11[18];
+params.H[19] = acadoWorkspace.H11[19];
+params.H[20] = acadoWorkspace.H11[20];
+params.H[21] = acadoWorkspace.H11[21];
+params.H[22] = acadoWorkspace.H11[22];
+params.H[23] = acadoWorkspace.H11[23];
+params.H[24] = acadoWorkspace.H11[24];
+params.H[25] = acadoWorkspace.H11[25];
+params.H[26] = acadoWorkspace.H11[26];
+params.H[27] = acadoWorkspace.H11[27];
+params.H[28] = acadoWorkspace.H11[28];
+params.H[29] = acadoWorkspace.H11[29];
+params.H[30] = acadoWorkspace.H11[30];
+params.H[31] = acadoWorkspace.H11[31];
+params.H[32] = acadoWorkspace.H11[32];
+params.H[33] = acadoWorkspace.H11[33];
+params.H[34] = acadoWorkspace.H11[34];
+params.H[35] = acadoWorkspace.H11[35];
+params.H[36] = acadoWorkspace.H11[36];
+params.H[37] = acadoWorkspace.H11[37];
+params.H[38] = acadoWorkspace.H11[38];
+params.H[39] = acadoWorkspace.H11[39];
+params.H[40] = acadoWorkspace.H11[40];
+params.H[41] = acadoWorkspace.H11[41];
+params.H[42] = acadoWorkspace.H11[42];
+params.H[43] = acadoWorkspace.H11[43];
+params.H[44] = acadoWorkspace.H11[44];
+params.H[45] = acadoWorkspace.H11[45];
+params.H[46] = acadoWorkspace.H11[46];
+params.H[47] = acadoWorkspace.H11[47];
+params.H[48] = acadoWorkspace.H11[48];
+params.H[49] = acadoWorkspace.H11[49];
+params.H[50] = acadoWorkspace.H11[50];
+params.H[51] = acadoWorkspace.H11[51];
+params.H[52] = acadoWorkspace.H11[52];
+params.H[53] = acadoWorkspace.H11[53];
+params.H[54] = acadoWorkspace.H11[54];
+params.H[55] = acadoWorkspace.H11[55];
+params.H[56] = acadoWorkspace.H11[56];
+params.H[57] = acadoWorkspace.H11[57];
+params.H[58] = acadoWorkspace.H11[58];
+params.H[59] = acadoWorkspace.H11[59];
+params.H[60] = acadoWorkspace.H11[60];
+params.H[61] = acadoWorkspace.H11[61];
+params.H[62] = acadoWorkspace.H11[62];
+params.H[63] = acadoWorkspace.H11[63];
+params.H[64] = acadoWorkspace.H11[64];
+params.H[65] = acadoWorkspace.H11[65];
+params.H[66] = acadoWorkspace.H11[66];
+params.H[67] = acadoWorkspace.H11[67];
+params.H[68] = acadoWorkspace.H11[68];
+params.H[69] = acadoWorkspace.H11[69];
+params.H[70] = acadoWorkspace.H11[70];
+params.H[71] = acadoWorkspace.H11[71];
+params.H[72] = acadoWorkspace.H11[72];
+params.H[73] = acadoWorkspace.H11[73];
+params.H[74] = acadoWorkspace.H11[74];
+params.H[75] = acadoWorkspace.H11[75];
+params.H[76] = acadoWorkspace.H11[76];
+params.H[77] = acadoWorkspace.H11[77];
+params.H[78] = acadoWorkspace.H11[78];
+params.H[79] = acadoWorkspace.H11[79];
+params.H[80] = acadoWorkspace.H11[80];
+params.H[81] = acadoWorkspace.H11[81];
+params.H[82] = acadoWorkspace.H11[82];
+params.H[83] = acadoWorkspace.H11[83];
+params.H[84] = acadoWorkspace.H11[84];
+params.H[85] = acadoWorkspace.H11[85];
+params.H[86] = acadoWorkspace.H11[86];
+params.H[87] = acadoWorkspace.H11[87];
+params.H[88] = acadoWorkspace.H11[88];
+params.H[89] = acadoWorkspace.H11[89];
+params.H[90] = acadoWorkspace.H11[90];
+params.H[91] = acadoWorkspace.H11[91];
+params.H[92] = acadoWorkspace.H11[92];
+params.H[93] = acadoWorkspace.H11[93];
+params.H[94] = acadoWorkspace.H11[94];
+params.H[95] = acadoWorkspace.H11[95];
+params.H[96] = acadoWorkspace.H11[96];
+params.H[97] = acadoWorkspace.H11[97];
+params.H[98] = acadoWorkspace.H11[98];
+params.H[99] = acadoWorkspace.H11[99];
+}
+
+int feedbackStep( real_t* x0 )
+{
+int retVal;
+acadoWorkspace.deltaX0[0] = x0[0] - acadoVariables.x[0];
+acadoWorkspace.deltaX0[1] = x0[1] - acadoVariables.x[1];
+acadoWorkspace.deltaX0[2] = x0[2] - acadoVariables.x[2];
+acadoWorkspace.deltaX0[3] = x0[3] - acadoVariables.x[3];
+
+initialValueEmbedding(  );
+
+retVal = (int) solve();
+
+acadoVariables.u[0] += vars.x[0];
+acadoVariables.u[1] += vars.x[1];
+acadoVariables.u[2] += vars.x[2];
+acadoVariables.u[3] += vars.x[3];
+acadoVariables.u[4] += vars.x[4];
+acadoVariables.u[5] += vars.x[5];
+acadoVariables.u[6] += vars.x[6];
+acadoVariables.u[7] += vars.x[7];
+acadoVariables.u[8] += vars.x[8];
+acadoVariables.u[9] += vars.x[9];
+acadoVariables.x[0] += acadoWorkspace.deltaX0[0];
+acadoVariables.x[1] += acadoWorkspace.deltaX0[1];
+acadoVariables.x[2] += acadoWorkspace.deltaX0[2];
+acadoVariables.x[3] += acadoWorkspace.deltaX0[3];
+expand(  );
+return retVal;
+}
+
+void shiftControls( real_t* uEnd )
+{
+acadoVariables.u[0] = acadoVariables.u[1];
+acadoVariables.u[1] = acadoVariables.u[2];
+acadoVariables.u[2] = acadoVariables.u[3];
+acadoVariables.u[3] = acadoVariables.u[4];
+acadoVariables.u[4] = acadoVariables.u[5];
+acadoVariables.u[5] = acadoVariables.u[6];
+acadoVariables.u[6] = acadoVariables.u[7];
+acadoVariables.u[7] = acadoVariables.u[8];
+acadoVariables.u[8] = acadoVariables.u[9];
+
+if (uEnd != NULL)
+{acadoVariables.u[9] = uEnd[0];
+}}
+
+void shiftStates( real_t* xEnd )
+{
+acadoVariables.x[0] = acadoVariables.x[4];
+acadoVariables.x[1] = acadoVariables.x[5];
+acadoVariables.x[2] = acadoVariables.x[6];
+acadoVariables.x[3] = acadoVariables.x[7];
+acadoVariables.x[4] = acadoVariables.x[8];
+acadoVariables.x[5] = acadoVariables.x[9];
+acadoVariables.x[6] = acadoVariables.x[10];
+acadoVariables.x[7] = acadoVariables.x[11];
+acadoVariables.x[8] = acadoVariables.x[12];
+acadoVariables.x[9] = acadoVariables.x[13];
+acadoVariables.x[10] = acadoVariables.x[14];
+acadoVariables.x[11] = acadoVariables.x[15];
+acadoVariables.x[12] = acadoVariables.x[16];
+acadoVariables.x[13] = acadoVariables.x[17];
+acadoVariables.x[14] = acadoVariables.x[18];
+acadoVariables.x[15] = acadoVariables.x[19];
+acadoVariables.x[16] = acadoVariables.x[20];
+acadoVariables.x[17] = acadoVariables.x[21];
+acadoVariables.x[18] = acadoVariables.x[22];
+acadoVariables.x[19] = acadoVariables.x[23];
+acadoVariables.x[20] = acadoVariables.x[24];
+acadoVariables.x[21] = acadoVariables.x[25];
+acadoVariables.x[22] = acadoVariables.x[26];
+acadoVariables.x[23] = acadoVariables.x[27];
+acadoVariables.x[24] = acadoVariables.x[28];
+acadoVariables.x[25] = acadoVariables.x[29];
+acadoVariables.x[26] = acadoVariables.x[30];
+acadoVariables.x[27] = acadoVariables.x[31];
+acadoVariables.x[28] = acadoVariables.x[32];
+acadoVariables.x[29] = acadoVariables.x[33];
+acadoVariables.x[30] = acadoVariables.x[34];
+acadoVariables.x[31] = acadoVariables.x[35];
+acadoVariables.x[32] = acadoVariables.x[36];
+acadoVariables.x[33] = acadoVariables.x[37];
+acadoVariables.x[34] = acadoVariables.x[38];
+acadoVariables.x[35] = acadoVariables.x[39];
+acadoVariables.x[36] = acadoVariables.x[40];
+acadoVariables.x[37] = acadoVariables.x[41];
+acadoVariables.x[38] = acadoVariables.x[42];
+acadoVariables.x[39] = acadoVariables.x[43];
+
+if (xEnd != NULL)
+{acadoVariables.x[40] = xEnd[0];
+acadoVariables.x[41] = xEnd[1];
+acadoVariables.x[42] = xEnd[2];
+acadoVariables.x[43] = xEnd[3];
+}}
+
+real_t getKKT(  )
+{
+real_t tmp;
+tmp = + acadoWorkspace.g1[0]*vars.x[0] + acadoWorkspace.g1[1]*vars.x[1] + acadoWorkspace.g1[2]*vars.x[2] + acadoWorkspace.g1[3]*vars.x[3] + acadoWorkspace.g1[4]*vars.x[4] + acadoWorkspace.g1[5]*vars.x[5] + acadoWorkspace.g1[6]*vars.x[6] + acadoWorkspace.g1[7]*vars.x[7] + acadoWorkspace.g1[8]*vars.x[8] + acadoWorkspace.g1[9]*vars.x[9];
+tmp = fabs( tmp );
+return tmp;
+}
+
@@ -0,0 +1,261 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/integrator/evaluation_tape.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Compares the recursive evaluation of the operator tree with the
+ *    evaluation based on the compiled tape, for the pendulum and the
+ *    CSTR (including its Riccati ODE) right-hand sides.
+ */
+
+
+#include <acado_integrators.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+const double k10 =  1.287e12;
+const double k20 =  1.287e12;
+const double k30 =  9.043e09;
+const double E1  =  -9758.3;
+const double E2  =  -9758.3;
+const double E3  =  -8560.0;
+const double H1  =      4.2;
+const double H2  =    -11.0;
+const double H3  =    -41.85;
+const double rho =      0.9342;
+const double Cp  =      3.01;
+const double kw  =   4032.0;
+const double AR  =      0.215;
+const double VR  =     10.0;
+const double mK  =      5.0;
+const double CPK =      2.0;
+
+const double cA0    =    5.1;
+const double theta0 =  104.9;
+
+
+/* Runs nEval evaluations, forward and backward sweeps and returns the  *
+ * CPU time. The results of the last sweep are stored in res.            */
+double sweep( Function &f, int nEval, double *res ){
+
+    int run1, run2;
+
+    const int N   = f.getNumberOfVariables() + 1;
+    const int dim = f.getDim();
+
+    double *x     = new double[N  ];
+    double *seed  = new double[N  ];
+    double *bseed = new double[dim];
+
+    double t0 = acadoGetTime();
+
+    for( run2 = 0; run2 < nEval; run2++ ){
+
+        for( run1 = 0; run1 < N; run1++ ){
+            x   [run1] = 1.0 + 0.01*run1;
+            seed[run1] = 0.0;
+        }
+        seed[1] = 1.0;
+
+        for( run1 = 0; run1 < dim; run1++ )
+            bseed[run1] = 1.0;
+
+        f.evaluate  ( 0, x, res );
+        f.AD_forward( 0, seed, &res[dim] );
+
+        for( run1 = 0; run1 < N; run1++ )
+            res[2*dim+run1] = 0.0;
+        f.AD_backward( 0, bseed, &res[2*dim] );
+    }
+
+    double cpuTime = acadoGetTime() - t0;
+
+    delete[] x;
+    delete[] seed;
+    delete[] bseed;
+
+    return cpuTime;
+}
+
+
+void compare( const char *name, DifferentialEquation &f, int nEval ){
+
+    int run1;
+
+    DifferentialEquation fTree( f );
+    fTree.useEvaluationTape( BT_FALSE );
+
+    const int n = 2*f.getDim() + f.getNumberOfVariables() + 1;
+
+    double *resTape = new double[n];
+    double *resTree = new double[n];
+
+    double tTree = sweep( fTree, nEval, resTree );
+    double tTape = sweep( f    , nEval, resTape );
+
+    double maxDeviation = 0.0;
+    for( run1 = 0; run1 < n; run1++ )
+        if( fabs( resTape[run1]-resTree[run1] ) > maxDeviation )
+            maxDeviation = fabs( resTape[run1]-resTree[run1] );
+
+    acadoPrintf( "%-10s  tree: %.3e s   tape: %.3e s   speed-up: %5.2f   max. deviation: %.1e\n",
+                 name, tTree/nEval, tTape/nEval, tTree/tTape, maxDeviation );
+
+    delete[] resTape;
+    delete[] resTree;
+}
+
+
+void compareIntegration( const char *name, DifferentialEquation &f,
+                         double tEnd, double *x0, double *u, double *p ){
+
+    DifferentialEquation fTree( f );
+    fTree.useEvaluationTape( BT_FALSE );
+
+    IntegratorRK45 integratorTree( fTree );
+    IntegratorRK45 integratorTape( f     );
+
+    integratorTree.set( MAX_NUM_INTEGRATOR_STEPS, 100000 );
+    integratorTape.set( MAX_NUM_INTEGRATOR_STEPS, 100000 );
+
+    double t0 = acadoGetTime();
+    if( integratorTree.integrate( 0.0, tEnd, x0, 0, p, u ) != SUCCESSFUL_RETURN )
+        return;
+    double tTree = acadoGetTime() - t0;
+
+    t0 = acadoGetTime();
+    if( integratorTape.integrate( 0.0, tEnd, x0, 0, p, u ) != SUCCESSFUL_RETURN )
+        return;
+    double tTape = acadoGetTime() - t0;
+
+    Vector xTree, xTape;
+    integratorTree.getX( xTree );
+    integratorTape.getX( xTape );
+
+    acadoPrintf( "%-10s  tree: %.3e s   tape: %.3e s   speed-up: %5.2f   max. deviation: %.1e\n",
+                 name, tTree, tTape, tTree/tTape, (xTree-xTape).getNorm( VN_LINF ) );
+}
+
+
+IntermediateState cstrModel( const DifferentialState &x,
+                             const Control           &u  ){
+
+    IntermediateState rhs(4);
+
+    IntermediateState cA     = x(0);
+    IntermediateState cB     = x(1);
+    IntermediateState theta  = x(2);
+    IntermediateState thetaK = x(3);
+
+    IntermediateState k1, k2, k3;
+
+    k1 = k10*exp(E1/(273.15 +theta));
+    k2 = k20*exp(E2/(273.15 +theta));
+    k3 = k30*exp(E3/(273.15 +theta));
+
+    rhs(0) = (1/3600.0)*(u(0)*(cA0-cA) - k1*cA - k3*cA*cA);
+    rhs(1) = (1/3600.0)*(- u(0)*cB + k1*cA - k2*cB);
+    rhs(2) = (1/3600.0)*(u(0)*(theta0-theta) - (1/(rho*Cp)) *(k1*cA*H1 + k2*cB*H2 + k3*cA*cA*H3)+(kw*AR/(rho*Cp*VR))*(thetaK -theta));
+    rhs(3) = (1/3600.0)*((1/(mK*CPK))*(u(1) + kw*AR*(theta-thetaK)));
+
+    return rhs;
+}
+
+
+void benchmarkPendulum( ){
+
+    DifferentialState      phi, dphi;
+    Control                F;
+    Parameter              l;
+    IntermediateState      z;
+    DifferentialEquation   f;
+
+    z = sin(phi);
+
+    f << dot(phi ) == dphi;
+    f << dot(dphi) == -(9.81/l)*z - 2.0*dphi + F/l;
+
+    double x0[2] = { 1.0, 0.0 };
+    double u [1] = { 0.0 };
+    double p [1] = { 1.0 };
+
+    compare           ( "pendulum", f, 100000       );
+    compareIntegration( "pendulum", f, 20.0, x0, u, p );
+
+    phi.clearStaticCounters();
+    F  .clearStaticCounters();
+    l  .clearStaticCounters();
+    z  .clearStaticCounters();
+}
+
+
+void benchmarkCSTR( ){
+
+    DifferentialState x(4), P(4,4);
+    Control           u(2);
+
+    IntermediateState rhs = cstrModel( x, u );
+
+    Matrix Q = zeros(4,4);
+    Q(0,0) = 0.2;
+    Q(1,1) = 1.0;
+    Q(2,2) = 0.5;
+    Q(3,3) = 0.2;
+
+    Matrix R = zeros(2,2);
+    R(0,0) = 0.5;
+    R(1,1) = 5e-7;
+
+    DifferentialEquation f;
+    f << dot(x) == rhs;
+    f << dot(P) == getRiccatiODE( rhs, x, u, P, Q, R );
+
+    double x0[20] = { 1.0, 0.5, 100.0, 100.0, 1.0, 0.0, 0.0, 0.0,
+                                              0.0, 1.0, 0.0, 0.0,
+                                              0.0, 0.0, 1.0, 0.0,
+                                              0.0, 0.0, 0.0, 1.0 };
+    double u0[2]  = { 14.19, -1113.5 };
+
+    compare           ( "cstr", f, 10000            );
+    compareIntegration( "cstr", f, 500.0, x0, u0, 0 );
+}
+
+
+int main( ){
+
+    acadoPrintf( "\nFunction evaluation + forward + backward sweep (per call) and\n" );
+    acadoPrintf( "integration with IntegratorRK45 (total):\n\n" );
+
+    benchmarkPendulum( );
+    benchmarkCSTR    ( );
+
+    return 0;
+}
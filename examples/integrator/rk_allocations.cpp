@@ -0,0 +1,153 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/integrator/rk_allocations.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Counts the heap allocations of repeated integrations of the pendulum
+ *    with the Runge-Kutta integrator RK45, including first order forward
+ *    sensitivities. After the first calls, which set up all work arrays,
+ *    no further allocations may occur; otherwise a non-zero value is
+ *    returned.
+ */
+
+
+#include <cstdlib>
+#include <new>
+
+#include <acado_integrators.hpp>
+
+
+/* Global allocation counter. */
+static long nAllocations = 0;
+
+void* operator new( size_t size ){
+
+    nAllocations++;
+
+    void *ptr = malloc( size > 0 ? size : 1 );
+    if( ptr == 0 ) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[]( size_t size ){
+
+    nAllocations++;
+
+    void *ptr = malloc( size > 0 ? size : 1 );
+    if( ptr == 0 ) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete  ( void *ptr ){ free( ptr ); }
+void operator delete[]( void *ptr ){ free( ptr ); }
+
+
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+    const uint nWarmUp = 3;
+    const uint nIter   = 10;
+
+    uint run1;
+    long nBefore;
+    long nNominal   = 0;
+    long nSensitivity = 0;
+
+
+    // DEFINE A RIGHT-HAND SIDE:
+    // -------------------------
+    DifferentialState      phi;    // the angle phi
+    DifferentialState     dphi;    // the first derivative of phi w.r.t time
+    Control                  F;    // a force acting on the pendulum
+    Parameter                l;    // the length of the pendulum
+
+    const double m     = 1.0  ;    // the mass of the pendulum
+    const double g     = 9.81 ;    // the gravitational constant
+    const double alpha = 2.0  ;    // frictional constant
+
+    DifferentialEquation f;
+
+    f << dot(phi ) == dphi;
+    f << dot(dphi) == -(m*g/l)*sin(phi) - alpha*dphi + F/(m*l);
+
+
+    // DEFINE AN INTEGRATOR:
+    // ---------------------
+    IntegratorRK45 integrator( f );
+
+    integrator.set( INTEGRATOR_TOLERANCE, 1.0e-6 );
+
+    // the forward sensitivities are computed on the frozen mesh:
+    integrator.freezeAll( );
+
+    double x_start[2] = { 1.0, 0.0 };
+    double u      [1] = { 0.0      };
+    double p      [1] = { 1.0      };
+
+    Vector xSeed( 2 );
+    xSeed(0) = 1.0;
+    xSeed(1) = 0.0;
+
+    Vector Dx;
+
+
+    // INTEGRATE REPEATEDLY AND COUNT THE ALLOCATIONS:
+    // -----------------------------------------------
+    for( run1 = 0; run1 < nWarmUp+nIter; run1++ ){
+
+        nBefore = nAllocations;
+        if( integrator.integrate( 0.0, 0.05, x_start, 0, p, u ) != SUCCESSFUL_RETURN )
+            return 1;
+        if( run1 >= nWarmUp )
+            nNominal += nAllocations - nBefore;
+
+        // (setting up the seeds allocates, only their propagation is checked)
+        if( integrator.setForwardSeed( 1, xSeed ) != SUCCESSFUL_RETURN )
+            return 1;
+
+        nBefore = nAllocations;
+        if( integrator.integrateSensitivities( ) != SUCCESSFUL_RETURN )
+            return 1;
+        if( integrator.getForwardSensitivities( Dx, 1 ) != SUCCESSFUL_RETURN )
+            return 1;
+        if( run1 >= nWarmUp )
+            nSensitivity += nAllocations - nBefore;
+
+        integrator.deleteAllSeeds( );
+    }
+
+    acadoPrintf( "allocations per call of integrate():              %ld\n", nNominal/nIter );
+    acadoPrintf( "allocations per call of integrateSensitivities(): %ld\n", nSensitivity/nIter );
+
+    if( ( nNominal > 0 ) || ( nSensitivity > 0 ) )
+        return 1;
+
+    return 0;
+}
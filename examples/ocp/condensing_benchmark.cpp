@@ -0,0 +1,149 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+ /**
+ *    \file examples/ocp/condensing_benchmark.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Measures the time spent in condensing (LOG_TIME_CONDENSING, summed
+ *    over all SQP iterations) when solving the rocket OCP of
+ *    examples/ocp/rocket.cpp for several numbers of nodes. Each OCP is
+ *    solved several times and the fastest run is reported. A non-zero
+ *    value is returned if one of the solutions fails.
+ *
+ *    The Lagrange term is integrated by the additional state L, since
+ *    minimizeLagrangeTerm would introduce a new state for every OCP.
+ */
+
+
+#include <acado_optimal_control.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+int main( ){
+
+    const uint nCases    = 4;
+    const uint nNodes[4] = { 25, 50, 100, 200 };
+    const uint nRuns     = 3;
+
+    uint run1, run2, run3;
+    int  nFailures = 0;
+
+
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+    DifferentialState     s, v, m, L;
+    Control               u;
+    DifferentialEquation  f;
+
+
+    // DEFINE A DIFFERENTIAL EQUATION:
+    // -------------------------------
+    f << dot(s) == v;
+    f << dot(v) == (u-0.02*v*v)/m;
+    f << dot(m) == -0.01*u*u;
+    f << dot(L) == u*u;
+
+
+    acadoPrintf( "\n  N  | iterations | condensing [s] | total [s]\n" );
+    acadoPrintf( "-----+------------+----------------+----------\n" );
+
+    for( run1 = 0; run1 < nCases; run1++ ){
+
+        // DEFINE AN OPTIMAL CONTROL PROBLEM:
+        // ----------------------------------
+        OCP ocp( 0.0, 10.0, nNodes[run1] );
+        ocp.minimizeMayerTerm( L );
+        ocp.subjectTo( f );
+
+        ocp.subjectTo( AT_START, s ==  0.0 );
+        ocp.subjectTo( AT_START, v ==  0.0 );
+        ocp.subjectTo( AT_START, m ==  1.0 );
+        ocp.subjectTo( AT_START, L ==  0.0 );
+        ocp.subjectTo( AT_END  , s == 10.0 );
+        ocp.subjectTo( AT_END  , v ==  0.0 );
+
+        ocp.subjectTo( -0.01 <= v <= 1.3 );
+
+        double timeCondensing = INFTY;
+        double timeTotal      = INFTY;
+        uint   nIterations    = 0;
+
+        for( run2 = 0; run2 < nRuns; run2++ ){
+
+            OptimizationAlgorithm algorithm( ocp );
+
+            algorithm.set( HESSIAN_APPROXIMATION, EXACT_HESSIAN );
+            algorithm.set( KKT_TOLERANCE,         1.0e-10       );
+            algorithm.set( MAX_NUM_ITERATIONS,    100           );
+            algorithm.set( PRINTLEVEL,            NONE          );
+            algorithm.set( PRINT_COPYRIGHT,       BT_FALSE      );
+
+            LogRecord logRecord( LOG_AT_EACH_ITERATION );
+            logRecord << LOG_TIME_CONDENSING;
+            algorithm << logRecord;
+
+            RealClock clock;
+            clock.start( );
+            returnValue returnvalue = algorithm.solve( );
+            clock.stop( );
+
+            if ( returnvalue != SUCCESSFUL_RETURN ){
+                nFailures++;
+                break;
+            }
+
+            algorithm.getLogRecord( logRecord );
+
+            MatrixVariablesGrid condensingTimes;
+            logRecord.getAll( LOG_TIME_CONDENSING,condensingTimes );
+
+            double sum = 0.0;
+            for( run3 = 0; run3 < condensingTimes.getNumPoints( ); run3++ )
+                sum += condensingTimes( run3,0,0 );
+
+            nIterations    = condensingTimes.getNumPoints( );
+            timeCondensing = acadoMin( timeCondensing,sum );
+            timeTotal      = acadoMin( timeTotal,clock.getTime( ) );
+        }
+
+        if ( run2 < nRuns ){
+            acadoPrintf( " %3d | solution failed\n", nNodes[run1] );
+            continue;
+        }
+
+        acadoPrintf( " %3d | %10d | %14.4f | %9.4f\n", nNodes[run1], nIterations, timeCondensing, timeTotal );
+    }
+
+    acadoPrintf( "\n" );
+
+    if( nFailures > 0 )
+        return 1;
+
+    return 0;
+}
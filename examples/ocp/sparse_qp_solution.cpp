@@ -0,0 +1,208 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+ /**
+ *    \file examples/ocp/sparse_qp_solution.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Solves two cart-pendulum OCPs for several numbers of nodes, once with
+ *    condensing (SPARSE_QP_SOLUTION = CONDENSING) and once with the
+ *    stage-wise interior point solver (SPARSE_QP_SOLUTION = SPARSE_SOLVER),
+ *    and reports the CPU times of both. The first OCP tracks the origin
+ *    subject to control and state bounds. The second one only penalises
+ *    the control and fixes the terminal state, such that the Gauss-Newton
+ *    Hessian is singular in the states. A non-zero value is returned if
+ *    one of the solutions fails or if the two solutions differ.
+ */
+
+
+#include <acado_optimal_control.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* Solves the OCP with the given sparse QP solution method. */
+static returnValue solveOCP(	const OCP &ocp,
+								int sparseQPsolution,
+								VariablesGrid &xd,
+								VariablesGrid &u,
+								double &cpuTime
+								)
+{
+    OptimizationAlgorithm algorithm( ocp );
+
+    algorithm.set( SPARSE_QP_SOLUTION,    sparseQPsolution );
+    algorithm.set( HESSIAN_APPROXIMATION, GAUSS_NEWTON     );
+    algorithm.set( KKT_TOLERANCE,         1.0e-10          );
+    algorithm.set( MAX_NUM_ITERATIONS,    100              );
+    algorithm.set( PRINTLEVEL,            NONE             );
+    algorithm.set( PRINT_COPYRIGHT,       BT_FALSE         );
+
+    RealClock clock;
+    clock.start( );
+    returnValue returnvalue = algorithm.solve( );
+    clock.stop( );
+
+    cpuTime = clock.getTime( );
+
+    algorithm.getDifferentialStates( xd );
+    algorithm.getControls( u );
+
+    return returnvalue;
+}
+
+
+/* Returns the largest absolute difference of two grids. */
+static double getMaxDifference(	const VariablesGrid &a,
+								const VariablesGrid &b
+								)
+{
+    VariablesGrid difference( a );
+    difference -= b;
+
+    return acadoMax( difference.getMax( ),-difference.getMin( ) );
+}
+
+
+int main( ){
+
+    const uint   nCases     = 4;
+    const uint   nNodes[4]  = { 10, 20, 40, 80 };
+    const double tolerance  = 1.0e-6;
+
+    uint run1, run2;
+    int  nFailures = 0;
+
+
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+    DifferentialState     p, theta, v, omega;
+    Control               F;
+    IntermediateState     a;
+    DifferentialEquation  f;
+
+    const double m = 0.2;
+    const double M = 1.0;
+    const double l = 0.5;
+    const double g = 9.81;
+
+
+    // DEFINE THE CART-PENDULUM DYNAMICS:
+    // ----------------------------------
+    a = ( F + m*l*omega*omega*sin(theta) - m*g*sin(theta)*cos(theta) ) / ( M + m*sin(theta)*sin(theta) );
+
+    f << dot(p)     == v;
+    f << dot(theta) == omega;
+    f << dot(v)     == a;
+    f << dot(omega) == ( -a*cos(theta) - g*sin(theta) ) / l;
+
+
+    // DEFINE THE LEAST-SQUARES TERMS:
+    // -------------------------------
+    Function hTracking;
+    hTracking << p << theta << v << omega << F;
+
+    Matrix Stracking = eye(5);
+    Stracking(4,4) = 0.1;
+    Vector rTracking = zeros(5);
+
+    Function hEffort;
+    hEffort << F;
+
+    Matrix Seffort = eye(1);
+    Vector rEffort = zeros(1);
+
+
+    acadoPrintf( "\n    OCP   |  N  | condensing [s] | sparse solver [s] | max. difference\n" );
+    acadoPrintf( "----------+-----+----------------+-------------------+----------------\n" );
+
+    for( run1 = 0; run1 < 2; run1++ ){
+        for( run2 = 0; run2 < nCases; run2++ ){
+
+            OCP ocp( 0.0, 3.0, nNodes[run2] );
+            ocp.subjectTo( f );
+
+            if( run1 == 0 ){
+                ocp.minimizeLSQ( Stracking, hTracking, rTracking );
+
+                ocp.subjectTo( AT_START, p     == 0.5 );
+                ocp.subjectTo( AT_START, theta == 0.3 );
+                ocp.subjectTo( AT_START, v     == 0.0 );
+                ocp.subjectTo( AT_START, omega == 0.0 );
+
+                ocp.subjectTo( -5.0 <= F <= 5.0 );
+                ocp.subjectTo( -0.2 <= p <= 1.0 );
+            }
+            else{
+                ocp.minimizeLSQ( Seffort, hEffort, rEffort );
+
+                ocp.subjectTo( AT_START, p     == 0.0 );
+                ocp.subjectTo( AT_START, theta == 0.0 );
+                ocp.subjectTo( AT_START, v     == 0.0 );
+                ocp.subjectTo( AT_START, omega == 0.0 );
+
+                ocp.subjectTo( AT_END,   p     == 1.0 );
+                ocp.subjectTo( AT_END,   theta == 0.0 );
+                ocp.subjectTo( AT_END,   v     == 0.0 );
+                ocp.subjectTo( AT_END,   omega == 0.0 );
+
+                ocp.subjectTo( -5.0 <= F <= 5.0 );
+            }
+
+            VariablesGrid xdCondensing, uCondensing;
+            VariablesGrid xdSparse,     uSparse;
+            double timeCondensing, timeSparse;
+
+            returnValue returnCondensing = solveOCP( ocp, CONDENSING,    xdCondensing, uCondensing, timeCondensing );
+            returnValue returnSparse     = solveOCP( ocp, SPARSE_SOLVER, xdSparse,     uSparse,     timeSparse     );
+
+            if( ( returnCondensing != SUCCESSFUL_RETURN ) || ( returnSparse != SUCCESSFUL_RETURN ) ){
+                acadoPrintf( " %8s | %3d | solution failed\n", ( run1 == 0 ) ? "tracking" : "effort", nNodes[run2] );
+                nFailures++;
+                continue;
+            }
+
+            double difference = acadoMax( getMaxDifference( xdCondensing,xdSparse ),
+                                          getMaxDifference( uCondensing,uSparse ) );
+
+            acadoPrintf( " %8s | %3d | %14.4f | %17.4f | %.3e\n",
+                         ( run1 == 0 ) ? "tracking" : "effort", nNodes[run2], timeCondensing, timeSparse, difference );
+
+            if( !( difference <= tolerance ) )
+                nFailures++;
+        }
+    }
+
+    acadoPrintf( "\n" );
+
+    if( nFailures > 0 ){
+        acadoPrintf( "%d of %d comparisons failed\n\n", nFailures, 2*nCases );
+        return 1;
+    }
+
+    return 0;
+}
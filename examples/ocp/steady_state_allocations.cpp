@@ -0,0 +1,168 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/ocp/steady_state_allocations.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Counts the heap allocations of repeated evaluations of a path
+ *    constraint and a least-squares term, including their backward
+ *    sensitivities and the Gauss-Newton Hessian. Only these evaluations
+ *    are checked, not a complete SQP iteration. After the first evaluation,
+ *    which sets up all work arrays, no further allocations may occur;
+ *    otherwise a non-zero value is returned.
+ */
+
+
+#include <cstdlib>
+#include <new>
+
+#include <acado_optimal_control.hpp>
+
+
+/* Global allocation counter. */
+static long nAllocations = 0;
+
+void* operator new( size_t size ){
+
+    nAllocations++;
+
+    void *ptr = malloc( size > 0 ? size : 1 );
+    if( ptr == 0 ) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[]( size_t size ){
+
+    nAllocations++;
+
+    void *ptr = malloc( size > 0 ? size : 1 );
+    if( ptr == 0 ) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete  ( void *ptr ){ free( ptr ); }
+void operator delete[]( void *ptr ){ free( ptr ); }
+
+
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+    const uint nPoints = 101;
+    const uint nIter   = 5;
+
+    uint run1;
+    long nBefore;
+    long nSteadyState = 0;
+
+
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+    DifferentialState x, v;
+    Control           u;
+
+    Grid grid( 0.0, 10.0, nPoints );
+
+    VariablesGrid xGrid( 2, grid );
+    VariablesGrid uGrid( 1, grid );
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+        xGrid( run1,0 ) = cos( 0.1*run1 );
+        xGrid( run1,1 ) = sin( 0.1*run1 );
+        uGrid( run1,0 ) = 0.01*run1;
+    }
+
+    OCPiterate iter( &xGrid, 0, 0, &uGrid, 0 );
+
+
+    // DEFINE A PATH CONSTRAINT AND AN LSQ TERM:
+    // -----------------------------------------
+    Vector lb(1), ub(1);
+    lb(0) = -1.0;
+    ub(0) =  1.0;
+
+    PathConstraint pathConstraint( grid );
+    pathConstraint.add( lb, x*x + sin(v)*u, ub );
+
+    BlockMatrix pathSeed( 1, nPoints );
+    for( run1 = 0; run1 < nPoints; run1++ )
+        pathSeed.setIdentity( 0, run1, 1 );
+
+    Function h;
+    h << x;
+    h << v*v;
+    h << 2.0*u;
+
+    LSQTerm lsqTerm( 0, h, 0 );
+    lsqTerm.setGrid( grid );
+
+    BlockMatrix lsqSeed( 1, 1 );
+    lsqSeed.setIdentity( 0, 0, 1 );
+
+    BlockMatrix hessian( 5*nPoints, 5*nPoints );
+
+
+    // EVALUATE REPEATEDLY AND COUNT THE ALLOCATIONS:
+    // ----------------------------------------------
+    acadoPrintf( "\n iteration | path constraint | LSQ term\n" );
+    acadoPrintf( "-----------+-----------------+---------\n" );
+
+    for( run1 = 0; run1 < nIter; run1++ ){
+
+        nBefore = nAllocations;
+
+        pathConstraint.init( iter );
+        pathConstraint.evaluate( iter );
+        pathConstraint.setBackwardSeed( &pathSeed, 1 );
+        pathConstraint.evaluateSensitivities( );
+
+        long nPath = nAllocations - nBefore;
+        nBefore = nAllocations;
+
+        hessian.setZero( );
+        lsqTerm.evaluate( iter );
+        lsqTerm.setBackwardSeed( &lsqSeed, 1 );
+        lsqTerm.evaluateSensitivitiesGN( &hessian );
+
+        long nLSQ = nAllocations - nBefore;
+
+        acadoPrintf( " %9d | %15ld | %8ld\n", run1, nPath, nLSQ );
+
+        if( run1 > 0 )
+            nSteadyState += nPath + nLSQ;
+    }
+
+    acadoPrintf( "\n" );
+
+    if( nSteadyState > 0 ){
+        acadoPrintf( "%ld allocations after the first evaluation\n\n", nSteadyState );
+        return 1;
+    }
+
+    return 0;
+}
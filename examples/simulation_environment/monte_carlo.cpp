@@ -0,0 +1,182 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+ /**
+ *    \file examples/simulation_environment/monte_carlo.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2013
+ *
+ *    Monte-Carlo study of the active damping example: the closed loop is
+ *    simulated for several initial wheel positions, each with its own
+ *    measurement noise stream. The scenarios are run in parallel if OpenMP
+ *    is enabled; the results do not depend on the number of threads.
+ */
+
+
+#include <acado_toolkit.hpp>
+
+
+int main( )
+{
+    USING_NAMESPACE_ACADO
+
+    const uint nScenarios = 8;
+
+    uint run1;
+
+
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+	DifferentialState xB; //Body Position
+	DifferentialState xW; //Wheel Position
+	DifferentialState vB; //Body Velocity
+	DifferentialState vW; //Wheel Velocity
+
+	Control F;
+
+	double mB = 350.0;
+	double mW = 50.0;
+	double kS = 20000.0;
+	double kT = 200000.0;
+
+
+    // DEFINE A DIFFERENTIAL EQUATION:
+    // -------------------------------
+    DifferentialEquation f;
+
+	f << dot(xB) == vB;
+	f << dot(xW) == vW;
+	f << dot(vB) == ( -kS*xB + kS*xW + F ) / mB;
+	f << dot(vW) == (  kS*xB - (kT+kS)*xW - F ) / mW;
+
+
+    // SETTING UP THE (SIMULATED) PROCESS WITH A NOISY SENSOR:
+    // -------------------------------------------------------
+	OutputFcn identity;
+	DynamicSystem dynamicSystem( f,identity );
+
+	Process process( dynamicSystem,INT_RK45 );
+
+	Vector mean( 4 ), amplitude( 4 );
+	mean.setZero( );
+	amplitude.setAll( 0.001 );
+
+	GaussianNoise sensorNoise( mean,amplitude );
+
+	Sensor sensor( 4 );
+	sensor.setOutputNoise( sensorNoise,0.05 );
+
+	process.setSensor( sensor );
+
+
+    // DEFINE AN OPTIMAL CONTROL PROBLEM:
+    // ----------------------------------
+    Function h;
+
+    h << xB;
+    h << xW;
+	h << vB;
+    h << vW;
+	h << F;
+
+    Matrix Q = zeros(5,5); // LSQ coefficient matrix
+	Q(0,0) = 10.0;
+	Q(1,1) = 10.0;
+	Q(2,2) = 1.0;
+	Q(3,3) = 1.0;
+	Q(4,4) = 1.0e-8;
+
+    Vector r(5); // Reference
+    r.setAll( 0.0 );
+
+
+    const double tStart = 0.0;
+    const double tEnd   = 1.0;
+
+    OCP ocp( tStart, tEnd, 20 );
+
+    ocp.minimizeLSQ( Q, h, r );
+
+	ocp.subjectTo( f );
+
+	ocp.subjectTo( -200.0 <= F <= 200.0 );
+
+
+    // SETTING UP THE MPC CONTROLLER:
+    // ------------------------------
+	RealTimeAlgorithm alg( ocp,0.05 );
+	alg.set( INTEGRATOR_TYPE, INT_RK78 );
+	alg.set( DYNAMIC_SENSITIVITY,FORWARD_SENSITIVITY );
+	alg.set( PRINTLEVEL,NONE );
+
+	StaticReferenceTrajectory zeroReference;
+
+	Controller controller( alg,zeroReference );
+
+
+    // SETTING UP THE ENSEMBLE OF CLOSED-LOOP SIMULATIONS...
+    // -----------------------------------------------------
+	SimulationEnvironment sim( 0.0,1.0,process,controller );
+
+	SimulationEnsemble ensemble( sim );
+	ensemble.setSeed( 42 );
+
+	Vector x0(4);
+	x0.setZero();
+
+	for( run1 = 0; run1 < nScenarios; run1++ ){
+		x0(1) = 0.002*run1;
+		ensemble.addScenario( x0 );
+	}
+
+	double t0 = acadoGetTime( );
+
+	if ( ensemble.run( ) != SUCCESSFUL_RETURN )
+		exit( EXIT_FAILURE );
+
+	double tRun = acadoGetTime( ) - t0;
+
+
+    // ... AND PRINT THE FINAL STATES OF ALL SCENARIOS
+    // -----------------------------------------------
+	VariablesGrid diffStates;
+
+	acadoPrintf( "\n scenario |   seed     |   xB(end)    |   xW(end)\n" );
+	acadoPrintf( "----------+------------+--------------+--------------\n" );
+
+	for( run1 = 0; run1 < nScenarios; run1++ ){
+
+		ensemble.getProcessDifferentialStates( run1,diffStates );
+
+		acadoPrintf( " %8d | %10u | %+.5e | %+.5e\n", run1, ensemble.getScenarioSeed( run1 ),
+					 diffStates( diffStates.getNumPoints()-1,0 ), diffStates( diffStates.getNumPoints()-1,1 ) );
+	}
+
+	acadoPrintf( "\n %d scenarios simulated in %.3f s\n\n", nScenarios, tRun );
+
+    return 0;
+}
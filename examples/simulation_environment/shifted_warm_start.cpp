@@ -0,0 +1,204 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+ /**
+ *    \file examples/simulation_environment/shifted_warm_start.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2013
+ *
+ *    Closed-loop simulation of the active damping example with shifted
+ *    real-time iterations, once with and once without USE_SHIFTED_WARM_START.
+ *    The warm start re-uses sensitivities of the previous linearization
+ *    point, hence both runs have to give nearly (but not bitwise) the same
+ *    trajectories. Returns a non-zero value if they differ.
+ */
+
+
+#include <acado_toolkit.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* runs the closed loop and returns its state and feedback trajectories */
+static returnValue runClosedLoop(	const OCP& ocp,
+									const DynamicSystem& dynamicSystem,
+									BooleanType useShiftedWarmStart,
+									VariablesGrid& diffStates,
+									VariablesGrid& feedbackControl
+									)
+{
+    // SETTING UP THE (SIMULATED) PROCESS:
+    // -----------------------------------
+	Process process( dynamicSystem,INT_RK45 );
+
+
+    // SETTING UP THE MPC CONTROLLER WITH SHIFTED REAL-TIME ITERATIONS:
+    // -----------------------------------------------------------------
+	RealTimeAlgorithm alg( ocp,0.05 );
+	alg.set( INTEGRATOR_TYPE, INT_RK78 );
+	alg.set( DYNAMIC_SENSITIVITY,FORWARD_SENSITIVITY );
+	alg.set( USE_REALTIME_SHIFTS,YES );
+	alg.set( USE_SHIFTED_WARM_START,(int)useShiftedWarmStart );
+	alg.set( PRINTLEVEL,NONE );
+
+	StaticReferenceTrajectory zeroReference;
+
+	Controller controller( alg,zeroReference );
+
+
+    // SETTING UP THE SIMULATION ENVIRONMENT AND RUN IT:
+    // --------------------------------------------------
+	SimulationEnvironment sim( 0.0,2.5,process,controller );
+
+	Vector x0(4);
+	x0.setZero( );
+	x0(0) = 0.01;
+	x0(1) = 0.02;
+
+	ACADO_TRY( sim.init( x0 ) );
+	ACADO_TRY( sim.run( ) );
+
+	sim.getProcessDifferentialStates( diffStates );
+	sim.getFeedbackControl( feedbackControl );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+/* returns the largest difference between two trajectories on the same grid */
+static double maxDifference(	const VariablesGrid& a,
+								const VariablesGrid& b
+								)
+{
+	double maxDiff = 0.0;
+
+	for( uint i=0; i<a.getNumPoints( ); ++i )
+		for( uint j=0; j<a.getNumValues( ); ++j )
+			if ( fabs( a( i,j ) - b( i,j ) ) > maxDiff )
+				maxDiff = fabs( a( i,j ) - b( i,j ) );
+
+	return maxDiff;
+}
+
+
+int main( )
+{
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+	DifferentialState xB; //Body Position
+	DifferentialState xW; //Wheel Position
+	DifferentialState vB; //Body Velocity
+	DifferentialState vW; //Wheel Velocity
+
+	Control F;
+
+	double mB = 350.0;
+	double mW = 50.0;
+	double kS = 20000.0;
+	double kT = 200000.0;
+
+
+    // DEFINE A DIFFERENTIAL EQUATION:
+    // -------------------------------
+    DifferentialEquation f;
+
+	f << dot(xB) == vB;
+	f << dot(xW) == vW;
+	f << dot(vB) == ( -kS*xB + kS*xW + F ) / mB;
+	f << dot(vW) == (  kS*xB - (kT+kS)*xW - F ) / mW;
+
+	OutputFcn identity;
+	DynamicSystem dynamicSystem( f,identity );
+
+
+    // DEFINE AN OPTIMAL CONTROL PROBLEM:
+    // ----------------------------------
+    Function h;
+
+    h << xB;
+    h << xW;
+	h << vB;
+    h << vW;
+	h << F;
+
+    Matrix Q = zeros(5,5); // LSQ coefficient matrix
+	Q(0,0) = 10.0;
+	Q(1,1) = 10.0;
+	Q(2,2) = 1.0;
+	Q(3,3) = 1.0;
+	Q(4,4) = 1.0e-8;
+
+    Vector r(5); // Reference
+    r.setAll( 0.0 );
+
+
+    const double tStart = 0.0;
+    const double tEnd   = 1.0;
+
+    OCP ocp( tStart, tEnd, 20 );
+
+    ocp.minimizeLSQ( Q, h, r );
+
+	ocp.subjectTo( f );
+
+	ocp.subjectTo( -200.0 <= F <= 200.0 );
+
+
+    // RUN THE CLOSED LOOP WITHOUT AND WITH SHIFTED WARM START:
+    // ---------------------------------------------------------
+	VariablesGrid xCold, uCold;
+	VariablesGrid xWarm, uWarm;
+
+	if ( runClosedLoop( ocp,dynamicSystem,BT_FALSE,xCold,uCold ) != SUCCESSFUL_RETURN )
+		return 1;
+
+	if ( runClosedLoop( ocp,dynamicSystem,BT_TRUE,xWarm,uWarm ) != SUCCESSFUL_RETURN )
+		return 1;
+
+	if ( ( xCold.getNumPoints( ) != xWarm.getNumPoints( ) ) ||
+		 ( uCold.getNumPoints( ) != uWarm.getNumPoints( ) ) )
+	{
+		acadoPrintf( "closed-loop trajectories have different lengths\n" );
+		return 1;
+	}
+
+	double xDiff = maxDifference( xCold,xWarm );
+	double uDiff = maxDifference( uCold,uWarm );
+
+	acadoPrintf( "max. state difference:    %.3e\n",xDiff );
+	acadoPrintf( "max. feedback difference: %.3e\n",uDiff );
+
+	// the warm start has to steer the wheel to rest like the cold start
+	acadoPrintf( "final wheel position:     %+.3e (cold), %+.3e (warm)\n",
+				 xCold( xCold.getLastIndex( ),1 ),xWarm( xWarm.getLastIndex( ),1 ) );
+
+	if ( ( xDiff > 1.0e-6 ) || ( uDiff > 1.0e-3 ) )
+		return 1;
+
+	return 0;
+}
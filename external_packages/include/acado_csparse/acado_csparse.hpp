@@ -42,6 +42,7 @@
 
 // FORWARD DECLARATIONS:
 // ---------------------
+   struct cs_sparse  ;
    struct cs_numeric ;
    struct cs_symbolic;
 
@@ -51,11 +52,22 @@ BEGIN_NAMESPACE_ACADO
 
 
 /**
- *	\brief (not yet documented)
+ *	\brief Sparse LU solver based on CSparse.
  *
  *	\ingroup ExternalFunctionality
  *
- *	The class ...
+ *	The class ACADOcsparse wraps the sparse LU factorization of CSparse.
+ *
+ *	The sparsity pattern and its symbolic analysis are kept between
+ *	successive calls of setMatrix(): as long as the dimension does not
+ *	change and the index list passed to setIndices() is contained in the
+ *	stored pattern, a new matrix is factorized numerically into the
+ *	existing L and U storage, re-using the pivot sequence of the last full
+ *	factorization. If new entries appear, the pattern is extended by them,
+ *	i.e. it settles down after a few changes even if small entries
+ *	alternately drop out of the index list. A full factorization is only
+ *	computed again if the pattern grows or if a re-used pivot becomes
+ *	too small.
  *
  *  \author Boris Houska, Hans Joachim Ferreau
  */
@@ -115,6 +127,20 @@ class ACADOcsparse : public SparseSolver{
 
 
 
+        /** Sets the matrix A from its dense (row-major) representation. \n
+         *  If the dimension is unchanged, the values are scattered into  \n
+         *  the stored pattern directly; the index list is only set up    \n
+         *  again if an entry outside of the pattern exceeds zeroTol.     \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                \n
+         */
+        virtual returnValue setDenseMatrix( const int    &n,
+                                            const double *A_,
+                                            double        zeroTol );
+
+
+
         /**  Solves the system  A*x = b  for the specified data.       \n
          *                                                             \n
          *   \return SUCCESSFUL_RETURN                                 \n
@@ -167,6 +193,40 @@ class ACADOcsparse : public SparseSolver{
     //
     protected:
 
+        /** Computes the LU factorization of the current matrix with the  \n
+         *  pivot sequence and the sparsity pattern of L and U taken from  \n
+         *  the previous factorization.                                    \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR if a pivot      \n
+         *          does not satisfy the pivot tolerance.                  \n
+         */
+        returnValue refactorize( );
+
+
+        /** Factorizes the values stored in the compressed matrix, re-using \n
+         *  the previous pivot sequence if possible.                         \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                   \n
+         */
+        returnValue factorize( );
+
+
+        /** Sets up the compressed matrix for the union of the current    \n
+         *  index list and the previous pattern and computes its symbolic  \n
+         *  analysis.                                                      \n
+         *                                                                 \n
+         *  \return SUCCESSFUL_RETURN                                      \n
+         */
+        returnValue setupPattern( );
+
+
+        /** Deletes the compressed matrix and its factorization; they are \n
+         *  set up again by the next call of setMatrix().                  \n
+         */
+        void clearAnalysis( );
+
 
 
     //
@@ -186,10 +246,14 @@ class ACADOcsparse : public SparseSolver{
     // DATA:
     // --------------------
     double              *x;          // The result vector    x
+    double              *w;          // workspace for the numeric refactorization
 
 
     // AUXILIARY VARIABLES:
     // --------------------
+    cs_sparse           *A;          // the matrix in compressed-column format (fixed pattern)
+    int           *entries;          // position of each element of the index list in A
+    int          *position;          // position of each element (i,j) in A, or -1 (dense dim x dim map)
     cs_symbolic         *S;          // pointer to a struct, which contains symbolic information about the matrix
     cs_numeric          *N;          // pointer to a struct, which contains numeric information about the matrix
 
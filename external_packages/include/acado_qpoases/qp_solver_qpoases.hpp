@@ -176,6 +176,15 @@ class QPsolver_qpOASES : public DenseQPsolver
         virtual returnValue getVarianceCovariance( Matrix &H, Matrix &var );
 
 
+        /** Sets a guess for the dual solution of the next QP. Its nonzero entries  \n
+         *  define the working set the next QP solution is initialised with; the    \n
+         *  guess is used once and dropped if it does not match the QP dimensions.  \n
+         *                                                                          \n
+         *  \return SUCCESSFUL_RETURN                                               \n
+         */
+        virtual returnValue setWorkingSetGuess( const Vector& yGuess );
+
+
 
     //
     // PROTECTED MEMBER FUNCTIONS:
@@ -198,6 +207,8 @@ class QPsolver_qpOASES : public DenseQPsolver
     //
     protected:
 		qpOASES::SQProblem* qp;
+
+		Vector dualSolutionGuess;				/**< Guess for the dual solution of the next QP (defines its initial working set). */
 };
 
 
@@ -55,32 +55,123 @@ ACADOcsparse::ACADOcsparse()
 	index1 = 0;
 	index2 = 0;
 	x = 0;
+	w = 0;
+	A = 0;
+	entries = 0;
+	position = 0;
 	S = 0;
 	N = 0;
 	TOL = 1e-14;
 	printLevel = LOW;
 }
 
+/* Returns a deep copy of the compressed-column matrix C. */
+static cs* copySparse(const cs *C)
+{
+	if (C == 0)
+		return 0;
+
+	cs *D = cs_spalloc(C->m, C->n, C->nzmax, C->x != 0, 0);
+
+	memcpy(D->p, C->p, (C->n + 1) * sizeof(int));
+	memcpy(D->i, C->i, C->nzmax * sizeof(int));
+	if (C->x != 0)
+		memcpy(D->x, C->x, C->nzmax * sizeof(double));
+
+	return D;
+}
+
+/* Returns a deep copy of the integer array v of length n. */
+static int* copyIndices(const int *v, int n)
+{
+	if (v == 0)
+		return 0;
+
+	int *u = (int*) cs_malloc(n, sizeof(int));
+	memcpy(u, v, n * sizeof(int));
+
+	return u;
+}
+
 ACADOcsparse::ACADOcsparse(const ACADOcsparse &arg)
 {
 	int run1;
 
 	dim = arg.dim;
 	nDense = arg.nDense;
-	index1 = 0;
-	index2 = 0;
+
+	if (arg.index1 == 0)
+	{
+		index1 = 0;
+		index2 = 0;
+	}
+	else
+	{
+		index1 = new int[nDense];
+		index2 = new int[nDense];
+		for (run1 = 0; run1 < nDense; run1++)
+		{
+			index1[run1] = arg.index1[run1];
+			index2[run1] = arg.index2[run1];
+		}
+	}
 
 	if (arg.x == 0)
+	{
 		x = 0;
+		w = 0;
+	}
 	else
 	{
 		x = new double[dim];
+		w = new double[dim];
 		for (run1 = 0; run1 < dim; run1++)
+		{
 			x[run1] = arg.x[run1];
+			w[run1] = 0.0;
+		}
 	}
 
-	S = 0;
-	N = 0;
+	A = copySparse(arg.A);
+
+	if (arg.entries == 0)
+		entries = 0;
+	else
+	{
+		entries = new int[nDense];
+		for (run1 = 0; run1 < nDense; run1++)
+			entries[run1] = arg.entries[run1];
+	}
+
+	if (arg.position == 0)
+		position = 0;
+	else
+	{
+		position = new int[dim * dim];
+		for (run1 = 0; run1 < dim * dim; run1++)
+			position[run1] = arg.position[run1];
+	}
+
+	if (arg.S == 0)
+		S = 0;
+	else
+	{
+		S = (css*) cs_calloc(1, sizeof(css));
+		S->q = copyIndices(arg.S->q, dim);
+		S->m2 = arg.S->m2;
+		S->lnz = arg.S->lnz;
+		S->unz = arg.S->unz;
+	}
+
+	if (arg.N == 0)
+		N = 0;
+	else
+	{
+		N = (csn*) cs_calloc(1, sizeof(csn));
+		N->L = copySparse(arg.N->L);
+		N->U = copySparse(arg.N->U);
+		N->pinv = copyIndices(arg.N->pinv, dim);
+	}
 
 	TOL = arg.TOL;
 	printLevel = arg.printLevel;
@@ -94,22 +185,14 @@ ACADOcsparse::~ACADOcsparse()
 		delete[] index2;
 	if (x != 0)
 		delete[] x;
-
-	if (S != 0)
-		cs_free(S);
-	if (N != 0)
-	{
-
-		if (N->L != 0)
-			cs_spfree(N->L);
-		if (N->U != 0)
-			cs_spfree(N->U);
-		if (N->pinv != 0)
-			free(N->pinv);
-		if (N->B != 0)
-			free(N->B);
-		free(N);
-	}
+	if (w != 0)
+		delete[] w;
+	if (entries != 0)
+		delete[] entries;
+	if (position != 0)
+		delete[] position;
+
+	clearAnalysis();
 }
 
 ACADOcsparse* ACADOcsparse::clone() const
@@ -126,7 +209,7 @@ returnValue ACADOcsparse::solve(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
@@ -147,7 +230,7 @@ returnValue ACADOcsparse::solveTranspose(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
@@ -162,68 +245,150 @@ returnValue ACADOcsparse::solveTranspose(double *b)
 
 returnValue ACADOcsparse::setDimension(const int &n)
 {
+	int run1;
+
+	if (n == dim && x != 0)
+		return SUCCESSFUL_RETURN;
+
+	clearAnalysis();
 	dim = n;
 
+	if (position != 0)
+	{
+		delete[] position;
+		position = 0;
+	}
+
 	if (x != 0)
 	{
 		delete[] x;
 		x = 0;
 	}
+	if (w != 0)
+	{
+		delete[] w;
+		w = 0;
+	}
 	x = new double[dim];
+	w = new double[dim];
+
+	for (run1 = 0; run1 < dim; run1++)
+		w[run1] = 0.0;
 
 	return SUCCESSFUL_RETURN;
 }
 
 returnValue ACADOcsparse::setNumberOfEntries(const int &nDense_)
 {
-	nDense = nDense_;
-	return SUCCESSFUL_RETURN;
-}
+	if (nDense_ == nDense)
+		return SUCCESSFUL_RETURN;
 
-returnValue ACADOcsparse::setIndices(const int *rowIdx_, const int *colIdx_)
-{
 	if (index1 != 0)
 		delete[] index1;
 	if (index2 != 0)
 		delete[] index2;
+	if (entries != 0)
+		delete[] entries;
+	index1 = 0;
+	index2 = 0;
+	entries = 0;
+
+	nDense = nDense_;
+	return SUCCESSFUL_RETURN;
+}
 
+returnValue ACADOcsparse::setIndices(const int *rowIdx_, const int *colIdx_)
+{
 	int run1;
 
-	index1 = new int[nDense];
-	index2 = new int[nDense];
+	if (index1 != 0)
+	{
+		for (run1 = 0; run1 < nDense; run1++)
+			if (index1[run1] != rowIdx_[run1] || index2[run1] != colIdx_[run1])
+				break;
+
+		if (run1 == nDense)
+			return SUCCESSFUL_RETURN;
+	}
+	else
+	{
+		index1 = new int[nDense];
+		index2 = new int[nDense];
+	}
 
 	for (run1 = 0; run1 < nDense; run1++)
 	{
 		index1[run1] = rowIdx_[run1];
 		index2[run1] = colIdx_[run1];
 	}
-	return SUCCESSFUL_RETURN;
+
+	if (entries == 0)
+		entries = new int[nDense];
+
+	// KEEP THE ANALYSIS IF THE NEW PATTERN IS CONTAINED IN THE OLD ONE:
+	// ------------------------------------------------------------------
+	if (A != 0)
+	{
+		for (run1 = 0; run1 < nDense; run1++)
+		{
+			entries[run1] = position[index1[run1] * dim + index2[run1]];
+			if (entries[run1] < 0)
+				break;
+		}
+
+		if (run1 == nDense)
+			return SUCCESSFUL_RETURN;
+	}
+
+	return setupPattern();
 }
 
 returnValue ACADOcsparse::setMatrix(double *A_)
 {
 	int run1;
-	int order = 0;
 
 	if (dim <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (nDense <= 0)
+	if (nDense <= 0 || index1 == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
-	cs *C, *D;
-	C = cs_spalloc(0, 0, 1, 1, 1);
+	if (A == 0)
+		setupPattern();
 
+	// entries of the pattern that are not in the index list are zero:
+	for (run1 = 0; run1 < A->p[dim]; run1++)
+		A->x[run1] = 0.0;
 	for (run1 = 0; run1 < nDense; run1++)
-		cs_entry(C, index1[run1], index2[run1], A_[run1]);
+		A->x[entries[run1]] = A_[run1];
 
-	D = cs_compress(C);
-	S = cs_sqr(order, D, 0);
-	N = cs_lu(D, S, TOL);
+	return factorize();
+}
 
-	cs_spfree(C);
-	cs_spfree(D);
+returnValue ACADOcsparse::setDenseMatrix(const int &n, const double *A_, double zeroTol)
+{
+	int run1, run2, p;
 
-	return SUCCESSFUL_RETURN;
+	if (n != dim || A == 0)
+		return SparseSolver::setDenseMatrix(n, A_, zeroTol);
+
+	// SCATTER THE VALUES INTO THE STORED PATTERN:
+	// -------------------------------------------
+	// all other entries are only compared against zeroTol; a new
+	// non-zero entry requires to extend the pattern and its analysis
+	for (run1 = 0; run1 < dim; run1++)
+	{
+		for (run2 = 0; run2 < dim; run2++)
+		{
+			p = position[run1 * dim + run2];
+
+			if (p >= 0)
+				A->x[p] = A_[run1 * dim + run2];
+			else if (fabs(A_[run1 * dim + run2]) > zeroTol)
+				return SparseSolver::setDenseMatrix(n, A_, zeroTol);
+		}
+	}
+
+	return factorize();
 }
 
 returnValue ACADOcsparse::getX(double *x_)
@@ -247,6 +412,151 @@ returnValue ACADOcsparse::setPrintLevel(PrintLevel printLevel_)
 	return SUCCESSFUL_RETURN;
 }
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue ACADOcsparse::refactorize()
+{
+	int k, p, q, j, col;
+	double ujk, pivot, a;
+
+	cs *L = N->L;
+	cs *U = N->U;
+	const int *pinv = N->pinv;
+
+	for (k = 0; k < dim; k++)
+	{
+		col = (S->q != 0) ? S->q[k] : k;
+
+		// scatter A(:,col) into the workspace (rows in pivot order):
+		for (p = A->p[col]; p < A->p[col + 1]; p++)
+			w[pinv[A->i[p]]] = A->x[p];
+
+		// U(:,k) in the topological order of the last factorization,
+		// the diagonal entry U(k,k) is stored last:
+		for (p = U->p[k]; p < U->p[k + 1] - 1; p++)
+		{
+			j = U->i[p];
+			ujk = w[j];
+			w[j] = 0.0;
+			U->x[p] = ujk;
+
+			for (q = L->p[j] + 1; q < L->p[j + 1]; q++)
+				w[L->i[q]] -= L->x[q] * ujk;
+		}
+
+		pivot = w[k];
+		w[k] = 0.0;
+
+		// the pivot has to satisfy the same threshold as in cs_lu:
+		a = fabs(pivot);
+		for (q = L->p[k] + 1; q < L->p[k + 1]; q++)
+			if (fabs(w[L->i[q]]) > a)
+				a = fabs(w[L->i[q]]);
+
+		if (a <= 0.0 || fabs(pivot) < a * TOL)
+		{
+			for (q = L->p[k] + 1; q < L->p[k + 1]; q++)
+				w[L->i[q]] = 0.0;
+			return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+		}
+
+		U->x[U->p[k + 1] - 1] = pivot;
+		L->x[L->p[k]] = 1.0;
+
+		for (q = L->p[k] + 1; q < L->p[k + 1]; q++)
+		{
+			L->x[q] = w[L->i[q]] / pivot;
+			w[L->i[q]] = 0.0;
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ACADOcsparse::factorize()
+{
+	// NUMERIC REFACTORIZATION WITH THE PREVIOUS PIVOT SEQUENCE:
+	// ---------------------------------------------------------
+	if (N != 0 && refactorize() == SUCCESSFUL_RETURN)
+		return SUCCESSFUL_RETURN;
+
+	// FULL FACTORIZATION WITH PARTIAL PIVOTING:
+	// -----------------------------------------
+	if (N != 0)
+		N = cs_nfree(N);
+
+	N = cs_lu(A, S, TOL);
+
+	if (N == 0)
+		return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue ACADOcsparse::setupPattern()
+{
+	int run1, run2, p;
+	int order = 0;
+
+	cs *C = cs_spalloc(0, 0, 1, 1, 1);
+
+	// the values of the triplet matrix keep track of the origin of each
+	// entry: k >= 0 for the k-th element of the index list, -1 for an
+	// element that is only contained in the previous pattern.
+	if (position == 0)
+	{
+		position = new int[dim * dim];
+		for (run1 = 0; run1 < dim * dim; run1++)
+			position[run1] = -1;
+	}
+
+	for (run1 = 0; run1 < nDense; run1++)
+	{
+		cs_entry(C, index1[run1], index2[run1], (double) run1);
+		position[index1[run1] * dim + index2[run1]] = -2;
+	}
+
+	if (A != 0)
+	{
+		for (run2 = 0; run2 < dim; run2++)
+			for (p = A->p[run2]; p < A->p[run2 + 1]; p++)
+				if (position[A->i[p] * dim + run2] >= 0)
+					cs_entry(C, A->i[p], run2, -1.0);
+	}
+
+	clearAnalysis();
+
+	A = cs_compress(C);
+	cs_spfree(C);
+
+	for (run2 = 0; run2 < dim; run2++)
+	{
+		for (p = A->p[run2]; p < A->p[run2 + 1]; p++)
+		{
+			position[A->i[p] * dim + run2] = p;
+			if (A->x[p] >= 0.0)
+				entries[(int) A->x[p]] = p;
+		}
+	}
+
+	S = cs_sqr(order, A, 0);
+
+	return SUCCESSFUL_RETURN;
+}
+
+void ACADOcsparse::clearAnalysis()
+{
+	if (A != 0)
+		A = cs_spfree(A);
+
+	if (S != 0)
+		S = cs_sfree(S);
+	if (N != 0)
+		N = cs_nfree(N);
+}
+
 CLOSE_NAMESPACE_ACADO
 
 #else // __MATLAB__
@@ -298,6 +608,11 @@ returnValue ACADOcsparse::setMatrix( double *A_ )
 	return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
 }
 
+returnValue ACADOcsparse::setDenseMatrix( const int &n, const double *A_, double zeroTol )
+{
+	return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+}
+
 returnValue ACADOcsparse::solveTranspose( double *b )
 {
 	return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
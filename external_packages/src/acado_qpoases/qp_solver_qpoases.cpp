@@ -58,6 +58,8 @@ QPsolver_qpOASES::QPsolver_qpOASES( const QPsolver_qpOASES& rhs ) : DenseQPsolve
 		qp = new qpOASES::SQProblem( *(rhs.qp) );
 	else
 		qp = 0;
+
+	dualSolutionGuess = rhs.dualSolutionGuess;
 }
 
 
@@ -83,6 +85,7 @@ QPsolver_qpOASES& QPsolver_qpOASES::operator=( const QPsolver_qpOASES& rhs )
 		else
 			qp = 0;
 
+		dualSolutionGuess = rhs.dualSolutionGuess;
     }
 
     return *this;
@@ -131,6 +134,19 @@ returnValue QPsolver_qpOASES::solve(	double* H,
 	{
 		returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
 	}
+	else if ( dualSolutionGuess.getDim( ) == (uint)( qp->getNV( ) + qp->getNC( ) ) )
+	{
+		/* initialise the working set from the given dual guess, fall back to a cold start if it is not consistent */
+		qp->reset( );
+		returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0, 0,dualSolutionGuess.getDoublePointer( ),0,0 );
+
+		if ( ( returnvalue != qpOASES::SUCCESSFUL_RETURN ) && ( returnvalue != qpOASES::RET_MAX_NWSR_REACHED ) )
+		{
+			numberOfSteps = maxIter;
+			qp->reset( );
+			returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
+		}
+	}
 	else
 	{
 		int performHotstart = 0;
@@ -149,6 +165,8 @@ returnValue QPsolver_qpOASES::solve(	double* H,
 	}
 	setLast( LOG_NUM_QP_ITERATIONS, numberOfSteps );
 
+	dualSolutionGuess.init( 0 );
+
 //	acadoPrintf( "nEC: %d\n", qp->getNEC( ) );
 
 	/* update QP status and determine return value */
@@ -268,6 +286,13 @@ returnValue QPsolver_qpOASES::getVarianceCovariance( Matrix &var ){
 }
 
 
+returnValue QPsolver_qpOASES::setWorkingSetGuess( const Vector& yGuess )
+{
+	dualSolutionGuess = yGuess;
+	return SUCCESSFUL_RETURN;
+}
+
+
 uint QPsolver_qpOASES::getNumberOfVariables( ) const
 {
 	if ( qp != 0 )
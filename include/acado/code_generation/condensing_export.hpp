@@ -309,7 +309,7 @@ class CondensingExport : public ExportAlgorithm
 		ExportVariable QS2;				/**< Second weighting matrix for free initial value. */
 		ExportVariable QQF;				/**< Variable containing the sum of Q and QF. */
 
-		ExportVariable state;			/**< Variable containing the augmented state vector to call the integrator. */
+		ExportVariable state;			/**< Variable containing the augmented state vector to call the integrator (one per interval for multiple shooting). */
 		ExportVariable residuum;		/**< Variable containing multi-shooting residuum. */
 		ExportVariable g0;				/**< Variable containing gradient of Lagrange function w.r.t. initial state. */
 		ExportVariable g1;				/**< Variable containing gradient of Lagrange function w.r.t. control inputs. */
@@ -188,6 +188,29 @@ class ExportODEfunction : public ExportFunction
 
 		unsigned getFunctionDim( void );
 
+		/** Enables or disables the elimination of common subexpressions, constant
+		 *	folding and removal of unused intermediate results in the exported code.
+		 *
+		 *	@param[in] _optimize	Whether the exported code shall be optimised.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setExportOptimization(	BooleanType _optimize
+											);
+
+		/** Counts the arithmetic operations of the exported code without and
+		 *	with optimisation. Both counts are zero if the function is not defined.
+		 *
+		 *	@param[out] _nBefore	Number of operations without optimisation.
+		 *	@param[out] _nAfter		Number of operations with optimisation.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue getNumExportOperations(	int& _nBefore,
+											int& _nAfter
+											) const;
+
 
 	//
     // PROTECTED MEMBER FUNCTIONS:
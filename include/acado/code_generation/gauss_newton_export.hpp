@@ -114,6 +114,25 @@ class GaussNewtonExport : public ExportAlgorithm
 		returnValue setControlBounds(	const VariablesGrid& _uBounds
 										);
 
+		/** Assigns nonlinear path constraints lb <= h(x,u) <= ub, which are
+		 *	imposed on the shooting nodes 0,...,N (0,...,N-1 if only N rows of
+		 *	bounds are given); the terminal node uses the last control. The
+		 *	constraints are linearised at the current iterate within the
+		 *	preparation step and condensed into the QP constraint matrix.
+		 *
+		 *	@param[in] _h			Path constraint function (states and controls only).
+		 *	@param[in] _lb			Lower bounds, one row per grid point.
+		 *	@param[in] _ub			Upper bounds, one row per grid point.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_ONLY_STATES_AND_CONTROLS_FOR_CODE_EXPORT, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue setPathConstraints(	const Function& _h,
+										const Matrix& _lb,
+										const Matrix& _ub
+										);
+
 
 		/** Adds all data declarations of the auto-generated Gauss-Newton algorithm 
 		 *	to given list of declarations.
@@ -168,9 +187,29 @@ class GaussNewtonExport : public ExportAlgorithm
 		 */
 		uint getNumStateBounds( ) const;
 
+		/** Returns number of path constraints over the whole horizon.
+		 *
+		 *  \return Number of path constraints
+		 */
+		uint getNumPathConstraints( ) const;
+
+		/** Returns number of constraints in underlying QP, i.e. bounds on
+		 *	differential states plus path constraints.
+		 *
+		 *  \return Number of constraints in underlying QP
+		 */
+		uint getNumConstraints( ) const;
+
 
 	protected:
 
+		/** Sets up the exported function that evaluates, linearises and condenses
+		 *	the path constraints at all shooting nodes.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setupPathConstraints( );
+
 		/** Copies all class members from given object.
 		 *
 		 *	@param[in] arg		Right-hand side object.
@@ -192,6 +231,10 @@ class GaussNewtonExport : public ExportAlgorithm
 		CondensingExport* condenser;				/**< Module for exporting a tailored condensing algorithm. */
 		VariablesGrid uBounds;						/**< Stores lower/upper bounds on control inputs. */
 
+		ExportODEfunction pathConstraints;			/**< Module to export the evaluation of the path constraints and their Jacobians. */
+		Matrix lbPathConValues;						/**< Lower bounds on the path constraints, one row per shooting node. */
+		Matrix ubPathConValues;						/**< Upper bounds on the path constraints, one row per shooting node. */
+
 		ExportVariable x;							/**< Variable containing the exported differential states. */
 		ExportVariable u;							/**< Variable containing the exported control inputs. */
 
@@ -206,6 +249,10 @@ class GaussNewtonExport : public ExportAlgorithm
 		ExportVariable g1;							/**< Variable containing gradient of Lagrange function w.r.t. control inputs. */
 		ExportVariable lbAValues;					/**< Variable containing user-defined lower limits on differential states. */
 		ExportVariable ubAValues;					/**< Variable containing user-defined upper limits on differential states. */
+		ExportVariable conValueIn;					/**< Variable containing the input of the path constraint evaluation. */
+		ExportVariable conValueOut;					/**< Variable containing values and Jacobians of the path constraints at one node. */
+		ExportVariable conRes;						/**< Variable containing the constant part of the linearised path constraints. */
+		ExportVariable conHxC;						/**< Variable containing the path constraint Jacobians w.r.t. the initial state. */
 
 		ExportVariable H;							/**< Variable containing the QP Hessian matrix. */
 		ExportVariable A;							/**< Variable containing the QP constraint matrix. */
@@ -224,6 +271,7 @@ class GaussNewtonExport : public ExportAlgorithm
 		ExportFunction shiftControls;				/**< Function implementing a shift of the control variables. */
 		ExportFunction shiftStates;					/**< Function implementing a shift of the state variables. */
 		ExportFunction getKKT;						/**< Function returning the KKT tolerance of current iterate. */
+		ExportFunction condensePathConstraints;		/**< Function linearising and condensing the path constraints. */
 };
 
 
@@ -208,6 +208,29 @@ class ExplicitRungeKuttaExport : public RungeKuttaExport
 		virtual returnValue initializeButcherTableau() = 0;
 
 
+		/** Determines which sensitivities of the variational equations can be
+		 *  nonzero, given the structural zeros of the Jacobians Jx and Ju, and
+		 *  copies the corresponding entries of Gx and Gu into GxS and GuS. The
+		 *  remaining entries of GxS and GuS are left at zero.
+		 *
+		 *	@param[in] Jx		Jacobian of the right-hand side w.r.t. the states.
+		 *	@param[in] Ju		Jacobian of the right-hand side w.r.t. the controls.
+		 *	@param[in] Gx		Sensitivities w.r.t. the initial states.
+		 *	@param[in] Gu		Sensitivities w.r.t. the controls.
+		 *	@param[out] GxS		Structurally nonzero sensitivities w.r.t. the initial states.
+		 *	@param[out] GuS		Structurally nonzero sensitivities w.r.t. the controls.
+		 *
+		 *	\return Number of products Jx(i,k)*G(k,j) which are structurally nonzero.
+		 */
+		uint setupSensitivityPattern(	const Expression& Jx,
+										const Expression& Ju,
+										const Expression& Gx,
+										const Expression& Gu,
+										IntermediateState& GxS,
+										IntermediateState& GuS
+										) const;
+
+
     protected:
 
 };
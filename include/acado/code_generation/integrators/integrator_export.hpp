@@ -292,6 +292,22 @@ class IntegratorExport : public ExportAlgorithm
 		virtual returnValue clear( );
 
 
+
+		/** Enables or disables the optimisation of all exported model functions
+		 *	and counts their arithmetic operations without and with optimisation.
+		 *
+		 *	@param[in] optimize		Whether the exported code shall be optimised.
+		 *	@param[out] nBefore		Number of operations without optimisation.
+		 *	@param[out] nAfter		Number of operations with optimisation.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue setExportOptimization(	BooleanType optimize,
+													int& nBefore,
+													int& nAfter
+													);
+
+
 		/**	Get the index of the integration interval, corresponding a certain time.
 		 *
 		 * 	@param[in] time		The time.
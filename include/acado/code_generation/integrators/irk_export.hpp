@@ -691,6 +691,22 @@ class ImplicitRungeKuttaExport : public RungeKuttaExport
 		virtual returnValue copy(	const ImplicitRungeKuttaExport& arg
 							);
 
+
+
+		/** Enables or disables the optimisation of all exported model functions
+		 *	including the linear input and output subsystems.
+		 *
+		 *	@param[in] optimize		Whether the exported code shall be optimised.
+		 *	@param[out] nBefore		Number of operations without optimisation.
+		 *	@param[out] nAfter		Number of operations with optimisation.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue setExportOptimization(	BooleanType optimize,
+													int& nBefore,
+													int& nAfter
+													);
+
 		
 		/** This routine initializes the matrices AA, bb and cc which
 		 * 	form the Butcher Tableau. */
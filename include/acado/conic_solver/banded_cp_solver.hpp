@@ -135,12 +135,31 @@ class BandedCPsolver: public AlgorithmicBase
 		virtual returnValue unfreezeCondensing( );
 
 
+        /** Passes the multipliers of the given banded conic program as a   \n
+         *  guess for the working set of the next solution. Solvers without \n
+         *  working set ignore this guess.                                   \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         */
+        virtual returnValue setWorkingSetGuess(	const BandedCP& cp
+												);
+
+
 
 	protected:
 
 		virtual returnValue setupOptions( );
 		virtual returnValue setupLogging( );
 
+
+        /** Checks whether the Hessian is positive definite and projects \n
+         *  the Hessian based on a heuristic damping factor. If this     \n
+         *  damping factor is smaller than 0, the routine does nothing.  \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN.                                   \n
+         */
+        returnValue projectHessian( Matrix &H_, double dampingFactor );
+
 };
 
 
@@ -147,12 +147,35 @@ class CondensingBasedCPsolver: public BandedCPsolver {
 		virtual returnValue unfreezeCondensing( );
 
 
+        /** Maps the multipliers of the given banded conic program onto the \n
+         *  bounds and constraints of the condensed QP and passes them to    \n
+         *  the dense CP solver as a guess for its next working set.         \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         */
+        virtual returnValue setWorkingSetGuess(	const BandedCP& cp
+												);
+
+
 
     //
     // PROTECTED MEMBER FUNCTIONS:
     //
     protected:
 
+        /** Copies a block of multipliers into the dual guess of the condensed \n
+         *  QP, starting at the given offset which is advanced by dim. Blocks   \n
+         *  of a different dimension leave the guess at zero.                   \n
+         *                                                                      \n
+         *  \return SUCCESSFUL_RETURN                                           \n
+         */
+        returnValue setDualBlockGuess(	const BlockMatrix& lambda,
+										uint idx,
+										uint dim,
+										uint& offset,
+										Vector& yGuess
+										) const;
+
         /** Initializes QP objects.
 		 *  \return SUCCESSFUL_RETURN \n
 		 *          RET_QP_INIT_FAILED */
@@ -176,15 +199,6 @@ class CondensingBasedCPsolver: public BandedCPsolver {
 
 
 
-        /** Checks whether the Hessian is positive definite and projects \n
-         *  the Hessian based on a heuristic damping factor. If this     \n
-         *  damping factor is smaller than 0, the routine does nothing.  \n
-         *                                                               \n
-         *  \return SUCCESSFUL_RETURN.                                   \n
-         */
-        returnValue projectHessian( Matrix &H_, double dampingFactor );
-
-
 		// --------
 		// SQP DATA
 		// --------
@@ -112,6 +112,15 @@ class DenseCPsolver : public AlgorithmicBase
         virtual uint getNumberOfIterations( ) const = 0;
 
 
+        /** Sets a guess for the dual solution of the next CP; its nonzero     \n
+         *  entries define the initial working set. Solvers without working   \n
+         *  set ignore this guess.                                             \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         */
+        virtual returnValue setWorkingSetGuess( const Vector& yGuess );
+
+
 		
     //
     // PROTECTED MEMBER FUNCTIONS:
@@ -0,0 +1,284 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/conic_solver/interior_point_based_cp_solver.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *
+ */
+
+
+#ifndef ACADO_TOOLKIT_INTERIOR_POINT_BASED_CP_SOLVER_HPP
+#define ACADO_TOOLKIT_INTERIOR_POINT_BASED_CP_SOLVER_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/clock/real_clock.hpp>
+#include <acado/conic_solver/banded_cp_solver.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Solves banded conic programs arising in optimal control without condensing.
+ *	\ingroup NumericalAlgorithm
+ *  The class interior point based CP solver solves band structured
+ *  quadratic programs directly by a primal-dual interior point method
+ *  (Mehrotra's predictor-corrector scheme).
+ *
+ *  Each node of the horizon is treated as a stage with the variables
+ *  (x,p,xa,u,w). The parameters as well as the controls and disturbances
+ *  at the last node are copied from stage to stage by additional equality
+ *  constraints, such that the Hessian and all constraints of the QP act on
+ *  a single stage. The KKT systems of the interior point iterations are
+ *  ordered stage by stage and are factorized by a banded LDL^T
+ *  factorization. Hence, the effort per iteration grows only linearly
+ *  with the number of nodes.
+ *
+ *  The factorization does not pivot. It is applied to a statically
+ *  regularised KKT matrix, and pivots of the wrong sign are replaced by
+ *  small ones of the right sign (dynamic regularisation). The steps are
+ *  computed by iterative refinement against the unregularised matrix. If
+ *  this does not reach a small backward error, the QP solution fails
+ *  instead of taking an inaccurate step.
+ *
+ *  Hessian blocks and constraints that couple different nodes (e.g.
+ *  coupled boundary constraints or a full BFGS update) are not supported.
+ *
+ *  \author Boris Houska, Hans Joachim Ferreau
+ */
+
+class InteriorPointBasedCPsolver: public BandedCPsolver {
+
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        InteriorPointBasedCPsolver( );
+
+        InteriorPointBasedCPsolver(	UserInteraction* _userInteraction,
+									uint nConstraints_,
+									const Vector& blockDims_
+									);
+
+        /** Copy constructor (deep copy). */
+        InteriorPointBasedCPsolver( const InteriorPointBasedCPsolver& rhs );
+
+        /** Destructor. */
+        virtual ~InteriorPointBasedCPsolver( );
+
+        /** Assignment operator (deep copy). */
+        InteriorPointBasedCPsolver& operator=( const InteriorPointBasedCPsolver& rhs );
+
+
+        /** Assignment operator (deep copy). */
+        virtual BandedCPsolver* clone() const;
+
+
+        /** initializes the banded conic solver */
+        virtual returnValue init( const OCPiterate &iter_ );
+
+
+        /** Sets up the stage-wise QP data from a given banded conic program */
+        virtual returnValue prepareSolve(	BandedCP& cp
+											);
+
+		/** Solves a given banded conic program in feedback mode:                   \n
+         *                                                                          \n
+         *  \param cp     the banded conic program to be solved                     \n
+         *                                                                          \n
+         *  \return SUCCESSFUL_RETURN   (if successful)                             \n
+         *          RET_BANDED_CP_SOLUTION_FAILED                                   \n
+         */
+        virtual returnValue solve(	BandedCP& cp
+									);
+
+        /** Writes the primal-dual solution back into the banded conic program */
+        virtual returnValue finalizeSolve(	BandedCP& cp
+											);
+
+
+		inline uint getNX( ) const;
+		inline uint getNXA( ) const;
+		inline uint getNP( ) const;
+		inline uint getNU( ) const;
+		inline uint getNW( ) const;
+
+		inline uint getNC( ) const;
+
+		/** Returns the number of variables per stage. */
+		inline uint getNZ( ) const;
+
+		inline uint getNumPoints( ) const;
+
+
+		virtual returnValue getParameters        ( Vector        &p_  ) const;
+		virtual returnValue getFirstControl      ( Vector        &u0_ ) const;
+
+
+		virtual returnValue setRealTimeParameters(	const Vector& DeltaX,
+													const Vector& DeltaP = emptyConstVector
+													);
+
+		inline BooleanType areRealTimeParametersDefined( ) const;
+
+
+		virtual returnValue freezeCondensing( );
+
+		virtual returnValue unfreezeCondensing( );
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Solves the stage-wise QP using not more than the given number of
+		 *  interior point iterations.
+		 *  \return SUCCESSFUL_RETURN \n
+		 *          RET_QP_SOLUTION_REACHED_LIMIT \n
+		 *          RET_QP_INFEASIBLE \n
+		 *          RET_QP_SOLUTION_FAILED */
+		virtual returnValue solveQP(	uint maxIter				/**< Maximum number of iterations. */
+										);
+
+
+        virtual returnValue solveCPsubproblem( );
+
+
+        /** Determines the stage and the offset within the stage variables   \n
+         *  of a block column of the banded CP (5*N blocks ordered as        \n
+         *  x, xa, p, u, w). Returns BT_TRUE if the block is a copy of the   \n
+         *  parameters, which may be assigned to any stage.                  \n
+         */
+        BooleanType getStageIndex(	uint blockIdx,
+									uint &stage,
+									uint &offset
+									) const;
+
+
+        /** Determines the stage and the offset within the stage variables   \n
+         *  of a block of the bounds of the banded CP (4*N+1 blocks ordered  \n
+         *  as x, xa, p, u, w). Returns BT_FALSE if the block does not       \n
+         *  belong to a stage variable (controls and disturbances at the     \n
+         *  last node, which are copies of their predecessors).              \n
+         */
+        BooleanType getBoundStageIndex(	uint blockIdx,
+										uint &stage,
+										uint &offset,
+										uint &dim
+										) const;
+
+
+        /** Copies Hessian, gradient, bounds, constraints and dynamics of   \n
+         *  the banded CP into the stage-wise QP data.                      \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         *          RET_NOT_YET_IMPLEMENTED if the CP couples several nodes \n
+         */
+        returnValue setupStageData(	BandedCP& cp
+									);
+
+
+        /** Expands the primal-dual solution of the stage-wise QP. */
+        returnValue expand(		BandedCP& cp
+								);
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        OCPiterate iter;
+        Vector blockDims;
+        uint nConstraints;
+
+
+        // STAGE-WISE QP DATA:
+        // ----------------------------------------------------------------------
+
+        Matrix  H;                  /**< Stage Hessians (stacked)                  */
+        Vector  g;                  /**< Stage gradients (stacked)                 */
+        Vector  lb;                 /**< Lower bounds on stage variables (stacked) */
+        Vector  ub;                 /**< Upper bounds on stage variables (stacked) */
+
+        Matrix  A;                  /**< Constraint rows, acting on a single stage */
+        Vector  lbA;                /**< Constraint lower bounds                   */
+        Vector  ubA;                /**< Constraint upper bounds                   */
+        uint   *constraintStage;    /**< Stage of each constraint row              */
+
+        Matrix  G;                  /**< Sensitivities of the dynamics (stacked)   */
+        Vector  b;                  /**< Residuum of the dynamics (stacked)        */
+        // ----------------------------------------------------------------------
+
+
+        // PRIMAL-DUAL SOLUTION:
+        // ----------------------------------------------------------------------
+
+        Vector  z;                  /**< Stage variables (stacked)                 */
+        Vector  yBounds;            /**< Multipliers of the bounds                 */
+        Vector  yConstraints;       /**< Multipliers of the constraints            */
+        Vector  yDynamics;          /**< Multipliers of the dynamics               */
+        // ----------------------------------------------------------------------
+
+
+        // WORK ARRAYS OF THE INTERIOR POINT ITERATIONS:
+        // ----------------------------------------------------------------------
+        // The arrays are kept from one solution to the next and are only
+        // enlarged if the stage-wise QP grows; they are not copied.
+
+        uint   *uintWork;           /**< Stage, variable and offset indices        */
+        int    *rowWork;            /**< Constraint rows (negative for bounds)     */
+        double *realWork;           /**< KKT matrices, iterates and residuals      */
+
+        uint    nUintWork;          /**< Allocated entries of uintWork             */
+        uint    nRowWork;           /**< Allocated entries of rowWork              */
+        uint    nRealWork;          /**< Allocated entries of realWork             */
+        // ----------------------------------------------------------------------
+
+		Vector deltaX;
+		Vector deltaP;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/conic_solver/interior_point_based_cp_solver.ipp>
+
+
+#endif  // ACADO_TOOLKIT_INTERIOR_POINT_BASED_CP_SOLVER_HPP
+
+/*
+ *  end of file
+ */
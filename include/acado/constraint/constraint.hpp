@@ -435,6 +435,12 @@ class Constraint : public BoxConstraint{
         /** returns the dimension of the requested sub-block */
         inline Vector getBlockDims( ) const;
 
+        /** returns the index of the grid point of the requested sub-block if it \n
+         *  belongs to a path or an algebraic consistency constraint, i.e. to a   \n
+         *  constraint that is repeated on each grid point, and -1 otherwise.     \n
+         */
+        inline int getBlockGridIndex( int idx ) const;
+
 
 
         /** returns whether the constraint is affine. */
@@ -443,6 +449,12 @@ class Constraint : public BoxConstraint{
 		/** returns whether object only comprises box constraints. */
 		inline BooleanType isBoxConstraint() const;
 
+		/** returns whether object only comprises box constraints and path  \n
+		 *  constraints, i.e. no boundary, coupled path, algebraic          \n
+		 *  consistency or (non-box) point constraints.                     \n
+		 */
+		inline BooleanType hasOnlyPathConstraints() const;
+
         /** Returns whether or not the constraint is empty.    \n
          *                                                     \n
          *  \return BT_TRUE if no constraint is specified yet. \n
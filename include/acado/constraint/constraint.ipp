@@ -179,6 +179,21 @@ inline BooleanType Constraint::isBoxConstraint() const
 }
 
 
+inline BooleanType Constraint::hasOnlyPathConstraints() const
+{
+	if( boundary_constraint             ->getNC() > 0 ) return BT_FALSE;
+	if( coupled_path_constraint         ->getNC() > 0 ) return BT_FALSE;
+	if( algebraic_consistency_constraint->getNC() > 0 ) return BT_FALSE;
+
+	if( point_constraints != 0 )
+		for( uint run1 = 0; run1 < grid.getNumPoints(); run1++ )
+			if( point_constraints[run1] != 0 )
+				if( point_constraints[run1]->isBoxConstraint() == BT_FALSE ) return BT_FALSE;
+
+	return BT_TRUE;
+}
+
+
 
 inline int Constraint::getNumberOfBlocks() const
 {
@@ -239,6 +254,30 @@ inline int Constraint::getBlockDim( int idx ) const
 }
 
 
+inline int Constraint::getBlockGridIndex( int idx ) const
+{
+    int nc = 0;
+
+    const int N = (int) grid.getNumPoints();
+
+    if( boundary_constraint    ->getNC() != 0 ) nc++;
+    if( coupled_path_constraint->getNC() != 0 ) nc++;
+
+    if( idx < nc ) return -1;
+
+    if( path_constraint->getNC() != 0 ){
+        if( idx < nc+N ) return idx-nc;
+        nc += N;
+    }
+    if( algebraic_consistency_constraint->getNC() != 0 ){
+        if( idx < nc+N ) return idx-nc;
+        nc += N;
+    }
+
+    return -1;
+}
+
+
 inline Vector Constraint::getBlockDims( ) const
 {
 	uint dim = getNumberOfBlocks();
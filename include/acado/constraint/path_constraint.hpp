@@ -130,6 +130,8 @@ class PathConstraint : public ConstraintElement{
 
 	protected:
 
+        Vector resultBuffer;   /**< work array for the function values */
+        Vector seedBuffer;     /**< work array for the backward seeds  */
 };
 
 
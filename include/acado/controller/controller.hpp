@@ -69,6 +69,8 @@ BEGIN_NAMESPACE_ACADO
  */
 class Controller : public SimulationBlock
 {
+    friend class SimulationEnsemble;
+
     //
     // PUBLIC MEMBER FUNCTIONS:
     //
@@ -198,6 +200,12 @@ class Controller : public SimulationBlock
 		 *
 		 *	\note If a non-empty reference trajectory is provided, this one is used
 		 *	      instead of the possibly set-up build-in one.
+		 *
+		 *	\note If the option USE_ASYNCHRONOUS_PREPARATION is set, only the feedback
+		 *	      step is performed and the preparation step is left pending. It can be
+		 *	      performed by calling finishPreparationStep while waiting for the next
+		 *	      process output; otherwise it is performed at the beginning of the
+		 *	      next feedback step.
 		 * 
 		 *  \return SUCCESSFUL_RETURN, \n
 		 *	        RET_BLOCK_NOT_READY, \n
@@ -265,6 +273,16 @@ class Controller : public SimulationBlock
 												const VariablesGrid& _yRef = emptyConstVariablesGrid
 												);
 
+		/** Performs the preparation step left pending by the previous step of the 
+		 *	controller if the option USE_ASYNCHRONOUS_PREPARATION is set.
+		 *	Does nothing if no preparation step is pending.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_CONTROLLER_STEP_FAILED, \n
+		 *	        RET_NO_CONTROLLAW_SPECIFIED
+		 */
+        returnValue finishPreparationStep( );
+
 		virtual returnValue obtainEstimates(	double currentTime,
 												const Vector& _y,
 												Vector& xEst,
@@ -369,6 +387,14 @@ class Controller : public SimulationBlock
 		 */
 		inline double getPreviousRealRuntime( );
 
+		/** Returns whether the preparation step of the previous step of the 
+		 *	controller is still pending.
+		 *
+		 *  \return BT_TRUE  iff a preparation step is pending, \n
+		 *	        BT_FALSE otherwise
+		 */
+		inline BooleanType isPreparationPending( ) const;
+
 
 		/** Enables the controller.
 		 *
@@ -427,6 +453,10 @@ class Controller : public SimulationBlock
 		BooleanType isEnabled;						/**< Flag indicating whether controller is enabled or not. */
 		
 		RealClock controlLawClock;					/**< Clock required to determine runtime of control law. */
+
+		BooleanType hasPendingPreparation;			/**< Flag indicating whether the preparation step of the previous step is still pending. */
+		double pendingPreparationTime;				/**< Time at next step to be used by the pending preparation step. */
+		VariablesGrid pendingReference;				/**< Piece of reference trajectory to be used by the pending preparation step. */
 };
 
 
@@ -153,6 +153,12 @@ inline double Controller::getPreviousRealRuntime( )
 }
 
 
+inline BooleanType Controller::isPreparationPending( ) const
+{
+	return hasPendingPreparation;
+}
+
+
 inline returnValue Controller::enable( )
 {
 	isEnabled = BT_TRUE;
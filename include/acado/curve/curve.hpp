@@ -50,6 +50,9 @@ BEGIN_NAMESPACE_ACADO
  *
  *  The class Curve allows to setup and evaluate piecewise-continous functions that 
  *  are defined over a scalar time interval and map into an Vectorspace of given dimension.
+ *  Pieces given in sampled form are stored as polynomial coefficients of degree up to
+ *  three in the local time of their interval, while general pieces are stored as
+ *  symbolic functions of the time.
  *
  *	\author Boris Houska, Hans Joachim Ferreau
  */
@@ -108,6 +111,9 @@ class Curve{
          *  the grid's start- and endpoint the same policy as for the other "add" functions  \n
          *  applies, i.e. the dimension should be equal to previously added pieces and the   \n
          *  time intervals should fit together.                                              \n
+         *  The modes IM_CONSTANT and IM_LINEAR store piecewise constant and linear         \n
+         *  polynomials, the mode IM_CUBIC stores the natural cubic spline through the       \n
+         *  sampled data (requires strictly increasing time points).                         \n
          *                                                                                   \n
          *  \param sampledData the data in sampled form to be interpolated and added.        \n
          *  \param mode        the interploation mode (default: linear interpolation)        \n
@@ -296,6 +302,57 @@ class Curve{
     //
     protected:
 
+        /** Appends the time interval [tStart,tEnd] to the curve and allocates     \n
+         *  the storage for its piece. The piece is initialised as the zero        \n
+         *  polynomial, i.e. its parameterization pointer is set to 0 and its      \n
+         *  coefficients are set to zero.                                          \n
+         *                                                                         \n
+         *  \param tStart  start of the time interval to be added.                 \n
+         *  \param tEnd    end of the time interval to be added.                   \n
+         *  \param _dim    the dimension of the piece to be added.                 \n
+         *                                                                         \n
+         *  \return SUCCESSFUL_RETURN                                              \n
+         *          RET_TIME_INTERVAL_NOT_VALID                                    \n
+         *          RET_INPUT_DIMENSION_MISMATCH                                   \n
+         */
+        returnValue appendInterval( double tStart,
+                                    double tEnd,
+                                    uint   _dim );
+
+
+        /** Makes sure that the curve can hold the given number of intervals      \n
+         *  without reallocating the storage of its pieces.                        \n
+         *                                                                         \n
+         *  \param _capacity  number of intervals to reserve storage for.          \n
+         */
+        void reserveIntervals( uint _capacity );
+
+
+        /** Adds the natural cubic spline, which interpolates the sampled data,   \n
+         *  as polynomial pieces of degree 3 to the curve.                         \n
+         *                                                                         \n
+         *  \param sampledData the data in sampled form to be interpolated.        \n
+         *                                                                         \n
+         *  \return SUCCESSFUL_RETURN                                              \n
+         *          RET_TIME_INTERVAL_NOT_VALID                                    \n
+         *          RET_INPUT_DIMENSION_MISMATCH                                   \n
+         */
+        returnValue addCubicSpline( const VariablesGrid& sampledData );
+
+
+        /** Evaluates the piece with number "idx" at the time t, which is assumed \n
+         *  to be contained in the domain of this piece.                           \n
+         *                                                                         \n
+         *  \param idx     (input)  the index of the piece.                        \n
+         *  \param t       (input)  the time at which the piece is evaluated.      \n
+         *  \param result  (output) the result of the evaluation.                  \n
+         *                                                                         \n
+         *  \return SUCCESSFUL_RETURN                                              \n
+         */
+        inline returnValue evaluatePiece( uint    idx,
+                                          double  t,
+                                          double *result ) const;
+
 
     //
     // DATA MEMBERS:
@@ -304,7 +361,9 @@ class Curve{
 
         uint                 nIntervals      ;   // number of intervals of the curve.
         uint                 dim             ;   // the dimension of the curve.
-        Function           **parameterization;   // the parameterizations of the curve pieces
+        Function           **parameterization;   // the symbolic parameterizations of the curve pieces (0 for polynomial pieces)
+        double              *coefficients    ;   // the coefficients of the polynomial pieces (4*dim per interval).
+        uint                 capacity        ;   // number of intervals for which storage is allocated.
         Grid                *grid            ;   // the grid points associated with the intervals of the curve.
 };
 
@@ -70,6 +70,32 @@ inline int Curve::getNumIntervals() const{
 }
 
 
+inline returnValue Curve::evaluatePiece( uint idx, double t, double *result ) const{
+
+    uint run1;
+
+    // SYMBOLIC PIECES ARE EVALUATED BY THEIR FUNCTION:
+    // ------------------------------------------------
+    if( parameterization[idx] != 0 ){
+        double tt[1] = { t };
+        return parameterization[idx]->evaluate( 0,tt,result );
+    }
+
+    // POLYNOMIAL PIECES ARE EVALUATED BY HORNER'S SCHEME
+    // IN THE LOCAL TIME OF THE INTERVAL:
+    // --------------------------------------------------
+    const double  s = t - grid->getTime(idx);
+    const double *c = &(coefficients[4*dim*idx]);
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        result[run1] = c[0] + s*( c[1] + s*( c[2] + s*c[3] ) );
+        c += 4;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -234,6 +234,17 @@ class DynamicDiscretization : public AlgorithmicBase
 
 
 
+		/** Shifts the first order sensitivities of all but the first     \n
+		*  interval by one interval towards the front. The subsequent     \n
+		*  first order evaluation of the sensitivities may then keep      \n
+		*  these results and only differentiate the last interval.        \n
+		*                                                                 \n
+		*  \return SUCCESSFUL_RETURN                                      \n
+		*/
+		virtual returnValue shiftSensitivities( );
+
+
+
 		/**< Returns the total number of intervals. */
 		inline int getNumberOfIntervals( ) const;
 
@@ -296,6 +307,8 @@ class DynamicDiscretization : public AlgorithmicBase
 		BlockMatrix      dForward ;   /**< the first order forward  derivatives */
 		BlockMatrix      dBackward;   /**< the first order backward derivatives */
 
+		BooleanType      areSensitivitiesShifted;  /**< whether the derivatives of all but the last interval have been shifted */
+
 };
 
 
@@ -90,6 +90,17 @@ class ShootingMethod : public DynamicDiscretization
         virtual returnValue clear();
 
 
+        /** Moves the intervals of a single-stage discretization onto a new   \n
+        *  union grid with the same number of intervals. The integrators are  \n
+        *  kept, i.e. they are not re-initialized. This allows to integrate    \n
+        *  consecutive sampling periods without repeating the setup.           \n
+        *                                                                      \n
+        *  \return SUCCESSFUL_RETURN                                           \n
+        *          RET_INVALID_ARGUMENTS                                       \n
+        */
+        returnValue setUnionGrid( const Grid &unionGrid_ );
+
+
 
 		/** Evaluates the discretized DifferentialEquation at a specified     \n
 		*  VariablesGrid. The results are written into the residuum of the   \n
@@ -159,6 +170,28 @@ class ShootingMethod : public DynamicDiscretization
             returnValue allocateIntegrator( uint idx, IntegratorType type_ );
 
 
+			/** Integrates all intervals of the union grid independently of each other  \n
+			*   (in parallel if OpenMP is available). This requires that the initial     \n
+			*   values of all intervals are given by the iterate, see                     \n
+			*   hasDecoupledIntervals().                                                   \n
+			*                                                                             \n
+			*   \return SUCCESSFUL_RETURN                                                 \n
+			*           RET_UNABLE_TO_INTEGRATE_SYSTEM                                    \n
+			*/
+			returnValue evaluateIntervals( OCPiterate &iter );
+
+			/** Returns BT_TRUE if the iterate specifies the initial values of all      \n
+			*   intervals and if none of its values is auto-initialized, i.e. if the      \n
+			*   intervals can be integrated independently of each other.                  \n
+			*/
+			BooleanType hasDecoupledIntervals( const OCPiterate &iter ) const;
+
+			/** Returns BT_FALSE if the value of z at time t is auto-initialized or if   \n
+			*   it is required but not given.                                             \n
+			*/
+			BooleanType isFixed( const VariablesGrid *z, double t, BooleanType isRequired ) const;
+
+
             returnValue differentiateBackward( const int    &idx ,
                                                const Matrix &seed,
                                                      Matrix &Gx  ,
@@ -173,6 +206,15 @@ class ShootingMethod : public DynamicDiscretization
                                                const Matrix  &dW ,
                                                      Matrix  &D    );
 
+            /** Computes the forward sensitivities of interval idx w.r.t. all   \n
+             *  forward seeds.                                                   \n
+             */
+            returnValue differentiateForward(  const int     &idx,
+                                                     Matrix  &DX ,
+                                                     Matrix  &DP ,
+                                                     Matrix  &DU ,
+                                                     Matrix  &DW   );
+
 
             returnValue differentiateForwardBackward( const int     &idx ,
                                                       const Matrix  &dX  ,
@@ -186,6 +228,14 @@ class ShootingMethod : public DynamicDiscretization
                                                             Matrix  &ddU ,
                                                             Matrix  &ddW   );
 
+            /** Computes the forward sensitivities D[0..3] and the hessian      \n
+             *  blocks H[0..15] of interval idx w.r.t. all forward seeds.       \n
+             */
+            returnValue differentiateForwardBackward( const int     &idx ,
+                                                      const Matrix  &seed,
+                                                            Matrix  *D   ,
+                                                            Matrix  *H     );
+
 
             returnValue update( Matrix &G, const Matrix &A, const Matrix &B );
 
@@ -64,13 +64,18 @@ public:
     /** Default constructor. */
     COperator( const CFunction &fcn, const Expression &arg, int component_ );
 
-    /** Copy constructor (deep copy). */
+    /** Copy constructor, the argument is shared with arg. */
     COperator( const COperator &arg );
 
+    /** Constructor which returns another component of the same call \n
+     *  of the C function. The argument is shared with arg.          \n
+     */
+    COperator( const COperator &arg, int component_ );
+
     /** Default destructor. */
     ~COperator();
 
-    /** Assignment Operator (deep copy). */
+    /** Assignment Operator, the argument is shared with arg. */
     COperator& operator=( const COperator &arg );
 
     /** ID Operator. */
@@ -341,12 +346,20 @@ public:
 
 
 
-     /** Provides a deep copy of the expression. \n
+     /** Provides a copy of the expression which \n
+      *  shares the arguments of the original.  \n
       *  \return a clone of the expression.      \n
       */
      virtual Operator* clone() const;
 
 
+     /** Replaces the arguments by unshared copies, see   \n
+      *  Operator::cloneUnshared().                        \n
+      *  \return SUCCESSFUL_RETURN                          \n
+      */
+     virtual returnValue unshareArguments( OperatorCopyTable &copies );
+
+
 
      /** Clears the buffer and resets the buffer size \n
       *  to 1.                                        \n
@@ -432,7 +445,9 @@ protected:
 protected:
 
     CFunction    cFunction;   /**< The C function to be evaluated  */
-    Expression    argument;   /**< The argument for the evaluation */
+    Operator    **argument;   /**< The components of the argument, shared by all    \n
+                               *   components of the same call of the C function    */
+    uint       argumentDim;   /**< The dimension of the argument   */
 
     double        **result;   /**< The results of the evaluation of the argument   */
     double      **d_result;   /**< The results for the derivative of the argument  */
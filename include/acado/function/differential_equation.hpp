@@ -188,6 +188,12 @@ class DifferentialEquation : public Function{
 		inline Vector getDifferentialStateComponents() const;
 
 
+		/** Returns the component of the differential state that is   \n
+		 *  associated with the differential equation index_.         \n
+		 */
+		inline int getDifferentialStateComponent( int index_ ) const;
+
+
 
 		/** Loading Expressions (deep copy). */
 		DifferentialEquation& addDifferential( const Expression& arg );
@@ -86,6 +86,16 @@ inline Vector DifferentialEquation::getDifferentialStateComponents() const{
 }
 
 
+inline int DifferentialEquation::getDifferentialStateComponent( int index_ ) const{
+
+    if( counter != 0 ){
+        ASSERT( index_ < counter );
+        return component[index_];
+    }
+    return index_;
+}
+
+
 inline double DifferentialEquation::getStartTime() const{
 
     if( T1 == 0 ) return t1;
@@ -145,6 +145,13 @@ public:
     inline Vector getDX() const;
 
 
+    /** Returns a pointer to the function evaluation point, which can be     \n
+     *  passed to the evaluation routines of the class Function that work   \n
+     *  on plain double arrays.                                              \n
+     */
+    inline double* getEvaluationPointer() const;
+
+
 	    /** Prints the data of this object.              \n
      *  Due to the efficient implementation of       \n
      *  this class not everything might be stored.   \n
@@ -162,6 +169,8 @@ protected:
 
     inline returnValue copy( const int *order, const Vector &rhs );
 
+    inline returnValue copy( const int *order, const VariablesGrid *rhs, const uint &pointIdx );
+
     void copy( const EvaluationPoint &rhs );
     void deleteAll();
 
@@ -169,8 +178,6 @@ protected:
 
     inline Vector backCopy( const int *order, const uint &dim ) const;
 
-    inline double* getEvaluationPointer() const;
-
 
 
 // PROTECTED MEMBERS:
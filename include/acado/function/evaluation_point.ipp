@@ -49,6 +49,16 @@ inline returnValue EvaluationPoint::copy( const int *order, const Vector &rhs ){
 }
 
 
+inline returnValue EvaluationPoint::copy( const int *order, const VariablesGrid *rhs, const uint &pointIdx ){
+
+    uint i;
+    if( rhs == 0 ) return SUCCESSFUL_RETURN;
+    for( i = 0; i < rhs->getNumValues(); i++ )
+        z[order[i]] = rhs->operator()( pointIdx,i );
+    return SUCCESSFUL_RETURN;
+}
+
+
 inline Vector EvaluationPoint::backCopy( const int *order, const uint &dim ) const{
 
     Vector tmp(dim);
@@ -58,7 +68,7 @@ inline Vector EvaluationPoint::backCopy( const int *order, const uint &dim ) con
     return tmp;
 }
 
-inline returnValue EvaluationPoint::setT ( const double &t  ){ return copy( idx[0], Vector(1,&t) ); }
+inline returnValue EvaluationPoint::setT ( const double &t  ){ z[idx[0][0]] = t; return SUCCESSFUL_RETURN; }
 inline returnValue EvaluationPoint::setX ( const Vector &x  ){ return copy( idx[1], x            ); }
 inline returnValue EvaluationPoint::setXA( const Vector &xa ){ return copy( idx[2], xa           ); }
 inline returnValue EvaluationPoint::setP ( const Vector &p  ){ return copy( idx[3], p            ); }
@@ -70,12 +80,13 @@ inline returnValue EvaluationPoint::setDX( const Vector &dx ){ return copy( idx[
 inline returnValue EvaluationPoint::setZ ( const uint       &idx_,
                                            const OCPiterate &iter  ){
 
+    // copy directly from the grids to avoid temporary vectors:
     setT ( iter.getTime (idx_) );
-    setX ( iter.getX    (idx_) );
-    setXA( iter.getXA   (idx_) );
-    setP ( iter.getP    (idx_) );
-    setU ( iter.getU    (idx_) );
-    setW ( iter.getW    (idx_) );
+    copy ( idx[1], iter.x , idx_ );
+    copy ( idx[2], iter.xa, idx_ );
+    copy ( idx[3], iter.p , idx_ );
+    copy ( idx[4], iter.u , idx_ );
+    copy ( idx[5], iter.w , idx_ );
 
     return SUCCESSFUL_RETURN;
 }
@@ -261,6 +261,19 @@ public:
 
 
 
+    /** Determines for each component of the function whether   \n
+     *  it depends on at least one of the nVar given variables   \n
+     *  and writes the result to pattern[0..getDim()-1].         \n
+     *  \return SUCCESSFUL_RETURN                                \n
+     *
+     */
+     returnValue getDependencyPattern( int           nVar     ,
+                                       VariableType *varType  ,
+                                       int          *component,
+                                       BooleanType  *pattern    );
+
+
+
     /** Checks whether the function is linear in                  \n
      *  (or not depending on)  var(index)                         \n
      *  \return BT_FALSE if no linearity is                       \n
@@ -359,6 +372,21 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for nDir        \n
+     *  directions at once, using the intermediate results from   \n
+     *  a buffer. The directions are stored interleaved, i.e.     \n
+     *  seed[nDir*i+k] and df[nDir*j+k] belong to direction k.    \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_forward(  int     number  /**< storage position     */,
+                              int     nDir    /**< number of directions */,
+                              double *seed    /**< the seeds            */,
+                              double *df      /**< the derivatives of
+                                                   the expression       */  );
+
+
+
     /** Automatic Differentiation in backward mode.                \n
      *                                                             \n
      *  \param seed    the backward seed                           \n
@@ -512,6 +540,28 @@ public:
      inline returnValue setMemoryOffset( int memoryOffset_ );
 
 
+     /** Enables or disables the evaluation based on a compiled tape    \n
+      *  (see FunctionEvaluationTree::useEvaluationTape).              \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      */
+     returnValue useEvaluationTape( BooleanType useTape_ );
+
+
+     /** Enables or disables the optimisation of exported code         \n
+      *  (see FunctionEvaluationTree::setExportOptimization).          \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      */
+     returnValue setExportOptimization( BooleanType optimizeExport_ );
+
+
+     /** Counts the arithmetic operations of the exported code without \n
+      *  and with export optimisation.                                 \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      *          RET_INVALID_ARGUMENTS                                 \n
+      */
+     returnValue getNumExportOperations( int &nBefore, int &nAfter ) const;
+
+
 
 // PROTECTED MEMBERS:
 // ------------------
@@ -0,0 +1,343 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/function_evaluation_tape.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ */
+
+
+#ifndef ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+#define ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+
+
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Flat, register-based representation of a FunctionEvaluationTree.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class FunctionEvaluationTape stores the operator trees of the
+ *  intermediate states and of all output components of a
+ *  FunctionEvaluationTree as one contiguous instruction array in
+ *  post-order. Each instruction writes exactly one entry of a dense work
+ *  vector, such that evaluation and first/second order automatic
+ *  differentiation reduce to simple loops over the tape instead of
+ *  recursive virtual calls through the operator tree. The work vectors are
+ *  buffered per storage position in the same way as the buffers of the
+ *  symbolic operators.
+ *
+ *  The tape is compiled with value numbering: a node that is shared by
+ *  several parents, as well as any subexpression that is structurally
+ *  identical to an instruction already on the tape, is stored once and
+ *  evaluated once. A segment may therefore refer to the results of earlier
+ *  segments, and its own result is not necessarily its last instruction.
+ *
+ *  Trees containing operators that can not be compiled (e.g. linked C
+ *  functions) are rejected by compile(); the FunctionEvaluationTree keeps
+ *  using the recursive evaluation in this case.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class FunctionEvaluationTape{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    FunctionEvaluationTape( );
+
+    /** Copy constructor (deep copy). */
+    FunctionEvaluationTape( const FunctionEvaluationTape& arg );
+
+    /** Destructor. */
+    ~FunctionEvaluationTape( );
+
+    /** Assignment operator (deep copy). */
+    FunctionEvaluationTape& operator=( const FunctionEvaluationTape& arg );
+
+
+    /** Linearises the given operator trees into the tape. The n      \n
+     *  intermediate expressions are stored first, their results are  \n
+     *  written back to the components isIndex[0..n-1] of x.          \n
+     *  \return SUCCESSFUL_RETURN                                     \n
+     *          RET_INVALID_ARGUMENTS if the trees contain operators  \n
+     *                                that can not be compiled.       \n
+     */
+    returnValue compile( int        n_       /**< number of intermediate states */,
+                         Operator **sub_     /**< intermediate expressions      */,
+                         const int *isIndex_ /**< indices of the intermediate
+                                              *   states in x                   */,
+                         int        dim_     /**< number of output components   */,
+                         Operator **f_       /**< output expressions            */  );
+
+
+    /** Clears the tape. */
+    returnValue clear( );
+
+
+    /** Returns whether the tape holds a compiled function. */
+    inline BooleanType isCompiled( ) const;
+
+
+    /** Returns the number of instructions on the tape. */
+    inline int getNumInstructions( ) const;
+
+
+    /** Evaluates the tape and stores the intermediate results in  \n
+     *  buffer position "number".                                  \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue evaluate( int number, double *x, double *result );
+
+
+    /** Forward differentiation; stores values and first order     \n
+     *  directional derivatives in buffer position "number".       \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_forward( int number, double *x, double *seed,
+                            double *f, double *df );
+
+
+    /** Forward differentiation based on buffered values.          \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_forward( int number, double *seed, double *df );
+
+
+    /** Forward differentiation of nDir directions at once based   \n
+     *  on buffered values. The directions are stored interleaved, \n
+     *  i.e. seed[nDir*i+k] and df[nDir*j+k] belong to the k-th    \n
+     *  direction. The buffered first order derivatives are not    \n
+     *  modified.                                                  \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_forward( int number, int nDir, double *seed, double *df );
+
+
+    /** Backward differentiation based on buffered values.         \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_backward( int number, double *seed, double *df );
+
+
+    /** Second order forward differentiation based on buffered     \n
+     *  values and first order derivatives.                        \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_forward2( int number, double *seed, double *dseed,
+                             double *df, double *ddf );
+
+
+    /** Second order backward differentiation based on buffered    \n
+     *  values and first order derivatives.                        \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_backward2( int number, double *seed1, double *seed2,
+                              double *df, double *ddf );
+
+
+    /** Resets the buffer size to 1.                               \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue clearBuffer( );
+
+
+    /** Exports the body of a C function which writes the output   \n
+     *  components into acado_f. Constant subexpressions are        \n
+     *  folded, trivial operations such as x*1 or x+0 are removed,  \n
+     *  and every remaining operation is emitted at most once:      \n
+     *  results which are needed more than once are stored in the   \n
+     *  local array tmpName. Intermediate states are not written    \n
+     *  back and operations that do not contribute to an output     \n
+     *  are dropped. If file is NULL, only the operations are       \n
+     *  counted. The variable names are taken from the compiled     \n
+     *  operator trees, which must therefore still exist.           \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_INVALID_ARGUMENTS if the tape is not compiled.  \n
+     */
+    returnValue exportCode( FILE       *file              /**< output file or NULL          */,
+                            const char *realString        /**< C type of real values        */,
+                            const char *tmpName           /**< name of the local array      */,
+                            int        &nOperationsBefore /**< operations in the trees      */,
+                            int        &nOperationsAfter  /**< operations actually emitted  */  ) const;
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    struct Instruction;
+
+    /** Strict weak ordering of instructions by operation and arguments. */
+    struct InstructionLess{
+        bool operator()( const Instruction &a, const Instruction &b ) const;
+    };
+
+    /** Instructions on the tape and their work vector indices. */
+    typedef std::map< Instruction, int, InstructionLess > InstructionTable;
+
+    /** Nodes which have already been appended to the tape. */
+    typedef std::map< const Operator*, int > NodeTable;
+
+
+    /** Appends the subtree "arg" to the tape, unless the node or  \n
+     *  an identical instruction is on the tape already.           \n
+     *  \return The work vector index of the result or -1 if the   \n
+     *          subtree can not be compiled.                       \n
+     */
+    int append( Operator         *arg         ,
+                InstructionTable &instructions_,
+                NodeTable        &nodes         );
+
+    /** Adds the instruction op to the tape, unless an identical   \n
+     *  instruction exists already.                                \n
+     *  \return The work vector index of the instruction.          \n
+     */
+    int addInstruction( const Instruction &op, InstructionTable &instructions_ );
+
+    /** Returns an empty instruction. */
+    static Instruction emptyInstruction( OperatorName name_ );
+
+    /** Makes sure that the buffer position "number" exists. */
+    void allocateBuffer( int number );
+
+    /** Computes the value of instruction i. */
+    double computeValue( int i, const double *w, const double *x ) const;
+
+    /** Computes the first order directional derivative of         \n
+     *  instruction i.                                             \n
+     */
+    double computeTangent( int i, const double *w, const double *dw,
+                           const double *seed ) const;
+
+    /** Computes the first and second order partial derivatives    \n
+     *  of instruction i with respect to its arguments.            \n
+     */
+    void getPartials( int i, const double *w,
+                      double &pa, double &pb ) const;
+
+    void getSecondPartials( int i, const double *w,
+                            double &paa, double &pab, double &pbb ) const;
+
+    /** Bookkeeping of exportCode: the representative instruction of    \n
+     *  each instruction after simplification, its use count, the index  \n
+     *  of the temporary holding it (or -1) and its value if it is       \n
+     *  constant.                                                        \n
+     */
+    struct ExportTable{
+        int         *rep       ;
+        int         *uses      ;
+        int         *tmp       ;
+        BooleanType *isConstant;
+        double      *constant  ;
+    };
+
+    /** Folds instruction i if all its operands are constant and      \n
+     *  removes trivial operations (x+0, x*1, x^1, ...).                 \n
+     *  \return An equivalent earlier instruction, or i itself if the    \n
+     *          instruction is constant or can not be simplified.        \n
+     */
+    int simplify( int i, ExportTable &table ) const;
+
+    /** Prints the expression computed by instruction i; operands which \n
+     *  are stored in temporaries are referenced by name.                \n
+     */
+    void printExpression( Stream &stream, int i, const ExportTable &table,
+                          const char *tmpName, BooleanType isTop ) const;
+
+    void copy( const FunctionEvaluationTape& arg );
+
+    void deleteAll( );
+
+
+//
+// DATA MEMBERS:
+//
+protected:
+
+    /** A single instruction of the tape. */
+    struct Instruction{
+
+        OperatorName name ;           /**< The operation.                      */
+        int          arg1 ;           /**< Work index of the first argument.   */
+        int          arg2 ;           /**< Work index of the second argument.  */
+        int          index;           /**< Variable index or integer exponent. */
+        double       value;           /**< Value of a constant.                */
+
+        double (*fcn  )(double);      /**< Function of unary operators.        */
+        double (*dfcn )(double);      /**< Its first derivative.               */
+        double (*ddfcn)(double);      /**< Its second derivative.              */
+
+        const Operator *node;         /**< The compiled leaf (only used for
+                                       *   exporting variable names).          */
+    };
+
+    Instruction *instructions;        /**< The instructions (post-order).       */
+    int          nInstructions;       /**< The number of instructions.          */
+
+    int          nSegments;           /**< Number of intermediate expressions
+                                       *   plus number of output components.    */
+    int          nIS;                 /**< Number of intermediate expressions.  */
+    int         *segmentEnd;          /**< One past the last instruction of
+                                       *   each segment.                        */
+    int         *segmentResult;       /**< Work index of the result of each
+                                       *   segment.                             */
+    int         *segmentTarget;       /**< Index in x of each intermediate state,
+                                       *   or output component.                 */
+
+    double      *values;              /**< Buffered work vectors.               */
+    double      *dvalues;             /**< Buffered first order derivatives.    */
+    int          bufferSize;          /**< The size of the buffer.              */
+
+    double      *work1;               /**< Scratch vectors for derivatives that  */
+    double      *work2;               /**< are not buffered.                    */
+
+    double      *tangents;            /**< Scratch for nTangents directions.    */
+    int          nTangents;           /**< Number of directions in tangents.    */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/function/function_evaluation_tape.ipp>
+
+
+#endif  // ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+
+// end of file.
@@ -36,6 +36,7 @@
 
 
 #include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function_evaluation_tape.hpp>
 
 
 
@@ -237,6 +238,20 @@ public:
      virtual BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Determines for each component of the function whether   \n
+     *  it depends on at least one of the nVar given variables.  \n
+     *  The result is written to pattern[0..dim-1]. Operators    \n
+     *  whose structure is unknown (e.g. C functions) are        \n
+     *  conservatively treated as dependent.                     \n
+     *  \return SUCCESSFUL_RETURN                                \n
+     *
+     */
+     virtual returnValue getDependencyPattern( int           nVar     /**< number of variables   */,
+                                               VariableType *varType  /**< their types          */,
+                                               int          *component/**< their components     */,
+                                               BooleanType  *pattern  /**< the output (dim)     */ );
+
+
     /** Checks whether the symbolic expression is linear in       \n
      *  a specified variable.                                     \n
      *  \return BT_FALSE if no linearity is                       \n
@@ -313,6 +328,22 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for nDir         \n
+     *  directions at once. This function uses the intermediate    \n
+     *  results from a buffer. The directions are stored           \n
+     *  interleaved, i.e. seed[nDir*i+k] and df[nDir*j+k] belong   \n
+     *  to the k-th direction.                                     \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     *          RET_NAN                                            \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDir    /**< number of directions */,
+                                     double *seed    /**< the seeds            */,
+                                     double *df      /**< the derivatives of
+                                                          the expression       */  );
+
+
+
     /** Automatic Differentiation in forward mode.                \n
      *  This function stores the intermediate                     \n
      *  results in a buffer (needed for 2nd order automatic       \n
@@ -475,6 +506,54 @@ public:
      returnValue setAuxVariableStructName(const String& s);
 
 
+     /** Enables or disables the evaluation via a compiled tape. If   \n
+      *  enabled (default), the expression is linearised into a flat  \n
+      *  FunctionEvaluationTape at the first evaluation and all       \n
+      *  evaluations and (first or second order) AD sweeps run on the \n
+      *  tape. Otherwise the operator tree is evaluated recursively.  \n
+      *  Note that buffered values are not shared between both modes, \n
+      *  i.e. the mode should not be changed between an evaluation    \n
+      *  and a subsequent backward sweep.                             \n
+      *  \return SUCCESSFUL_RETURN                                    \n
+      */
+     returnValue useEvaluationTape( BooleanType useTape_ );
+
+
+     /** Enables or disables the optimisation of exported code. If     \n
+      *  enabled, exportCode eliminates common subexpressions, folds   \n
+      *  constants and drops unused intermediate results by exporting  \n
+      *  a FunctionEvaluationTape instead of printing the operator     \n
+      *  trees. Expressions which can not be compiled are exported     \n
+      *  without optimisation.                                         \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      */
+     returnValue setExportOptimization( BooleanType optimizeExport_ );
+
+
+     /** Counts the arithmetic operations which exportCode emits       \n
+      *  without (nBefore) and with (nAfter) export optimisation.      \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      *          RET_INVALID_ARGUMENTS if the expression can not be    \n
+      *                                compiled.                       \n
+      */
+     returnValue getNumExportOperations( int &nBefore, int &nAfter ) const;
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+     /** Compiles the tape if necessary.                              \n
+      *  \return BT_TRUE  if evaluations should use the tape,         \n
+      *          BT_FALSE otherwise (tape disabled or not compilable). \n
+      */
+     BooleanType isTapeAvailable( );
+
+     /** Compiles the expression into the given tape. */
+     returnValue compileTape( FunctionEvaluationTape &tape_ ) const;
+
+
     //
     // DATA MEMBERS:
     //
@@ -493,6 +572,13 @@ public:
 
     String				auxVariableName;
     String				auxVariableStructName;
+
+    FunctionEvaluationTape tape;      /**< The compiled expression.            */
+    BooleanType          useTape  ;   /**< Whether the tape shall be used.     */
+    BooleanType          isTapeUpToDate; /**< Whether the tape has been compiled
+                                       *  for the current expression.          */
+    BooleanType          optimizeExport; /**< Whether exported code shall be
+                                       *  optimised.                          */
 };
 
 
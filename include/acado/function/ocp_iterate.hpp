@@ -80,6 +80,15 @@ class OCPiterate{
         /** Assignment operator (deep copy). */
         OCPiterate& operator=( const OCPiterate& rhs );
 
+        /** Copies the time points and numerical values of another iterate into   \n
+         *  the existing storage. Only grids whose number of points or values     \n
+         *  differ are re-allocated (deep copy); settings like names or bounds of  \n
+         *  grids with unchanged structure are kept.                              \n
+         *                                                                        \n
+         *  \return SUCCESSFUL_RETURN                                              \n
+         */
+        returnValue copyValues( const OCPiterate& rhs );
+
 
 		returnValue allocateAll( );
 		
@@ -196,6 +205,8 @@ class OCPiterate{
 
 		void copy (const OCPiterate& rhs);
 
+		void copyValues( VariablesGrid*& z, const VariablesGrid* const rhs );
+
 		inline Vector copy ( const VariablesGrid *z, const uint &idx ) const;
 
 		inline uint getDim( VariablesGrid *z ) const;
@@ -288,6 +288,25 @@ class Integrator : public AlgorithmicBase
 
 
 
+		/** Integrates the first order forward sensitivities for all    \n
+		*  columns of the given seed matrices. The k-th column of D     \n
+		*  is the sensitivity of the differential states in the         \n
+		*  direction defined by the k-th columns of the seeds. Empty    \n
+		*  seed matrices are treated as zero.                           \n
+		*  Integrators that can not propagate several directions at     \n
+		*  once integrate the directions one after another.             \n
+		*                                                               \n
+		*  \return SUCCESSFUL_RETURN                                    \n
+		*          RET_NOT_FROZEN                                       \n
+		*/
+		virtual returnValue integrateForwardSensitivities(	const Matrix &xSeed /**< the seeds w.r.t states       */,
+															const Matrix &pSeed /**< the seeds w.r.t parameters   */,
+															const Matrix &uSeed /**< the seeds w.r.t controls     */,
+															const Matrix &wSeed /**< the seeds w.r.t disturbances */,
+															Matrix       &D     /**< the sensitivities (output)   */  );
+
+
+
 		/** Sets an initial guess for the differential state derivatives \n
 		*  (consistency condition)                                      \n
 		*  \return SUCCESSFUL_RETURN                                    \n
@@ -598,12 +617,21 @@ class Integrator : public AlgorithmicBase
 		*  hmax
 		*  tune
 		*  TOL
+		*  ATOL
 		*  las
 		*  (cf. SETTINGS  for more details)
 		*/
 		void initializeOptions();
 
 
+
+		/** Initializes the given storage on the current time interval. \n
+		*  The storage is only re-allocated if the number of grid points \n
+		*  or values changes; otherwise only the time points are updated.\n
+		*/
+		void initializeStorage( VariablesGrid &storage, int nValues ) const;
+
+
 		virtual returnValue setupLogging( );
 
 
@@ -642,6 +670,8 @@ class Integrator : public AlgorithmicBase
 		double   hmax                ;  /**< the maximum step size                              */
 		double   tune                ;  /**< tuning parameter for the step size control.        */
 		double   TOL                 ;  /**< the integration tolerance                          */
+		double   ATOL                ;  /**< the absolute integration tolerance                 */
+		int      printProfile        ;  /**< whether the run time profile is printed            */
 		int      las                 ;  /** the type of linear algebra solver to be used        */
 
 		Grid     timeInterval        ;  /**< the time interval                                  */
@@ -713,6 +743,19 @@ class Integrator : public AlgorithmicBase
 		VariablesGrid         iStore;
 
 
+		// WORKSPACE OF integrate() AND integrateSensitivities():
+		// --------------------------
+		Grid                workGrid;
+		Vector              workX0  ;
+		Vector              workXA  ;
+		Vector              workP   ;
+		Vector              workU   ;
+		Vector              workW   ;
+		Vector              workX   ;
+		Vector              workXE  ;
+		Matrix              workDX  ;
+
+
 };
 
 
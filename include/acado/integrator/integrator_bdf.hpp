@@ -375,6 +375,23 @@ protected:
     void printRKIntermediateResults();
 
 
+    /** Determines the structural sparsity pattern of the iteration     \n
+     *  matrix and groups its columns into colors, such that columns    \n
+     *  of the same color do not share any non-zero row.                \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue determineJacobianColoring();
+
+
+    /** Evaluates the iteration matrix J with one forward sweep per     \n
+     *  color. The derivatives are seeded with dSeed and xSeed for the  \n
+     *  differential states and with 1 for the algebraic states.        \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF             \n
+     */
+    returnValue evaluateJacobian( int number, double dSeed, double xSeed, Matrix &J );
+
+
     /** Decomposes the Jacobian J.               \n
      *  \return SUCCESSFUL_RETURN                \n
      *          RET_THE_DAE_INDEX_IS_TOO_LARGE   \n
@@ -550,6 +567,12 @@ protected:
     int      nOfM              ; /**< number of distinct inverse Jacobian approximations  */
     int      maxNM             ; /**< number of allocated Jacobian storage positions      */
 
+    int      nColors           ; /**< number of colors of the Jacobian columns            */
+    int     *colorStart        ; /**< start of each color in colorColumns                 */
+    int     *colorColumns      ; /**< the Jacobian columns sorted by color                */
+    int     *jacStart          ; /**< start of each column in jacRows                     */
+    int     *jacRows           ; /**< the structurally non-zero rows of each column       */
+
     int     *nOfNewtonSteps    ; /**< the number of newton steps (for each BDF-step)      */
     double **eta               ; /**< the predictor and corrector approximations          */
     double **eta2              ; /**< the predictor and corrector approximations          */
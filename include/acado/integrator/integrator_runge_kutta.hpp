@@ -212,6 +212,23 @@ public:
     /** Returns the current step size */
     virtual double getStepSize() const;
 
+
+    // ================================================================================
+
+
+    /** Integrates the first order forward sensitivities for all    \n
+     *  columns of the given seed matrices. If all steps are frozen \n
+     *  the directions are propagated together in a single pass     \n
+     *  over the stored steps.                                      \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_NOT_FROZEN                                      \n
+     */
+    virtual returnValue integrateForwardSensitivities( const Matrix &xSeed /**< the seeds w.r.t states       */,
+                                                       const Matrix &pSeed /**< the seeds w.r.t parameters   */,
+                                                       const Matrix &uSeed /**< the seeds w.r.t controls     */,
+                                                       const Matrix &wSeed /**< the seeds w.r.t disturbances */,
+                                                       Matrix       &D     /**< the sensitivities (output)   */  );
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -452,6 +469,8 @@ protected:
     double  *x                 ;  /**< the actual state (only internal use)               */
     double   err_power         ;  /**< root order of the step size control                */
 
+    BooleanType optionsUpToDate;  /**< whether the settings reflect the current options   */
+
 
     // SENSITIVITIES:
     // --------------
@@ -477,6 +496,9 @@ protected:
     double    *etaH2           ;  /**< Sensitivity matrix (only internal use)             */
     double    *etaH3           ;  /**< Sensitivity matrix (only internal use)             */
 
+    double    *etaG_           ;  /**< Backup of etaG for the interpolation (workspace)   */
+    double    *etaG3_          ;  /**< Backup of etaG3 for the interpolation (workspace)  */
+
 
     // STORAGE:
     // --------
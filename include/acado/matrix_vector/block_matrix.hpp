@@ -101,6 +101,36 @@ class BlockMatrix{
 
 
 
+		/** Set method that defines a certain component as the product A*B.
+		 *  The storage of the component is re-used if its dimensions do not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue setDense( uint           rowIdx, /**< Row index of the component.    */
+                              uint           colIdx, /**< Column index of the component. */
+                              const Matrix&  A,      /**< Left factor.                   */
+                              const Matrix&  B       /**< Right factor.                  */ );
+
+
+		/** Add method that adds the product A*B to a certain component
+		 *  without creating a temporary matrix.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue addDense( uint           rowIdx, /**< Row index of the component.    */
+                              uint           colIdx, /**< Column index of the component. */
+                              const Matrix&  A,      /**< Left factor.                   */
+                              const Matrix&  B       /**< Right factor.                  */ );
+
+
+
+		/** Declares a certain component as dense matrix of the given dimensions
+		 *  and returns a reference to it, such that it can be written in place.
+		 *  The storage of the component is re-used if its dimensions do not change,
+		 *  its entries are not initialised otherwise.
+		 *  \return Reference to the component */
+		Matrix& getDenseBlock( uint rowIdx, /**< Row index of the component.    */
+                               uint colIdx, /**< Column index of the component. */
+                               uint nR,     /**< Number of rows.                */
+                               uint nC      /**< Number of columns.             */ );
+
+
 		/** Access method that returns the value of a certain component.
 		 *  \return SUCCESSFUL_RETURN
          */
@@ -109,6 +139,14 @@ class BlockMatrix{
                                         Matrix &value   )  const;
 
 
+		/** Access method that returns a reference to a certain component
+		 *  (without copying it). Note that components of type SBMT_ZERO may
+		 *  be empty.
+         */
+		inline const Matrix& getSubBlock( uint rowIdx,  /**< Row index of the component.    */
+                                          uint colIdx   /**< Column index of the component. */ )  const;
+
+
 		/** Access method that returns the value of a certain component and requiring
          *  a given dimension.
 		 *  \return SUCCESSFUL_RETURN
@@ -158,6 +196,27 @@ class BlockMatrix{
 		BlockMatrix operator^( const BlockMatrix& arg	/**< Block Matrix Factor. */ ) const;
 
 
+		/** Stores the difference A-B in the object. The storage of the
+		 *  components is re-used as long as the dimensions do not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue setDifference( const BlockMatrix& A,	/**< Minuend.    */
+                                   const BlockMatrix& B	/**< Subtrahend. */ );
+
+
+		/** Stores the product A*B in the object. The storage of the components
+		 *  is re-used as long as the dimensions do not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue setProduct( const BlockMatrix& A,	/**< Left factor.  */
+                                const BlockMatrix& B	/**< Right factor. */ );
+
+
+		/** Stores the product A^T*B in the object. The storage of the components
+		 *  is re-used as long as the dimensions do not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue setTransposedProduct( const BlockMatrix& A,	/**< Left factor (transposed). */
+                                          const BlockMatrix& B	/**< Right factor.             */ );
+
+
 		/** Returns number of block rows of the block matrix object.
 		 *  \return Number of rows. */
 		inline uint getNumRows( ) const;
@@ -188,6 +247,15 @@ class BlockMatrix{
 		inline returnValue setZero( uint rowIdx, uint colIdx );
 
 
+		/** Copies the sub block (srcRowIdx,srcColIdx), including its type,
+		 *  into the sub block (rowIdx,colIdx).
+		 *  \return SUCCESSFUL_RETURN */
+		inline returnValue copySubBlock( uint rowIdx,     /**< row    index of the target sub block */
+                                         uint colIdx,     /**< column index of the target sub block */
+                                         uint srcRowIdx,  /**< row    index of the source sub block */
+                                         uint srcColIdx   /**< column index of the source sub block */ );
+
+
 		/** Returns whether the block matrix element is empty. */
 		inline BooleanType isEmpty() const;
 
@@ -254,6 +322,13 @@ class BlockMatrix{
     //
     protected:
 
+        /** Re-initializes the object as an all-zero block matrix with the
+         *  given dimensions, keeping the storage of the components. */
+        void prepareResult( uint _nRows, uint _nCols );
+
+        /** Empties all components that are still of type SBMT_ZERO. */
+        returnValue finalizeResult( );
+
 
 
     //
@@ -49,6 +49,15 @@ inline returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx, Matrix &v
 }
 
 
+inline const Matrix& BlockMatrix::getSubBlock( uint rowIdx, uint colIdx )  const{
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    return elements[rowIdx][colIdx];
+}
+
+
 inline uint BlockMatrix::getNumRows( ) const{
 
 	return nRows;
@@ -99,6 +108,22 @@ inline returnValue BlockMatrix::setZero( uint rowIdx, uint colIdx ){
 }
 
 
+inline returnValue BlockMatrix::copySubBlock( uint rowIdx, uint colIdx, uint srcRowIdx, uint srcColIdx ){
+
+    ASSERT( rowIdx    < getNumRows( ) );
+    ASSERT( colIdx    < getNumCols( ) );
+    ASSERT( srcRowIdx < getNumRows( ) );
+    ASSERT( srcColIdx < getNumCols( ) );
+
+    if( ( rowIdx == srcRowIdx ) && ( colIdx == srcColIdx ) )
+        return SUCCESSFUL_RETURN;
+
+    types   [rowIdx][colIdx] = types   [srcRowIdx][srcColIdx];
+    elements[rowIdx][colIdx] = elements[srcRowIdx][srcColIdx];
+    return SUCCESSFUL_RETURN;
+}
+
+
 inline returnValue BlockMatrix::addRegularisation( uint rowIdx, uint colIdx, double eps ){
 
     ASSERT( rowIdx < getNumRows( ) );
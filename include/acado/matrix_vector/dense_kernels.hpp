@@ -0,0 +1,139 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/matrix_vector/dense_kernels.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ *
+ *    Low-level dense linear algebra kernels on row-major double arrays
+ *    which are used by the Matrix, Vector and BlockMatrix classes.
+ *
+ *    The kernels are register-blocked and use SSE2 or AVX instructions if
+ *    the library is compiled with the corresponding flags (see
+ *    cmake/CompilerOptionsSSE.cmake; AVX requires the CMake option
+ *    WITH_AVX). All kernels accumulate the inner
+ *    products in the same order as the straightforward loops, such that
+ *    the results do not depend on the instruction set.
+ */
+
+
+#ifndef ACADO_TOOLKIT_DENSE_KERNELS_HPP
+#define ACADO_TOOLKIT_DENSE_KERNELS_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Computes C += A*B, or C += A^T*B if transposeA is BT_TRUE, where   \n
+ *  C is (m x n), B is (l x n) and A is (m x l), or (l x m) if it is   \n
+ *  transposed.                                                        \n
+ */
+void denseGemm( uint          m         ,
+                uint          n         ,
+                uint          l         ,
+                const double *A         ,
+                BooleanType   transposeA,
+                const double *B         ,
+                double       *C           );
+
+
+/** Computes y += A*x, or y += A^T*x if transposeA is BT_TRUE, where   \n
+ *  A is (m x n).                                                      \n
+ */
+void denseGemv( uint          m         ,
+                uint          n         ,
+                const double *A         ,
+                BooleanType   transposeA,
+                const double *x         ,
+                double       *y           );
+
+
+/** Computes C += A^T*A, where A is (l x n) and the (n x n) matrix C   \n
+ *  is symmetric. Only the lower triangle is computed, the upper       \n
+ *  triangle is copied from it.                                        \n
+ */
+void denseSyrk( uint          n,
+                uint          l,
+                const double *A,
+                double       *C  );
+
+
+/** Overwrites the lower triangle of the symmetric (n x n) matrix A    \n
+ *  with its Cholesky factor L, A = L*L^T. The strictly upper triangle \n
+ *  is overwritten with L^T. Only the lower triangle of A is read.     \n
+ *                                                                     \n
+ *  \return SUCCESSFUL_RETURN                                          \n
+ *          RET_MATRIX_NOT_SPD if a diagonal entry of L is smaller     \n
+ *          than EPS (the factorization is completed nevertheless).    \n
+ */
+returnValue denseCholesky( uint    n,
+                           double *A  );
+
+
+/** Overwrites the (n x nRhs) matrix B with L^{-1}*B, or L^{-T}*B if   \n
+ *  transposeL is BT_TRUE, where L is the lower triangle of the        \n
+ *  (n x n) matrix L.                                                  \n
+ */
+void denseTriangularSolve( uint          n         ,
+                           uint          nRhs      ,
+                           const double *L         ,
+                           BooleanType   transposeL,
+                           double       *B           );
+
+
+/** Overwrites the (n x n) matrix A with its LU factorization with     \n
+ *  partial pivoting, P*A = L*U, where L has a unit diagonal. Row k    \n
+ *  has been exchanged with row pivots[k].                             \n
+ *                                                                     \n
+ *  \return SUCCESSFUL_RETURN                                          \n
+ *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR if a pivot is zero. \n
+ */
+returnValue denseLU( uint    n     ,
+                     double *A     ,
+                     uint   *pivots  );
+
+
+/** Overwrites the (n x nRhs) matrix B with A^{-1}*B, where LU and     \n
+ *  pivots are the output of denseLU.                                  \n
+ */
+void denseLUSolve( uint          n     ,
+                   uint          nRhs  ,
+                   const double *LU    ,
+                   const uint   *pivots,
+                   double       *B       );
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_DENSE_KERNELS_HPP
+
+/*
+ *	end of file
+ */
@@ -322,6 +322,38 @@ class Matrix : public VectorspaceElement{
 		inline Matrix operator^(	const Matrix& arg	/**< Matrix factor. */
 									) const;
 
+		/** Stores the product A*B in the matrix object. The storage of the
+		 *  object is only re-allocated if its dimensions change.
+		 *  \return SUCCESSFUL_RETURN \n
+		 *          RET_VECTOR_DIMENSION_MISMATCH */
+		returnValue setProduct(	const Matrix& A,	/**< Left factor.  */
+								const Matrix& B		/**< Right factor. */
+								);
+
+		/** Adds the product A*B to the matrix object without creating a
+		 *  temporary object.
+		 *  \return SUCCESSFUL_RETURN \n
+		 *          RET_VECTOR_DIMENSION_MISMATCH */
+		returnValue addProduct(	const Matrix& A,	/**< Left factor.  */
+								const Matrix& B		/**< Right factor. */
+								);
+
+		/** Stores the product A^T*B in the matrix object. The storage of the
+		 *  object is only re-allocated if its dimensions change.
+		 *  \return SUCCESSFUL_RETURN \n
+		 *          RET_VECTOR_DIMENSION_MISMATCH */
+		returnValue setTransposedProduct(	const Matrix& A,	/**< Left factor (transposed). */
+											const Matrix& B		/**< Right factor.             */
+											);
+
+		/** Adds the product A^T*B to the matrix object without creating a
+		 *  temporary object.
+		 *  \return SUCCESSFUL_RETURN \n
+		 *          RET_VECTOR_DIMENSION_MISMATCH */
+		returnValue addTransposedProduct(	const Matrix& A,	/**< Left factor (transposed). */
+											const Matrix& B		/**< Right factor.             */
+											);
+
 		/** Multiplies a vector from the right to the matrix object and
 		 *  stores the result to a temporary object.
 		 *  \return Temporary object containing result of multiplication. */
@@ -567,6 +599,9 @@ class Matrix : public VectorspaceElement{
 
 
         /**  Computes the sparse LU decomposition of the matrix.          \n
+         *   If the matrix has been decomposed before and no new non-zero \n
+         *   entries appeared, the symbolic analysis and the pivot        \n
+         *   sequence of the previous decomposition are re-used.          \n
          *                                                                \n
          *   \return  The matrix decomposition  A = LU  in an efficient   \n
          *            sparse storage format.                              \n
@@ -793,9 +828,6 @@ class Matrix : public VectorspaceElement{
                                              double *V               ) const;
 
 
-        void lowerTriangularInverse( double *L, int n ) const;
-
-
 
     //
     // DATA MEMBERS:
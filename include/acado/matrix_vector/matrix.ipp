@@ -184,17 +184,10 @@ inline Matrix Matrix::operator*(	const Matrix& arg
 {
 	ASSERT( getNumCols( ) == arg.getNumRows( ) );
 
-	uint i,j,k;
-
-	uint newNumRows = getNumRows( );
-	uint newNumCols = arg.getNumCols( );
-	Matrix result( newNumRows,newNumCols );
+	Matrix result( getNumRows( ),arg.getNumCols( ) );
 	result.setZero( );
 
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<newNumCols; ++j )
-			for( k=0; k<getNumCols( ); ++k )
-				result( i,j ) += operator()( i,k ) * arg( k,j );
+	denseGemm( getNumRows( ),arg.getNumCols( ),getNumCols( ),element,BT_FALSE,arg.element,result.element );
 
 	return result;
 }
@@ -205,17 +198,13 @@ inline Matrix Matrix::operator^(	const Matrix& arg
 {
 	ASSERT( getNumRows( ) == arg.getNumRows( ) );
 
-	uint i,j,k;
-
-	uint newNumRows = getNumCols( );
-	uint newNumCols = arg.getNumCols( );
-	Matrix result( newNumRows,newNumCols );
+	Matrix result( getNumCols( ),arg.getNumCols( ) );
 	result.setZero( );
 
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<newNumCols; ++j )
-			for( k=0; k<getNumRows( ); ++k )
-				result( i,j ) += operator()( k,i ) * arg( k,j );
+	if ( &arg == this )
+		denseSyrk( getNumCols( ),getNumRows( ),element,result.element );
+	else
+		denseGemm( getNumCols( ),arg.getNumCols( ),getNumRows( ),element,BT_TRUE,arg.element,result.element );
 
 	return result;
 }
@@ -226,15 +215,10 @@ inline Vector Matrix::operator*(	const Vector& arg
 {
 	ASSERT( getNumCols( ) == arg.getDim( ) );
 
-	uint i,j;
-
-	uint newNumRows = getNumRows( );
-	Vector result( newNumRows );
+	Vector result( getNumRows( ) );
 	result.setZero( );
 
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<getNumCols( ); ++j )
-			result( i ) += operator()( i,j ) * arg( j );
+	denseGemv( getNumRows( ),getNumCols( ),element,BT_FALSE,arg.getDoublePointer( ),result.getDoublePointer( ) );
 
 	return result;
 }
@@ -246,15 +230,10 @@ inline Vector Matrix::operator^(	const Vector& arg
 {
 	ASSERT( getNumRows( ) == arg.getDim( ) );
 
-	uint i,j;
-
-	uint newNumRows = getNumCols( );
-	Vector result( newNumRows );
+	Vector result( getNumCols( ) );
 	result.setZero( );
 
-	for( j=0; j<getNumRows( ); ++j )
-		for( i=0; i<newNumRows; ++i )
-			result( i ) += operator()( j,i ) * arg( j );
+	denseGemv( getNumRows( ),getNumCols( ),element,BT_TRUE,arg.getDoublePointer( ),result.getDoublePointer( ) );
 
 	return result;
 }
@@ -36,6 +36,8 @@
 
 #include <acado/utils/acado_utils.hpp>
 
+#include <acado/matrix_vector/dense_kernels.hpp>
+
 #include <acado/matrix_vector/vectorspace_element.hpp>
 
 #include <acado/matrix_vector/vector.hpp>
@@ -458,6 +458,8 @@ class VectorspaceElement
 
 		double* getDoublePointer( );
 
+		const double* getDoublePointer( ) const;
+
 
 
     //
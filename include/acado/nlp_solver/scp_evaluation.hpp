@@ -120,6 +120,19 @@ class SCPevaluation : public AlgorithmicBase
 
 
 
+        /** Shifts the multipliers and the linearization stored in the banded  \n
+         *  CP by one grid point towards the front, consistently with a shift  \n
+         *  of the iterate. The sensitivities of the ODE/DAE discretization of  \n
+         *  all but the last interval are kept, such that the next evaluation   \n
+         *  of the first order sensitivities only differentiates this interval. \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        virtual returnValue shift(	uint N,
+									BandedCP& cp
+									);
+
+
         /** computes the KKT-tolerance (only for internal termination check). \n
          *
          *  \return The requested KKT tolerance.
@@ -169,6 +182,69 @@ class SCPevaluation : public AlgorithmicBase
 		virtual returnValue setupLogging( );
 
 
+        /** Evaluates the sensitivities of the objective and writes the gradient \n
+         *  into cp.objectiveGradient. Depending on the Hessian approximation     \n
+         *  mode, the objective's contribution is written into cp.hessian.        \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        returnValue evaluateObjectiveSensitivities(	HessianApproximationMode hessMode,
+													BandedCP& cp
+													);
+
+        /** Evaluates the sensitivities of the ODE/DAE discretization and writes \n
+         *  them into cp.dynGradient. For an exact Hessian, the second order      \n
+         *  contribution is added into dynamicHessian.                            \n
+         *
+         *  \return SUCCESSFUL_RETURN or an error code of the dynamic discretization
+         */
+        returnValue evaluateDynamicSensitivities(	HessianApproximationMode dynHessMode,
+													int dynMode,
+													BandedCP& cp
+													);
+
+        /** Evaluates the sensitivities of the constraints and writes them into  \n
+         *  cp.constraintGradient. For an exact Hessian, the second order         \n
+         *  contribution is added into constraintHessian.                         \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        returnValue evaluateConstraintSensitivities(	HessianApproximationMode hessMode,
+														int conMode,
+														BandedCP& cp
+														);
+
+        /** Shifts the block rows [first,first+n) of the given matrix by one    \n
+         *  towards the front; the last of these block rows is kept.           \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        returnValue shiftBlockRows(	BlockMatrix& A,
+									uint first,
+									uint n
+									) const;
+
+        /** Shifts the block columns [first,first+n) of the given matrix by one \n
+         *  towards the front; the last of these block columns is kept.        \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        returnValue shiftBlockCols(	BlockMatrix& A,
+									uint first,
+									uint n
+									) const;
+
+        /** Sets a buffer for a Hessian contribution to zero, with the block    \n
+         *  dimensions of the given Hessian. The block storage is kept if the    \n
+         *  dimensions do not change.                                            \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        returnValue initHessianContribution(	const BlockMatrix& hessian,
+												BlockMatrix& contribution
+												) const;
+
+
     //
     // DATA MEMBERS:
     //
@@ -182,6 +258,9 @@ class SCPevaluation : public AlgorithmicBase
 
 		BooleanType isCP;
 		BooleanType areSensitivitiesFrozen;
+
+        BlockMatrix dynamicHessian;        /**< Hessian contribution of the dynamic discretization. */
+        BlockMatrix constraintHessian;     /**< Hessian contribution of the constraints.            */
 };
 
 
@@ -114,6 +114,8 @@ class SCPmeritFunction : public AlgorithmicBase
     //
     protected:
 
+		OCPiterate iterTest;	/**< Trial iterate x_k + alpha * Delta x_k (storage is re-used between evaluations). */
+
     	//double functionWeight;
        	//double dynamicWeight;
     	//double equalityWeight;
@@ -42,6 +42,7 @@
 #include <acado/conic_solver/dense_qp_solver.hpp>
 #include <acado/conic_solver/banded_cp_solver.hpp>
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
+#include <acado/conic_solver/interior_point_based_cp_solver.hpp>
 
 #include <acado/nlp_solver/scp_evaluation.hpp>
 #include <acado/nlp_solver/scp_step_linesearch.hpp>
@@ -186,9 +187,9 @@ class SCPmethod : public NLPsolver
         returnValue checkForConvergence( );
 		
 
-		returnValue computeHessianMatrix(	const BlockMatrix& oldLagrangeGradient,
-											const BlockMatrix& newLagrangeGradient
-											);
+		/** Updates the Hessian approximation from the step and the difference of
+		 *	the members newLagrangeGradient and oldLagrangeGradient. */
+		returnValue computeHessianMatrix( );
 
 
         returnValue initializeHessianProjection( );
@@ -259,6 +260,10 @@ class SCPmethod : public NLPsolver
 		OCPiterate iter;
 		OCPiterate oldIter;
 
+		BlockMatrix oldLagrangeGradient;
+		BlockMatrix newLagrangeGradient;
+		BlockMatrix deltaLagrangeGradient;
+
 		SCPevaluation* eval;
 		SCPstep* scpStep;
 		NLPderivativeApproximation* derivativeApproximation;
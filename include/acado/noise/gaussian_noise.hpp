@@ -254,7 +254,7 @@ class GaussianNoise : public Noise
 		 */
 		double getGaussianRandomNumber(	double _mean,
 										double _variance
-										) const;
+										);
 
 
 	//
@@ -156,6 +156,21 @@ class Noise
 		inline BlockStatus getStatus( ) const;
 
 
+		/** Derives a seed for an independent stream of pseudo-random numbers from
+		 *	a given seed and a stream index. Different stream indices (or seeds) lead
+		 *	to uncorrelated streams, e.g. for different noise components or for
+		 *	different scenarios of an ensemble of simulations.
+		 *
+		 *	@param[in] seed			Seed (non-zero).
+		 *	@param[in] streamIdx	Index of the stream.
+		 *
+		 *  \return Non-zero seed of the stream
+		 */
+		static uint deriveSeed(	uint seed,
+								uint streamIdx
+								);
+
+
 
 	//
 	//  PROTECTED MEMBER FUNCTIONS:
@@ -171,6 +186,18 @@ class Noise
 		inline returnValue setStatus(	BlockStatus _status
 										);
 
+		/** Initializes the pseudo-random number generator of this noise block.
+		 *	Each noise block has its own generator, thus several blocks can generate
+		 *	noise concurrently and independently of each other. If seed is not
+		 *	specified (i.e. 0), a seed is obtained from the system clock.
+		 *
+		 *	@param[in] seed		Seed for pseudo-random number generator.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue initializeRandomNumberGenerator(	uint seed
+														);
+
 		/** Returns a pseudo-random number based on a uniform distribution with
 		 *	given lower and upper limits.
 		 *
@@ -181,7 +208,7 @@ class Noise
 		 */
 		inline double getUniformRandomNumber(	double _lowerLimit,
 												double _upperLimit
-												) const;
+												);
 
 
 	//
@@ -191,6 +218,8 @@ class Noise
 		BlockStatus status;				/**< Current status of the noise. */
 
 		VariablesGrid w;				/**< Sequence of most recently generated noise. */
+
+		uint randomState;				/**< State of the pseudo-random number generator (xorshift). */
 };
 
 
@@ -74,17 +74,17 @@ inline returnValue Noise::setStatus(	BlockStatus _status
 
 inline double Noise::getUniformRandomNumber(	double _lowerLimit,
 												double _upperLimit
-												) const
+												)
 {
-	double halfAmplitude = ( _upperLimit - _lowerLimit ) / 2.0;
+	/* Marsaglia's xorshift generator, the state is never zero */
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
 
-	/* Random number between -RAND_MAX and RAND_MAX */
-	int randomNumber = ( rand( ) - RAND_MAX/2 ) * 2;
+	/* Random number between 0 and 1 */
+	double scaledRandomNumber = ((double) randomState) / 4294967296.0;
 
-	/* Random number between -1 and 1 */
-	double scaledRandomNumber = ((double) randomNumber) / ((double) RAND_MAX);
-
-	return ( halfAmplitude*scaledRandomNumber + _lowerLimit+halfAmplitude );
+	return ( _lowerLimit + ( _upperLimit - _lowerLimit )*scaledRandomNumber );
 }
 
 
@@ -156,6 +156,23 @@ class LSQTerm : public ObjectiveElement{
     //
     protected:
 
+        /** Writes the backward derivatives at the given grid point into the  \n
+         *  blocks of dBackward. The Jacobian has to be stored in h_jac.       \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         */
+        returnValue storeBackwardSensitivities( int pointIdx, double bseed_ );
+
+
+        /** Adds the (Gauss-Newton part of the) Hessian at the given grid      \n
+         *  point to the given block matrix, where h_jac and S_h_jac have to   \n
+         *  contain the Jacobian and the weighted Jacobian.                    \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         */
+        returnValue addHessianBlocks( int pointIdx, BlockMatrix *hessian );
+
+
 
     //
     // DATA MEMBERS:
@@ -172,6 +189,13 @@ class LSQTerm : public ObjectiveElement{
                                               *  to be stored for backward     \n
                                               *  differentiation               \n
                                               */
+
+    Vector              h_res           ;    /**< work array for the residuum          */
+    Vector              h_seed          ;    /**< work array for the seeds             */
+    Vector              f_seed          ;    /**< work array for the forward seeds     */
+    Matrix              h_jac           ;    /**< work array for the Jacobian          */
+    Matrix              S_h_jac         ;    /**< work array for the weighted Jacobian */
+    Matrix              h_hess[5][5]    ;    /**< work arrays for the Hessian blocks   */
 };
 
 
@@ -74,7 +74,11 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
 
 
 
-        /** Starts execution. */
+        /** Starts execution. The weighted problems are solved in waves of  \n
+         *  independent copies of the algorithm, one per OpenMP thread. With \n
+         *  PARETO_FRONT_HOTSTART each problem is initialized with the       \n
+         *  solution at the nearest weight that has already been solved.     \n
+         */
         virtual returnValue solve( );
 
 
@@ -249,6 +253,19 @@ class MultiObjectiveAlgorithm : public OptimizationAlgorithm
         inline returnValue printAuxiliaryRoutine( const char*fileName, VariablesGrid *x_ ) const;
 
 
+        /**  Returns the index of the weight (column of Weights) closest   \n
+         *   to the weight with index "point" among all weights, which are \n
+         *   marked as available, or -1 if there is no such weight.        \n
+         *   Among equally close weights the predecessor "point"-1 is       \n
+         *   preferred.                                                     \n
+         *                                                                  \n
+         *  \return index of the nearest available weight or -1            \n
+         */
+        int getNearestPoint( const Matrix      &Weights  ,
+                             int                point    ,
+                             const BooleanType *available ) const;
+
+
     //
     // DATA MEMBERS:
     //
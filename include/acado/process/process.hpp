@@ -156,6 +156,19 @@ class Process : public SimulationBlock
 		returnValue setSensor(	const Sensor& _sensor
 								);
 
+		/** Assigns a seed for the noise of actuator and sensor. Both obtain
+		 *	independent streams of pseudo-random numbers derived from this seed,
+		 *	thus the simulation can be reproduced exactly. If the seed is 0, seeds
+		 *	are obtained from the system clock. The seed applies to the actuator
+		 *	and sensor currently set and takes effect at the next initialization.
+		 *
+		 *	@param[in]  _noiseSeed		Seed for actuator and sensor noise.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setNoiseSeed(	uint _noiseSeed
+									);
+
 
 		/** Assigns new process disturbance to be used for simulation.
 		 *
@@ -524,6 +537,15 @@ class Process : public SimulationBlock
 		returnValue clear( );
 
 
+		/** Drops the integrators kept from previous calls of simulate, such
+		 *	that the next call sets them up again with the current dynamic
+		 *	system and options.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clearIntegrators( );
+
+
 		/** Actually calls the integrator for performing a simulation. All
 		 *	simulated results are logged internally.
 		 *
@@ -611,6 +633,7 @@ class Process : public SimulationBlock
 		Curve* processDisturbance;					/**< Process disturbance block. */
 
 		VariablesGrid y;
+		OutputFcn outputFcn;						/**< Output function of the dynamic system. */
 
 		double lastTime;
 
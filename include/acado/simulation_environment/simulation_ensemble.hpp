@@ -0,0 +1,346 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/simulation_environment/simulation_ensemble.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ */
+
+
+#ifndef ACADO_TOOLKIT_SIMULATION_ENSEMBLE_HPP
+#define ACADO_TOOLKIT_SIMULATION_ENSEMBLE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+#include <acado/simulation_environment/simulation_environment.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+/**
+ *	\brief Runs an ensemble of closed-loop simulations, e.g. for Monte-Carlo studies.
+ *
+ *	\ingroup UserInterfaces
+ *
+ *	The class SimulationEnsemble runs a number of closed-loop simulations (scenarios)
+ *	of a given SimulationEnvironment. The scenarios differ in the initial value of the
+ *	differential states, the parameters and the seed of the actuator and sensor noise.
+ *
+ *	Each scenario is simulated on its own deep copies of the Process and the Controller
+ *	(including control law, estimator and reference trajectory) of the given simulation
+ *	environment, which itself is not modified. Moreover, each scenario obtains its own
+ *	stream of pseudo-random numbers derived from its seed, thus all results can be
+ *	reproduced exactly. If OpenMP is available, the scenarios are simulated in parallel.
+ *
+ *	After the ensemble has been run, the results of each scenario can be obtained
+ *	separately or combined into one VariablesGrid holding the results of all scenarios.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ *
+ */
+class SimulationEnsemble
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Default constructor. 
+		 */
+		SimulationEnsemble( );
+
+		/** Constructor which takes the simulation environment whose Process and
+		 *	Controller are to be simulated.
+		 *
+		 *	@param[in] _environment		Simulation environment.
+		 *
+		 *	\note Only pointers to Process and Controller of the simulation environment are stored!
+		 */
+		SimulationEnsemble(	const SimulationEnvironment& _environment
+							);
+
+		/** Copy constructor (deep copy).
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		SimulationEnsemble(	const SimulationEnsemble& rhs
+							);
+
+		/** Destructor. 
+		 */
+		virtual ~SimulationEnsemble( );
+
+		/** Assignment Operator (deep copy).
+		 *
+		 *	@param[in] rhs	Right-hand side object.
+		 */
+		SimulationEnsemble& operator=(	const SimulationEnsemble& rhs
+										);
+
+
+		/** Assigns new simulation environment whose Process and Controller are to be
+		 *	simulated. All results are cleared.
+		 *
+		 *	@param[in]  _environment		New simulation environment.
+		 *
+		 *	\note Only pointers to Process and Controller of the simulation environment are stored!
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setSimulationEnvironment(	const SimulationEnvironment& _environment
+												);
+
+		/** Assigns the seed from which the noise seeds of all scenarios are derived
+		 *	that have been added without a seed of their own. If the seed is 0, the
+		 *	noise seeds are obtained from the system clock.
+		 *
+		 *	@param[in]  _seed		Seed of the ensemble.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setSeed(	uint _seed
+								);
+
+		/** Adds a scenario to the ensemble.
+		 *
+		 *	@param[in]  _x0		Initial value for differential states.
+		 *	@param[in]  _p		Initial value for parameters.
+		 *	@param[in]  _seed	Seed for the actuator and sensor noise; if not specified
+		 *						(i.e. 0), it is derived from the seed of the ensemble.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue addScenario(	const Vector& _x0,
+									const Vector& _p = emptyConstVector,
+									uint _seed = 0
+									);
+
+		/** Removes all scenarios and their results.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clearScenarios( );
+
+
+		/** Runs the complete simulations of all scenarios. Scenarios that fail do
+		 *	not affect the other ones, their return values can be obtained via
+		 *	getReturnValue.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_NO_PROCESS_SPECIFIED, \n
+		 *	        RET_NO_CONTROLLER_SPECIFIED, \n
+		 *	        RET_ENVIRONMENT_STEP_FAILED
+		 */
+		returnValue run( );
+
+
+		/** Returns number of scenarios.
+		 *
+		 *	\return Number of scenarios
+		 */
+		inline uint getNumScenarios( ) const;
+
+		/** Returns the noise seed of a scenario.
+		 *
+		 *	@param[in]  idx		Index of the scenario.
+		 *
+		 *	\return Noise seed of the scenario
+		 */
+		uint getScenarioSeed(	uint idx
+								) const;
+
+		/** Returns the return value of the simulation of a scenario.
+		 *
+		 *	@param[in]  idx		Index of the scenario.
+		 *
+		 *	\return Return value of the simulation of the scenario
+		 */
+		inline returnValue getReturnValue(	uint idx
+											) const;
+
+
+		/** Returns output of the process at sampling instants of a scenario.
+		 *
+		 *	@param[in]   idx						Index of the scenario.
+		 *	@param[out]  _sampledProcessOutput		Sampled output of the process.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 */
+		inline returnValue getSampledProcessOutput(	uint idx,
+													VariablesGrid& _sampledProcessOutput
+													) const;
+
+		/** Returns differential states of the process of a scenario.
+		 *
+		 *	@param[in]   idx				Index of the scenario.
+		 *	@param[out]  _diffStates		Differential states of the process.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 */
+		inline returnValue getProcessDifferentialStates(	uint idx,
+															VariablesGrid& _diffStates
+															) const;
+
+		/** Returns feedback control signals of the controller of a scenario.
+		 *
+		 *	@param[in]   idx						Index of the scenario.
+		 *	@param[out]  _sampledFeedbackControl	Feedback control signals of the controller.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INDEX_OUT_OF_BOUNDS
+		 */
+		inline returnValue getFeedbackControl(	uint idx,
+												VariablesGrid& _sampledFeedbackControl
+												) const;
+
+
+		/** Returns output of the process at sampling instants of all scenarios.
+		 *	The values of scenario i are stored in the columns i*ny to (i+1)*ny-1.
+		 *
+		 *	@param[out]  _sampledProcessOutput		Sampled output of all processes.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED
+		 */
+		returnValue getSampledProcessOutput(	VariablesGrid& _sampledProcessOutput
+												) const;
+
+		/** Returns differential states of the process of all scenarios.
+		 *	The values of scenario i are stored in the columns i*nx to (i+1)*nx-1.
+		 *
+		 *	@param[out]  _diffStates		Differential states of all processes.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED
+		 */
+		returnValue getProcessDifferentialStates(	VariablesGrid& _diffStates
+													) const;
+
+		/** Returns feedback control signals of the controller of all scenarios.
+		 *	The values of scenario i are stored in the columns i*nu to (i+1)*nu-1.
+		 *
+		 *	@param[out]  _sampledFeedbackControl	Feedback control signals of all controllers.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED
+		 */
+		returnValue getFeedbackControl(	VariablesGrid& _sampledFeedbackControl
+										) const;
+
+
+
+	//
+	//  PROTECTED MEMBER FUNCTIONS:
+	//
+	protected:
+
+		/** Sets up the simulation environment of a scenario on deep copies of
+		 *	Process and Controller and initializes it. As this involves symbolic
+		 *	operations, it must not be called concurrently.
+		 *
+		 *	@param[in]  idx					Index of the scenario.
+		 *	@param[out] scenarioEnvironment	Simulation environment of the scenario.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_ENVIRONMENT_INIT_FAILED
+		 */
+		returnValue setupScenario(	uint idx,
+									SimulationEnvironment*& scenarioEnvironment
+									);
+
+		/** Stores the results of the simulation environment of a scenario
+		 *	and deletes it together with its copies of Process and Controller.
+		 *
+		 *	@param[in]     idx					Index of the scenario.
+		 *	@param[in,out] scenarioEnvironment	Simulation environment of the scenario.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue finishScenario(	uint idx,
+									SimulationEnvironment*& scenarioEnvironment
+									);
+
+		/** Frees the memory of all results.
+		 */
+		void clearResults( );
+
+		/** Copies all scenarios and results of the given ensemble.
+		 */
+		void copy(	const SimulationEnsemble& rhs
+					);
+
+		/** Combines the given results of all scenarios into one VariablesGrid.
+		 *
+		 *	@param[in]  results		Results of all scenarios.
+		 *	@param[out] combined	Combined results.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED
+		 */
+		returnValue combineResults(	const VariablesGrid* const results,
+									VariablesGrid& combined
+									) const;
+
+
+	//
+	//  PROTECTED MEMBERS:
+	//
+	protected:
+		SimulationEnvironment environment;			/**< Simulation environment whose Process and Controller are simulated. */
+
+		uint seed;									/**< Seed from which the noise seeds of the scenarios are derived. */
+
+		uint nScenarios;							/**< Number of scenarios. */
+		Matrix xStart;								/**< Initial values of the differential states (one row per scenario). */
+		Matrix pStart;								/**< Initial values of the parameters (one row per scenario). */
+		uint* seeds;								/**< Noise seeds of the scenarios (0 if derived from the seed of the ensemble). */
+
+		returnValue* returnValues;					/**< Return values of the simulations of all scenarios. */
+		VariablesGrid* sampledProcessOutputs;		/**< Sampled process outputs of all scenarios. */
+		VariablesGrid* processDifferentialStates;	/**< Differential states of the processes of all scenarios. */
+		VariablesGrid* feedbackControls;			/**< Feedback controls of all scenarios. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/simulation_environment/simulation_ensemble.ipp>
+
+
+#endif	// ACADO_TOOLKIT_SIMULATION_ENSEMBLE_HPP
+
+
+/*
+ *	end of file
+ */
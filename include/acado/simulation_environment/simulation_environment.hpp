@@ -70,6 +70,8 @@ BEGIN_NAMESPACE_ACADO
  */
 class SimulationEnvironment : public SimulationBlock
 {
+	friend class SimulationEnsemble;
+
 	//
 	//  PUBLIC MEMBER FUNCTIONS:
 	//
@@ -336,6 +338,28 @@ class SimulationEnvironment : public SimulationBlock
 		virtual returnValue setupLogging( );
 
 
+		/** Simulates the process from the current simulation time until the
+		 *	next sampling instant and updates the simulation history.
+		 *
+		 *	@param[in]  nextSamplingInstant		Next sampling instant.
+		 *	@param[in]  compDelay				Computational delay of the controls.
+		 *	@param[in]  u						Controls from the controller.
+		 *	@param[in]  p						Parameters from the controller.
+		 *	@param[in]  uPrevious				Controls applied before the computational delay.
+		 *	@param[in]  pPrevious				Parameters applied before the computational delay.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_ENVIRONMENT_STEP_FAILED, \n
+		 *	        RET_COMPUTATIONAL_DELAY_TOO_BIG
+		 */
+		returnValue stepProcess(	double nextSamplingInstant,
+									double compDelay,
+									const Vector& u,
+									const Vector& p,
+									const Vector& uPrevious,
+									const Vector& pPrevious
+									);
+
 		/** Returns computational delay used for simulation based on the actual real
 		 *	controller runtime and the options set by the user.
 		 *
@@ -112,6 +112,20 @@ class SparseSolver{
 
 
 
+        /** Sets the matrix A from its dense (row-major) representation. \n
+         *  Entries with an absolute value of at most zeroTol are treated \n
+         *  as zeros. By default the index list of the other entries is   \n
+         *  set up and passed to setIndices() and setMatrix().            \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                \n
+         */
+        virtual returnValue setDenseMatrix( const int    &n,
+                                            const double *A_,
+                                            double        zeroTol );
+
+
+
         /**  Solves the system  A*x = b  for the specified data.       \n
          *                                                             \n
          *   \return SUCCESSFUL_RETURN                                 \n
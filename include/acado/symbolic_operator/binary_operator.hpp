@@ -57,6 +57,7 @@ class BinaryOperator : public SmoothOperator{
 public:
 
   friend class Power_Int;
+  friend class FunctionEvaluationTape;
   /** Default constructor. */
   BinaryOperator();
 
@@ -327,12 +328,20 @@ public:
                                                           of the expression  */   ) = 0;
 
 
-     /** Provides a deep copy of the expression. \n
+     /** Provides a copy of the expression which \n
+      *  shares the arguments of the original.  \n
       *  \return a clone of the expression.      \n
       */
      virtual Operator* clone() const = 0;
 
 
+     /** Replaces the arguments by unshared copies, see   \n
+      *  Operator::cloneUnshared().                        \n
+      *  \return SUCCESSFUL_RETURN                          \n
+      */
+     virtual returnValue unshareArguments( OperatorCopyTable &copies );
+
+
      /** Clears the buffer and resets the buffer size \n
       *  to 1.                                        \n
       *  \return SUCCESFUL_RETURN                     \n
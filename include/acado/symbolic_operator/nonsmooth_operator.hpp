@@ -500,9 +500,6 @@ public:
     virtual BooleanType isSymbolic() const;
 
 
-    int nCount;
-
-
 //
 //  PROTECTED FUNCTIONS:
 //
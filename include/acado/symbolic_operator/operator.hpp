@@ -450,8 +450,9 @@ public:
 
 
 
-     /** Provides a deep copy of the expression. \n
-      *  \return a clone of the expression.      \n
+     /** Provides a copy of the expression. Only the root node is  \n
+      *  copied, the arguments are shared with the original.       \n
+      *  \return a clone of the expression.                        \n
       */
      virtual Operator* clone() const = 0;
 
@@ -544,6 +545,48 @@ public:
     virtual BooleanType isSymbolic() const = 0;
 
 
+     /** Returns a copy of the operator tree which does not share any  \n
+      *  node with other trees. Nodes which occur several times within \n
+      *  the tree (or within all trees copied with the same table) are \n
+      *  copied only once, i.e. the copy keeps the DAG structure.      \n
+      *                                                                \n
+      *  \return The copy, which is owned by the caller.               \n
+      */
+     Operator* cloneUnshared( OperatorCopyTable &copies /**< the nodes copied so far */ ) const;
+
+
+     /** Replaces the arguments of the operator by unshared copies,    \n
+      *  see cloneUnshared().                                          \n
+      *                                                                \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      */
+     virtual returnValue unshareArguments( OperatorCopyTable &copies /**< the nodes copied so far */ );
+
+
+     /** Registers the caller as an additional owner of an argument    \n
+      *  which is shared with other operators.                          \n
+      */
+     static void retainArgument( Operator *arg );
+
+
+     /** Releases an argument which may be shared with other operators: \n
+      *  the argument is deleted if the caller is its only owner, and   \n
+      *  its reference counter is decreased otherwise.                  \n
+      */
+     static void releaseArgument( Operator *arg );
+
+
+     /** Returns BT_TRUE if the node has more than one owner.          \n
+      */
+     static BooleanType isSharedArgument( const Operator *arg );
+
+
+    /** The number of owners of this node minus one. Operators share   \n
+     *  their arguments with their copies, i.e. copying a tree only    \n
+     *  copies its root. As copies of an expression may be destroyed   \n
+     *  by different threads, the counter is only accessed atomically  \n
+     *  via retainArgument(), releaseArgument() and isSharedArgument().\n
+     */
     int nCount;
 
 
@@ -561,6 +604,14 @@ public:
 protected:
 
 
+     /** Returns the unshared copy of an argument, see cloneUnshared(). \n
+      *  An argument which has been copied before with the same table   \n
+      *  is not copied again, but its copy is shared.                   \n
+      */
+     static Operator* copyArgument( const Operator    *arg   ,
+                                    OperatorCopyTable &copies  );
+
+
 };
 
 
@@ -53,6 +53,8 @@ BEGIN_NAMESPACE_ACADO
  */
 class Power_Int : public SmoothOperator{
 
+friend class FunctionEvaluationTape;
+
 public:
 
 
@@ -332,12 +334,20 @@ public:
      virtual Stream& print( Stream &stream ) const;
 
 
-     /** Provides a deep copy of the expression. \n
+     /** Provides a copy of the expression which \n
+      *  shares the arguments of the original.  \n
       *  \return a clone of the expression.      \n
       */
      virtual Operator* clone() const;
 
 
+     /** Replaces the arguments by unshared copies, see   \n
+      *  Operator::cloneUnshared().                        \n
+      *  \return SUCCESSFUL_RETURN                          \n
+      */
+     virtual returnValue unshareArguments( OperatorCopyTable &copies );
+
+
      /** Clears the buffer and resets the buffer size \n
       *  to 1.                                        \n
       *  \return SUCCESFUL_RETURN                     \n
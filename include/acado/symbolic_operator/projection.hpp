@@ -55,6 +55,7 @@ class Projection : public SmoothOperator{
 
 
 friend class FunctionEvaluationTree;
+friend class FunctionEvaluationTape;
 
 
 public:
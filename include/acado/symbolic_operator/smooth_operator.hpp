@@ -500,8 +500,6 @@ public:
     virtual BooleanType isSymbolic() const = 0;
 
 
-    int nCount;
-
 //
 //  PROTECTED FUNCTIONS:
 //
@@ -34,6 +34,8 @@
 #include <acado/matrix_vector/matrix_vector.hpp>
 #include <acado/variables_grid/variables_grid.hpp>
 
+#include <map>
+
 BEGIN_NAMESPACE_ACADO
 
 
@@ -72,6 +74,12 @@ BEGIN_NAMESPACE_ACADO
    class TreeProjection              ;
 
 
+// TABLE OF NODES AND THEIR UNSHARED COPIES:
+// -----------------------------------------
+
+   typedef std::map< const Operator*, Operator* > OperatorCopyTable;
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
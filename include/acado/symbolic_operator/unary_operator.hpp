@@ -54,6 +54,8 @@ BEGIN_NAMESPACE_ACADO
 
 class UnaryOperator : public SmoothOperator{
 
+friend class FunctionEvaluationTape;
+
 public:
 
     /** Default constructor. */
@@ -294,12 +296,20 @@ public:
      virtual Stream& print( Stream &stream ) const;
 
 
-    /** Provides a deep copy of the expression. \n
+    /** Provides a copy of the expression which \n
+     *  shares the arguments of the original.  \n
      *  \return a clone of the expression.      \n
      */
     virtual Operator* clone() const = 0;
 
 
+    /** Replaces the arguments by unshared copies, see   \n
+     *  Operator::cloneUnshared().                        \n
+     *  \return SUCCESSFUL_RETURN                          \n
+     */
+    virtual returnValue unshareArguments( OperatorCopyTable &copies );
+
+
     /** Clears the buffer and resets the buffer size \n
      *  to 1.                                        \n
      *  \return SUCCESFUL_RETURN                     \n
@@ -130,6 +130,26 @@ class TransferDevice : public SimulationBlock
 		inline BooleanType hasDeadTime( ) const;
 
 
+		/** Assigns a seed for the additive noise. Each noise component obtains
+		 *	its own stream of pseudo-random numbers derived from this seed, which
+		 *	allows to reproduce the generated noise exactly. If the seed is 0
+		 *	(default), seeds are obtained from the system clock. The seed takes
+		 *	effect when the transfer device is initialized.
+		 *
+		 *	@param[in]  _noiseSeed		Seed for additive noise.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		inline returnValue setNoiseSeed(	uint _noiseSeed
+											);
+
+		/** Returns the seed for the additive noise.
+		 *
+		 *  \return Seed for additive noise
+		 */
+		inline uint getNoiseSeed( ) const;
+
+
 
 	//
 	// PROTECTED MEMBER FUNCTIONS:
@@ -177,6 +197,8 @@ class TransferDevice : public SimulationBlock
 		Vector  noiseSamplingTimes;					/**< Noise sampling times for each component of the transfer device signal. */
 
 		Vector  deadTimes;							/**< Dead times for each component of the transfer device signal. */
+
+		uint noiseSeed;								/**< Seed for the additive noise (0 if obtained from the system clock). */
 };
 
 
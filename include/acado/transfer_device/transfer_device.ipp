@@ -81,6 +81,21 @@ inline BooleanType TransferDevice::hasDeadTime( ) const
 
 
 
+inline returnValue TransferDevice::setNoiseSeed(	uint _noiseSeed
+												)
+{
+	noiseSeed = _noiseSeed;
+	return SUCCESSFUL_RETURN;
+}
+
+
+inline uint TransferDevice::getNoiseSeed( ) const
+{
+	return noiseSeed;
+}
+
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
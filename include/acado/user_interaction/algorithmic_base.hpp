@@ -426,6 +426,13 @@ class AlgorithmicBase
 												) const;
 
 
+		/** Declares all options to be unchanged.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		inline returnValue declareOptionsUnchanged( );
+
+
 		/** Sets all numerical values at all time instants of all items
 		 *	with given name within all records.
 		 *
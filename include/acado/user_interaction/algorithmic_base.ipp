@@ -165,6 +165,12 @@ inline BooleanType AlgorithmicBase::haveOptionsChanged(	uint idx
 }
 
 
+inline returnValue AlgorithmicBase::declareOptionsUnchanged( )
+{
+	return userInteraction->declareOptionsUnchanged( );
+}
+
+
 
 inline returnValue AlgorithmicBase::setAll(	LogName _name,
 											const MatrixVariablesGrid& values
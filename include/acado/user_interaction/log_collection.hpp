@@ -56,7 +56,11 @@ BEGIN_NAMESPACE_ACADO
  *
  *	Besides managing the singly-linked list, this class tunnels the main 
  *	functionality of the LogRecord class such that this functionality can be 
- *	called on all records within the list simultaneously.
+ *	called on all records within the list simultaneously. Items that are 
+ *	identified by a LogName are resolved to direct slots whenever a record is 
+ *	added, such that storing a value does not need to search the records.
+ *	Therefore, records must not be changed structurally once they have been 
+ *	added to the collection.
  *
  *	\note Parts of the public functionality of the LogCollection are tunnelled 
  *	by the AlgorithmicBase class to be used in derived developer classes. In case
@@ -708,6 +712,54 @@ class LogCollection
 								double time = -INFTY
 								);
 
+		/** Sets a scalar value at last time instant of all items
+		 *	with given internal name and internal type within all records.
+		 *	The value is staged in a work matrix of the collection.
+		 *
+		 *	@param[in]  _name		Internal name of item.
+		 *	@param[in]  _type		Internal type of item.
+		 *	@param[in]  lastValue	Numerical value at last time instant of given item.
+		 *	@param[in]  time		Time label of the instant.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_COLLECTION_CORRUPTED 
+		 */
+		returnValue setLastScalar(	uint _name,
+									LogRecordItemType _type,
+									double lastValue,
+									double time = -INFTY
+									);
+
+		/** Sets a vector value at last time instant of all items
+		 *	with given internal name and internal type within all records.
+		 *	The value is staged in a work matrix of the collection.
+		 *
+		 *	@param[in]  _name		Internal name of item.
+		 *	@param[in]  _type		Internal type of item.
+		 *	@param[in]  lastValue	Numerical value at last time instant of given item.
+		 *	@param[in]  time		Time label of the instant.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_COLLECTION_CORRUPTED 
+		 */
+		returnValue setLastVector(	uint _name,
+									LogRecordItemType _type,
+									const Vector& lastValue,
+									double time = -INFTY
+									);
+
+		/** Writes the value into all matching items; the caller has to hold
+		 *	the critical section acadoLogCollection.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_COLLECTION_CORRUPTED 
+		 */
+		returnValue writeLast(	uint _name,
+								LogRecordItemType _type,
+								const Matrix& value,
+								double time
+								);
+
 
 		/** Checks whether the collection contains a certain record and,
 		 *	if so, return its index within the collection.
@@ -768,6 +820,20 @@ class LogCollection
 									) const;
 
 
+		/** Resolves all items of all records that are identified by a LogName 
+		 *	to direct slots.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue updateSlots( );
+
+		/** Clears the slots of all items identified by a LogName.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clearSlots( );
+
+
     //
     // DATA MEMBERS:
     //
@@ -776,6 +842,14 @@ class LogCollection
 		LogRecord* last;				/**< Pointer to last record of the singly-linked list. */
 
 		uint number;					/**< Total number of records within the singly-linked list of the collection. */
+
+		uint nSlotNames;				/**< Number of LogNames covered by the slots (maximum LogName plus one). */
+		uint* slotStart;				/**< Index of the first slot of each LogName (of length nSlotNames+1). */
+		LogRecordItem** slotItems;		/**< Items of all records ordered by their LogName. */
+		LogRecord** slotRecords;		/**< Records containing the items of the corresponding slots. */
+
+		Matrix scalarBuffer;			/**< Work matrix for storing scalar values (only accessed within the critical section acadoLogCollection). */
+		Matrix vectorBuffer;			/**< Work matrix for storing vector values (only accessed within the critical section acadoLogCollection). */
 };
 
 
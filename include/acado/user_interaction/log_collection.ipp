@@ -184,8 +184,7 @@ inline returnValue LogCollection::setLast(	LogName _name,
 											double time
 											)
 {
-	Matrix tmp( lastValue );
-	return setLast( _name,tmp,time );
+	return setLastScalar( (int)_name,LRT_ENUM,(double) lastValue,time );
 }
 
 
@@ -194,8 +193,7 @@ inline returnValue LogCollection::setLast(	const Expression& _name,
 											double time
 											)
 {
-	Matrix tmp( lastValue );
-	return setLast( _name,tmp,time );
+	return setLastScalar( _name.getComponent( 0 ),LRT_VARIABLE,(double) lastValue,time );
 }
 
 
@@ -204,8 +202,7 @@ inline returnValue LogCollection::setLast(	LogName _name,
 											double time
 											)
 {
-	Matrix tmp( lastValue );
-	return setLast( _name,tmp,time );
+	return setLastScalar( (int)_name,LRT_ENUM,(double) lastValue,time );
 }
 
 
@@ -214,8 +211,7 @@ inline returnValue LogCollection::setLast(	const Expression& _name,
 											double time
 											)
 {
-	Matrix tmp( lastValue );
-	return setLast( _name,tmp,time );
+	return setLastScalar( _name.getComponent( 0 ),LRT_VARIABLE,(double) lastValue,time );
 }
 
 
@@ -224,8 +220,7 @@ inline returnValue LogCollection::setLast(	LogName _name,
 											double time
 											)
 {
-	Matrix tmp( lastValue );
-	return setLast( (int)_name,LRT_ENUM,tmp,time );
+	return setLastVector( (int)_name,LRT_ENUM,lastValue,time );
 }
 
 
@@ -234,8 +229,7 @@ inline returnValue LogCollection::setLast(	const Expression& _name,
 											double time
 											)
 {
-	Matrix tmp( lastValue );
-	return setLast( _name.getComponent( 0 ),LRT_VARIABLE,tmp,time );
+	return setLastVector( _name.getComponent( 0 ),LRT_VARIABLE,lastValue,time );
 }
 
 
@@ -65,6 +65,8 @@ BEGIN_NAMESPACE_ACADO
  *	defining whether the information is stored at each iteration or only at the 
  *	start or end, respectively; (ii) the file, e.g. a file or the screen,
  *	to which the whole log record including all its items can be printed.
+ *	Optionally, the number of stored time instants per item can be bounded such 
+ *	that long runs only keep the newest values.
  *
  *	Finally, it is interesting to know that LogRecords can be setup by the user and
  *	flushed to UserInterface classes. Internally, LogRecords are stored as basic 
@@ -737,6 +739,25 @@ class LogRecord
 											);
 
 
+		/** Limits the number of time instants on which numerical values are stored
+		 *	within each item of the record (including items added later on). If more 
+		 *	values are logged, the oldest ones are overwritten.
+		 *
+		 *	@param[in]  _maxNumPoints	Maximum number of stored time instants (0 = unbounded).
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setMaxNumPoints(	uint _maxNumPoints
+										);
+
+		/** Returns maximum number of time instants on which numerical values are 
+		 *	stored within each item of the record.
+		 *
+		 *  \return Maximum number of time instants (0 = unbounded)
+		 */
+		inline uint getMaxNumPoints( ) const;
+
+
 		/** Returns whether an (possibly empty) item with given internal name 
 		 *	exists or not.
 		 *
@@ -979,12 +1000,15 @@ class LogRecord
 										) const;
 
 
-		/** Returns the length of the string containing all numerical values of all 
-		 *	items of the record in the pre-defined output format.
+		/** Returns the length of the string containing the numerical values of all 
+		 *	items of the record to be printed in the pre-defined output format.
+		 *
+		 *	@param[in] _mode	Print mode defining which values are to be printed.
 		 *
 		 *  \return String length
 		 */
-		uint determineRecordStringLength( ) const;
+		uint determineRecordStringLength(	LogPrintMode _mode
+											) const;
 
 
     //
@@ -998,6 +1022,7 @@ class LogRecord
 		FILE* outputFile;				/**< Output file to which the log record can be printed. */
 		char* outputFileName;			/**< Output file given by its file name to which the log record can be printed. */
 		PrintScheme printScheme;		/**< Print scheme defining the output format of the information. */
+		uint maxNumPoints;				/**< Maximum number of stored time instants per item (0 = unbounded). */
 
 		LogRecordItem* first;			/**< Pointer to first item of the singly-linked list. */
 		LogRecordItem* last;			/**< Pointer to last item of the singly-linked list. */
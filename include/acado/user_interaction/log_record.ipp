@@ -334,6 +334,12 @@ inline PrintScheme LogRecord::getPrintScheme( ) const
 }
 
 
+inline uint LogRecord::getMaxNumPoints( ) const
+{
+	return maxNumPoints;
+}
+
+
 inline returnValue LogRecord::setLogFrequency(	LogFrequency _frequency
 												)
 {
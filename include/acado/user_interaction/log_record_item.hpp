@@ -54,7 +54,12 @@ BEGIN_NAMESPACE_ACADO
  *
  *	All information is internally stored in Matrix format; as information is 
  *	usually not only stored once but at different instants, e.g. at each iteration,
- *	information is stored in a MatrixVariablesGrid. Besides the actual numerical values
+ *	information is stored in a ring buffer of matrices together with their time 
+ *	labels. Each slot of this buffer keeps its storage when being overwritten, so 
+ *	logging a value of unchanged dimension does not allocate memory once the buffer 
+ *	is set up. Optionally, the number of stored values can be bounded; in this case 
+ *	the oldest values are overwritten such that memory stays bounded also for long 
+ *	runs. Values are handed out as MatrixVariablesGrid. Besides the actual numerical values
  *	of the information, also the output format of these values is stored within this 
  *	class. It describes who the information is to be printed into a string by, e.g., 
  *	defining a label, separators or the decimal precision to be shown.
@@ -162,7 +167,7 @@ class LogRecordItem
 		 *
 		 *  \return Matrix-valued variables grid containing all numerical values 
 		 */
-		inline const MatrixVariablesGrid& getAllValues( ) const;
+		MatrixVariablesGrid getAllValues( ) const;
 
 		/** Assigns all numerical values of the item. In case the LogFrequency
 		 *	is set to LOG_AT_EACH_ITERATION, the full matrix-valued variables grid
@@ -188,6 +193,15 @@ class LogRecordItem
 		inline Matrix getValue(	uint idx
 								) const;
 
+		/** Returns time label of given time instant.
+		 *
+		 *	@param[in] idx	Index of time instant.
+		 *
+		 *  \return Time label of the instant 
+		 */
+		inline double getTime(	uint idx
+								) const;
+
 		/** Returns numerical value at first time instant.
 		 *
 		 *  \return Matrix containing the numerical value 
@@ -201,13 +215,16 @@ class LogRecordItem
 		inline Matrix getLastValue( ) const;
 
 		
-		/** Assigns the numerical value at current time instant.
+		/** Assigns the numerical value at current time instant. Values logged
+		 *	at each iteration are rejected unless their time label is strictly
+		 *	larger than the one of the previous value.
 		 *
 		 *	@param[in] _frequency	Log frequency defining which values are to be assigned.
 		 *	@param[in] _value		New value to be assigned.
 		 *	@param[in] _time		Time label of the instant.
 		 *
-		 *  \return SUCCESSFUL_RETURN
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
 		 */
 		returnValue setValue(	LogFrequency _frequency,
 								const Matrix& _value,
@@ -225,8 +242,8 @@ class LogRecordItem
 		 *
 		 *  \return SUCCESSFUL_RETURN 
 		 */
-		inline returnValue getValueString(	char** valueString
-											) const;
+		returnValue getValueString(	char** valueString
+									) const;
 
 		/** Obtains a string containing the numerical value at a given time
 		 *	instant of the item in the pre-defined output format.
@@ -249,7 +266,7 @@ class LogRecordItem
 		 *
 		 *  \return String length
 		 */
-		inline uint determineStringLength( ) const;
+		uint determineStringLength( ) const;
 
 		/** Returns the length of the containing the numerical value at a given time
 		 *	instant of the item in the pre-defined output format.
@@ -325,8 +342,29 @@ class LogRecordItem
 		inline BooleanType isWriteProtected( ) const;
 
 
-		
-		inline uint getNumDoubles( ) const;
+		/** Limits the number of time instants on which numerical values are stored.
+		 *	If more values are logged, the oldest ones are overwritten. Values that 
+		 *	exceed a reduced limit are discarded immediately.
+		 *
+		 *	@param[in]  _maxNumPoints	Maximum number of stored time instants (0 = unbounded).
+		 *
+		 *  \return SUCCESSFUL_RETURN 
+		 */
+		returnValue setMaxNumPoints(	uint _maxNumPoints
+										);
+
+		/** Returns maximum number of time instants on which numerical values are stored.
+		 *
+		 *  \return Maximum number of time instants (0 = unbounded).
+		 */
+		inline uint getMaxNumPoints( ) const;
+
+
+		/** Returns total number of doubles stored within the item.
+		 *
+		 *  \return Number of doubles.
+		 */
+		uint getNumDoubles( ) const;
 
 
 	//
@@ -348,11 +386,72 @@ class LogRecordItem
 									);
 
 
+		/** Returns the slot of the ring buffer that holds the value at a given 
+		 *	time instant.
+		 *
+		 *	@param[in]  idx		Index of time instant.
+		 *
+		 *  \return Slot of the ring buffer 
+		 */
+		inline uint getSlot(	uint idx
+								) const;
+
+		/** Returns the slot of the ring buffer into which a new value is to be 
+		 *	written. The buffer is enlarged geometrically unless it has reached its 
+		 *	maximum size; in that case the slot of the oldest value is returned.
+		 *
+		 *  \return Slot of the ring buffer 
+		 */
+		uint getNewSlot( );
+
+		/** Re-allocates the ring buffer such that the stored values are kept in 
+		 *	chronological order starting at slot zero. If the new size is smaller 
+		 *	than the number of stored values, only the newest values are kept.
+		 *
+		 *	@param[in]  _bufferSize		New number of slots of the ring buffer.
+		 *
+		 *  \return SUCCESSFUL_RETURN 
+		 */
+		returnValue resizeBuffer(	uint _bufferSize
+									);
+
+		/** Deletes all stored values and frees the ring buffer.
+		 *
+		 *  \return SUCCESSFUL_RETURN 
+		 */
+		returnValue clearValues( );
+
+		/** Copies all stored values of another item.
+		 *
+		 *	@param[in] rhs	Item whose values are to be copied.
+		 *
+		 *  \return SUCCESSFUL_RETURN 
+		 */
+		returnValue copyValues(	const LogRecordItem& rhs
+								);
+
+		/** Stacks all stored values row-wise into one matrix.
+		 *
+		 *	@param[out] stackedValues	Matrix containing all stored values.
+		 *
+		 *  \return SUCCESSFUL_RETURN 
+		 */
+		returnValue getStackedValues(	Matrix& stackedValues
+										) const;
+
+
 	//
 	// DATA MEMBERS:
 	//
 	protected:
-		MatrixVariablesGrid values;						/**< The actual numerical values at all time instants. */
+		Matrix** values;								/**< Ring buffer of the actual numerical values (each slot keeps its storage when overwritten). */
+		double* times;									/**< Time labels of the numerical values within the ring buffer. */
+
+		uint bufferSize;								/**< Number of allocated slots of the ring buffer. */
+		uint maxNumPoints;								/**< Maximum number of stored time instants (0 = unbounded). */
+		uint firstSlot;									/**< Slot holding the value at the first stored time instant. */
+		uint nPoints;									/**< Number of stored time instants. */
+		uint nWritten;									/**< Total number of values written so far (used for default time labels). */
 
 		int name;										/**< Internal name defined by a LogName. */
 		LogRecordItemType type;							/**< Internal type of item (LogName enumeration or symbolic expression). */
@@ -40,12 +40,6 @@ BEGIN_NAMESPACE_ACADO
 // To be returned by reference
 const Matrix emptyMatrix_;
 
-inline const MatrixVariablesGrid& LogRecordItem::getAllValues( ) const
-{
-	return values;
-}
-
-
 inline Matrix LogRecordItem::getValue(	uint idx
 										) const
 {
@@ -54,7 +48,17 @@ inline Matrix LogRecordItem::getValue(	uint idx
 		return emptyMatrix_;
 	}
 
-	return values.getMatrix( idx );
+	return *(values[getSlot( idx )]);
+}
+
+
+inline double LogRecordItem::getTime(	uint idx
+										) const
+{
+	if (idx >= getNumPoints( ))
+		return -INFTY;
+
+	return times[getSlot( idx )];
 }
 
 
@@ -80,18 +84,6 @@ inline Matrix LogRecordItem::getLastValue( ) const
 }
 
 
-inline returnValue LogRecordItem::getValueString( char** valueString ) const
-{
-	Matrix tmp;
-
-	for( uint i=0; i<getNumPoints( ); ++i )
-		tmp.appendRows( values.getMatrix(i) );
-
-	return tmp.printToString( valueString, label,startString,endString,
-							  width,precision,colSeparator,rowSeparator );
-}
-
-
 inline returnValue LogRecordItem::getValueString(	char** valueString,
 													uint idx
 													) const
@@ -99,31 +91,19 @@ inline returnValue LogRecordItem::getValueString(	char** valueString,
 	if (idx >= getNumPoints( ))
 		return SUCCESSFUL_RETURN;
 
-	return values.getMatrix( idx ).printToString( valueString, label,startString,endString,
+	return values[getSlot( idx )]->printToString( valueString, label,startString,endString,
 												  width,precision,colSeparator,rowSeparator );
 }
 
 
 
-inline uint LogRecordItem::determineStringLength( ) const
-{
-	Matrix tmp;
-
-	for( uint i=0; i<getNumPoints( ); ++i )
-		tmp.appendRows( values.getMatrix(i) );
-
-	return tmp.determineStringLength( label,startString,endString,
-									  width,precision,colSeparator,rowSeparator );
-}
-
-
 inline uint LogRecordItem::determineStringLength(	uint idx
 													) const
 {
 	if (idx >= getNumPoints( ))
 		return SUCCESSFUL_RETURN;
 
-	return values.getMatrix( idx ).determineStringLength( label,startString,endString,
+	return values[getSlot( idx )]->determineStringLength( label,startString,endString,
 														  width,precision,colSeparator,rowSeparator );
 }
 
@@ -155,7 +135,7 @@ inline LogRecordItem* LogRecordItem::getNext( ) const
 
 inline uint LogRecordItem::getNumPoints( ) const
 {
-	return values.getNumPoints( );
+	return nPoints;
 }
 
 
@@ -189,9 +169,26 @@ inline BooleanType LogRecordItem::isWriteProtected( ) const
 }
 
 
-inline uint LogRecordItem::getNumDoubles( ) const
+inline uint LogRecordItem::getMaxNumPoints( ) const
+{
+	return maxNumPoints;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+inline uint LogRecordItem::getSlot(	uint idx
+									) const
 {
-	return values.getDim();
+	uint slot = firstSlot + idx;
+
+	if ( slot >= bufferSize )
+		slot -= bufferSize;
+
+	return slot;
 }
 
 
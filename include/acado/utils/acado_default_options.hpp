@@ -64,9 +64,11 @@ const double 	defaultInfeasibleQPrelaxation = 1.0e-8;								/**< Default value
 const int 		defaultInfeasibleQPhandling = IQH_RELAX_L2;							/**< Default value for specifying the strategy to handle infeasible sub-QPs (possible values: IQH_STOP, IQH_IGNORE, IQH_RELAX_L2). */
 const int 		defaultUseRealtimeIterations = BT_FALSE;							/**< Default value for specifying whether real-time iterations shall be used (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseRealtimeShifts = BT_FALSE;								/**< Default value for specifying whether shifted real-time iterations shall be used (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseShiftedWarmStart = BT_FALSE;								/**< Default value for specifying whether a shift also shifts the multipliers, the sensitivities and the QP working set such that only the last interval is linearized again (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseImmediateFeedback = BT_FALSE;								/**< Default value for specifying whether immediate feedback shall be used (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultTerminateAtConvergence = BT_TRUE;							/**< Default value for specifying whether to stop iterations at convergence (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseReferencePrediction = BT_TRUE;							/**< Default value for specifying whether the prediction of the reference trajectory shall be known the control law (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseAsynchronousPreparation = BT_FALSE;						/**< Default value for specifying whether the preparation step of a controller is postponed such that it overlaps with the process simulation (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPrintlevel = MEDIUM;											/**< Default value for the printlevel determining the quatity of output given by the optimization algorithm (possible values: HIGH, MEDIUM, LOW, NONE). */
 const int 		defaultPrintCopyright = BT_TRUE;									/**< Default value for specifying whether the ACADO copyright notice is printed or not (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultprintSCPmethodProfile = BT_FALSE;							/**< Default value for printing the profile of the SCP method (possible values: BT_FALSE, BT_TRUE). */
@@ -76,6 +78,7 @@ const int 		defaultFreezeIntegrator = BT_TRUE;							/**< Default value for spec
 const int 		defaultIntegratorType = INT_RK45;							/**< Default value for integrator type (possible values: INT_RK12, INT_RK23, INT_RK45, INT_RK78, INT_BDF). */
 const int 		defaultFeasibilityCheck = BT_FALSE;							/**< Default value for specifying whether infeasibilty shall be checked (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPlotResoltion = LOW;									/**< Default value for specifying the plot resolution (possible values: HIGH, MEDIUM, LOW). */
+const int 		defaultParallelIntegration = BT_FALSE;						/**< Default value for specifying whether the shooting intervals are integrated in parallel (possible values: BT_TRUE, BT_FALSE). */
 
 // Integrator
 const int 		defaultMaxNumSteps = 1000;									/**< Default value for maximum number of integrator steps (possible values: any positive integer). */
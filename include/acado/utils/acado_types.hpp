@@ -372,6 +372,7 @@ enum OptionsName
 	CG_USE_C99,									/**< Code generation is allowed (or not) to export C-code that conforms C99 standard. */
 	CG_COMPUTE_COVARIANCE_MATRIX,				/**< Enable computation of the variance-covariance matrix for the last estimate. */
 	CG_HARDCODE_CONSTRAINT_VALUES,				/**< Enable/disable hard-coding of the constraint values. */
+	CG_OPTIMIZE_EXPRESSIONS,					/**< Enable/disable common subexpression elimination, constant folding and removal of unused intermediate results in exported model functions. */
 	IMPLICIT_INTEGRATOR_MODE,					/**< This determines the mode of the implicit integrator (see enum ImplicitIntegratorMode). */
 	IMPLICIT_INTEGRATOR_NUM_ITS,				/**< This is the performed number of Newton iterations in the implicit integrator. */
 	IMPLICIT_INTEGRATOR_NUM_ITS_INIT,			/**< This is the performed number of Newton iterations in the implicit integrator for the initialization of the first step. */
@@ -450,7 +451,10 @@ enum OptionsName
 	GENERATE_SIMULINK_INTERFACE,
 	GENERATE_MATLAB_INTERFACE,
 	OPERATING_SYSTEM,
-	USE_SINGLE_PRECISION
+	USE_SINGLE_PRECISION,
+	PARALLEL_INTEGRATION,
+	USE_ASYNCHRONOUS_PREPARATION,
+	USE_SHIFTED_WARM_START
 };
 
 
@@ -518,7 +522,11 @@ enum LogName
     LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS,
     LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION,
 	// 50
-    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION
+    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION,
+    LOG_TIME_INTERVAL_EVALUATIONS,   /**< Log integration time of each shooting interval */
+    LOG_TIME_INTERVAL_SENSITIVITIES, /**< Log sensitivity generation time of each shooting interval */
+    LOG_TIME_ITERATE_UPDATE,         /**< Log time for storing the previous iterate of an SQP iteration */
+    LOG_TIME_CONTROLLER_FEEDBACK     /**< Log runtime of the feedback step of a controller, i.e. its feedback latency */
 };
 
 
@@ -289,6 +289,17 @@ class Grid
 		returnValue addTime(	double _time
 								);
 
+		/** Makes sure that the grid can hold the given number of grid points
+		 *	without reallocating its storage. Appending grid points via addTime
+		 *	grows the storage geometrically, so reserving is only an optimization.
+		 *
+		 *	@param[in] _capacity	Number of grid points to reserve storage for.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue reserve(	uint _capacity
+								);
+
 
 		/** Constructs the set union in time of current and given grid. A merge
 		 *	method defines the way duplicate entries are handled. Moreover,
@@ -442,7 +453,7 @@ class Grid
 						) const;
 
 		/** Returns index of first grid point at given time, starting at
-		 *	startIdx.
+		 *	startIdx. The (ordered) grid is searched by bisection.
 		 *
 		 *	@param[in] _time		Time to be found.
 		 *	@param[in] startIdx		Start index for searching for time point.
@@ -603,6 +614,15 @@ class Grid
 		 */
 		int findNextIndex( ) const;
 
+		/** Sets the number of grid points. The storage is only reallocated
+		 *	if it can not hold the given number of grid points; the times
+		 *	are not initialized.
+		 *
+		 *	@param[in] _nPoints		Number of grid points.
+		 */
+		void allocateTimes(	uint _nPoints
+							);
+
 
     //
     // DATA MEMBERS:
@@ -611,6 +631,7 @@ class Grid
 
 		uint nPoints;					/**< Number of grid points. */
 		double* times;					/**< Time values at grid points. */
+		uint capacity;					/**< Number of grid points the storage can hold. */
 };
 
 
@@ -192,7 +192,7 @@ inline BooleanType Grid::isEquidistant( ) const
 
 inline double Grid::getIntervalLength( ) const{
 
-    if ( times == 0 )
+    if ( nPoints == 0 )
 		return -1.0;
 
     return times[nPoints-1] - times[0];
@@ -202,7 +202,7 @@ inline double Grid::getIntervalLength( ) const{
 inline double Grid::getIntervalLength(	uint pointIdx
 										) const
 {
-	if ( times == 0 )
+	if ( nPoints == 0 )
 		return -1.0;
 
 	if ( pointIdx >= getNumPoints( ) )
@@ -241,7 +241,7 @@ inline BooleanType Grid::isLast(	uint pointIdx
 inline BooleanType Grid::isInInterval(	double _time
 										) const
 {
-    if ( times == 0 )
+    if ( nPoints == 0 )
 		return BT_FALSE;
 
     if ( acadoIsSmaller( getTime( 0             ) , _time ) == BT_TRUE &&
@@ -252,7 +252,7 @@ inline BooleanType Grid::isInInterval(	double _time
 
 inline BooleanType Grid::isInInterval( uint pointIdx, double _time ) const{
 
-    if ( times == 0 )
+    if ( nPoints == 0 )
 		return BT_FALSE;
 
 	if ( pointIdx >= getNumPoints( ) )
@@ -274,7 +274,7 @@ inline BooleanType Grid::isInInterval( uint pointIdx, double _time ) const{
 
 inline BooleanType Grid::isInUpperHalfOpenInterval( uint pointIdx, double _time ) const
 {
-	if ( times == 0 )
+	if ( nPoints == 0 )
 		return BT_FALSE;
 
 	if ( pointIdx >= getNumPoints( ) )
@@ -296,7 +296,7 @@ inline BooleanType Grid::isInUpperHalfOpenInterval( uint pointIdx, double _time
 
 inline BooleanType Grid::isInLowerHalfOpenInterval( uint pointIdx, double _time ) const{
 
-	if ( times == 0 )
+	if ( nPoints == 0 )
 		return BT_FALSE;
 
 	if ( pointIdx >= getNumPoints( ) )
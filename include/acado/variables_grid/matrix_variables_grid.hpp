@@ -472,6 +472,16 @@ class MatrixVariablesGrid : public Grid
 								double newTime = -INFTY
 								);
 
+		/** Makes sure that the grid can hold the given number of grid points
+		 *	without reallocating its time and pointer arrays.
+		 *
+		 *	@param[in] _capacity	Number of grid points to reserve storage for.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue reserve(	uint _capacity
+								);
+
 
 		/** Assigns new matrix to grid point with given index.
 		 *
@@ -1349,6 +1359,14 @@ class MatrixVariablesGrid : public Grid
 		 */
 		returnValue clearValues( );
 
+		/** Allocates the (empty) array of MatrixVariables for all grid points.
+		 *	Note that this function assumes that the grid has already been setup
+		 *	and that the array has been cleared.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue allocateValues( );
+
 
 		/** Initializes array of MatrixVariables with given information.
 		 *	Note that this function assumes that the grid has already been setup.
@@ -1395,6 +1413,7 @@ class MatrixVariablesGrid : public Grid
     protected:
 
 		MatrixVariable** values;				/**< Matrix-valued optimization variable at all grid points. */
+		uint valuesCapacity;					/**< Number of grid points the array of MatrixVariables can hold. */
 };
 
 
@@ -43,6 +43,7 @@
 #include <acado/control_law/exported_rti_scheme.hpp>
 #include <acado/reference_trajectory/reference_trajectory.hpp>
 #include <acado/simulation_environment/simulation_environment.hpp>
+#include <acado/simulation_environment/simulation_ensemble.hpp>
 #include <acado/process/process.hpp>
 #include <acado/noise/noise.hpp>
 #include <acado/transfer_device/actuator.hpp>
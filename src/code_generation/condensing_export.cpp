@@ -838,7 +838,12 @@ returnValue CondensingExport::setupEvaluation( )
 	u.setup( "u",        getN(), getNU(),     REAL,ACADO_VARIABLES );
 	p.setup( "p",        1, getNP(),          REAL,ACADO_VARIABLES );
 
-	state.setup   ( "state",    1,getNX()*(getNX()+getNU()+1) + getNU() +getNP(), REAL,ACADO_WORKSPACE );
+	// with multiple shooting, each interval gets its own augmented state such
+	// that all integrations can be performed before condensing
+	if ( performsSingleShooting() == BT_TRUE )
+		state.setup( "state", 1,getNX()*(getNX()+getNU()+1) + getNU() +getNP(), REAL,ACADO_WORKSPACE );
+	else
+		state.setup( "state", getN(),getNX()*(getNX()+getNU()+1) + getNU() +getNP(), REAL,ACADO_WORKSPACE );
 
 	if ( isInitialStateFixed( ) == BT_FALSE )
 	{
@@ -902,54 +907,75 @@ returnValue CondensingExport::setupEvaluation( )
 	setupQP.addStatement( reset == 1 );
 
 	ExportIndex run( String("run1") );
-	ExportForLoop loop( run, 0,getN() );
-	
 	setupQP.addIndex( run );
 
-	if ( performsSingleShooting() == BT_FALSE ) {
-		loop.addStatement( reset == 1 );
-		loop.addStatement( state.getCols( 0,getNX() ) == x.getRow( run ) );
-	}
-	
 	// no free parameters implemented yet!
 	uint uIdx = getNX() * ( 1+getNX() );
 	uint pIdx = getNX() * ( 1+getNX()+getNU() );
 	uIdx = pIdx;
 	pIdx = pIdx + getNU();
-	loop.addStatement( state.getCols( uIdx,pIdx ) == u.getRow( run ) );
-	loop.addStatement( state.getCols( pIdx,pIdx+getNP() ) == p );
-	loop.addLinebreak( );
-	
-	if ( integrator->equidistantControlGrid() )
-	{
-		loop.addFunctionCall( "integrate", state, reset.makeArgument() );
-	}
-	else
-	{
-		loop.addFunctionCall( "integrate", state, reset.makeArgument(), run.makeArgument() );
-	}
-	if( performsSingleShooting() ) loop.addStatement( reset == 0 );
-	
+
 	if ( performsSingleShooting() == BT_TRUE )
 	{
+		// the integration of each interval starts from the end of the previous one
+		ExportForLoop loop( run, 0,getN() );
+
+		loop.addStatement( state.getCols( uIdx,pIdx ) == u.getRow( run ) );
+		loop.addStatement( state.getCols( pIdx,pIdx+getNP() ) == p );
+		loop.addLinebreak( );
+
+		if ( integrator->equidistantControlGrid() )
+			loop.addFunctionCall( "integrate", state, reset.makeArgument() );
+		else
+			loop.addFunctionCall( "integrate", state, reset.makeArgument(), run.makeArgument() );
+
+		loop.addStatement( reset == 0 );
 		loop.addStatement( x.getRow( run+1 ) == state.getCols( 0,getNX() ) );
+		loop.addLinebreak( );
+
+		loop.addFunctionCall( condense1, run.makeArgument(),state );
+
+		setupQP.addStatement( loop );
+		setupQP.addLinebreak( );
 	}
 	else
 	{
 		//
-		// Multiple shooting
+		// Multiple shooting: the integrations of all intervals are independent
+		// and are performed first (in parallel, if desired); the condensing
+		// recursion over the stored sensitivities follows.
 		// TODO: Check the sign here
 		//
-		loop.addStatement( residuum.getRow( run ) == state.getCols( 0,getNX() ) - x.getRow( run+1 ) );
+		ExportForLoop integrationLoop( run, 0,getN() );
+
+		integrationLoop.addStatement( state.getSubMatrix( run,run+1, 0,getNX() ) == x.getRow( run ) );
+		integrationLoop.addStatement( state.getSubMatrix( run,run+1, uIdx,pIdx ) == u.getRow( run ) );
+		integrationLoop.addStatement( state.getSubMatrix( run,run+1, pIdx,pIdx+getNP() ) == p );
+		integrationLoop.addLinebreak( );
+
+		if ( integrator->equidistantControlGrid() )
+			integrationLoop.addFunctionCall( "integrate", state.getAddress( run,0 ), reset.makeArgument() );
+		else
+			integrationLoop.addFunctionCall( "integrate", state.getAddress( run,0 ), reset.makeArgument(), run.makeArgument() );
+
+		integrationLoop.addStatement( residuum.getRow( run ) == state.getSubMatrix( run,run+1, 0,getNX() ) - x.getRow( run+1 ) );
+
+		int useOMP;
+		get( CG_USE_OPENMP,useOMP );
+
+		if ( useOMP )
+			setupQP.addStatement( "#pragma omp parallel for\n" );
+
+		setupQP.addStatement( integrationLoop );
+		setupQP.addLinebreak( );
+
+		ExportForLoop condensingLoop( run, 0,getN() );
+		condensingLoop.addFunctionCall( condense1, run.makeArgument(),state.getAddress( run,0 ) );
+
+		setupQP.addStatement( condensingLoop );
+		setupQP.addLinebreak( );
 	}
-	
-	loop.addLinebreak( );
-	
-	loop.addFunctionCall( condense1, run.makeArgument(),state );
 
-    setupQP.addStatement( loop );
-	setupQP.addLinebreak( );
-		
 	setupQP.addFunctionCall( condense2 );
 
 	////////////////////////////////////////////////////////////////////////////
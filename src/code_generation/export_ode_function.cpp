@@ -209,6 +209,30 @@ unsigned ExportODEfunction::getFunctionDim( void )
 	return f->getDim();
 }
 
+
+returnValue ExportODEfunction::setExportOptimization(	BooleanType _optimize
+														)
+{
+	if ( f == 0 )
+		return SUCCESSFUL_RETURN;
+
+	return f->setExportOptimization( _optimize );
+}
+
+
+returnValue ExportODEfunction::getNumExportOperations(	int& _nBefore,
+														int& _nAfter
+														) const
+{
+	_nBefore = 0;
+	_nAfter  = 0;
+
+	if ( ( f == 0 ) || ( f->getDim() == 0 ) )
+		return SUCCESSFUL_RETURN;
+
+	return f->getNumExportOperations( _nBefore,_nAfter );
+}
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -106,7 +106,7 @@ returnValue GaussNewtonExport::setup( )
 	deltaX0.setup( "deltaX0", getNX(),1, REAL,ACADO_WORKSPACE );
 	
 	H.setup(   "H",   getNumQPvars(),getNumQPvars(),       REAL,ACADO_PARAMS );
-	A.setup(   "A",   getNumStateBounds( ),getNumQPvars(), REAL,ACADO_PARAMS );
+	A.setup(   "A",   getNumConstraints( ),getNumQPvars(), REAL,ACADO_PARAMS );
 	H00.setup( "H00", getNX(),getNX(),               REAL,ACADO_WORKSPACE );
 	H01.setup( "H01", getNX(),getN()*getNU(),        REAL,ACADO_WORKSPACE );
 	H11.setup( "H11", getN()*getNU(),getN()*getNU(), REAL,ACADO_WORKSPACE );
@@ -124,16 +124,18 @@ returnValue GaussNewtonExport::setup( )
 	ExportVariable lbValues( "lb", lbValuesMatrix );
 	ExportVariable ubValues( "ub", ubValuesMatrix );
 	
-	lbA.setup( "lbA", getNumStateBounds(),1, REAL,ACADO_PARAMS );
-	ubA.setup( "ubA", getNumStateBounds(),1, REAL,ACADO_PARAMS );
+	lbA.setup( "lbA", getNumConstraints(),1, REAL,ACADO_PARAMS );
+	ubA.setup( "ubA", getNumConstraints(),1, REAL,ACADO_PARAMS );
 	lbAValues.setup( "lbA", getNumStateBounds(),1, REAL,ACADO_WORKSPACE );
 	ubAValues.setup( "ubA", getNumStateBounds(),1, REAL,ACADO_WORKSPACE );
 	
 	xVars.setup( "x", getNumQPvars(),1, REAL,ACADO_VARS );
-	yVars.setup( "y", getNumQPvars()+getNumStateBounds(),1, REAL,ACADO_VARS );
+	yVars.setup( "y", getNumQPvars()+getNumConstraints(),1, REAL,ACADO_VARS );
 
 	ExportVariable tmp("tmp",1, 1, REAL, ACADO_LOCAL, BT_TRUE);
 
+	setupPathConstraints( );
+
 	////////////////////////////////////////////////////////////////////////////
 	//
 	// Preparation step
@@ -146,6 +148,9 @@ returnValue GaussNewtonExport::setup( )
 
 	preparationStep.addFunctionCall( "setupQP" );
 
+	if ( getNumPathConstraints( ) > 0 )
+		preparationStep.addFunctionCall( condensePathConstraints );
+
 
 	////////////////////////////////////////////////////////////////////////////
 	//
@@ -240,6 +245,35 @@ returnValue GaussNewtonExport::setup( )
 		initialValueEmbedding.addLinebreak( );
 	}
 
+	if( getNumPathConstraints( ) > 0 )
+	{
+		// shift path constraint bounds by their linearisation
+		Matrix lbPathMatrix( getNumPathConstraints(),1 );
+		Matrix ubPathMatrix( getNumPathConstraints(),1 );
+
+		uint nc = lbPathConValues.getNumCols( );
+		for( run1 = 0; run1 < getNumPathConstraints()/nc; ++run1 )
+			for( run2 = 0; run2 < nc; ++run2 )
+			{
+				lbPathMatrix( run1*nc+run2,0 ) = lbPathConValues( run1,run2 );
+				ubPathMatrix( run1*nc+run2,0 ) = ubPathConValues( run1,run2 );
+			}
+
+		ExportVariable lbPathValues( "lbPath", lbPathMatrix );
+		ExportVariable ubPathValues( "ubPath", ubPathMatrix );
+
+		initialValueEmbedding.addStatement( lbA.getRows( getNumStateBounds(),getNumConstraints() ) == lbPathValues - conRes );
+		initialValueEmbedding.addStatement( ubA.getRows( getNumStateBounds(),getNumConstraints() ) == ubPathValues - conRes );
+
+		if ( condenser->performsFullCondensing() == BT_TRUE )
+		{
+			initialValueEmbedding.addStatement( lbA.getRows( getNumStateBounds(),getNumConstraints() ) -= conHxC*deltaX0 );
+			initialValueEmbedding.addStatement( ubA.getRows( getNumStateBounds(),getNumConstraints() ) -= conHxC*deltaX0 );
+		}
+
+		initialValueEmbedding.addLinebreak( );
+	}
+
 	if ( condenser->performsFullCondensing() == BT_TRUE )
 	{
 		initialValueEmbedding.addStatement( H == H11 );
@@ -415,6 +449,69 @@ returnValue GaussNewtonExport::setControlBounds(	const VariablesGrid& _uBounds
 
 
 
+returnValue GaussNewtonExport::setPathConstraints(	const Function& _h,
+													const Matrix& _lb,
+													const Matrix& _ub
+													)
+{
+	lbPathConValues.init( 0,0 );
+	ubPathConValues.init( 0,0 );
+	pathConstraints = ExportODEfunction( );
+
+	if ( _h.getDim() == 0 )
+		return SUCCESSFUL_RETURN;
+
+	if ( ( _h.getNXA() > 0 ) || ( _h.getNDX() > 0 ) || ( _h.getNUI() > 0 ) ||
+		 ( _h.getNP() > 0 ) || ( _h.getNPI() > 0 ) || ( _h.getNW() > 0 ) ||
+		 ( _h.getNX() > (int)getNX() ) || ( _h.getNU() > (int)getNU() ) )
+		return ACADOERROR( RET_ONLY_STATES_AND_CONTROLS_FOR_CODE_EXPORT );
+
+	if ( ( _lb.getNumRows() < getN() ) || ( _ub.getNumRows() < getN() ) ||
+		 ( (int)_lb.getNumCols() != _h.getDim() ) || ( (int)_ub.getNumCols() != _h.getDim() ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	Expression h;
+	_h.getExpression( h );
+
+	Parameter         dummy0;
+	Control           dummy1;
+	DifferentialState dummy2;
+	dummy0.clearStaticCounters();
+	dummy1.clearStaticCounters();
+	dummy2.clearStaticCounters();
+
+	DifferentialState xS( getNX() );
+	Control           uS( getNU() );
+
+	Expression Hx = forwardDerivative( h,xS );
+	Expression Hu = forwardDerivative( h,uS );
+
+	// one row per constraint: value, Jacobian w.r.t. states and w.r.t. controls
+	Function hFcn;
+	for( uint run1 = 0; run1 < (uint)_h.getDim(); ++run1 )
+	{
+		hFcn << h.getRow( run1 );
+		hFcn << Hx.getRow( run1 );
+		hFcn << Hu.getRow( run1 );
+	}
+
+	returnValue returnvalue = pathConstraints.init( hFcn,"evaluatePathConstraints",getNX(),0,getNU() );
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return ACADOERROR( returnvalue );
+
+	ExportVariable auxVar = pathConstraints.getGlobalExportVariable( );
+	auxVar.setName( "conAuxVar" );
+	auxVar.setDataStruct( ACADO_WORKSPACE );
+	pathConstraints.setGlobalExportVariable( auxVar );
+
+	lbPathConValues = _lb;
+	ubPathConValues = _ub;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue GaussNewtonExport::getDataDeclarations(	ExportStatementBlock& declarations,
 													ExportStruct dataStruct
 													) const
@@ -432,6 +529,21 @@ returnValue GaussNewtonExport::getDataDeclarations(	ExportStatementBlock& declar
 	declarations.addDeclaration( xVars,dataStruct );
 	declarations.addDeclaration( yVars,dataStruct );
 
+	// ACADO_WORKSPACE
+	if ( getNumPathConstraints( ) > 0 )
+	{
+		ExportVariable auxVar = pathConstraints.getGlobalExportVariable( );
+		if ( auxVar.getDim() > 0 )
+			declarations.addDeclaration( auxVar,dataStruct );
+
+		declarations.addDeclaration( conValueIn,dataStruct );
+		declarations.addDeclaration( conValueOut,dataStruct );
+		declarations.addDeclaration( conRes,dataStruct );
+
+		if ( condenser->performsFullCondensing() == BT_TRUE )
+			declarations.addDeclaration( conHxC,dataStruct );
+	}
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -446,6 +558,12 @@ returnValue GaussNewtonExport::getFunctionDeclarations(	ExportStatementBlock& de
 	declarations.addDeclaration( shiftStates );
 	declarations.addDeclaration( getKKT );
 
+	if ( getNumPathConstraints( ) > 0 )
+	{
+		declarations.addDeclaration( pathConstraints );
+		declarations.addDeclaration( condensePathConstraints );
+	}
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -459,6 +577,12 @@ returnValue GaussNewtonExport::getCode(	ExportStatementBlock& code
 // 	if ( (PrintLevel)printLevel >= HIGH ) 
 // 		acadoPrintf( "--> Exporting %s... ",fileName.getName() );
 
+	if ( getNumPathConstraints( ) > 0 )
+	{
+		code.addFunction( pathConstraints );
+		code.addFunction( condensePathConstraints );
+	}
+
 	code.addFunction( preparationStep );
 	code.addFunction( initialValueEmbedding );
 	code.addFunction( feedbackStep );
@@ -493,16 +617,116 @@ uint GaussNewtonExport::getNumStateBounds( ) const
 }
 
 
+uint GaussNewtonExport::getNumPathConstraints( ) const
+{
+	// nodes 0,...,N if bounds are given on all grid points, otherwise 0,...,N-1
+	uint nNodes = acadoMin( (int)lbPathConValues.getNumRows(),(int)getN()+1 );
+
+	return nNodes * lbPathConValues.getNumCols();
+}
+
+
+uint GaussNewtonExport::getNumConstraints( ) const
+{
+	return getNumStateBounds() + getNumPathConstraints();
+}
+
+
 
 // PROTECTED:
 
 
+returnValue GaussNewtonExport::setupPathConstraints( )
+{
+	uint nc = lbPathConValues.getNumCols( );
+
+	if ( nc == 0 )
+		return SUCCESSFUL_RETURN;
+
+	uint run1;
+	uint nNodes = getNumPathConstraints( ) / nc;
+
+	conValueIn.setup ( "conValueIn",  NX+NU,1,        REAL,ACADO_WORKSPACE );
+	conValueOut.setup( "conValueOut", nc,1+NX+NU,     REAL,ACADO_WORKSPACE );
+	conRes.setup     ( "conRes",      nNodes*nc,1,    REAL,ACADO_WORKSPACE );
+	conHxC.setup     ( "conHxC",      nNodes*nc,NX,   REAL,ACADO_WORKSPACE );
+
+	ExportVariable conH  = conValueOut.getCol( 0 );
+	ExportVariable conHx = conValueOut.getSubMatrix( 0,nc, 1,1+NX );
+	ExportVariable conHu = conValueOut.getSubMatrix( 0,nc, 1+NX,1+NX+NU );
+
+	// columns of the control inputs within the QP variables
+	uint uOffset = 0;
+	if ( condenser->performsFullCondensing() == BT_FALSE )
+		uOffset = NX;
+
+	//
+	// The constraint at node k is linearised at the current iterate and the
+	// state deviation is replaced by its condensed representation
+	//     dx_k = C_k*deltaX0 + E_k*deltaU - d_k,
+	// i.e. the rows of C, E and d belonging to node k (node 0 is the initial
+	// state itself). The part depending on deltaX0 is stored in conHxC (full
+	// condensing) or in the first columns of A (partial condensing).
+	// At the terminal node N the last control u_{N-1} is used, as in the
+	// discretization of path constraints in the SCP method.
+	//
+	condensePathConstraints.setup( "condensePathConstraints" );
+
+	for( run1 = 0; run1 < nNodes; ++run1 )
+	{
+		uint row  = getNumStateBounds() + run1*nc;
+		uint uIdx = acadoMin( (int)run1,(int)getN()-1 );
+
+		condensePathConstraints.addStatement( conValueIn.getRows( 0,NX ) == x.getRows( run1*NX,(run1+1)*NX ) );
+		condensePathConstraints.addStatement( conValueIn.getRows( NX,NX+NU ) == u.getRows( uIdx*NU,(uIdx+1)*NU ) );
+		condensePathConstraints.addFunctionCall( "evaluatePathConstraints",conValueIn,conValueOut );
+
+		if ( run1 == 0 )
+		{
+			condensePathConstraints.addStatement( conRes.getRows( 0,nc ) == conH );
+
+			if ( condenser->performsFullCondensing() == BT_TRUE )
+				condensePathConstraints.addStatement( conHxC.getRows( 0,nc ) == conHx );
+			else
+				condensePathConstraints.addStatement( A.getSubMatrix( row,row+nc, 0,NX ) == conHx );
+		}
+		else
+		{
+			if ( condenser->performsSingleShooting() == BT_TRUE )
+				condensePathConstraints.addStatement( conRes.getRows( run1*nc,(run1+1)*nc ) == conH );
+			else
+				condensePathConstraints.addStatement( conRes.getRows( run1*nc,(run1+1)*nc ) == conH - conHx*d.getRows( (run1-1)*NX,run1*NX ) );
+
+			if ( condenser->performsFullCondensing() == BT_TRUE )
+				condensePathConstraints.addStatement( conHxC.getRows( run1*nc,(run1+1)*nc ) == conHx*C.getRows( (run1-1)*NX,run1*NX ) );
+			else
+				condensePathConstraints.addStatement( A.getSubMatrix( row,row+nc, 0,NX ) == conHx*C.getRows( (run1-1)*NX,run1*NX ) );
+
+			condensePathConstraints.addStatement( A.getSubMatrix( row,row+nc, uOffset,uOffset+run1*NU ) ==
+												  conHx*E.getSubMatrix( (run1-1)*NX,run1*NX, 0,run1*NU ) );
+		}
+
+		if ( run1 < getN() )
+			condensePathConstraints.addStatement( A.getSubMatrix( row,row+nc, uOffset+run1*NU,uOffset+(run1+1)*NU ) == conHu );
+		else
+			condensePathConstraints.addStatement( A.getSubMatrix( row,row+nc, uOffset+uIdx*NU,uOffset+(uIdx+1)*NU ) += conHu );
+		condensePathConstraints.addLinebreak( );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue GaussNewtonExport::copy(	const GaussNewtonExport& arg
 										)
 {
 	condenser = arg.condenser;
 	uBounds   = arg.uBounds;
 
+	pathConstraints = arg.pathConstraints;
+	lbPathConValues = arg.lbPathConValues;
+	ubPathConValues = arg.ubPathConValues;
+
 	// ExportVariables
 	x = arg.x;
 	u = arg.u;
@@ -519,6 +743,11 @@ returnValue GaussNewtonExport::copy(	const GaussNewtonExport& arg
 	lbAValues = arg.lbAValues;
 	ubAValues = arg.ubAValues;
 
+	conValueIn  = arg.conValueIn;
+	conValueOut = arg.conValueOut;
+	conRes      = arg.conRes;
+	conHxC      = arg.conHxC;
+
 	H   = arg.H;
 	A   = arg.A;
 	g   = arg.g;
@@ -531,12 +760,13 @@ returnValue GaussNewtonExport::copy(	const GaussNewtonExport& arg
 	yVars = arg.yVars;
 	
 	// ExportFunctions
-	preparationStep       = arg.preparationStep;
-	feedbackStep          = arg.feedbackStep;
-	initialValueEmbedding = arg.initialValueEmbedding;
-	shiftControls         = arg.shiftControls;
-	shiftStates           = arg.shiftStates;
-	getKKT                = arg.getKKT;
+	preparationStep         = arg.preparationStep;
+	feedbackStep            = arg.feedbackStep;
+	initialValueEmbedding   = arg.initialValueEmbedding;
+	shiftControls           = arg.shiftControls;
+	shiftStates             = arg.shiftStates;
+	getKKT                  = arg.getKKT;
+	condensePathConstraints = arg.condensePathConstraints;
 
 	return SUCCESSFUL_RETURN;
 }
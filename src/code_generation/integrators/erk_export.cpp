@@ -220,14 +220,31 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 	f << rhs_;
 /*	if ( f.getDim() != f.getNX() )
 		return ACADOERROR( RET_ILLFORMED_ODE );*/
-	
+
+	// sensitivities which are structurally zero are replaced by zeros,
+	// such that only structurally nonzero products are exported
+	Expression Jx = forwardDerivative( rhs_, x );
+	Expression Ju = forwardDerivative( rhs_, u );
+
+	IntermediateState GxS = zeros( NX,NX );
+	IntermediateState GuS = zeros( NX,NU );
+
+	uint numProducts = setupSensitivityPattern( Jx,Ju,Gx,Gu,GxS,GuS );
+
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= MEDIUM )
+		acadoPrintf( "--> Variational equations: %d of %d products are structurally nonzero (%d flops saved).\n",
+					 numProducts, NX*NX*(NX+NU), 2*(NX*NX*(NX+NU)-numProducts) );
+
 	// add VDE for differential states
-	f << forwardDerivative( rhs_, x ) * Gx;
+	f << Jx * GxS;
 /*	if ( f.getDim() != f.getNX() )
 		return ACADOERROR( RET_ILLFORMED_ODE );*/
 	
 	// add VDE for control inputs
-	f << forwardDerivative( rhs_, x ) * Gu + forwardDerivative( rhs_, u );
+	f << Jx * GuS + Ju;
 // 	if ( f.getDim() != f.getNX() )
 // 		return ACADOERROR( RET_ILLFORMED_ODE );
 
@@ -247,6 +264,97 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 }
 
 
+uint ExplicitRungeKuttaExport::setupSensitivityPattern(	const Expression& Jx,
+														const Expression& Ju,
+														const Expression& Gx,
+														const Expression& Gu,
+														IntermediateState& GxS,
+														IntermediateState& GuS
+														) const
+{
+	uint run1, run2, run3;
+	uint numProducts = 0;
+
+	// (element access to intermediate states does not modify them)
+	IntermediateState JxS = Jx;
+	IntermediateState JuS = Ju;
+
+	BooleanType *Px = (BooleanType*) calloc( NX*NX,sizeof(BooleanType) );
+	BooleanType *Sx = (BooleanType*) calloc( NX*NX,sizeof(BooleanType) );
+	BooleanType *Su = (BooleanType*) calloc( NX*NU+1,sizeof(BooleanType) );
+
+	// initial pattern: Gx(0) = I, Gu is driven by the Jacobian w.r.t. u
+	for( run1 = 0; run1 < NX; run1++ ){
+		for( run2 = 0; run2 < NX; run2++ ){
+			Px[run1*NX+run2] = ( JxS(run1,run2).isOneOrZero() != NE_ZERO ) ? BT_TRUE : BT_FALSE;
+			Sx[run1*NX+run2] = ( run1 == run2 ) ? BT_TRUE : BT_FALSE;
+		}
+		for( run2 = 0; run2 < NU; run2++ )
+			Su[run1*NU+run2] = ( JuS(run1,run2).isOneOrZero() != NE_ZERO ) ? BT_TRUE : BT_FALSE;
+	}
+
+	// close the patterns under d/dt G = Jx*G (+ Ju)
+	BooleanType changed = BT_TRUE;
+
+	while( changed == BT_TRUE ){
+
+		changed = BT_FALSE;
+
+		for( run1 = 0; run1 < NX; run1++ ){
+			for( run3 = 0; run3 < NX; run3++ ){
+
+				if ( Px[run1*NX+run3] == BT_FALSE )
+					continue;
+
+				for( run2 = 0; run2 < NX; run2++ ){
+					if ( ( Sx[run3*NX+run2] == BT_TRUE ) && ( Sx[run1*NX+run2] == BT_FALSE ) ){
+						Sx[run1*NX+run2] = BT_TRUE;
+						changed = BT_TRUE;
+					}
+				}
+				for( run2 = 0; run2 < NU; run2++ ){
+					if ( ( Su[run3*NU+run2] == BT_TRUE ) && ( Su[run1*NU+run2] == BT_FALSE ) ){
+						Su[run1*NU+run2] = BT_TRUE;
+						changed = BT_TRUE;
+					}
+				}
+			}
+		}
+	}
+
+	for( run1 = 0; run1 < NX; run1++ ){
+		for( run2 = 0; run2 < NX; run2++ )
+			if ( Sx[run1*NX+run2] == BT_TRUE )
+				GxS(run1,run2) = Gx(run1,run2);
+		for( run2 = 0; run2 < NU; run2++ )
+			if ( Su[run1*NU+run2] == BT_TRUE )
+				GuS(run1,run2) = Gu(run1,run2);
+	}
+
+	// count the products Jx(i,k)*G(k,j) which remain
+	for( run1 = 0; run1 < NX; run1++ ){
+		for( run3 = 0; run3 < NX; run3++ ){
+
+			if ( Px[run1*NX+run3] == BT_FALSE )
+				continue;
+
+			for( run2 = 0; run2 < NX; run2++ )
+				if ( Sx[run3*NX+run2] == BT_TRUE )
+					numProducts++;
+			for( run2 = 0; run2 < NU; run2++ )
+				if ( Su[run3*NU+run2] == BT_TRUE )
+					numProducts++;
+		}
+	}
+
+	free( Px );
+	free( Sx );
+	free( Su );
+
+	return numProducts;
+}
+
+
 returnValue ExplicitRungeKuttaExport::setLinearInput( const Matrix& M1, const Matrix& A1, const Matrix& B1 ) {
 
 	return ACADOERROR( RET_INVALID_OPTION );
@@ -178,6 +178,21 @@ returnValue IntegratorExport::setModelData( const ModelData& data ) {
 
 	setup( );
 
+	int optimizeExpressions;
+	get( CG_OPTIMIZE_EXPRESSIONS,optimizeExpressions );
+
+	if ( (BooleanType)optimizeExpressions == BT_TRUE )
+	{
+		int nBefore, nAfter;
+		setExportOptimization( BT_TRUE,nBefore,nAfter );
+
+		int printLevel;
+		get( PRINTLEVEL,printLevel );
+
+		if ( (PrintLevel)printLevel >= MEDIUM )
+			acadoPrintf( "--> Optimized model functions: %d instead of %d operations are exported.\n",nAfter,nBefore );
+	}
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -186,6 +201,43 @@ returnValue IntegratorExport::setModelData( const ModelData& data ) {
 // PROTECTED:
 
 
+returnValue IntegratorExport::setExportOptimization(	BooleanType optimize,
+														int& nBefore,
+														int& nAfter
+														)
+{
+	uint i;
+	int before, after;
+
+	nBefore = 0;
+	nAfter  = 0;
+
+	rhs.setExportOptimization( optimize );
+	rhs.getNumExportOperations( before,after );
+	nBefore += before;
+	nAfter  += after;
+
+	diffs_rhs.setExportOptimization( optimize );
+	diffs_rhs.getNumExportOperations( before,after );
+	nBefore += before;
+	nAfter  += after;
+
+	for( i = 0; i < outputs.size(); i++ ) {
+		outputs[i].setExportOptimization( optimize );
+		outputs[i].getNumExportOperations( before,after );
+		nBefore += before;
+		nAfter  += after;
+
+		diffs_outputs[i].setExportOptimization( optimize );
+		diffs_outputs[i].getNumExportOperations( before,after );
+		nBefore += before;
+		nAfter  += after;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue IntegratorExport::copy(	const IntegratorExport& arg
 									)
 {
@@ -2604,6 +2604,39 @@ returnValue ImplicitRungeKuttaExport::prepareFullRhs( ) {
 }
 
 
+returnValue ImplicitRungeKuttaExport::setExportOptimization(	BooleanType optimize,
+																int& nBefore,
+																int& nAfter
+																)
+{
+	int before, after;
+
+	IntegratorExport::setExportOptimization( optimize,nBefore,nAfter );
+
+	lin_input.setExportOptimization( optimize );
+	lin_input.getNumExportOperations( before,after );
+	nBefore += before;
+	nAfter  += after;
+
+	lin_output.setExportOptimization( optimize );
+	lin_output.getNumExportOperations( before,after );
+	nBefore += before;
+	nAfter  += after;
+
+	rhs3.setExportOptimization( optimize );
+	rhs3.getNumExportOperations( before,after );
+	nBefore += before;
+	nAfter  += after;
+
+	diffs_rhs3.setExportOptimization( optimize );
+	diffs_rhs3.getNumExportOperations( before,after );
+	nBefore += before;
+	nAfter  += after;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ImplicitRungeKuttaExport::copy(	const ImplicitRungeKuttaExport& arg
 									)
 {
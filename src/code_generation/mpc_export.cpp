@@ -221,7 +221,7 @@ returnValue MPCexport::printDimensionsQP( )
 	acadoPrintf( "\n***********************  ACADO CODE GENERATION  ***********************\n\n" );
 	acadoPrintf( " The condensed QP comprises " );
 	acadoPrintf( "%d variables and ", gaussNewton->getNumQPvars() );
-	acadoPrintf( "%d constraints.\n", gaussNewton->getNumStateBounds() );
+	acadoPrintf( "%d constraints.\n", gaussNewton->getNumConstraints() );
 	acadoPrintf( "\n***********************************************************************\n\n" );
 
 	return SUCCESSFUL_RETURN;
@@ -323,6 +323,10 @@ returnValue MPCexport::setup( )
 	ocp.getConstraint( constraint );
 	constraint.getBounds( tmp );
 
+	Function pathConstraints;
+	Matrix lbPathConstraints, ubPathConstraints;
+	constraint.getPathConstraints( pathConstraints,lbPathConstraints,ubPathConstraints );
+
 
 	// setup condensing
 	double levenbergMarquardt;
@@ -395,6 +399,11 @@ returnValue MPCexport::setup( )
 
 	gaussNewton->setCondensingExport( condenser );
 	gaussNewton->setControlBounds( *(tmp.u) );
+
+	returnvalue = gaussNewton->setPathConstraints( pathConstraints,lbPathConstraints,ubPathConstraints );
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return ACADOERROR( returnvalue );
+
 	gaussNewton->setup( );
 
 
@@ -440,13 +449,25 @@ returnValue MPCexport::checkConsistency( ) const
 	//if ( grid.isEquidistant( ) == BT_FALSE )
 		//return ACADOERROR( RET_ONLY_EQUIDISTANT_GRID_FOR_CODE_EXPORT );
 
-	// only state or control BOUNDS supported!
+	// only state or control BOUNDS and PATH CONSTRAINTS in states and controls supported!
 	Constraint constraint;
 	ocp.getConstraint( constraint );
 	
-	if ( constraint.isBoxConstraint( ) == BT_FALSE )
+	if ( constraint.hasOnlyPathConstraints( ) == BT_FALSE )
 		return ACADOERROR( RET_ONLY_BOUNDS_FOR_CODE_EXPORT );
 
+	Function pathConstraints;
+	Matrix lbPathConstraints, ubPathConstraints;
+
+	if ( ( constraint.getPathConstraints( pathConstraints,lbPathConstraints,ubPathConstraints ) == SUCCESSFUL_RETURN ) &&
+		 ( pathConstraints.getDim( ) > 0 ) )
+	{
+		if ( ( pathConstraints.getNXA( ) > 0 ) || ( pathConstraints.getNDX( ) > 0 ) ||
+			 ( pathConstraints.getNUI( ) > 0 ) || ( pathConstraints.getNP( ) > 0 ) ||
+			 ( pathConstraints.getNPI( ) > 0 ) || ( pathConstraints.getNW( ) > 0 ) )
+			return ACADOERROR( RET_ONLY_STATES_AND_CONTROLS_FOR_CODE_EXPORT );
+	}
+
 
 	int sparseQPsolution;
 	get( SPARSE_QP_SOLUTION,sparseQPsolution );
@@ -933,7 +954,7 @@ returnValue MPCexport::exportMakefile(	const String& _dirName,
 			Makefile.addLinebreak( );
 			Makefile.addStatement( "OBJECTS = \\\n" );
 
-			if ( gaussNewton->getNumStateBounds() > 0 )
+			if ( gaussNewton->getNumConstraints() > 0 )
 				Makefile.addStatement( "\t./qpoases/SRC/QProblem.o        \\\n" );
 
 			Makefile.addStatement( "\t./qpoases/SRC/QProblemB.o       \\\n" );
@@ -984,7 +1005,7 @@ returnValue MPCexport::exportMakefile(	const String& _dirName,
 			Makefile.addLinebreak( );
 			Makefile.addStatement( "OBJECTS = \\\n" );
 
-			if ( gaussNewton->getNumStateBounds() > 0 )
+			if ( gaussNewton->getNumConstraints() > 0 )
 				Makefile.addStatement( "\t./qpoases3/src/QProblem.o        \\\n" );
 			else
 				Makefile.addStatement( "\t./qpoases3/src/QProblemB.o       \\\n" );
@@ -1033,6 +1054,17 @@ returnValue MPCexport::exportMakefile(	const String& _dirName,
 			return ACADOERROR( RET_INVALID_OPTION );
 	}
 
+	int useOMP;
+	get( CG_USE_OPENMP,useOMP );
+
+	if ( useOMP )
+	{
+		Makefile.addStatement( "CFLAGS   += -fopenmp\n" );
+		Makefile.addStatement( "CXXFLAGS += -fopenmp\n" );
+		Makefile.addStatement( "LDLIBS   += -fopenmp\n" );
+		Makefile.addLinebreak( );
+	}
+
 	return Makefile.exportCode( );
 }
 
@@ -1051,7 +1083,7 @@ returnValue MPCexport::exportQPsolverInterface(	const String& _dirName,
 
 	// if not specified, use default value
 	if ( maxNumQPiterations <= 0 )
-		maxNumQPiterations = 3*(gaussNewton->getNumQPvars()+gaussNewton->getNumStateBounds());
+		maxNumQPiterations = 3*(gaussNewton->getNumQPvars()+gaussNewton->getNumConstraints());
 
 	int hotstartQP;
 	get( HOTSTART_QP,hotstartQP );
@@ -1100,7 +1132,7 @@ returnValue MPCexport::exportQPsolverInterface(	const String& _dirName,
 	qpSolverHeader.addStatement( "#include <math.h>\n" );
 	qpSolverHeader.addLinebreak( 2 );
 	qpSolverHeader.addStatement( (String)"#define QPOASES_NVMAX      " << gaussNewton->getNumQPvars() << "\n" );
-	qpSolverHeader.addStatement( (String)"#define QPOASES_NCMAX      " << acadoMax( gaussNewton->getNumStateBounds(),1 ) << "\n" );
+	qpSolverHeader.addStatement( (String)"#define QPOASES_NCMAX      " << acadoMax( gaussNewton->getNumConstraints(),1 ) << "\n" );
 	qpSolverHeader.addStatement( (String)"#define QPOASES_NWSRMAX    " << acadoMax( maxNumQPiterations,1 ) << "\n" );
 	qpSolverHeader.addStatement( (String)"#define QPOASES_PRINTLEVEL " << "PL_NONE" << "\n" );
 
@@ -1156,7 +1188,7 @@ returnValue MPCexport::exportQPsolverInterface(	const String& _dirName,
 	{
 		qpSolverSource.addStatement( "#include \"solver.h\"\n" );
 		
-		if ( gaussNewton->getNumStateBounds() > 0 )
+		if ( gaussNewton->getNumConstraints() > 0 )
 			qpSolverSource.addStatement( "#include \"include/qpOASES/QProblem.h\"\n" );
 		else
 			qpSolverSource.addStatement( "#include \"include/qpOASES/QProblemB.h\"\n" );
@@ -1173,9 +1205,9 @@ returnValue MPCexport::exportQPsolverInterface(	const String& _dirName,
 
 	if ( (QPSolverName)qpSolver == QP_QPOASES )
 	{
-		if ( gaussNewton->getNumStateBounds() > 0 )
+		if ( gaussNewton->getNumConstraints() > 0 )
 		{
-			qpSolverSource.addStatement( (String)"  QProblem qp( " << gaussNewton->getNumQPvars() << "," << gaussNewton->getNumStateBounds() << " );\n" );
+			qpSolverSource.addStatement( (String)"  QProblem qp( " << gaussNewton->getNumQPvars() << "," << gaussNewton->getNumConstraints() << " );\n" );
 			if ( (BooleanType)hotstartQP == BT_TRUE )
 				qpSolverSource.addStatement( "  returnValue retVal = qp.init( params.H,params.g,params.A,params.lb,params.ub,params.lbA,params.ubA, nWSR,vars.y );\n" );
 			else
@@ -1197,10 +1229,10 @@ returnValue MPCexport::exportQPsolverInterface(	const String& _dirName,
 	}
 	else
 	{
-		if ( gaussNewton->getNumStateBounds() > 0 )
+		if ( gaussNewton->getNumConstraints() > 0 )
 		{
 			qpSolverSource.addStatement( "  QProblem qp;\n" );
-			qpSolverSource.addStatement( (String)"  QProblemCON( &qp," << gaussNewton->getNumQPvars() << "," << gaussNewton->getNumStateBounds() << ",HST_POSDEF );\n" );
+			qpSolverSource.addStatement( (String)"  QProblemCON( &qp," << gaussNewton->getNumQPvars() << "," << gaussNewton->getNumConstraints() << ",HST_POSDEF );\n" );
 			if ( (BooleanType)hotstartQP == BT_TRUE )
 				qpSolverSource.addStatement( "  returnValue retVal = QProblem_initW( &qp,params.H,params.g,params.A,params.lb,params.ub,params.lbA,params.ubA, &nWSR,0, 0,vars.y,0,0 );\n" );
 			else
@@ -122,6 +122,13 @@ returnValue BandedCPsolver::unfreezeCondensing( )
 }
 
 
+returnValue BandedCPsolver::setWorkingSetGuess(	const BandedCP& cp
+												)
+{
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
@@ -151,6 +158,47 @@ returnValue BandedCPsolver::setupLogging( )
 }
 
 
+returnValue BandedCPsolver::projectHessian( Matrix &H_, double dampingFactor ){
+
+    if( dampingFactor < 0.0 ) return SUCCESSFUL_RETURN;
+
+    int run1,run2;
+
+
+    // COMPUTE THE EIGENVALUES OF THE HESSIAN:
+    // ---------------------------------------
+
+    Matrix Q;
+    Vector D = H_.getEigenvalues( Q );
+    const int n = D.getDim();
+
+
+    // OVER-PROJECT THE EIGENVALUES BASED ON THE DAMPING TECHNIQUE:
+    // ------------------------------------------------------------
+
+    for( run1 = 0; run1 < n; run1++ ){
+        if( D(run1) <= 0.1 * dampingFactor ){
+            if( fabs(D(run1)) >= dampingFactor ) D(run1) = fabs(D(run1));
+            else                                 D(run1) = dampingFactor;
+        }
+    }
+
+
+    // RECONSTRUCT THE PROJECTED HESSIAN MATRIX:
+    // -----------------------------------------
+
+    Matrix tmp(n,n);
+
+    for( run1 = 0; run1 < n; run1++ )
+        for( run2 = 0; run2 < n; run2++ )
+            tmp(run1,run2) = D(run1)*Q(run2,run1);
+
+    H_ = Q*tmp;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
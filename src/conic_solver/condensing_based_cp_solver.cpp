@@ -344,53 +344,56 @@ returnValue CondensingBasedCPsolver::unfreezeCondensing( )
 }
 
 
+returnValue CondensingBasedCPsolver::setWorkingSetGuess(	const BandedCP& cp
+															)
+{
+    uint run1;
 
-//
-// PROTECTED MEMBER FUNCTIONS:
-//
-
-returnValue CondensingBasedCPsolver::projectHessian( Matrix &H_, double dampingFactor ){
+    uint N  = getNumPoints();
+    uint nF = getNF();
 
-    if( dampingFactor < 0.0 ) return SUCCESSFUL_RETURN;
+    if( ( cpSolver == 0 ) || ( getNX() == 0 ) || ( N < 2 ) )
+        return SUCCESSFUL_RETURN;
 
-    int run1,run2;
+    if( ( cp.lambdaBound.getNumRows() != 4*N+1 ) || ( cp.lambdaConstraint.getNumRows() != blockDims.getDim() ) )
+        return SUCCESSFUL_RETURN;
 
+    Vector yGuess( nF + getNA() );
+    yGuess.setZero();
 
-    // COMPUTE THE EIGENVALUES OF THE HESSIAN:
-    // ---------------------------------------
+    // (this is the inverse of the mapping in expand)
+    uint offset = 0;
 
-    Matrix Q;
-    Vector D = H_.getEigenvalues( Q );
-    const int n = D.getDim();
+    setDualBlockGuess( cp.lambdaBound, 0, getNX(), offset, yGuess );
 
+    for( run1 = 0; run1 < N; run1++ )
+        setDualBlockGuess( cp.lambdaBound, N+run1, getNXA(), offset, yGuess );
 
-    // OVER-PROJECT THE EIGENVALUES BASED ON THE DAMPING TECHNIQUE:
-    // ------------------------------------------------------------
+    setDualBlockGuess( cp.lambdaBound, 2*N, getNP(), offset, yGuess );
 
-    for( run1 = 0; run1 < n; run1++ ){
-        if( D(run1) <= 0.1 * dampingFactor ){
-            if( fabs(D(run1)) >= dampingFactor ) D(run1) = fabs(D(run1));
-            else                                 D(run1) = dampingFactor;
-        }
-    }
+    for( run1 = 0; run1 < N-1; run1++ )
+        setDualBlockGuess( cp.lambdaBound, 2*N+1+run1, getNU(), offset, yGuess );
 
+    for( run1 = 0; run1 < N-1; run1++ )
+        setDualBlockGuess( cp.lambdaBound, 3*N+1+run1, getNW(), offset, yGuess );
 
-    // RECONSTRUCT THE PROJECTED HESSIAN MATRIX:
-    // -----------------------------------------
+    offset = nF;
+    for( run1 = 0; run1 < blockDims.getDim(); run1++ )
+        setDualBlockGuess( cp.lambdaConstraint, run1, (uint) blockDims(run1), offset, yGuess );
 
-    Matrix tmp(n,n);
+    offset = nF + getNC();
+    for( run1 = 1; run1 < N; run1++ )
+        setDualBlockGuess( cp.lambdaBound, run1, getNX(), offset, yGuess );
 
-    for( run1 = 0; run1 < n; run1++ )
-        for( run2 = 0; run2 < n; run2++ )
-            tmp(run1,run2) = D(run1)*Q(run2,run1);
-
-    H_ = Q*tmp;
-
-    return SUCCESSFUL_RETURN;
+    return cpSolver->setWorkingSetGuess( yGuess );
 }
 
 
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
 returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 {
 	if( denseCP.isQP() == BT_FALSE )
@@ -531,8 +534,8 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 		if ( condensingStatus != COS_FROZEN )
 		{
 			// generate H
-			hT       = cp.hessian*T;
-			HDense   = T^hT;
+			hT    .setProduct          ( cp.hessian, T  );
+			HDense.setTransposedProduct( T         , hT );
 
 			if( getNX() != 0 ) generateHessianBlockLine( getNX(), rowOffset, rowOffset1 );
 			rowOffset++;
@@ -557,7 +560,7 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 
 
 			// generate A
-			ADense   = cp.constraintGradient*T;
+			ADense.setProduct( cp.constraintGradient, T );
 
 			denseCP.A.setZero();
 
@@ -1073,6 +1076,28 @@ returnValue CondensingBasedCPsolver::generateObjectiveGradient( ){
 
 
 
+returnValue CondensingBasedCPsolver::setDualBlockGuess(	const BlockMatrix& lambda,
+															uint idx,
+															uint dim,
+															uint& offset,
+															Vector& yGuess
+															) const
+{
+    uint run1;
+
+    const Matrix& block = lambda.getSubBlock( idx, 0 );
+
+    if( ( block.getNumRows() == dim ) && ( block.getNumCols() == 1 ) && ( offset+dim <= yGuess.getDim() ) )
+        for( run1 = 0; run1 < dim; run1++ )
+            yGuess(offset+run1) = block(run1,0);
+
+    offset += dim;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 												)
 {
@@ -1378,81 +1403,74 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 	uint run1, run2;
 	uint N = getNumPoints();
 
-	Matrix  Gx;
-	Matrix   G;
-	Matrix tmp;
+	// The blocks are accessed by reference and the products are evaluated
+	// into the existing blocks of T and d, such that no temporary matrices
+	// are created once the condensing operator has been set up.
 
 	for( run1 = 0; run1 < N-1; run1++ )
 	{
 			// DIFFERENTIAL STATES:
 			// --------------------
-			cp.dynGradient.getSubBlock( run1, 0,  Gx );   // Get the sensitivity G_x^i with respect to x
+			const Matrix &Gx = cp.dynGradient.getSubBlock( run1, 0 );   // Get the sensitivity G_x^i with respect to x
 			
 		if ( condensingStatus != COS_FROZEN )
 		{
-			T             .getSubBlock( run1, 0, tmp );   // get the corresponding  C_i .
-
-			T.setDense( run1+1, 0, Gx*tmp );		   // compute C_{i+1} := G_x^i * C_i
+			T.setDense( run1+1, 0, Gx, T.getSubBlock( run1, 0 ) );   // compute C_{i+1} := G_x^i * C_i
 
 			// ALGEBRAIC STATES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 1, G );
-
-			for( run2 = 0; run2 <= run1; run2++ ){
+			const Matrix &Ga = cp.dynGradient.getSubBlock( run1, 1 );
 
-				T.getSubBlock( run1, run2+1, tmp );
+			if( Ga.getDim() != 0 ){
 
-				if( G.getDim() != 0 ){
+				for( run2 = 0; run2 <= run1; run2++ ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+1, G      );
-					else               T.setDense( run1+1, run2+1, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+1, Ga );
+					else               T.setDense( run1+1, run2+1, Gx, T.getSubBlock( run1, run2+1 ) );
 				}
 			}
 
 			// PARAMETERS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 2  ,  G  ); // Get the sensitivity G_p^i with respect to p
-			T             .getSubBlock( run1, N+1, tmp ); // get the corresponding  D_p^i.
+			const Matrix &Gp = cp.dynGradient.getSubBlock( run1, 2 ); // Get the sensitivity G_p^i with respect to p
 
-			if( tmp.getDim() != 0 ){
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1, Gx*tmp + G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
-			}
-			else{
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1,          G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+			if( Gp.getDim() != 0 ){
+
+				if( T.getSubBlock( run1, N+1 ).getDim() != 0 ){
+					T.setDense( run1+1, N+1, Gx, T.getSubBlock( run1, N+1 ) );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+					T.addDense( run1+1, N+1, Gp );
+				}
+				else
+					T.setDense( run1+1, N+1, Gp );
 			}
 
 			// CONTROLS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 3, G );
-			for( run2 = 0; run2 <= run1; run2++ ){
+			const Matrix &Gu = cp.dynGradient.getSubBlock( run1, 3 );
 
-				T.getSubBlock( run1, run2+2+N, tmp );
+			if( Gu.getDim() != 0 ){
 
-				if( G.getDim() != 0 ){
+				for( run2 = 0; run2 <= run1; run2++ ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, G      );
-					else               T.setDense( run1+1, run2+2+N, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, Gu );
+					else               T.setDense( run1+1, run2+2+N, Gx, T.getSubBlock( run1, run2+2+N ) );
 				}
 			}
 
 			// DISTURBANCES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 4, G );
+			const Matrix &Gw = cp.dynGradient.getSubBlock( run1, 4 );
 
-			for( run2 = 0; run2 <= run1; run2++ ){
+			if( Gw.getDim() != 0 ){
 
-				T.getSubBlock( run1, run2+1+2*N, tmp );
+				for( run2 = 0; run2 <= run1; run2++ ){
 
-				if( G.getDim() != 0 ){
-
-					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, G      );
-					else               T.setDense( run1+1, run2+1+2*N, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, Gw );
+					else               T.setDense( run1+1, run2+1+2*N, Gx, T.getSubBlock( run1, run2+1+2*N ) );
 				}
 			}
 		}
@@ -1460,16 +1478,16 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 		// RESIDUUM:
 		// --------------------
 
-		cp.dynResiduum.getSubBlock( run1, 0,  G  );   // Get the residuum  b^i
-		d             .getSubBlock( run1, 0, tmp );   // get the corresponding  d^i.
+		const Matrix &b = cp.dynResiduum.getSubBlock( run1, 0 );   // Get the residuum  b^i
 
-		if( tmp.getDim() != 0 ){
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, Gx*tmp + G );   // compute  d^{i+1} := G_x^i d^i + b^i
-		}
-		else{
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, G );   // compute  d^{i+1} := b^i
+		if( b.getDim() != 0 ){
+
+			if( d.getSubBlock( run1, 0 ).getDim() != 0 ){
+				d.setDense( run1+1, 0, Gx, d.getSubBlock( run1, 0 ) );   // compute  d^{i+1} := G_x^i d^i + b^i
+				d.addDense( run1+1, 0, b );
+			}
+			else
+				d.setDense( run1+1, 0, b );   // compute  d^{i+1} := b^i
 		}
 	}
 
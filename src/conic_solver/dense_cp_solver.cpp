@@ -79,6 +79,13 @@ DenseCPsolver& DenseCPsolver::operator=( const DenseCPsolver& rhs )
 }
 
 
+returnValue DenseCPsolver::setWorkingSetGuess( const Vector& yGuess )
+{
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -0,0 +1,1456 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/conic_solver/interior_point_based_cp_solver.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *
+ */
+
+#include <acado/conic_solver/interior_point_based_cp_solver.hpp>
+
+#include <cfloat>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+static const double IP_TOLERANCE        = 1.0e-10;	/**< Tolerance on the (scaled) KKT residuals and the duality measure. */
+static const double IP_STEP_FRACTION    = 0.995;	/**< Fraction of the maximum step to the boundary. */
+static const double IP_REGULARISATION   = 1.0e-7;	/**< Static primal (positive) and dual (negative) regularisation of the KKT matrix. */
+static const double IP_PIVOT_TOLERANCE  = 1.0e-13;	/**< Pivots of the expected sign that are smaller than this value are perturbed. */
+static const double IP_PIVOT_PERTURBATION = 1.0e-7;	/**< Magnitude of perturbed pivots (dynamic regularisation). */
+static const uint   IP_REFINEMENT_STEPS = 10;		/**< Maximum number of iterative refinement steps per solution of a KKT system. */
+static const double IP_REFINEMENT_TOLERANCE = 1.0e-14;	/**< Iterative refinement stops at this relative backward error. */
+static const double IP_BREAKDOWN_TOLERANCE  = SQRT_EPS;	/**< Larger relative backward errors of a KKT solution are reported as breakdown. */
+static const double IP_INFINITE_BOUND   = 0.5*INFTY;	/**< Bounds beyond this value are dropped (they are shifted by the linearisation point). */
+
+
+//
+// BANDED LINEAR ALGEBRA:
+//
+// Symmetric matrices of half bandwidth bw are stored by their lower
+// triangle, row by row: entry (i,j) with j <= i <= j+bw is K[i*(bw+1)+(i-j)].
+//
+
+/* Overwrites K with its factorization K = L*D*L^T, where L has a unit
+ * diagonal. No pivoting is performed, which relies on K being
+ * quasi-definite: the pivots of the rows with sign +1 (primal variables)
+ * have to be positive and the ones of the rows with sign -1 (multipliers)
+ * negative. Pivots with the wrong sign or a magnitude below
+ * IP_PIVOT_TOLERANCE are replaced by sign*IP_PIVOT_PERTURBATION (dynamic
+ * regularisation), i.e. a perturbed matrix is factorized. */
+static returnValue factorizeBand( uint n, uint bw, double *K, const double *sign, double *work )
+{
+	uint i, j, k, k0;
+	const uint w = bw+1;
+
+	for( j = 0; j < n; j++ ){
+
+		double *Kj = K + j*w;
+		k0 = ( j > bw ) ? j-bw : 0;
+
+		// work[j-k] = L(j,k) * D(k)
+		double d = Kj[0];
+		for( k = k0; k < j; k++ ){
+			work[j-k] = Kj[j-k]*K[k*w];
+			d -= Kj[j-k]*work[j-k];
+		}
+
+		// pivots that are not a finite number (NaN or overflow)
+		if ( !( fabs( d ) <= DBL_MAX ) )
+			return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+
+		if ( !( sign[j]*d > IP_PIVOT_TOLERANCE ) )
+			d = sign[j]*IP_PIVOT_PERTURBATION;
+		Kj[0] = d;
+
+		for( i = j+1; ( i < n ) && ( i <= j+bw ); i++ ){
+
+			double *Ki = K + i*w;
+			double  v  = Ki[i-j];
+
+			for( k = ( i > bw ) ? i-bw : 0; k < j; k++ )
+				v -= Ki[i-k]*work[j-k];
+
+			Ki[i-j] = v/d;
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+/* Overwrites x with K^{-1}*x, where L contains the output of factorizeBand. */
+static void solveBand( uint n, uint bw, const double *L, double *x )
+{
+	uint i, k;
+	const uint w = bw+1;
+
+	for( i = 0; i < n; i++ ){
+		const double *Li = L + i*w;
+		for( k = ( i > bw ) ? i-bw : 0; k < i; k++ )
+			x[i] -= Li[i-k]*x[k];
+	}
+
+	for( i = 0; i < n; i++ )
+		x[i] /= L[i*w];
+
+	for( i = n; i-- > 0; ){
+		const double *Li = L + i*w;
+		for( k = ( i > bw ) ? i-bw : 0; k < i; k++ )
+			x[k] -= Li[i-k]*x[i];
+	}
+}
+
+
+/* Computes r = rhs - K*x. */
+static void residualBand( uint n, uint bw, const double *K, const double *x, const double *rhs, double *r )
+{
+	uint i, k;
+	const uint w = bw+1;
+
+	for( i = 0; i < n; i++ )
+		r[i] = rhs[i];
+
+	for( i = 0; i < n; i++ ){
+		const double *Ki = K + i*w;
+		r[i] -= Ki[0]*x[i];
+		for( k = ( i > bw ) ? i-bw : 0; k < i; k++ ){
+			r[i] -= Ki[i-k]*x[k];
+			r[k] -= Ki[i-k]*x[i];
+		}
+	}
+}
+
+
+/* Enlarges a work array to at least dim entries, keeping its content. */
+template <typename T>
+static void reserveWork( T *&array, uint &capacity, uint dim )
+{
+	if ( dim <= capacity )
+		return;
+
+	array = (T*) realloc( array,dim*sizeof(T) );
+	capacity = dim;
+}
+
+
+/* Returns the infinity norm of a symmetric band matrix. */
+static double normBand( uint n, uint bw, const double *K, double *rowSum )
+{
+	uint i, k;
+	const uint w = bw+1;
+	double norm = 0.0;
+
+	for( i = 0; i < n; i++ )
+		rowSum[i] = 0.0;
+
+	for( i = 0; i < n; i++ ){
+		const double *Ki = K + i*w;
+		rowSum[i] += fabs( Ki[0] );
+		for( k = ( i > bw ) ? i-bw : 0; k < i; k++ ){
+			rowSum[i] += fabs( Ki[i-k] );
+			rowSum[k] += fabs( Ki[i-k] );
+		}
+	}
+
+	for( i = 0; i < n; i++ )
+		norm = acadoMax( norm,rowSum[i] );
+
+	return norm;
+}
+
+
+/* Computes r = rhs - K*x and returns the relative backward error
+ * ||r|| / ( ||rhs|| + ||K||*||x|| ) in the infinity norm. */
+static double backwardErrorBand( uint n, uint bw, const double *K, double normK, const double *x, const double *rhs, double *r )
+{
+	uint i;
+	double normR = 0.0, normRhs = 0.0, normX = 0.0;
+
+	residualBand( n,bw,K,x,rhs,r );
+
+	for( i = 0; i < n; i++ ){
+		normR   = acadoMax( normR,fabs( r[i] ) );
+		normRhs = acadoMax( normRhs,fabs( rhs[i] ) );
+		normX   = acadoMax( normX,fabs( x[i] ) );
+	}
+
+	if ( !( normR > 0.0 ) )
+		return 0.0;
+
+	return normR / ( normRhs + normK*normX );
+}
+
+
+/* Solves K*x = rhs by iterative refinement, where L contains the
+ * factorization of a regularised K. Refinement stops as soon as a step
+ * does not reduce the backward error, which is returned. */
+static double refineBand( uint n, uint bw, const double *K, double normK, const double *L,
+						  const double *rhs, double *x, double *r, double *dx )
+{
+	uint i, step;
+
+	for( i = 0; i < n; i++ )
+		x[i] = rhs[i];
+	solveBand( n,bw,L,x );
+
+	double error = backwardErrorBand( n,bw,K,normK,x,rhs,r );
+
+	for( step = 0; ( step < IP_REFINEMENT_STEPS ) && ( error > IP_REFINEMENT_TOLERANCE ); step++ ){
+
+		for( i = 0; i < n; i++ )
+			dx[i] = r[i];
+		solveBand( n,bw,L,dx );
+
+		for( i = 0; i < n; i++ )
+			x[i] += dx[i];
+
+		double newError = backwardErrorBand( n,bw,K,normK,x,rhs,r );
+
+		if ( !( newError < error ) ){
+			for( i = 0; i < n; i++ )
+				x[i] -= dx[i];
+			break;
+		}
+
+		error = newError;
+	}
+
+	return error;
+}
+
+
+/* Returns a^T*x of a bound (row < 0) or a constraint row acting on the stage variables x. */
+static inline double rowTimes( const Matrix &A, int row, uint var, uint nZ, const double *x )
+{
+	if ( row < 0 )
+		return x[var];
+
+	double value = 0.0;
+	for( uint j = 0; j < nZ; j++ )
+		value += A(row,j)*x[j];
+
+	return value;
+}
+
+
+/* Computes x += alpha*a of a bound (row < 0) or a constraint row acting on the stage variables x. */
+static inline void addRow( const Matrix &A, int row, uint var, uint nZ, double alpha, double *x )
+{
+	if ( row < 0 ){
+		x[var] += alpha;
+		return;
+	}
+
+	for( uint j = 0; j < nZ; j++ )
+		x[j] += alpha*A(row,j);
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+InteriorPointBasedCPsolver::InteriorPointBasedCPsolver( ) : BandedCPsolver( )
+{
+	nConstraints = 0;
+	blockDims = 0;
+
+	constraintStage = 0;
+
+	uintWork  = 0;
+	rowWork   = 0;
+	realWork  = 0;
+	nUintWork = 0;
+	nRowWork  = 0;
+	nRealWork = 0;
+}
+
+
+InteriorPointBasedCPsolver::InteriorPointBasedCPsolver(	UserInteraction* _userInteraction,
+														uint nConstraints_,
+														const Vector& blockDims_
+														) : BandedCPsolver( _userInteraction )
+{
+	nConstraints = nConstraints_;
+	blockDims = blockDims_;
+
+	constraintStage = 0;
+
+	uintWork  = 0;
+	rowWork   = 0;
+	realWork  = 0;
+	nUintWork = 0;
+	nRowWork  = 0;
+	nRealWork = 0;
+}
+
+
+InteriorPointBasedCPsolver::InteriorPointBasedCPsolver( const InteriorPointBasedCPsolver& rhs )
+                           :BandedCPsolver( rhs )
+{
+	constraintStage = 0;
+
+	uintWork  = 0;
+	rowWork   = 0;
+	realWork  = 0;
+	nUintWork = 0;
+	nRowWork  = 0;
+	nRealWork = 0;
+
+	*this = rhs;
+}
+
+
+InteriorPointBasedCPsolver::~InteriorPointBasedCPsolver( ){
+
+	if( constraintStage != 0 ) free( constraintStage );
+
+	if( uintWork != 0 ) free( uintWork );
+	if( rowWork  != 0 ) free( rowWork  );
+	if( realWork != 0 ) free( realWork );
+}
+
+
+InteriorPointBasedCPsolver& InteriorPointBasedCPsolver::operator=( const InteriorPointBasedCPsolver& rhs ){
+
+    if ( this != &rhs ){
+
+		BandedCPsolver::operator=( rhs );
+
+		iter = rhs.iter;
+		nConstraints = rhs.nConstraints;
+		blockDims = rhs.blockDims;
+
+		H = rhs.H;
+		g = rhs.g;
+		lb = rhs.lb;
+		ub = rhs.ub;
+
+		A = rhs.A;
+		lbA = rhs.lbA;
+		ubA = rhs.ubA;
+
+		if( constraintStage != 0 ) free( constraintStage );
+		constraintStage = 0;
+
+		if( rhs.constraintStage != 0 ){
+			constraintStage = (uint*) calloc( nConstraints,sizeof(uint) );
+			for( uint run1 = 0; run1 < nConstraints; run1++ )
+				constraintStage[run1] = rhs.constraintStage[run1];
+		}
+
+		G = rhs.G;
+		b = rhs.b;
+
+		z = rhs.z;
+		yBounds = rhs.yBounds;
+		yConstraints = rhs.yConstraints;
+		yDynamics = rhs.yDynamics;
+
+		deltaX = rhs.deltaX;
+		deltaP = rhs.deltaP;
+    }
+    return *this;
+}
+
+
+BandedCPsolver* InteriorPointBasedCPsolver::clone() const
+{
+     return new InteriorPointBasedCPsolver(*this);
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::init(	const OCPiterate &iter_
+												)
+{
+	iter = iter_;
+
+	if ( getNumPoints( ) == 0 )
+		return ACADOERROR( RET_BANDED_CP_INIT_FAILED );
+
+	if( constraintStage != 0 ) free( constraintStage );
+	constraintStage = 0;
+
+	if( nConstraints > 0 )
+		constraintStage = (uint*) calloc( nConstraints,sizeof(uint) );
+
+	z.init( getNumPoints()*getNZ() );
+	z.setZero( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::prepareSolve(	BandedCP& cp
+														)
+{
+	uint run1, run2, run3;
+
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH ) 
+		acadoPrintf( "--> Setting up stage-wise QP ...\n" );
+
+    returnValue returnvalue = setupStageData( cp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+
+	// ENSURE THAT THE STAGE HESSIANS ARE SYMMETRIC AND POSITIVE DEFINITE:
+	// --------------------------------------------------------------------
+	int hessianMode;
+	get( HESSIAN_APPROXIMATION,hessianMode );
+
+	double hessianProjectionFactor;
+	get( HESSIAN_PROJECTION_FACTOR, hessianProjectionFactor );
+
+    double levenbergMarquard;
+    get( LEVENBERG_MARQUARDT, levenbergMarquard );
+
+	const uint nZ = getNZ();
+	Matrix Hk( nZ,nZ );
+
+	for( run1 = 0; run1 < getNumPoints(); run1++ )
+	{
+		for( run2 = 0; run2 < nZ; run2++ )
+			for( run3 = 0; run3 < nZ; run3++ )
+				Hk(run2,run3) = H(run1*nZ+run2,run3);
+
+		if ( Hk.isSymmetric( ) == BT_FALSE )
+		{
+			ACADOWARNING( RET_NONSYMMETRIC_HESSIAN_MATRIX );
+			Hk.symmetrize();
+		}
+
+		if ( (HessianApproximationMode)hessianMode == EXACT_HESSIAN )
+			projectHessian( Hk, hessianProjectionFactor );
+
+		if( levenbergMarquard > EPS )
+			for( run2 = 0; run2 < nZ; run2++ )
+				Hk(run2,run2) += levenbergMarquard;
+
+		for( run2 = 0; run2 < nZ; run2++ )
+			for( run3 = 0; run3 < nZ; run3++ )
+				H(run1*nZ+run2,run3) = Hk(run2,run3);
+	}
+
+	// consistency check of Hessian matrix
+	if ( ( H.getMax( ) > 1.0e16 ) || ( H.getMin( ) < -1.0e16 ) )
+		return ACADOERROR( RET_ILLFORMED_HESSIAN_MATRIX );
+
+	if ( (PrintLevel)printLevel >= HIGH ) 
+		acadoPrintf( "<-- Setting up stage-wise QP done.\n" );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue InteriorPointBasedCPsolver::solve(	BandedCP& cp
+												)
+{
+	uint run1;
+
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+	{
+		if ( prepareSolve( cp ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+	}
+
+
+    // FIX THE INITIAL STATE AND THE PARAMETERS (IF SPECIFIED):
+    // --------------------------------------------------------
+
+	if ( deltaX.isEmpty( ) == BT_FALSE )
+	{
+		for( run1 = 0; run1 < getNX(); run1++ )
+		{
+			lb(run1) = deltaX(run1);
+			ub(run1) = deltaX(run1);
+		}
+	}
+
+	if ( deltaP.isEmpty( ) == BT_FALSE )
+	{
+		for( run1 = 0; run1 < getNP(); run1++ )
+		{
+			lb(getNX()+run1) = deltaP(run1);
+			ub(getNX()+run1) = deltaP(run1);
+		}
+	}
+
+
+    // Solve QP subproblem
+    // ------------------------------------
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH ) 
+		acadoPrintf( "--> Solving stage-wise QP ...\n" );
+
+    returnValue returnvalue = solveCPsubproblem( );
+    if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+
+	if ( (PrintLevel)printLevel >= HIGH ) 
+		acadoPrintf( "<-- Solving stage-wise QP done.\n" );
+
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+		return finalizeSolve( cp );
+	else
+		return SUCCESSFUL_RETURN;
+}
+
+
+returnValue InteriorPointBasedCPsolver::finalizeSolve(	BandedCP& cp
+														)
+{
+	RealClock clock;
+
+	clock.reset( );
+	clock.start( );
+
+    returnValue returnvalue = expand( cp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+	clock.stop( );
+	setLast( LOG_TIME_EXPAND,clock.getTime() );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::getParameters( Vector &p_  ) const
+{
+	if ( p_.getDim( ) != getNP( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	if ( z.getDim( ) != getNumPoints()*getNZ() )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	for( uint i=0; i<getNP(); ++i )
+		p_( i ) = z( getNX()+i );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue InteriorPointBasedCPsolver::getFirstControl( Vector &u0_ ) const
+{
+	if ( u0_.getDim( ) != getNU( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	if ( z.getDim( ) != getNumPoints()*getNZ() )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	uint startIdx = getNX() + getNP() + getNXA();
+
+	for( uint i=0; i<getNU(); ++i )
+		u0_( i ) = z( startIdx+i );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::setRealTimeParameters(	const Vector& DeltaX,
+																const Vector& DeltaP
+																)
+{
+	deltaX = DeltaX;
+	deltaP = DeltaP;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::freezeCondensing( )
+{
+	// nothing is condensed
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue InteriorPointBasedCPsolver::unfreezeCondensing( )
+{
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue InteriorPointBasedCPsolver::solveCPsubproblem( )
+{
+    int maxQPiter;
+    get( MAX_NUM_QP_ITERATIONS, maxQPiter );
+
+	RealClock clock;
+	clock.start( );
+
+	returnValue returnvalue = solveQP( maxQPiter );
+
+	clock.stop( );
+	setLast( LOG_TIME_QP,clock.getTime() );
+	setLast( LOG_TIME_RELAXED_QP,0.0 );
+	setLast( LOG_IS_QP_RELAXED, BT_FALSE );
+
+	switch( returnvalue )
+	{
+		case SUCCESSFUL_RETURN:
+			break;
+
+		case RET_QP_SOLUTION_REACHED_LIMIT:
+			ACADOWARNING( RET_QP_SOLUTION_REACHED_LIMIT );
+			break;
+
+		case RET_QP_INFEASIBLE:
+			int infeasibleQPhandling;
+			get( INFEASIBLE_QP_HANDLING,infeasibleQPhandling );
+
+			// relaxations are not available for the stage-wise QP
+			if ( (InfeasibleQPhandling)infeasibleQPhandling != IQH_IGNORE )
+				return ACADOERROR( RET_QP_INFEASIBLE );
+			break;
+
+		default:
+			return ACADOERROR( RET_QP_SOLUTION_FAILED );
+	}
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+BooleanType InteriorPointBasedCPsolver::getStageIndex(	uint blockIdx,
+														uint &stage,
+														uint &offset
+														) const
+{
+	uint N = getNumPoints();
+
+	stage = blockIdx % N;
+
+	switch( blockIdx / N )
+	{
+		case 0:  offset = 0;                                break;
+		case 1:  offset = getNX() + getNP();                break;
+		case 2:  offset = getNX();                          return BT_TRUE;
+		case 3:  offset = getNX() + getNP() + getNXA();     break;
+		default: offset = getNZ() - getNW();                break;
+	}
+
+	return BT_FALSE;
+}
+
+
+BooleanType InteriorPointBasedCPsolver::getBoundStageIndex(	uint blockIdx,
+															uint &stage,
+															uint &offset,
+															uint &dim
+															) const
+{
+	uint N = getNumPoints();
+
+	if ( blockIdx < N )
+	{
+		stage = blockIdx;  offset = 0;  dim = getNX();
+		return BT_TRUE;
+	}
+
+	if ( blockIdx < 2*N )
+	{
+		stage = blockIdx-N;  offset = getNX() + getNP();  dim = getNXA();
+		return BT_TRUE;
+	}
+
+	if ( blockIdx == 2*N )
+	{
+		stage = 0;  offset = getNX();  dim = getNP();
+		return BT_TRUE;
+	}
+
+	if ( blockIdx <= 3*N )
+	{
+		stage = blockIdx-2*N-1;  offset = getNX() + getNP() + getNXA();  dim = getNU();
+	}
+	else
+	{
+		stage = blockIdx-3*N-1;  offset = getNZ() - getNW();  dim = getNW();
+	}
+
+	if ( stage+1 < N )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::setupStageData(	BandedCP& cp
+														)
+{
+	uint run1, run2, run3, run4;
+
+	const uint N  = getNumPoints();
+	const uint nZ = getNZ();
+	const uint nX = getNX();
+
+	uint stage1, stage2, offset1, offset2, dim;
+	BooleanType isParameter1, isParameter2;
+
+
+	// HESSIAN:
+	// --------
+	// All copies of the parameters coincide, such that a parameter block
+	// is assigned to the stage of the block it is multiplied with.
+
+	H.init( N*nZ,nZ );
+	H.setZero( );
+
+	for( run1 = 0; run1 < cp.hessian.getNumRows(); run1++ ){
+		for( run2 = 0; run2 < cp.hessian.getNumCols(); run2++ ){
+
+			const Matrix &Hij = cp.hessian.getSubBlock( run1,run2 );
+			if( Hij.getDim() == 0 ) continue;
+
+			isParameter1 = getStageIndex( run1, stage1, offset1 );
+			isParameter2 = getStageIndex( run2, stage2, offset2 );
+
+			if( isParameter1 == BT_TRUE ) stage1 = stage2;
+			if( isParameter2 == BT_TRUE ) stage2 = stage1;
+
+			if( stage1 != stage2 ){
+				if( Hij.isZero( ) == BT_TRUE ) continue;
+				return ACADOERRORTEXT( RET_NOT_YET_IMPLEMENTED, "Hessian couples different nodes." );
+			}
+
+			for( run3 = 0; run3 < Hij.getNumRows(); run3++ )
+				for( run4 = 0; run4 < Hij.getNumCols(); run4++ )
+					H(stage1*nZ+offset1+run3,offset2+run4) += Hij(run3,run4);
+		}
+	}
+
+
+	// GRADIENT:
+	// ---------
+	g.init( N*nZ );
+	g.setZero( );
+
+	for( run1 = 0; run1 < cp.objectiveGradient.getNumCols(); run1++ ){
+
+		const Matrix &gi = cp.objectiveGradient.getSubBlock( 0,run1 );
+		if( gi.getDim() == 0 ) continue;
+
+		getStageIndex( run1, stage1, offset1 );
+
+		for( run2 = 0; run2 < gi.getNumCols(); run2++ )
+			g(stage1*nZ+offset1+run2) += gi(0,run2);
+	}
+
+
+	// BOUNDS:
+	// -------
+	lb.init( N*nZ );
+	ub.init( N*nZ );
+	lb.setAll( -INFTY );
+	ub.setAll(  INFTY );
+
+	for( run1 = 0; run1 < cp.lowerBoundResiduum.getNumRows(); run1++ ){
+
+		if( getBoundStageIndex( run1, stage1, offset1, dim ) == BT_FALSE ) continue;
+
+		const Matrix &lbi = cp.lowerBoundResiduum.getSubBlock( run1,0 );
+		for( run2 = 0; run2 < lbi.getNumRows(); run2++ )
+			lb(stage1*nZ+offset1+run2) = lbi(run2,0);
+
+		const Matrix &ubi = cp.upperBoundResiduum.getSubBlock( run1,0 );
+		for( run2 = 0; run2 < ubi.getNumRows(); run2++ )
+			ub(stage1*nZ+offset1+run2) = ubi(run2,0);
+	}
+
+
+	// CONSTRAINTS:
+	// ------------
+	// Each constraint row is assigned to the (unique) stage of its non-zero
+	// entries; parameter entries are moved to this stage.
+
+	A.init( nConstraints,nZ );
+	A.setZero( );
+	lbA.init( nConstraints );
+	ubA.init( nConstraints );
+	lbA.setAll( -INFTY );
+	ubA.setAll(  INFTY );
+
+	uint rowOffset = 0;
+
+	for( run1 = 0; run1 < cp.constraintGradient.getNumRows(); run1++ ){
+
+		const uint nRows = (uint) blockDims(run1);
+
+		if ( rowOffset+nRows > nConstraints )
+			return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+		for( run3 = 0; run3 < nRows; run3++ )
+			constraintStage[rowOffset+run3] = N;
+
+		for( run2 = 0; run2 < cp.constraintGradient.getNumCols(); run2++ ){
+
+			const Matrix &Aij = cp.constraintGradient.getSubBlock( run1,run2 );
+			if( ( Aij.getDim() == 0 ) || ( getStageIndex( run2, stage1, offset1 ) == BT_TRUE ) ) continue;
+
+			for( run3 = 0; run3 < Aij.getNumRows(); run3++ ){
+				for( run4 = 0; run4 < Aij.getNumCols(); run4++ ){
+					if( ( Aij(run3,run4) > 0.0 ) || ( Aij(run3,run4) < 0.0 ) ){
+						if( constraintStage[rowOffset+run3] == N )
+							constraintStage[rowOffset+run3] = stage1;
+						else if( constraintStage[rowOffset+run3] != stage1 )
+							return ACADOERRORTEXT( RET_NOT_YET_IMPLEMENTED, "Constraint couples different nodes." );
+						break;
+					}
+				}
+			}
+		}
+
+		for( run3 = 0; run3 < nRows; run3++ )
+			if( constraintStage[rowOffset+run3] == N )
+				constraintStage[rowOffset+run3] = 0;
+
+		for( run2 = 0; run2 < cp.constraintGradient.getNumCols(); run2++ ){
+
+			const Matrix &Aij = cp.constraintGradient.getSubBlock( run1,run2 );
+			if( Aij.getDim() == 0 ) continue;
+
+			isParameter1 = getStageIndex( run2, stage1, offset1 );
+
+			for( run3 = 0; run3 < Aij.getNumRows(); run3++ )
+				if( ( isParameter1 == BT_TRUE ) || ( constraintStage[rowOffset+run3] == stage1 ) )
+					for( run4 = 0; run4 < Aij.getNumCols(); run4++ )
+						A(rowOffset+run3,offset1+run4) += Aij(run3,run4);
+		}
+
+		const Matrix &lbi = cp.lowerConstraintResiduum.getSubBlock( run1,0 );
+		for( run3 = 0; run3 < lbi.getNumRows(); run3++ )
+			lbA(rowOffset+run3) = lbi(run3,0);
+
+		const Matrix &ubi = cp.upperConstraintResiduum.getSubBlock( run1,0 );
+		for( run3 = 0; run3 < ubi.getNumRows(); run3++ )
+			ubA(rowOffset+run3) = ubi(run3,0);
+
+		rowOffset += nRows;
+	}
+
+
+	// DYNAMICS:
+	// ---------
+	// x_{k+1} = G^k * (x_k,p_k,xa_k,u_k,w_k) + b^k
+
+	if ( ( N > 1 ) && ( nX > 0 ) )
+	{
+		G.init( (N-1)*nX,nZ );
+		b.init( (N-1)*nX );
+		G.setZero( );
+		b.setZero( );
+
+		for( run1 = 0; run1 < N-1; run1++ ){
+			for( run2 = 0; run2 < 5; run2++ ){
+
+				const Matrix &Gij = cp.dynGradient.getSubBlock( run1,run2 );
+				if( Gij.getDim() == 0 ) continue;
+
+				getStageIndex( run2*N, stage1, offset1 );
+
+				for( run3 = 0; run3 < Gij.getNumRows(); run3++ )
+					for( run4 = 0; run4 < Gij.getNumCols(); run4++ )
+						G(run1*nX+run3,offset1+run4) = Gij(run3,run4);
+			}
+
+			const Matrix &bi = cp.dynResiduum.getSubBlock( run1,0 );
+			for( run3 = 0; run3 < bi.getNumRows(); run3++ )
+				b(run1*nX+run3) = bi(run3,0);
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::solveQP(	uint maxIter
+													)
+{
+	uint run1, run2, run3, run4;
+
+	const uint N   = getNumPoints();
+	const uint nZ  = getNZ();
+	const uint nX  = getNX();
+	const uint nP  = getNP();
+	const uint nXA = getNXA();
+	const uint nV  = N*nZ;
+	const uint nC  = getNC();
+
+
+	// SPLIT BOUNDS AND CONSTRAINTS INTO EQUALITIES AND INEQUALITIES:
+	// --------------------------------------------------------------
+	// Rows refer to a bound on the stage variable var (row < 0) or to a
+	// constraint row; inequalities read sign*a^T*z_stage >= rhs.
+
+	uint nEq = 0;
+	uint nIn = 0;
+
+	// the stage arrays eqStart, eqPos, offZ and nCpl lead the integer work array
+	reserveWork( uintWork,nUintWork,4*(N+1) );
+
+	uint *eqStart = uintWork;
+	uint *eqPos   = eqStart + N+1;
+	uint *offZ    = eqPos   + N+1;
+	uint *nCpl    = offZ    + N+1;
+
+	for( run1 = 0; run1 < 4*(N+1); run1++ )
+		uintWork[run1] = 0;
+
+	for( run1 = 0; run1 < nV+nC; run1++ ){
+
+		double lo = ( run1 < nV ) ? lb(run1) : lbA(run1-nV);
+		double up = ( run1 < nV ) ? ub(run1) : ubA(run1-nV);
+		uint   stage = ( run1 < nV ) ? run1/nZ : constraintStage[run1-nV];
+
+		if ( ( lo > -IP_INFINITE_BOUND ) && ( up < IP_INFINITE_BOUND ) && ( up - lo <= EQUALITY_EPS ) ){
+			eqStart[stage+1]++;
+			nEq++;
+		}
+		else{
+			if ( lo > -IP_INFINITE_BOUND ) nIn++;
+			if ( up <  IP_INFINITE_BOUND ) nIn++;
+		}
+	}
+
+	for( run1 = 0; run1 < N; run1++ )
+		eqStart[run1+1] += eqStart[run1];
+
+	// enlarging keeps the stage arrays, but may move them
+	reserveWork( uintWork,nUintWork,4*(N+1) + 2*(nEq+1) + 2*(nIn+1) );
+	reserveWork( rowWork,nRowWork,(nEq+1) + (nIn+1) );
+	reserveWork( realWork,nRealWork,(nEq+1) + 2*(nIn+1) );
+
+	eqStart = uintWork;
+	eqPos   = eqStart + N+1;
+	offZ    = eqPos   + N+1;
+	nCpl    = offZ    + N+1;
+
+	uint   *eqStage = nCpl    + N+1;
+	uint   *eqVar   = eqStage + nEq+1;
+	uint   *inStage = eqVar   + nEq+1;
+	uint   *inVar   = inStage + nIn+1;
+
+	int    *eqRow   = rowWork;
+	int    *inRow   = eqRow + nEq+1;
+
+	double *eqRhs   = realWork;
+	double *inSign  = eqRhs  + nEq+1;
+	double *inRhs   = inSign + nIn+1;
+
+	for( run1 = 0; run1 < N; run1++ )
+		eqPos[run1] = eqStart[run1];
+
+	nIn = 0;
+	for( run1 = 0; run1 < nV+nC; run1++ ){
+
+		double lo = ( run1 < nV ) ? lb(run1) : lbA(run1-nV);
+		double up = ( run1 < nV ) ? ub(run1) : ubA(run1-nV);
+		uint   stage = ( run1 < nV ) ? run1/nZ : constraintStage[run1-nV];
+		int    row   = ( run1 < nV ) ? -1 : (int)(run1-nV);
+		uint   var   = ( run1 < nV ) ? run1%nZ : 0;
+
+		if ( ( lo > -IP_INFINITE_BOUND ) && ( up < IP_INFINITE_BOUND ) && ( up - lo <= EQUALITY_EPS ) ){
+			run2 = eqPos[stage]++;
+			eqStage[run2] = stage;  eqRow[run2] = row;  eqVar[run2] = var;  eqRhs[run2] = lo;
+		}
+		else{
+			if ( lo > -IP_INFINITE_BOUND ){
+				inStage[nIn] = stage;  inRow[nIn] = row;  inVar[nIn] = var;  inSign[nIn] =  1.0;  inRhs[nIn] =  lo;
+				nIn++;
+			}
+			if ( up < IP_INFINITE_BOUND ){
+				inStage[nIn] = stage;  inRow[nIn] = row;  inVar[nIn] = var;  inSign[nIn] = -1.0;  inRhs[nIn] = -up;
+				nIn++;
+			}
+		}
+	}
+
+
+	// LAYOUT OF THE KKT SYSTEM:
+	// -------------------------
+	// The KKT system is ordered stage by stage: the stage variables, the
+	// equalities of the stage and the equalities coupling the stage to
+	// the next one (dynamics and copies of the parameters, and of the
+	// controls and disturbances at the last node).
+
+	uint bw = ( nZ > 0 ) ? nZ-1 : 0;
+
+	for( run1 = 0; run1 < N; run1++ ){
+
+		if ( run1+1 < N )
+			nCpl[run1] = nX + nP + ( ( run1+2 == N ) ? getNU() + getNW() : 0 );
+
+		uint nEqStage = eqStart[run1+1] - eqStart[run1];
+
+		offZ[run1+1] = offZ[run1] + nZ + nEqStage + nCpl[run1];
+
+		if ( nZ + nEqStage + nCpl[run1] > bw+1 )
+			bw = nZ + nEqStage + nCpl[run1] - 1;
+	}
+
+	const uint nK = offZ[N];
+	const uint w  = bw+1;
+
+	// the right hand sides of the equalities and inequalities lead the real work array
+	reserveWork( realWork,nRealWork,(nEq+1) + 8*(nIn+1) + 2*nK*w + 7*nK + w );
+
+	eqRhs  = realWork;
+	inSign = eqRhs  + nEq+1;
+	inRhs  = inSign + nIn+1;
+
+	double *s     = inRhs + nIn+1;
+	double *y     = s     + nIn+1;
+	double *ri    = y     + nIn+1;
+	double *ds    = ri    + nIn+1;
+	double *dy    = ds    + nIn+1;
+	double *rsy   = dy    + nIn+1;
+
+	double *K0    = rsy   + nIn+1;
+	double *K     = K0    + nK*w;
+	double *x     = K     + nK*w;
+	double *r     = x     + nK;
+	double *rhs   = r     + nK;
+	double *dx    = rhs   + nK;
+	double *res   = dx    + nK;
+	double *cor   = res   + nK;
+	double *sign  = cor   + nK;
+	double *work  = sign  + nK;
+
+	for( run1 = 0; run1 < nK; run1++ )
+		x[run1] = 0.0;
+
+	// expected signs of the pivots of the quasi-definite KKT matrix
+	for( run1 = 0; run1 < N; run1++ ){
+		for( run2 = offZ[run1]; run2 < offZ[run1]+nZ; run2++ )
+			sign[run2] =  1.0;
+		for( run2 = offZ[run1]+nZ; run2 < offZ[run1+1]; run2++ )
+			sign[run2] = -1.0;
+	}
+
+
+	// INITIAL GUESS:
+	// --------------
+	for( run1 = 0; run1 < nIn; run1++ ){
+		s[run1] = acadoMax( -inRhs[run1],1.0 );
+		y[run1] = 1.0;
+	}
+
+	double scale = 1.0;
+	for( run1 = 0; run1 < g.getDim(); run1++ )
+		scale = acadoMax( scale,1.0+fabs(g(run1)) );
+	for( run1 = 0; run1 < b.getDim(); run1++ )
+		scale = acadoMax( scale,1.0+fabs(b(run1)) );
+
+	const double tol = IP_TOLERANCE*scale;
+
+
+	// PRIMAL-DUAL INTERIOR POINT ITERATIONS:
+	// --------------------------------------
+	returnValue returnvalue = RET_QP_SOLUTION_REACHED_LIMIT;
+	double resP = 0.0;
+
+	for( uint iteration = 0; iteration <= maxIter; iteration++ ){
+
+		// KKT residuals: stationarity H*z + g - E^T*nu - A^T*y,
+		// equalities E*z - e and inequalities sign*A*z - rhs - s
+		for( run1 = 0; run1 < N; run1++ ){
+			for( run2 = 0; run2 < nZ; run2++ ){
+				double value = g(run1*nZ+run2);
+				for( run3 = 0; run3 < nZ; run3++ )
+					value += H(run1*nZ+run2,run3)*x[offZ[run1]+run3];
+				r[offZ[run1]+run2] = value;
+			}
+		}
+
+		for( run1 = 0; run1 < nEq; run1++ ){
+			uint o = offZ[eqStage[run1]];
+			uint R = o + nZ + run1 - eqStart[eqStage[run1]];
+			r[R] = rowTimes( A,eqRow[run1],eqVar[run1],nZ,x+o ) - eqRhs[run1];
+			addRow( A,eqRow[run1],eqVar[run1],nZ,-x[R],r+o );
+		}
+
+		for( run1 = 0; run1+1 < N; run1++ ){
+			uint o  = offZ[run1];
+			uint o1 = offZ[run1+1];
+			uint R  = o1 - nCpl[run1];
+
+			for( run2 = 0; run2 < nCpl[run1]; run2++, R++ ){
+				uint j = ( run2 < nX+nP ) ? run2 : run2+nXA;
+				double value = x[o1+j];
+
+				if ( run2 < nX ){
+					value -= b(run1*nX+run2);
+					for( run3 = 0; run3 < nZ; run3++ ){
+						value        -= G(run1*nX+run2,run3)*x[o+run3];
+						r[o+run3]    += G(run1*nX+run2,run3)*x[R];
+					}
+				}
+				else{
+					value        -= x[o+j];
+					r[o+j]       += x[R];
+				}
+				r[o1+j] -= x[R];
+				r[R]     = value;
+			}
+		}
+
+		double mu = 0.0;
+		for( run1 = 0; run1 < nIn; run1++ ){
+			uint o = offZ[inStage[run1]];
+			ri[run1] = inSign[run1]*rowTimes( A,inRow[run1],inVar[run1],nZ,x+o ) - inRhs[run1] - s[run1];
+			addRow( A,inRow[run1],inVar[run1],nZ,-inSign[run1]*y[run1],r+o );
+			mu += s[run1]*y[run1];
+		}
+		if ( nIn > 0 )
+			mu /= (double) nIn;
+
+		double resD = 0.0;
+		resP = 0.0;
+		for( run1 = 0; run1 < N; run1++ ){
+			for( run2 = offZ[run1]; run2 < offZ[run1]+nZ; run2++ )
+				resD = acadoMax( resD,fabs(r[run2]) );
+			for( run2 = offZ[run1]+nZ; run2 < offZ[run1+1]; run2++ )
+				resP = acadoMax( resP,fabs(r[run2]) );
+		}
+		for( run1 = 0; run1 < nIn; run1++ )
+			resP = acadoMax( resP,fabs(ri[run1]) );
+
+		if ( ( resD <= tol ) && ( resP <= tol ) && ( mu <= tol ) ){
+			returnvalue = SUCCESSFUL_RETURN;
+			break;
+		}
+
+		if ( iteration == maxIter )
+			break;
+
+
+		// Assemble the KKT matrix [ H + A^T*(Y/S)*A, E^T; E, 0 ] and factorize it
+		// with static regularisation (positive for z, negative for nu) and
+		// dynamic regularisation of too small pivots. The regularised factors
+		// only serve as preconditioner of the iterative refinement, which acts
+		// on the unregularised matrix.
+		for( run1 = 0; run1 < nK*w; run1++ )
+			K0[run1] = 0.0;
+
+		for( run1 = 0; run1 < N; run1++ ){
+			uint o = offZ[run1];
+			for( run2 = 0; run2 < nZ; run2++ )
+				for( run3 = 0; run3 <= run2; run3++ )
+					K0[(o+run2)*w+run2-run3] = H(run1*nZ+run2,run3);
+		}
+
+		for( run1 = 0; run1 < nIn; run1++ ){
+			uint   o = offZ[inStage[run1]];
+			double d = y[run1]/s[run1];
+
+			if ( inRow[run1] < 0 ){
+				K0[(o+inVar[run1])*w] += d;
+			}
+			else{
+				for( run2 = 0; run2 < nZ; run2++ ){
+					double a = d*A(inRow[run1],run2);
+					if ( ( a > 0.0 ) || ( a < 0.0 ) )
+						for( run3 = 0; run3 <= run2; run3++ )
+							K0[(o+run2)*w+run2-run3] += a*A(inRow[run1],run3);
+				}
+			}
+		}
+
+		for( run1 = 0; run1 < nEq; run1++ ){
+			uint o = offZ[eqStage[run1]];
+			uint R = o + nZ + run1 - eqStart[eqStage[run1]];
+
+			if ( eqRow[run1] < 0 )
+				K0[R*w+R-o-eqVar[run1]] = 1.0;
+			else
+				for( run2 = 0; run2 < nZ; run2++ )
+					K0[R*w+R-o-run2] = A(eqRow[run1],run2);
+		}
+
+		for( run1 = 0; run1+1 < N; run1++ ){
+			uint o  = offZ[run1];
+			uint o1 = offZ[run1+1];
+			uint R  = o1 - nCpl[run1];
+
+			for( run2 = 0; run2 < nCpl[run1]; run2++, R++ ){
+				uint j = ( run2 < nX+nP ) ? run2 : run2+nXA;
+
+				if ( run2 < nX )
+					for( run3 = 0; run3 < nZ; run3++ )
+						K0[R*w+R-o-run3] = -G(run1*nX+run2,run3);
+				else
+					K0[R*w+R-o-j] = -1.0;
+
+				K0[(o1+j)*w+o1+j-R] = 1.0;
+			}
+		}
+
+		for( run1 = 0; run1 < nK*w; run1++ )
+			K[run1] = K0[run1];
+
+		for( run1 = 0; run1 < nK; run1++ )
+			K[run1*w] += sign[run1]*IP_REGULARISATION;
+
+		const double normK0 = normBand( nK,bw,K0,res );
+
+		if ( factorizeBand( nK,bw,K,sign,work ) != SUCCESSFUL_RETURN ){
+			ACADOWARNING( RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR );
+			returnvalue = RET_QP_SOLUTION_FAILED;
+			break;
+		}
+
+
+		// Predictor (run4 = 0) and corrector (run4 = 1) steps
+		double alpha = 1.0;
+		double sigma = 0.0;
+		BooleanType breakdown = BT_FALSE;
+
+		for( run4 = 0; run4 < 2; run4++ ){
+
+			for( run1 = 0; run1 < nIn; run1++ ){
+				rsy[run1] = s[run1]*y[run1];
+				if ( run4 == 1 )
+					rsy[run1] += ds[run1]*dy[run1] - sigma*mu;
+			}
+
+			for( run1 = 0; run1 < nK; run1++ )
+				rhs[run1] = -r[run1];
+
+			for( run1 = 0; run1 < nIn; run1++ )
+				addRow( A,inRow[run1],inVar[run1],nZ,
+						-inSign[run1]*( rsy[run1] + y[run1]*ri[run1] )/s[run1],
+						rhs+offZ[inStage[run1]] );
+
+			if ( refineBand( nK,bw,K0,normK0,K,rhs,dx,res,cor ) > IP_BREAKDOWN_TOLERANCE ){
+				breakdown = BT_TRUE;
+				break;
+			}
+
+			alpha = 1.0;
+			for( run1 = 0; run1 < nIn; run1++ ){
+				ds[run1] = inSign[run1]*rowTimes( A,inRow[run1],inVar[run1],nZ,dx+offZ[inStage[run1]] ) + ri[run1];
+				dy[run1] = -( rsy[run1] + y[run1]*ds[run1] )/s[run1];
+
+				if ( ds[run1] < 0.0 ) alpha = acadoMin( alpha,-s[run1]/ds[run1] );
+				if ( dy[run1] < 0.0 ) alpha = acadoMin( alpha,-y[run1]/dy[run1] );
+			}
+
+			if ( nIn == 0 )
+				break;
+
+			if ( run4 == 0 ){
+				double muAff = 0.0;
+				for( run1 = 0; run1 < nIn; run1++ )
+					muAff += ( s[run1] + alpha*ds[run1] )*( y[run1] + alpha*dy[run1] );
+				muAff /= (double) nIn;
+
+				sigma = muAff/mu;
+				sigma = sigma*sigma*sigma;
+			}
+		}
+
+		// the KKT system could not be solved accurately
+		if ( breakdown == BT_TRUE ){
+			ACADOWARNING( RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR );
+			returnvalue = RET_QP_SOLUTION_FAILED;
+			break;
+		}
+
+		if ( nIn > 0 )
+			alpha = acadoMin( 1.0,IP_STEP_FRACTION*alpha );
+
+
+		// Update the iterate (the KKT system is solved for -delta nu)
+		for( run1 = 0; run1 < N; run1++ ){
+			for( run2 = offZ[run1]; run2 < offZ[run1]+nZ; run2++ )
+				x[run2] += alpha*dx[run2];
+			for( run2 = offZ[run1]+nZ; run2 < offZ[run1+1]; run2++ )
+				x[run2] -= alpha*dx[run2];
+		}
+
+		for( run1 = 0; run1 < nIn; run1++ ){
+			s[run1] += alpha*ds[run1];
+			y[run1] += alpha*dy[run1];
+		}
+
+		if ( alpha <= 1.0e3*EPS )
+			break;
+	}
+
+	if ( ( returnvalue == RET_QP_SOLUTION_REACHED_LIMIT ) && ( resP > SQRT_EPS*scale ) )
+		returnvalue = RET_QP_INFEASIBLE;
+
+
+	// STORE THE PRIMAL-DUAL SOLUTION:
+	// -------------------------------
+	z.init( nV );
+	yBounds.init( nV );
+	yConstraints.init( nC );
+	yBounds.setZero( );
+	yConstraints.setZero( );
+
+	for( run1 = 0; run1 < N; run1++ )
+		for( run2 = 0; run2 < nZ; run2++ )
+			z(run1*nZ+run2) = x[offZ[run1]+run2];
+
+	for( run1 = 0; run1 < nEq; run1++ ){
+		double nu = x[offZ[eqStage[run1]] + nZ + run1 - eqStart[eqStage[run1]]];
+		if ( eqRow[run1] < 0 ) yBounds( eqStage[run1]*nZ+eqVar[run1] ) = nu;
+		else                   yConstraints( eqRow[run1] ) = nu;
+	}
+
+	for( run1 = 0; run1 < nIn; run1++ ){
+		if ( inRow[run1] < 0 ) yBounds( inStage[run1]*nZ+inVar[run1] ) += inSign[run1]*y[run1];
+		else                   yConstraints( inRow[run1] ) += inSign[run1]*y[run1];
+	}
+
+	if ( ( N > 1 ) && ( nX > 0 ) ){
+		yDynamics.init( (N-1)*nX );
+		for( run1 = 0; run1+1 < N; run1++ )
+			for( run2 = 0; run2 < nX; run2++ )
+				yDynamics(run1*nX+run2) = x[offZ[run1+1]-nCpl[run1]+run2];
+	}
+
+
+	return returnvalue;
+}
+
+
+
+returnValue InteriorPointBasedCPsolver::expand(	BandedCP& cp
+												)
+{
+	uint run1, run2;
+	uint stage, offset, dim;
+
+	const uint N  = getNumPoints();
+	const uint nZ = getNZ();
+	const uint nX = getNX();
+
+	const uint blockDim[5] = { getNX(), getNXA(), getNP(), getNU(), getNW() };
+
+	Matrix tmp;
+
+
+	// PRIMAL SOLUTION:
+	// ----------------
+	cp.deltaX.init( 5*N, 1 );
+
+	for( run1 = 0; run1 < 5*N; run1++ ){
+
+		getStageIndex( run1, stage, offset );
+
+		if( blockDim[run1/N] == 0 ) continue;
+
+		tmp.init( blockDim[run1/N], 1 );
+		for( run2 = 0; run2 < blockDim[run1/N]; run2++ )
+			tmp(run2,0) = z(stage*nZ+offset+run2);
+		cp.deltaX.setDense( run1, 0, tmp );
+	}
+
+
+	// MULTIPLIERS OF THE DYNAMICS:
+	// ----------------------------
+	if( nX != 0 ){
+
+		int dynMode;
+		get( DYNAMIC_SENSITIVITY, dynMode );
+
+		cp.lambdaDynamic.init( N-1, 1 );
+
+		for( run1 = 0; run1+1 < N; run1++ ){
+			tmp.init( nX, 1 );
+
+			if( dynMode == FORWARD_SENSITIVITY_LIFTED )
+				tmp.setAll(1.0/((double) nX));
+			else
+				for( run2 = 0; run2 < nX; run2++ )
+					tmp(run2,0) = yDynamics(run1*nX+run2);
+
+			cp.lambdaDynamic.setDense( run1, 0, tmp );
+		}
+	}
+
+
+	// MULTIPLIERS OF THE CONSTRAINTS:
+	// -------------------------------
+    cp.lambdaConstraint.init( blockDims.getDim(), 1 );
+
+    uint rowOffset = 0;
+    for( run1 = 0; run1 < blockDims.getDim(); run1++ ){
+        tmp.init( (uint) blockDims(run1), 1 );
+
+        for( run2 = 0; run2 < (uint) blockDims(run1); run2++ )
+            tmp(run2,0) = yConstraints(rowOffset+run2);
+
+        cp.lambdaConstraint.setDense( run1, 0, tmp );
+        rowOffset += (uint) blockDims(run1);
+    }
+
+
+	// MULTIPLIERS OF THE BOUNDS:
+	// --------------------------
+    cp.lambdaBound.init( 4*N+1, 1 );
+
+	for( run1 = 0; run1 < 4*N+1; run1++ ){
+
+		if( ( getBoundStageIndex( run1, stage, offset, dim ) == BT_FALSE ) || ( dim == 0 ) ) continue;
+
+		tmp.init( dim, 1 );
+		for( run2 = 0; run2 < dim; run2++ )
+			tmp(run2,0) = yBounds(stage*nZ+offset+run2);
+		cp.lambdaBound.setDense( run1, 0, tmp );
+	}
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
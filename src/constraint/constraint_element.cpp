@@ -152,11 +152,16 @@ ConstraintElement::ConstraintElement( const ConstraintElement& rhs ){
     if( rhs.t_index != 0 )  t_index = new int     [nFcn];
     else                    t_index = 0                 ;
 
-	if( rhs.z       != 0 )  z       = new EvaluationPoint( *(rhs.z) );
+	if( rhs.z       != 0 )  z       = new EvaluationPoint[nFcn];
 	else                    z       = 0                 ;
 
-	if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint( *(rhs.JJ) );
+	if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint[nFcn];
 	else                    JJ      = 0                 ;
+
+	for( run1 = 0; run1 < nFcn; run1++ ){
+	    if( z  != 0 ) z [run1] = rhs.z [run1];
+	    if( JJ != 0 ) JJ[run1] = rhs.JJ[run1];
+	}
 	
     nx      = rhs.nx;
     na      = rhs.na;
@@ -380,12 +385,17 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
         if( rhs.t_index != 0 )  t_index = new int     [nFcn];
         else                    t_index = 0                 ;
 
-		if( rhs.z       != 0 )  z       = new EvaluationPoint( *(rhs.z) );
+		if( rhs.z       != 0 )  z       = new EvaluationPoint[nFcn];
 		else                    z       = 0                 ;
 
-		if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint( *(rhs.JJ) );
+		if( rhs.JJ      != 0 )  JJ      = new EvaluationPoint[nFcn];
 		else                    JJ      = 0                 ;
 
+		for( run1 = 0; run1 < nFcn; run1++ ){
+		    if( z  != 0 ) z [run1] = rhs.z [run1];
+		    if( JJ != 0 ) JJ[run1] = rhs.JJ[run1];
+		}
+
         nx      = rhs.nx;
         na      = rhs.na;
         nu      = rhs.nu;
@@ -478,7 +488,8 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
 returnValue ConstraintElement::init(  const OCPiterate& iter ){
 
     int run1, run2;
-	
+    int nyOld = ny;
+
 	initializeEvaluationPoints( iter );
 	
 
@@ -501,8 +512,10 @@ returnValue ConstraintElement::init(  const OCPiterate& iter ){
 
     for( run2 = 0; run2 < nFcn; run2++ ){
 
-        if( y_index[run2] != 0 )  delete[] y_index[run2];
+        if( y_index[run2] == 0 || ny != nyOld ){
+            if( y_index[run2] != 0 )  delete[] y_index[run2];
             y_index[run2]       = new      int[ny]      ;
+        }
 
         for( run1 = 0; run1 < nx; run1++ )
             y_index[run2][run1] = fcn[run2].index( VT_DIFFERENTIAL_STATE, run1 );
@@ -650,8 +663,8 @@ returnValue ConstraintElement::setBackwardSeed( BlockMatrix *seed, int order ){
     if( order == 1 ){
 
         if( seed != 0 ){
-            if( bSeed != 0 ) delete bSeed;
-            bSeed = new BlockMatrix(*seed);
+            if( bSeed != 0 ) *bSeed = *seed;
+            else              bSeed = new BlockMatrix(*seed);
         }
         else{
             if( bSeed != 0 ) delete bSeed;
@@ -729,14 +742,12 @@ returnValue ConstraintElement::getBackwardSensitivities( BlockMatrix *D, int ord
 
 returnValue ConstraintElement::initializeEvaluationPoints( const OCPiterate& iter )
 {
-	if ( z != 0 )
-		delete[] z;
-	
-	if ( JJ != 0 )
-		delete[] JJ;
+	// the evaluation points keep their storage if the dimensions do not change
+	if ( z == 0 )
+		z = new EvaluationPoint[nFcn];
 
-	z = new EvaluationPoint[nFcn];
-	JJ = new EvaluationPoint[nFcn];
+	if ( JJ == 0 )
+		JJ = new EvaluationPoint[nFcn];
 	//HH = new EvaluationPoint[nFcn];
 
 	for( int i=0; i<nFcn; ++i )
@@ -83,26 +83,28 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
 
     if( nc == 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
-    residuumL.init(T+1,1);
-    residuumU.init(T+1,1);
+    if( (int) residuumL.getNumRows() != T+1 || residuumL.getNumCols() != 1 )
+        residuumL.init(T+1,1);
 
-    for( run1 = 0; run1 <= T; run1++ ){
+    if( (int) residuumU.getNumRows() != T+1 || residuumU.getNumCols() != 1 )
+        residuumU.init(T+1,1);
 
-        Matrix resL( nc, 1 );
-        Matrix resU( nc, 1 );
+    resultBuffer.init( nc );
 
-		z[0].setZ( run1, iter );
-		Vector result = fcn[0].evaluate( z[0],run1 );
+    for( run1 = 0; run1 <= T; run1++ ){
 
-        for( run2 = 0; run2 < nc; run2++ ){
-             resL( run2, 0 ) = lb[run1][run2] - result(run2);
-             resU( run2, 0 ) = ub[run1][run2] - result(run2);
-        }
+		z[0].setZ( run1, iter );
+		fcn[0].evaluate( run1, z[0].getEvaluationPointer(), resultBuffer.getDoublePointer() );
 
         // STORE THE RESULTS:
         // ------------------
-        residuumL.setDense( run1, 0, resL );
-        residuumU.setDense( run1, 0, resU );
+        Matrix &resL = residuumL.getDenseBlock( run1, 0, nc, 1 );
+        Matrix &resU = residuumU.getDenseBlock( run1, 0, nc, 1 );
+
+        for( run2 = 0; run2 < nc; run2++ ){
+             resL( run2, 0 ) = lb[run1][run2] - resultBuffer(run2);
+             resU( run2, 0 ) = ub[run1][run2] - resultBuffer(run2);
+        }
     }
 
     return SUCCESSFUL_RETURN;
@@ -112,12 +114,13 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
 returnValue PathConstraint::evaluateSensitivities(){
 
 
-    int run1, run3;
+    int run1, run2, run3;
     returnValue returnvalue;
 
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
     const int N  = grid.getNumPoints();
+    const int nc = fcn[0].getDim();
 
     // EVALUATION OF THE SENSITIVITIES:
     // --------------------------------
@@ -131,50 +134,44 @@ returnValue PathConstraint::evaluateSensitivities(){
 
 		int nBDirs;
 
-        dBackward.init( N, 5*N );
+        if( (int) dBackward.getNumRows() != N || (int) dBackward.getNumCols() != 5*N )
+            dBackward.init( N, 5*N );
 
+        seedBuffer.init( nc );
 
         for( run3 = 0; run3 < N; run3++ )
 		{
-            Matrix bseed_;
-            bSeed->getSubBlock( 0, run3, bseed_);
+            const Matrix &bseed_ = bSeed->getSubBlock( 0, run3 );
 			
             nBDirs = bSeed->getNumRows( 0, run3 );
 
-            Matrix Dx ( nBDirs, nx );
-            Matrix Dxa( nBDirs, na );
-            Matrix Dp ( nBDirs, np );
-            Matrix Du ( nBDirs, nu );
-            Matrix Dw ( nBDirs, nw );
+            // the derivatives are written into the blocks in place:
+            Matrix *Dx  = nx > 0 ? &dBackward.getDenseBlock( run3,     run3, nBDirs, nx ) : 0;
+            Matrix *Dxa = na > 0 ? &dBackward.getDenseBlock( run3,   N+run3, nBDirs, na ) : 0;
+            Matrix *Dp  = np > 0 ? &dBackward.getDenseBlock( run3, 2*N+run3, nBDirs, np ) : 0;
+            Matrix *Du  = nu > 0 ? &dBackward.getDenseBlock( run3, 3*N+run3, nBDirs, nu ) : 0;
+            Matrix *Dw  = nw > 0 ? &dBackward.getDenseBlock( run3, 4*N+run3, nBDirs, nw ) : 0;
 
 			for( run1 = 0; run1 < nBDirs; run1++ )
 			{
-				ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1),JJ[0],run3 ) );
-		
-				if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
-				if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
-				if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
-				if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
-				if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
-				
-				JJ[0].setZero( );
+				for( run2 = 0; run2 < nc; run2++ )
+					seedBuffer(run2) = bseed_(run1,run2);
 
-            }
+				if( fcn[0].ADisSupported() == BT_TRUE )
+					ACADO_TRY( fcn[0].AD_backward( run3,seedBuffer.getDoublePointer(),JJ[0].getEvaluationPointer() ) );
+				else
+					ACADO_TRY( fcn[0].AD_backward( seedBuffer,JJ[0],run3 ) );
 
-			if( nx > 0 )
-				dBackward.setDense( run3,     run3, Dx );
+				const double *df = JJ[0].getEvaluationPointer();
 
-			if( na > 0 )
-				dBackward.setDense( run3,   N+run3, Dxa );
+				for( run2 = 0; run2 < nx; run2++ ) Dx ->operator()( run1,run2 ) = df[y_index[0][            run2]];
+				for( run2 = 0; run2 < na; run2++ ) Dxa->operator()( run1,run2 ) = df[y_index[0][nx+         run2]];
+				for( run2 = 0; run2 < np; run2++ ) Dp ->operator()( run1,run2 ) = df[y_index[0][nx+na+      run2]];
+				for( run2 = 0; run2 < nu; run2++ ) Du ->operator()( run1,run2 ) = df[y_index[0][nx+na+np+   run2]];
+				for( run2 = 0; run2 < nw; run2++ ) Dw ->operator()( run1,run2 ) = df[y_index[0][nx+na+np+nu+run2]];
 
-			if( np > 0 )
-				dBackward.setDense( run3, 2*N+run3, Dp );
-
-			if( nu > 0 )
-				dBackward.setDense( run3, 3*N+run3, Du );
-
-			if( nw > 0 )
-				dBackward.setDense( run3, 4*N+run3, Dw );
+				JJ[0].setZero( );
+            }
         }
 
 		return SUCCESSFUL_RETURN;
@@ -197,24 +194,25 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
 
     dBackward.init( N, 5*N );
 
+    int run1, run2;
+
+    double *bseed1 = new double[nc];
+    double *bseed2 = new double[nc];
+    double *R      = new double[nc];
+    double *J      = new double[fcn[0].getNumberOfVariables() +1];
+    double *H      = new double[fcn[0].getNumberOfVariables() +1];
+    double *fseed  = new double[fcn[0].getNumberOfVariables() +1];
+
+    Matrix seed;
+
     for( run3 = 0; run3 < N; run3++ ){
 
-        Matrix seed;
         seed_.getSubBlock( count, 0, seed, nc, 1 );
         count++;
 
         // EVALUATION OF THE SENSITIVITIES:
         // --------------------------------
 
-        int run1, run2;
-
-        double *bseed1 = new double[nc];
-        double *bseed2 = new double[nc];
-        double *R      = new double[nc];
-        double *J      = new double[fcn[0].getNumberOfVariables() +1];
-        double *H      = new double[fcn[0].getNumberOfVariables() +1];
-        double *fseed  = new double[fcn[0].getNumberOfVariables() +1];
-
         for( run1 = 0; run1 < nc; run1++ ){
             bseed1[run1] = seed(run1,0);
             bseed2[run1] = 0.0;
@@ -445,14 +443,15 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
             if( nw > 0 ) hessian.addDense( 4*N+run3, 4*N + run3, Hw  );
         }
 
-        delete[] bseed1;
-        delete[] bseed2;
-        delete[] R     ;
-        delete[] J     ;
-        delete[] H     ;
-        delete[] fseed ;
     }
 
+    delete[] bseed1;
+    delete[] bseed2;
+    delete[] R     ;
+    delete[] J     ;
+    delete[] H     ;
+    delete[] fseed ;
+
 
     return SUCCESSFUL_RETURN;
 }
@@ -51,6 +51,9 @@ Controller::Controller( ) : SimulationBlock( BN_CONTROLLER )
 	referenceTrajectory = 0;
 	
 	isEnabled = BT_TRUE;
+
+	hasPendingPreparation  = BT_FALSE;
+	pendingPreparationTime = 0.0;
 	
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -83,6 +86,9 @@ Controller::Controller(	ControlLaw& _controlLaw,
 		referenceTrajectory = 0;
 	
 	isEnabled = BT_TRUE;
+
+	hasPendingPreparation  = BT_FALSE;
+	pendingPreparationTime = 0.0;
 	
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -111,6 +117,9 @@ Controller::Controller(	ControlLaw& _controlLaw,
 		referenceTrajectory = 0;
 	
 	isEnabled = BT_TRUE;
+
+	hasPendingPreparation  = BT_FALSE;
+	pendingPreparationTime = 0.0;
 	
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -134,6 +143,10 @@ Controller::Controller( const Controller& rhs ) : SimulationBlock( rhs )
 		referenceTrajectory = 0;
 	
 	isEnabled = rhs.isEnabled;
+
+	hasPendingPreparation  = rhs.hasPendingPreparation;
+	pendingPreparationTime = rhs.pendingPreparationTime;
+	pendingReference       = rhs.pendingReference;
 }
 
 
@@ -181,6 +194,10 @@ Controller& Controller::operator=( const Controller& rhs )
 			referenceTrajectory = 0;
 		
 		isEnabled = rhs.isEnabled;
+
+		hasPendingPreparation  = rhs.hasPendingPreparation;
+		pendingPreparationTime = rhs.pendingPreparationTime;
+		pendingReference       = rhs.pendingReference;
 	}
 
     return *this;
@@ -325,6 +342,8 @@ returnValue Controller::init(	double startTime,
 			return ACADOERROR( RET_BLOCK_DIMENSION_MISMATCH );
 	}
 
+	hasPendingPreparation = BT_FALSE;
+
 	realClock.reset( );
 	setStatus( BS_READY );
 
@@ -349,6 +368,7 @@ returnValue Controller::step(	double currentTime,
 	if ( isEnabled == BT_FALSE )
 	{
 		logCollection.setLast( LOG_TIME_CONTROLLER,0.0 );
+		logCollection.setLast( LOG_TIME_CONTROLLER_FEEDBACK,0.0 );
 		logCollection.setLast( LOG_TIME_CONTROL_LAW,0.0 );
 		logCollection.setLast( LOG_TIME_ESTIMATOR,0.0 );
 		return SUCCESSFUL_RETURN;
@@ -358,7 +378,19 @@ returnValue Controller::step(	double currentTime,
 		return ACADOERROR( RET_CONTROLLER_STEP_FAILED );
 
 	double nextTime = currentTime + controlLaw->getSamplingTime( );
-		
+
+	int useAsynchronousPreparation;
+	get( USE_ASYNCHRONOUS_PREPARATION,useAsynchronousPreparation );
+
+	/* Postpone preparation step such that it overlaps with waiting for the next process output */
+	if ( (BooleanType)useAsynchronousPreparation == BT_TRUE )
+	{
+		hasPendingPreparation  = BT_TRUE;
+		pendingPreparationTime = nextTime;
+		pendingReference       = _yRef;
+		return SUCCESSFUL_RETURN;
+	}
+
 	if ( preparationStep( nextTime,_yRef ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_CONTROLLER_STEP_FAILED );
 
@@ -424,6 +456,10 @@ returnValue Controller::feedbackStep(	double currentTime,
 										const VariablesGrid& _yRef
 										)
 {
+	/* Complete a still pending preparation step before new feedback can be given */
+	if ( finishPreparationStep( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLER_STEP_FAILED );
+
 	realClock.reset( );
 	
 	if ( controlLaw == 0 )
@@ -458,6 +494,7 @@ returnValue Controller::feedbackStep(	double currentTime,
 
 	controlLawClock.stop();
 	realClock.stop( );
+	logCollection.setLast( LOG_TIME_CONTROLLER_FEEDBACK,realClock.getTime() );
 
 	#ifdef SIM_DEBUG
 	Vector uTmp;
@@ -473,6 +510,9 @@ returnValue Controller::preparationStep(	double nextTime,
 											const VariablesGrid& _yRef
 											)
 {
+	/* An explicit preparation step replaces the pending one */
+	hasPendingPreparation = BT_FALSE;
+
 	if ( controlLaw == 0 )
 		return ACADOERROR( RET_NO_CONTROLLAW_SPECIFIED );
 
@@ -512,6 +552,15 @@ returnValue Controller::preparationStep(	double nextTime,
 }
 
 
+returnValue Controller::finishPreparationStep( )
+{
+	if ( hasPendingPreparation == BT_FALSE )
+		return SUCCESSFUL_RETURN;
+
+	return preparationStep( pendingPreparationTime,pendingReference );
+}
+
+
 
 double Controller::getNextSamplingInstant(	double currentTime
 											)
@@ -548,6 +597,7 @@ double Controller::getNextSamplingInstant(	double currentTime
 returnValue Controller::setupOptions( )
 {
 	addOption( USE_REFERENCE_PREDICTION,defaultUseReferencePrediction );
+	addOption( USE_ASYNCHRONOUS_PREPARATION,defaultUseAsynchronousPreparation );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -559,6 +609,7 @@ returnValue Controller::setupLogging( )
 
 	tmp.addItem( LOG_FEEDBACK_CONTROL );
 	tmp.addItem( LOG_TIME_CONTROLLER );
+	tmp.addItem( LOG_TIME_CONTROLLER_FEEDBACK );
 	tmp.addItem( LOG_TIME_ESTIMATOR );
 	tmp.addItem( LOG_TIME_CONTROL_LAW );
 
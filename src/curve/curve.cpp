@@ -46,6 +46,8 @@ Curve::Curve( ){
     nIntervals       = 0;
     dim              = 0;
     parameterization = 0;
+    coefficients     = 0;
+    capacity         = 0;
     grid             = 0;
 }
 
@@ -55,14 +57,19 @@ Curve::Curve( const Curve& arg ){
 
     nIntervals       = arg.nIntervals;
     dim              = arg.dim       ;
+    capacity         = arg.nIntervals;
 
     parameterization = (Function**)calloc(nIntervals,sizeof(Function*));
+    coefficients     = (double*)calloc(4*dim*nIntervals,sizeof(double));
 
     for( run1 = 0; run1 < nIntervals; run1++ ){
         if( arg.parameterization[run1] != 0 ) parameterization[run1] = new Function(*arg.parameterization[run1]);
         else                                  parameterization[run1] = 0;
     }
 
+    for( run1 = 0; run1 < 4*dim*nIntervals; run1++ )
+        coefficients[run1] = arg.coefficients[run1];
+
     if( arg.grid != 0 )  grid = new Grid(*arg.grid);
     else                 grid = 0;
 }
@@ -77,6 +84,7 @@ Curve::~Curve( ){
             delete parameterization[run1];
 
      if( parameterization != 0 ) free(parameterization);
+     if( coefficients     != 0 ) free(coefficients);
      if( grid != 0 ) delete grid;
 }
 
@@ -92,17 +100,23 @@ Curve& Curve::operator=( const Curve& arg ){
                 delete parameterization[run1];
 
         if( parameterization != 0 ) free(parameterization);
+        if( coefficients     != 0 ) free(coefficients);
         if( grid != 0 ) delete grid;
 
         nIntervals       = arg.nIntervals;
         dim              = arg.dim       ;
+        capacity         = arg.nIntervals;
         parameterization = (Function**)calloc(nIntervals,sizeof(Function*));
+        coefficients     = (double*)calloc(4*dim*nIntervals,sizeof(double));
 
         for( run1 = 0; run1 < nIntervals; run1++ ){
             if( arg.parameterization[run1] != 0 ) parameterization[run1] = new Function(*arg.parameterization[run1]);
             else                                  parameterization[run1] = 0;
         }
 
+        for( run1 = 0; run1 < 4*dim*nIntervals; run1++ )
+            coefficients[run1] = arg.coefficients[run1];
+
         if( arg.grid != 0 )  grid = new Grid(*arg.grid);
         else                 grid = 0;
     }
@@ -121,15 +135,25 @@ Curve Curve::operator()(	uint idx
 		return tmp;
 	}
 
-    uint run1;
+    uint run1, run2;
+
+	// symbolic pieces keep the dimension of the curve
+	tmp.dim = 1;
+	for( run1 = 0; run1 < nIntervals; run1++ )
+		if( parameterization[run1] != 0 )
+			tmp.dim = dim; // -> 1!
 
 	tmp.nIntervals       = nIntervals;
-	tmp.dim              = dim         ; // -> 1!
+	tmp.capacity         = nIntervals;
 	tmp.parameterization = (Function**)calloc(nIntervals,sizeof(Function*));
+	tmp.coefficients     = (double*)calloc(4*tmp.dim*nIntervals,sizeof(double));
 
 	for( run1 = 0; run1 < nIntervals; run1++ ){
 		if( parameterization[run1] != 0 ) tmp.parameterization[run1] = new Function( parameterization[run1]->operator()( idx ) );
 		else                              tmp.parameterization[run1] = 0;
+
+		for( run2 = 0; run2 < 4; run2++ )
+			tmp.coefficients[4*tmp.dim*run1+run2] = coefficients[4*(dim*run1+idx)+run2];
 	}
 
 	if( grid != 0 )  tmp.grid = new Grid(*grid);
@@ -141,16 +165,22 @@ Curve Curve::operator()(	uint idx
 
 returnValue Curve::add( double tStart, double tEnd, const Vector constant ){
 
-    uint     run1;
-    Function tmp ;
+    uint        run1       ;
+    returnValue returnvalue;
 
-    // CONSTRUCT SIMPLY A CONSTANT FUNCTION AND ADD IT:
-    // ------------------------------------------------
+    // STORE A CONSTANT POLYNOMIAL PIECE:
+    // ----------------------------------
+
+    returnvalue = appendInterval( tStart, tEnd, constant.getDim() );
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    double *c = &(coefficients[4*dim*(nIntervals-1)]);
 
-    for( run1 = 0; run1 < constant.getDim(); run1++ )
-         tmp << constant(run1);
+    for( run1 = 0; run1 < dim; run1++ )
+        c[4*run1] = constant(run1);
 
-    return add( tStart, tEnd, tmp );
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -158,41 +188,42 @@ returnValue Curve::add( const VariablesGrid& sampledData, InterpolationMode mode
 
     uint         run1,run2  ;
     returnValue  returnvalue;
-    Function    *tmp        ;
-    TIME         t          ;
-    double       m,b        ;
+    double      *c          ;
+
+    uint nPoints = sampledData.getNumPoints();
+    uint nRows   = sampledData.getNumRows();
 
     switch( mode ){
 
         case IM_CONSTANT:
-             for( run1 = 0; run1 < sampledData.getNumPoints()-1; run1++ ){
-                 tmp = new Function();
-                 for( run2 = 0; run2 < sampledData.getNumRows(); run2++ )
-                     tmp->operator<<( sampledData(run1,run2) );
-                 returnvalue = add( sampledData.getTime(run1), sampledData.getTime(run1+1), *tmp );
-                 if( returnvalue != SUCCESSFUL_RETURN )
+             reserveIntervals( nIntervals + nPoints );
+             for( run1 = 0; run1+1 < nPoints; run1++ ){
+                 returnvalue = appendInterval( sampledData.getTime(run1), sampledData.getTime(run1+1), nRows );
+                 if( returnvalue != SUCCESSFUL_RETURN ){
                      ACADOERROR(returnvalue);
-                 delete tmp;
+                     continue;
+                 }
+                 c = &(coefficients[4*dim*(nIntervals-1)]);
+                 for( run2 = 0; run2 < nRows; run2++ )
+                     c[4*run2] = sampledData(run1,run2);
              }
              return SUCCESSFUL_RETURN;
 
 
         case IM_LINEAR:
-             for( run1 = 0; run1 < sampledData.getNumPoints()-1; run1++ ){
-                 tmp = new Function();
-                 for( run2 = 0; run2 < sampledData.getNumRows(); run2++ ){
-
-                     m = (sampledData(run1+1,run2)    - sampledData(run1,run2)   )/
-                         (sampledData.getTime(run1+1) - sampledData.getTime(run1));
-
-                     b = sampledData(run1,run2) - m*sampledData.getTime(run1);
-
-                     tmp->operator<<( m*t + b );
-                 }
-                 returnvalue = add( sampledData.getTime(run1), sampledData.getTime(run1+1), *tmp );
-                 if( returnvalue != SUCCESSFUL_RETURN )
+             reserveIntervals( nIntervals + nPoints );
+             for( run1 = 0; run1+1 < nPoints; run1++ ){
+                 returnvalue = appendInterval( sampledData.getTime(run1), sampledData.getTime(run1+1), nRows );
+                 if( returnvalue != SUCCESSFUL_RETURN ){
                      ACADOERROR(returnvalue);
-                 delete tmp;
+                     continue;
+                 }
+                 c = &(coefficients[4*dim*(nIntervals-1)]);
+                 for( run2 = 0; run2 < nRows; run2++ ){
+                     c[4*run2  ] = sampledData(run1,run2);
+                     c[4*run2+1] = (sampledData(run1+1,run2)    - sampledData(run1,run2)   )/
+                                   (sampledData.getTime(run1+1) - sampledData.getTime(run1));
+                 }
              }
              return SUCCESSFUL_RETURN;
 
@@ -201,7 +232,7 @@ returnValue Curve::add( const VariablesGrid& sampledData, InterpolationMode mode
              return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
 
         case IM_CUBIC:
-             return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+             return addCubicSpline( sampledData );
 
         default:
              return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
@@ -213,63 +244,7 @@ returnValue Curve::add( const VariablesGrid& sampledData, InterpolationMode mode
 
 returnValue Curve::add( double tStart, double tEnd, const Function &parameterization_ ){
 
-    uint run1;
-
-    // CHECK WHETHER  "tStart < tEnd": 
-    // ------------------------------------------------
-    if( acadoIsStrictlyGreater( tStart,tEnd ) == BT_TRUE )
-        return ACADOERROR(RET_TIME_INTERVAL_NOT_VALID);
-
-
-    // CHECK WHETHER THE INPUT VECTOR IS EMPTY: 
-    // ------------------------------------------------
-    if( parameterization_.getDim() == 0 )
-        return ACADOERROR(RET_INPUT_DIMENSION_MISMATCH);
-
-
-
-    if( isEmpty() == BT_FALSE ){
-
-        // IF THE CURVE IS NOT EMPTY THE DIMENSIONS MUST BE CHECKED:
-        // ---------------------------------------------------------
-        if( getDim() != (int) parameterization_.getDim() )
-            return ACADOERROR(RET_INPUT_DIMENSION_MISMATCH);
-
-        // CHECK WHETHER THE CURVE HAS NO GAP's:
-        // ---------------------------------------------------------
-        if( acadoIsEqual( tStart,grid->getLastTime() ) == BT_FALSE )
-		{
-			ASSERT(1==0);
-            return ACADOERROR(RET_TIME_INTERVAL_NOT_VALID);
-		}
-
-        // APPEND THE NEW TIME INTERVAL TO THE GRID:
-        // ---------------------------------------------------------
-
-        double *times = new double[nIntervals+2];
-        for( run1 = 0; run1 < nIntervals+1; run1++ )        
-            times[run1] = grid->getTime(run1);
-        times[nIntervals+1] = tEnd;
-
-        delete grid;
-        grid = new Grid( nIntervals+2, times );
-
-        nIntervals++;
-        delete[] times;
-
-        // ---------------------------------------------------------
-    }
-    else{
-
-        // SETUP A NEW GRID:
-        // ----------------------------------------------------
-
-        grid = new Grid( tStart, tEnd, 2 );
-        nIntervals++;
-
-        // ----------------------------------------------------
-    }
-
+    returnValue returnvalue;
 
     // CHECK WHETHER THE FUNCTION ITSELF IS VALID:
     // -------------------------------------------
@@ -284,17 +259,11 @@ returnValue Curve::add( double tStart, double tEnd, const Function &parameteriza
     }
 
 
-    // SET THE DIMENSION OF THE CURVE:
-    // (the correctness of the dimension has already been cecked)
-    // ----------------------------------------------------------
-
-    dim = parameterization_.getDim();
-
-
-    // ALLOCATE MEMORY FOR THE NEW PIECE OF CURVE:
-    // -------------------------------------------
-
-    parameterization = (Function**)realloc(parameterization,nIntervals*sizeof(Function*));
+    // APPEND THE NEW TIME INTERVAL:
+    // -----------------------------
+    returnvalue = appendInterval( tStart, tEnd, parameterization_.getDim() );
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
 
 
     // MAKE A DEEP COPY OF THE PARAMETERIZATION:
@@ -333,18 +302,16 @@ returnValue Curve::evaluate( double t, double *result ) const{
         return ACADOERROR(RET_INVALID_ARGUMENTS);
 
 
-    // OBTAIN THE INTERVAL INDEX:
-    // --------------------------
+    // OBTAIN THE INTERVAL INDEX (BY BISECTION):
+    // -----------------------------------------
 
     idx = grid->getFloorIndex(t);
     if( idx == nIntervals ) idx--;
 
 
-    // EVALUATE THE FUNCTION ASSOCIATED WITH THIS INTERVAL:
-    // ----------------------------------------------------
-    double tt[1] = { t };
-    returnvalue = parameterization[idx]->evaluate(0,tt,result);
-
+    // EVALUATE THE PIECE ASSOCIATED WITH THIS INTERVAL:
+    // -------------------------------------------------
+    returnvalue = evaluatePiece( idx,t,result );
 
     if( returnvalue != SUCCESSFUL_RETURN )
         return ACADOERROR(returnvalue);
@@ -355,23 +322,12 @@ returnValue Curve::evaluate( double t, double *result ) const{
 
 returnValue Curve::evaluate( double t, Vector &result ) const{
 
-    uint        run1       ;
-    returnValue returnvalue;
-
-    double *tmp = new double[dim];
-
-    returnvalue = evaluate( t, tmp );
-
-    if( returnvalue != SUCCESSFUL_RETURN )
-        return returnvalue;
+    if( isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
     result.init(dim);
-    for( run1 = 0; run1 < dim; run1++ )
-        result(run1) = tmp[run1];
-
-     delete[] tmp;
 
-    return SUCCESSFUL_RETURN;
+    return evaluate( t, result.getDoublePointer() );
 }
 
 
@@ -390,18 +346,53 @@ returnValue Curve::evaluate( double tStart, double tEnd, VariablesGrid &result )
 
 returnValue Curve::discretize( const Grid &discretizationGrid, VariablesGrid &result ) const{
 
-    uint        run1       ;
+    uint        run1, run2 ;
+    uint        idx        ;
     returnValue returnvalue;
-    Vector      tmp        ;
+    double      t          ;
+
+    if( ( isEmpty() == BT_TRUE ) && ( discretizationGrid.getNumPoints() > 0 ) )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
     result.init( dim, discretizationGrid );
 
+    double *tmp = (double*)calloc(dim,sizeof(double));
+
+    // EVALUATE ALL GRID POINTS IN ONE PASS: FOR SORTED GRIDS THE
+    // INTERVAL INDEX IS ONLY MOVED FORWARD, OTHERWISE IT IS SEARCHED.
+    // PIECES ARE HALF-OPEN [t_i,t_{i+1}) AS IN Grid::getFloorIndex:
+    // ---------------------------------------------------------------
+    idx = 0;
+
     for( run1 = 0; run1 < discretizationGrid.getNumPoints(); run1++ ){
-        returnvalue = evaluate( discretizationGrid.getTime(run1), tmp );
-        if( returnvalue != SUCCESSFUL_RETURN )
-            return returnvalue;
-        result.setVector(run1,tmp);
+
+        t = discretizationGrid.getTime(run1);
+
+        if( (t > grid->getLastTime() + 100.0*EPS) || (t < grid->getFirstTime() - 100.0*EPS) ){
+            free(tmp);
+            return ACADOERROR(RET_INVALID_TIME_POINT);
+        }
+
+        if( ( run1 == 0 ) || ( acadoIsStrictlyGreater( grid->getTime(idx), t ) == BT_TRUE ) ){
+            idx = grid->getFloorIndex(t);
+            if( idx == nIntervals ) idx--;
+        }
+
+        while( ( idx+1 < nIntervals ) && ( acadoIsStrictlyGreater( grid->getTime(idx+1), t ) == BT_FALSE ) )
+            idx++;
+
+        returnvalue = evaluatePiece( idx,t,tmp );
+        if( returnvalue != SUCCESSFUL_RETURN ){
+            free(tmp);
+            return ACADOERROR(returnvalue);
+        }
+
+        for( run2 = 0; run2 < dim; run2++ )
+            result(run1,run2) = tmp[run2];
     }
+
+    free(tmp);
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -460,6 +451,171 @@ BooleanType Curve::isInTimeDomain(	double t
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+returnValue Curve::appendInterval( double tStart, double tEnd, uint _dim ){
+
+    uint run1;
+
+    // CHECK WHETHER  "tStart < tEnd":
+    // ------------------------------------------------
+    if( acadoIsStrictlyGreater( tStart,tEnd ) == BT_TRUE )
+        return ACADOERROR(RET_TIME_INTERVAL_NOT_VALID);
+
+
+    // CHECK WHETHER THE INPUT VECTOR IS EMPTY:
+    // ------------------------------------------------
+    if( _dim == 0 )
+        return ACADOERROR(RET_INPUT_DIMENSION_MISMATCH);
+
+
+    if( isEmpty() == BT_FALSE ){
+
+        // IF THE CURVE IS NOT EMPTY THE DIMENSIONS MUST BE CHECKED:
+        // ---------------------------------------------------------
+        if( dim != _dim )
+            return ACADOERROR(RET_INPUT_DIMENSION_MISMATCH);
+
+        // CHECK WHETHER THE CURVE HAS NO GAP's:
+        // ---------------------------------------------------------
+        if( acadoIsEqual( tStart,grid->getLastTime() ) == BT_FALSE )
+		{
+			ASSERT(1==0);
+            return ACADOERROR(RET_TIME_INTERVAL_NOT_VALID);
+		}
+
+        // APPEND THE NEW TIME INTERVAL TO THE GRID:
+        // ---------------------------------------------------------
+        grid->addTime( tEnd );
+    }
+    else{
+
+        // SETUP A NEW GRID:
+        // ----------------------------------------------------
+        if( grid != 0 ) delete grid;
+        grid = new Grid( tStart, tEnd, 2 );
+
+        if( dim != _dim ) capacity = 0;
+        dim = _dim;
+    }
+
+
+    // ALLOCATE MEMORY FOR THE NEW PIECE OF CURVE:
+    // -------------------------------------------
+
+    if( nIntervals == capacity )
+        reserveIntervals( 2*capacity+1 );
+
+    parameterization[nIntervals] = 0;
+
+    for( run1 = 0; run1 < 4*dim; run1++ )
+        coefficients[4*dim*nIntervals+run1] = 0.0;
+
+    nIntervals++;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void Curve::reserveIntervals( uint _capacity ){
+
+    if( _capacity <= capacity )
+        return;
+
+    // the coefficient storage can only be sized once the dimension is known
+    if( dim == 0 )
+        return;
+
+    parameterization = (Function**)realloc(parameterization,_capacity*sizeof(Function*));
+    coefficients     = (double*)realloc(coefficients,4*dim*_capacity*sizeof(double));
+    capacity         = _capacity;
+}
+
+
+returnValue Curve::addCubicSpline( const VariablesGrid& sampledData ){
+
+    uint        run1, run2 ;
+    returnValue returnvalue;
+
+    uint nPoints = sampledData.getNumPoints();
+    uint nRows   = sampledData.getNumRows();
+
+    if( nPoints < 2 )
+        return SUCCESSFUL_RETURN;
+
+    double *h    = (double*)calloc(nPoints-1,sizeof(double));
+    double *diag = (double*)calloc(nPoints  ,sizeof(double));
+    double *M    = (double*)calloc(nPoints  ,sizeof(double));
+
+    for( run1 = 0; run1+1 < nPoints; run1++ ){
+        h[run1] = sampledData.getTime(run1+1) - sampledData.getTime(run1);
+        if( h[run1] <= 0.0 ){
+            free(h); free(diag); free(M);
+            return ACADOERROR(RET_TIME_INTERVAL_NOT_VALID);
+        }
+    }
+
+    // ELIMINATE THE SUB-DIAGONAL OF THE TRIDIAGONAL SYSTEM FOR THE SECOND
+    // DERIVATIVES ONCE; IT ONLY DEPENDS ON THE TIME POINTS (NATURAL SPLINE):
+    // ---------------------------------------------------------------------
+    for( run1 = 1; run1+1 < nPoints; run1++ ){
+        diag[run1] = 2.0*( h[run1-1] + h[run1] );
+        if( run1 > 1 )
+            diag[run1] -= h[run1-1]*h[run1-1]/diag[run1-1];
+    }
+
+
+    // APPEND THE INTERVALS:
+    // ---------------------
+    uint firstInterval = nIntervals;
+
+    reserveIntervals( nIntervals + nPoints );
+    for( run1 = 0; run1+1 < nPoints; run1++ ){
+        returnvalue = appendInterval( sampledData.getTime(run1), sampledData.getTime(run1+1), nRows );
+        if( returnvalue != SUCCESSFUL_RETURN ){
+            free(h); free(diag); free(M);
+            return returnvalue;
+        }
+    }
+
+
+    // SOLVE FOR THE SECOND DERIVATIVES AND STORE THE COEFFICIENTS
+    // OF EACH COMPONENT:
+    // -----------------------------------------------------------
+    for( run2 = 0; run2 < nRows; run2++ ){
+
+        M[0]         = 0.0;
+        M[nPoints-1] = 0.0;
+
+        for( run1 = 1; run1+1 < nPoints; run1++ ){
+            M[run1] = 6.0*( ( sampledData(run1+1,run2) - sampledData(run1  ,run2) )/h[run1]
+                          - ( sampledData(run1  ,run2) - sampledData(run1-1,run2) )/h[run1-1] );
+            if( run1 > 1 )
+                M[run1] -= h[run1-1]/diag[run1-1]*M[run1-1];
+        }
+
+        for( run1 = nPoints-2; run1 >= 1; run1-- ){
+            if( run1+2 < nPoints )
+                M[run1] -= h[run1]*M[run1+1];
+            M[run1] /= diag[run1];
+        }
+
+        for( run1 = 0; run1+1 < nPoints; run1++ ){
+
+            double *c = &(coefficients[4*(dim*(firstInterval+run1)+run2)]);
+
+            c[0] = sampledData(run1,run2);
+            c[1] = ( sampledData(run1+1,run2) - sampledData(run1,run2) )/h[run1]
+                 - h[run1]*( 2.0*M[run1] + M[run1+1] )/6.0;
+            c[2] = 0.5*M[run1];
+            c[3] = ( M[run1+1] - M[run1] )/( 6.0*h[run1] );
+        }
+    }
+
+    free(h); free(diag); free(M);
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
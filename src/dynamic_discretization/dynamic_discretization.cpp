@@ -172,6 +172,23 @@ returnValue DynamicDiscretization::getBackwardSensitivities( BlockMatrix &D ) co
 }
 
 
+returnValue DynamicDiscretization::shiftSensitivities( ){
+
+    uint run1, run2;
+
+    for( run1 = 0; run1+1 < dForward.getNumRows(); run1++ )
+        for( run2 = 0; run2 < dForward.getNumCols(); run2++ )
+            dForward.copySubBlock( run1, run2, run1+1, run2 );
+
+    for( run1 = 0; run1+1 < dBackward.getNumRows(); run1++ )
+        for( run2 = 0; run2 < dBackward.getNumCols(); run2++ )
+            dBackward.copySubBlock( run1, run2, run1+1, run2 );
+
+    areSensitivitiesShifted = BT_TRUE;
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue DynamicDiscretization::deleteAllSeeds(){
 
     BlockMatrix empty;
@@ -192,6 +209,7 @@ returnValue DynamicDiscretization::setupOptions( ){
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( PARALLEL_INTEGRATION        , defaultParallelIntegration     );
 
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -240,6 +258,8 @@ void DynamicDiscretization::initializeVariables(){
     np               = 0        ;
     nu               = 0        ;
     nw               = 0        ;
+
+    areSensitivitiesShifted = BT_FALSE;
 }
 
 void DynamicDiscretization::copy( const DynamicDiscretization& arg ){
@@ -264,6 +284,8 @@ void DynamicDiscretization::copy( const DynamicDiscretization& arg ){
 
     dForward  = arg.dForward ;
     dBackward = arg.dBackward;
+
+    areSensitivitiesShifted = arg.areSensitivitiesShifted;
 }
 
 
@@ -201,6 +201,20 @@ returnValue ShootingMethod::clear(){
 
 
 
+returnValue ShootingMethod::setUnionGrid( const Grid &unionGrid_ ){
+
+    if( ( integrator == 0 ) || ( breakPoints.getNumRows() != 1 ) )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    if( unionGrid_.getNumIntervals() != unionGrid.getNumIntervals() )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    unionGrid = unionGrid_;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ShootingMethod::evaluate(	OCPiterate &iter
 										)
 {
@@ -225,6 +239,14 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
     residuum = *(iter.x);
     residuum.setAll( 0.0 );
 
+    int parallelIntegration;
+    get( PARALLEL_INTEGRATION, parallelIntegration );
+
+    if ( ( (BooleanType)parallelIntegration == BT_TRUE ) && ( hasDecoupledIntervals( iter ) == BT_TRUE ) )
+        return evaluateIntervals( iter );
+
+    Vector timings( unionGrid.getNumIntervals() );
+
     iter.getInitialData( x, xa, p, u, w );
 // 	iter.x->print( "x" );
 // 	iter.u->print( "u" );
@@ -274,8 +296,10 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 // 		u.print("u before");
 // 		x.print("x before");
 // 		w.print("w");
+        double t0 = acadoGetTime();
         if ( integrator[run1]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+        timings( run1 ) = acadoGetTime() - t0;
 
 		
 		Vector xOld;
@@ -318,11 +342,200 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 
     // LOG THE RESULTS:
     // ----------------
+    setLast( LOG_TIME_INTERVAL_EVALUATIONS, timings );
+
+    return logTrajectory( iter );
+}
+
+
+
+returnValue ShootingMethod::evaluateIntervals( OCPiterate &iter ){
+
+    int run1;
+    uint run2;
+    double tStart, tEnd;
+
+    Vector x, xa, p, u, w;
+
+    Vector *x0    = new Vector[N];
+    Vector *xa0   = new Vector[N];
+    Vector *p0    = new Vector[N];
+    Vector *u0    = new Vector[N];
+    Vector *w0    = new Vector[N];
+    Vector *xNext = new Vector[N];
+    Grid   *grid  = new Grid  [N];
+
+    returnValue *returnvalues = new returnValue[N];
+    Vector timings( N );
+
+    int freezeIntegrator;
+    get( FREEZE_INTEGRATOR, freezeIntegrator );
+
+
+    // COLLECT THE INITIAL VALUES OF ALL INTERVALS:
+    // --------------------------------------------
+    // (as no value is auto-initialized, the updates do not depend on the
+    //  integration results and can be carried out in advance)
+
+    iter.getInitialData( x, xa, p, u, w );
+
+    for( run1 = 0; run1 < N; run1++ ){
+
+        integrator[run1]->setOptions( getOptions( 0 ) );
+
+        if ( (BooleanType)freezeIntegrator == BT_TRUE )
+            integrator[run1]->freezeAll();
+
+        tStart = unionGrid.getTime( run1   );
+        tEnd   = unionGrid.getTime( run1+1 );
+
+        Grid evaluationGrid;
+        iter.x->getSubGrid( tStart,tEnd,evaluationGrid );
+
+        Grid outputGrid;
+        if ( acadoIsNegative( integrator[run1]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
+            outputGrid.init( tStart,tEnd,getNumEvaluationPoints() );
+        else
+            outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[run1]->getDifferentialEquationSampleTime() ) );
+
+        grid[run1] = outputGrid & evaluationGrid;
+
+        x0 [run1] = x ;
+        xa0[run1] = xa;
+        p0 [run1] = p ;
+        u0 [run1] = u ;
+        w0 [run1] = w ;
+
+        Vector pOld = p;
+
+        if ( evaluationGrid.getNumPoints( ) <= 2 )
+            iter.updateData( tEnd, x, xa, p, u, w );
+        else
+            for( run2 = 1; run2 < outputGrid.getNumPoints(); ++run2 )
+                if ( evaluationGrid.hasTime( outputGrid.getTime(run2) ) == BT_TRUE )
+                    iter.updateData( outputGrid.getTime(run2), x, xa, p, u, w );
+
+        if ( iter.isInSimulationMode( ) == BT_FALSE )
+            p = pOld;
+
+        xNext[run1] = x;
+    }
+
+
+    // INTEGRATE ALL INTERVALS INDEPENDENTLY:
+    // --------------------------------------
+#ifdef _OPENMP
+    #pragma omp parallel for schedule( dynamic )
+#endif
+    for( run1 = 0; run1 < N; run1++ ){
+
+        double t0 = acadoGetTime();
+        returnvalues[run1] = integrator[run1]->integrate( grid[run1], x0[run1], xa0[run1], p0[run1], u0[run1], w0[run1] );
+        timings( run1 ) = acadoGetTime() - t0;
+    }
+
+
+    // COMPUTE THE RESIDUUM IN THE ORDER OF THE INTERVALS:
+    // ---------------------------------------------------
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( run1 = 0; run1 < N; run1++ ){
+
+        if ( returnvalues[run1] != SUCCESSFUL_RETURN ){
+            returnvalue = ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+            break;
+        }
+
+        Vector xOld;
+        Grid evaluationGrid;
+        iter.x->getSubGrid( unionGrid.getTime( run1 ),unionGrid.getTime( run1+1 ),evaluationGrid );
+
+        if ( evaluationGrid.getNumPoints( ) <= 2 ){
+            integrator[run1]->getX( xOld );
+        }
+        else{
+            VariablesGrid xAll;
+            integrator[run1]->getX( xAll );
+            xOld = xAll.getLastVector( );
+        }
+
+        residuum.setVector( run1, xOld - xNext[run1] );
+    }
+
+    delete[] x0;
+    delete[] xa0;
+    delete[] p0;
+    delete[] u0;
+    delete[] w0;
+    delete[] xNext;
+    delete[] grid;
+    delete[] returnvalues;
+
+    if ( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+
+    // LOG THE RESULTS:
+    // ----------------
+    setLast( LOG_TIME_INTERVAL_EVALUATIONS, timings );
+
     return logTrajectory( iter );
 }
 
 
 
+BooleanType ShootingMethod::hasDecoupledIntervals( const OCPiterate &iter ) const{
+
+    int run1;
+    uint run2;
+
+    if ( iter.x == 0 )
+        return BT_FALSE;
+
+    for( run1 = 0; run1 < N; run1++ ){
+
+        double tEnd = unionGrid.getTime( run1+1 );
+
+        // the initial value of the next interval must not depend on the integration:
+        if ( isFixed( iter.x , tEnd, BT_TRUE ) == BT_FALSE ) return BT_FALSE;
+        if ( isFixed( iter.xa, tEnd, BT_TRUE ) == BT_FALSE ) return BT_FALSE;
+
+        // and the integration must not modify the iterate:
+        Grid evaluationGrid;
+        iter.x->getSubGrid( unionGrid.getTime( run1 ),tEnd,evaluationGrid );
+
+        for( run2 = 0; run2 < evaluationGrid.getNumPoints(); ++run2 ){
+
+            double t = evaluationGrid.getTime( run2 );
+
+            if ( isFixed( iter.x , t, BT_FALSE ) == BT_FALSE ) return BT_FALSE;
+            if ( isFixed( iter.xa, t, BT_FALSE ) == BT_FALSE ) return BT_FALSE;
+            if ( isFixed( iter.p , t, BT_FALSE ) == BT_FALSE ) return BT_FALSE;
+            if ( isFixed( iter.u , t, BT_FALSE ) == BT_FALSE ) return BT_FALSE;
+            if ( isFixed( iter.w , t, BT_FALSE ) == BT_FALSE ) return BT_FALSE;
+        }
+    }
+
+    return BT_TRUE;
+}
+
+
+BooleanType ShootingMethod::isFixed( const VariablesGrid *z, double t, BooleanType isRequired ) const{
+
+    if ( z == 0 )
+        return BT_TRUE;
+
+    if ( z->getNumValues( ) == 0 )
+        return BT_TRUE;
+
+    if ( z->hasTime( t ) == BT_FALSE )
+        return ( isRequired == BT_TRUE ) ? BT_FALSE : BT_TRUE;
+
+    return ( z->getAutoInit( z->getFloorIndex( t ) ) == BT_TRUE ) ? BT_FALSE : BT_TRUE;
+}
+
+
+
 returnValue ShootingMethod::differentiateBackward( const int    &idx ,
                                                    const Matrix &seed,
                                                          Matrix &Gx  ,
@@ -367,33 +580,7 @@ returnValue ShootingMethod::differentiateForward(  const int     &idx,
                                                    const Matrix  &dW ,
                                                          Matrix  &D    ){
 
-    int run1;
-    int n = 0;
-
-    n = acadoMax( n, dX.getNumCols() );
-    n = acadoMax( n, dP.getNumCols() );
-    n = acadoMax( n, dU.getNumCols() );
-    n = acadoMax( n, dW.getNumCols() );
-
-    D.init( nx, n );
-
-    for( run1 = 0; run1 < n; run1++ ){
-
-         Vector tmp;
-
-         Vector tmpX; if( dX.isEmpty() == BT_FALSE ) tmpX = dX.getCol( run1 );
-         Vector tmpP; if( dP.isEmpty() == BT_FALSE ) tmpP = dP.getCol( run1 );
-         Vector tmpU; if( dU.isEmpty() == BT_FALSE ) tmpU = dU.getCol( run1 );
-         Vector tmpW; if( dW.isEmpty() == BT_FALSE ) tmpW = dW.getCol( run1 );
-
-         ACADO_TRY( integrator[idx]->setForwardSeed( 1, tmpX, tmpP, tmpU, tmpW ) );
-         ACADO_TRY( integrator[idx]->integrateSensitivities( )                   );
-         ACADO_TRY( integrator[idx]->getForwardSensitivities( tmp, 1 )           );
-
-         D.setCol( run1, tmp );
-    }
-
-    return SUCCESSFUL_RETURN;
+    return integrator[idx]->integrateForwardSensitivities( dX, dP, dU, dW, D );
 }
 
 
@@ -467,48 +654,130 @@ returnValue ShootingMethod::evaluateSensitivities(){
 
     int i;
 
+    int parallelIntegration;
+    get( PARALLEL_INTEGRATION, parallelIntegration );
+
+    Matrix      *D            = new Matrix[4*N];
+    returnValue *returnvalues = new returnValue[N];
+    Vector       timings( N );
+
+    timings.setZero( );
+
+
+    // KEEP THE SHIFTED SENSITIVITIES IF AVAILABLE:
+    // --------------------------------------------
+    // (only the last interval has to be differentiated then)
+
+    int firstInterval = 0;
+
+    if( areSensitivitiesShifted == BT_TRUE ){
+
+        const BlockMatrix &shifted = ( bSeed.isEmpty() == BT_FALSE ) ? dBackward : dForward;
+
+        if( ( (int) shifted.getNumRows() == N ) && ( shifted.getNumCols() == 5 ) )
+            firstInterval = N-1;
+    }
+    areSensitivitiesShifted = BT_FALSE;
+
+
     // COMPUTATION OF BACKWARD SENSITIVITIES:
     // --------------------------------------
 
     if( bSeed.isEmpty() == BT_FALSE ){
 
-        dBackward.init( N, 5 );
+#ifdef _OPENMP
+        #pragma omp parallel for schedule( dynamic ) if( parallelIntegration == BT_TRUE )
+#endif
+        for( i = firstInterval; i < N; i++ ){
 
-        for( i = 0; i < N; i++ ){
+             double t0 = acadoGetTime();
 
-             Matrix seed, X, P, U, W;
+             Matrix seed;
              bSeed.getSubBlock( 0, i, seed );
 
-             ACADO_TRY( differentiateBackward( i, seed, X, P, U, W ) );
+             returnvalues[i] = differentiateBackward( i, seed, D[4*i], D[4*i+1], D[4*i+2], D[4*i+3] );
+             timings(i) = acadoGetTime() - t0;
+        }
+
+        if( firstInterval == 0 )
+            dBackward.init( N, 5 );
+
+        for( i = firstInterval; i < N; i++ ){
 
-             if( nx > 0 ) dBackward.setDense( i, 0, X );
-             if( np > 0 ) dBackward.setDense( i, 2, P );
-             if( nu > 0 ) dBackward.setDense( i, 3, U );
-             if( nw > 0 ) dBackward.setDense( i, 4, W );
+             if( returnvalues[i] != SUCCESSFUL_RETURN ) break;
+
+             if( nx > 0 ) dBackward.setDense( i, 0, D[4*i  ] );
+             if( np > 0 ) dBackward.setDense( i, 2, D[4*i+1] );
+             if( nu > 0 ) dBackward.setDense( i, 3, D[4*i+2] );
+             if( nw > 0 ) dBackward.setDense( i, 4, D[4*i+3] );
         }
-        return SUCCESSFUL_RETURN;
     }
 
 
     // COMPUTATION OF FORWARD SENSITIVITIES:
     // -------------------------------------
 
-    dForward.init( N, 5 );
+    else{
 
-    for( i = 0; i < N; i++ ){
+#ifdef _OPENMP
+        #pragma omp parallel for schedule( dynamic ) if( parallelIntegration == BT_TRUE )
+#endif
+        for( i = firstInterval; i < N; i++ ){
 
-        Matrix X, P, U, W, D, E;
+            double t0 = acadoGetTime();
 
-        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
-        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
-        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
-        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
+            returnvalues[i] = differentiateForward( i, D[4*i], D[4*i+1], D[4*i+2], D[4*i+3] );
+            timings(i) = acadoGetTime() - t0;
+        }
 
-        if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D )); dForward.setDense( i, 0, D ); }
-        if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D )); dForward.setDense( i, 2, D ); }
-        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); }
-        if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D )); dForward.setDense( i, 4, D ); }
+        if( firstInterval == 0 )
+            dForward.init( N, 5 );
+
+        for( i = firstInterval; i < N; i++ ){
+
+            if( returnvalues[i] != SUCCESSFUL_RETURN ) break;
+
+            if( nx > 0 ) dForward.setDense( i, 0, D[4*i  ] );
+            if( np > 0 ) dForward.setDense( i, 2, D[4*i+1] );
+            if( nu > 0 ) dForward.setDense( i, 3, D[4*i+2] );
+            if( nw > 0 ) dForward.setDense( i, 4, D[4*i+3] );
+        }
     }
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+    if( i < N ) returnvalue = returnvalues[i];
+
+    delete[] D;
+    delete[] returnvalues;
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    setLast( LOG_TIME_INTERVAL_SENSITIVITIES, timings );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue ShootingMethod::differentiateForward( const int &idx,
+                                                  Matrix    &DX ,
+                                                  Matrix    &DP ,
+                                                  Matrix    &DU ,
+                                                  Matrix    &DW   ){
+
+    Matrix X, P, U, W, E;
+
+    if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( idx, 0, X );
+    if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( idx, 0, P );
+    if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( idx, 0, U );
+    if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( idx, 0, W );
+
+    if( nx > 0 ) ACADO_TRY( differentiateForward( idx, X, E, E, E, DX ) );
+    if( np > 0 ) ACADO_TRY( differentiateForward( idx, E, P, E, E, DP ) );
+    if( nu > 0 ) ACADO_TRY( differentiateForward( idx, E, E, U, E, DU ) );
+    if( nw > 0 ) ACADO_TRY( differentiateForward( idx, E, E, E, W, DW ) );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -533,6 +802,8 @@ returnValue ShootingMethod::evaluateSensitivitiesLifted( ){
 
     int i,j;
 
+    areSensitivitiesShifted = BT_FALSE;
+
     dForward.init( N, 5 );
     Matrix Gx, *Gu, b, d, D, E, X, P, U, W, A, B;
     Gu = new Matrix[N];
@@ -588,64 +859,95 @@ returnValue ShootingMethod::evaluateSensitivitiesLifted( ){
 returnValue ShootingMethod::evaluateSensitivities( const BlockMatrix &seed, BlockMatrix &hessian ){
 
     const int NN = N+1;
-    dForward.init( N, 5 );
-    int i;
+    int i, j;
 
-    for( i = 0; i < N; i++ ){
+    int parallelIntegration;
+    get( PARALLEL_INTEGRATION, parallelIntegration );
 
-        Matrix X, P, U, W, D, E, HX, HP, HU, HW, S;
+    // the second order terms depend on the current multipliers, such that
+    // shifted sensitivities are not reused here:
+    areSensitivitiesShifted = BT_FALSE;
 
-        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
-        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
-        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
-        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
+    // D[4*i+j] is the sensitivity and H[16*i+4*j+k] the hessian block of
+    // interval i w.r.t. the variable types j and k (x,p,u,w):
+    Matrix      *D            = new Matrix[ 4*N];
+    Matrix      *H            = new Matrix[16*N];
+    returnValue *returnvalues = new returnValue[N];
+    Vector       timings( N );
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule( dynamic ) if( parallelIntegration == BT_TRUE )
+#endif
+    for( i = 0; i < N; i++ ){
+
+        double t0 = acadoGetTime();
 
+        Matrix S;
         seed.getSubBlock( i, 0, S, nx, 1 );
 
-        if( nx > 0 ){
+        returnvalues[i] = differentiateForwardBackward( i, S, &D[4*i], &H[16*i] );
+        timings(i) = acadoGetTime() - t0;
+    }
 
-            ACADO_TRY( differentiateForwardBackward( i, X, E, E, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 0, D );
+    dForward.init( N, 5 );
 
-            if( nx > 0 ) hessian.addDense( i,      i, HX );
-            if( np > 0 ) hessian.addDense( i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( i, 4*NN+i, HW );
-        }
+    // row/column offsets of the blocks of x, p, u and w in the hessian:
+    const int offset[4] = { 0, 2*NN, 3*NN, 4*NN };
+    const int dim   [4] = { nx, np, nu, nw };
 
-        if( np > 0 ){
+    returnValue returnvalue = SUCCESSFUL_RETURN;
 
-            ACADO_TRY( differentiateForwardBackward( i, E, P, E, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 2, D );
+    for( i = 0; i < N; i++ ){
 
-            if( nx > 0 ) hessian.addDense( 2*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 2*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 2*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 2*NN+i, 4*NN+i, HW );
+        if( returnvalues[i] != SUCCESSFUL_RETURN ){
+            returnvalue = returnvalues[i];
+            break;
         }
 
-        if( nu > 0 ){
+        for( j = 0; j < 4; j++ ){
+
+            if( dim[j] == 0 ) continue;
 
-            ACADO_TRY( differentiateForwardBackward( i, E, E, U, E, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 3, D );
+            dForward.setDense( i, j == 0 ? 0 : j+1, D[4*i+j] );
 
-            if( nx > 0 ) hessian.addDense( 3*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 3*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 3*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 3*NN+i, 4*NN+i, HW );
+            if( nx > 0 ) hessian.addDense( offset[j]+i,      i, H[16*i+4*j  ] );
+            if( np > 0 ) hessian.addDense( offset[j]+i, 2*NN+i, H[16*i+4*j+1] );
+            if( nu > 0 ) hessian.addDense( offset[j]+i, 3*NN+i, H[16*i+4*j+2] );
+            if( nw > 0 ) hessian.addDense( offset[j]+i, 4*NN+i, H[16*i+4*j+3] );
         }
+    }
 
-        if( nw > 0 ){
+    delete[] D;
+    delete[] H;
+    delete[] returnvalues;
 
-            ACADO_TRY( differentiateForwardBackward( i, E, E, E, W, S, D, HX, HP, HU, HW ));
-            dForward.setDense( i, 4, D );
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    setLast( LOG_TIME_INTERVAL_SENSITIVITIES, timings );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue ShootingMethod::differentiateForwardBackward( const int    &idx ,
+                                                          const Matrix &seed,
+                                                                Matrix *D   ,
+                                                                Matrix *H     ){
+
+    Matrix X, P, U, W, E;
+
+    if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( idx, 0, X );
+    if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( idx, 0, P );
+    if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( idx, 0, U );
+    if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( idx, 0, W );
+
+    if( nx > 0 ) ACADO_TRY( differentiateForwardBackward( idx, X, E, E, E, seed, D[0], H[ 0], H[ 1], H[ 2], H[ 3] ) );
+    if( np > 0 ) ACADO_TRY( differentiateForwardBackward( idx, E, P, E, E, seed, D[1], H[ 4], H[ 5], H[ 6], H[ 7] ) );
+    if( nu > 0 ) ACADO_TRY( differentiateForwardBackward( idx, E, E, U, E, seed, D[2], H[ 8], H[ 9], H[10], H[11] ) );
+    if( nw > 0 ) ACADO_TRY( differentiateForwardBackward( idx, E, E, E, W, seed, D[3], H[12], H[13], H[14], H[15] ) );
 
-            if( nx > 0 ) hessian.addDense( 4*NN+i,      i, HX );
-            if( np > 0 ) hessian.addDense( 4*NN+i, 2*NN+i, HP );
-            if( nu > 0 ) hessian.addDense( 4*NN+i, 3*NN+i, HU );
-            if( nw > 0 ) hessian.addDense( 4*NN+i, 4*NN+i, HW );
-        }
-    }
     return SUCCESSFUL_RETURN;
 }
 
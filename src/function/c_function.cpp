@@ -186,9 +186,12 @@ Expression CFunction::operator()( const Expression &arg ){
     COperator dummy;
     dummy.increaseID();
 
+    // all components of the call share the same argument:
+    COperator call( thisFunction, arg, 0 );
+
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new COperator( thisFunction, arg, run1 );
+        tmp.element[run1] = new COperator( call, run1 );
     }
 
     return tmp;
@@ -51,6 +51,8 @@ COperator::COperator( ) :SmoothOperator( )
     component    = -1;
     bufferSize   =  0;
     idx          =  0;
+    argument     =  0;
+    argumentDim  =  0;
 
     first        = BT_FALSE;
     globalTypeID = counter ;
@@ -64,8 +66,12 @@ COperator::COperator( const CFunction &fcn, const Expression &arg, int component
 
     uint run1;
 
-    cFunction = fcn;
-    argument  = arg;
+    cFunction   = fcn;
+    argumentDim = arg.getDim();
+    argument    = (Operator**)calloc(argumentDim,sizeof(Operator*));
+
+    for( run1 = 0; run1 < argumentDim; run1++ )
+        argument[run1] = arg.element[run1]->clone();
 
     component = component_;
 
@@ -80,8 +86,8 @@ COperator::COperator( const CFunction &fcn, const Expression &arg, int component
     d_result = (double**)calloc(bufferSize,sizeof(double*));
 
     for( run1 = 0; run1 < bufferSize; run1++ ){
-        result  [run1] = new double[argument.getDim()];
-        d_result[run1] = new double[argument.getDim()];
+        result  [run1] = new double[argumentDim];
+        d_result[run1] = new double[argumentDim];
     }
 
     cresult   = (double**)calloc(bufferSize,sizeof(double*));
@@ -98,6 +104,13 @@ COperator::COperator( const CFunction &fcn, const Expression &arg, int component
 
 COperator::COperator( const COperator &arg ){ copy(arg); }
 
+
+COperator::COperator( const COperator &arg, int component_ ){
+
+    copy(arg);
+    component = component_;
+}
+
 COperator::~COperator(){ deleteAll(); }
 
 
@@ -121,12 +134,18 @@ void COperator::copy( const COperator &arg ){
 
     bufferSize     = arg.bufferSize   ;
     cFunction      = arg.cFunction    ;
-    argument       = arg.argument     ;
+    argumentDim    = arg.argumentDim  ;
     component      = arg.component    ;
 
     first          = arg.first        ;
     globalTypeID   = arg.globalTypeID ;
 
+    argument = (Operator**)calloc(argumentDim,sizeof(Operator*));
+    for( run1 = 0; run1 < argumentDim; run1++ ){
+        argument[run1] = arg.argument[run1];
+        retainArgument( argument[run1] );
+    }
+
     idx = new int[cFunction.getDim()];
     for( run1 = 0; run1 < cFunction.getDim(); run1++ )
          idx[run1] = arg.idx[run1];
@@ -136,10 +155,10 @@ void COperator::copy( const COperator &arg ){
 
     for( run1 = 0; run1 < bufferSize; run1++ ){
 
-        result  [run1] = new double[argument.getDim()];
-        d_result[run1] = new double[argument.getDim()];
+        result  [run1] = new double[argumentDim];
+        d_result[run1] = new double[argumentDim];
 
-        for( run2 = 0; run2 < argument.getDim(); run2++ ){
+        for( run2 = 0; run2 < argumentDim; run2++ ){
               result[run1][run2] = arg.result  [run1][run2];
             d_result[run1][run2] = arg.d_result[run1][run2];
         }
@@ -158,8 +177,6 @@ void COperator::copy( const COperator &arg ){
             d_cresult[run1][run2] = arg.d_cresult[run1][run2];
         }
     }
-
-    nCount = 0;
 }
 
 
@@ -183,6 +200,10 @@ void COperator::deleteAll(){
     free( cresult   );
     free( d_cresult );
 
+    for( run1 = 0; run1 < argumentDim; run1++ )
+        releaseArgument( argument[run1] );
+    free( argument );
+
     delete[] idx;
 }
 
@@ -208,15 +229,15 @@ returnValue COperator::evaluate( int number, double *x, double *result_ ){
             d_cresult = (double**)realloc(d_cresult,bufferSize*sizeof(double*));
 
             for( run1 = oldSize; run1 < bufferSize; run1++ ){
-                result   [run1] = new double[argument.getDim() ];
-                d_result [run1] = new double[argument.getDim() ];
+                result   [run1] = new double[argumentDim ];
+                d_result [run1] = new double[argumentDim ];
                 cresult  [run1] = new double[cFunction.getDim()];
                 d_cresult[run1] = new double[cFunction.getDim()];
             }
         }
 
-        for( run1 = 0; run1 < argument.getDim(); run1++ )
-            argument.element[run1]->evaluate( number, x , &result[number][run1] );
+        for( run1 = 0; run1 < argumentDim; run1++ )
+            argument[run1]->evaluate( number, x , &result[number][run1] );
         cFunction.evaluate( number, result[number], cresult[number] );
         result_[0] = cresult[number][component];
         for( run1 = 0; run1 < cFunction.getDim(); run1++ )
@@ -286,8 +307,8 @@ BooleanType COperator::isDependingOn( VariableType var ) const{
 
     uint run1;
 
-    for( run1 = 0; run1 < argument.getDim(); run1++ )
-        if( argument.element[run1]->isDependingOn(var) == BT_TRUE )
+    for( run1 = 0; run1 < argumentDim; run1++ )
+        if( argument[run1]->isDependingOn(var) == BT_TRUE )
             return BT_TRUE;
     return BT_FALSE;
 }
@@ -300,8 +321,8 @@ BooleanType COperator::isDependingOn( int dim,
 
     uint run1;
 
-    for( run1 = 0; run1 < argument.getDim(); run1++ )
-        if( argument.element[run1]->isDependingOn( dim, varType, component_, implicit_dep ) == BT_TRUE )
+    for( run1 = 0; run1 < argumentDim; run1++ )
+        if( argument[run1]->isDependingOn( dim, varType, component_, implicit_dep ) == BT_TRUE )
             return BT_TRUE;
     return BT_FALSE;
 }
@@ -381,15 +402,15 @@ returnValue COperator::AD_forward( int number, double *x, double *seed,
             d_cresult = (double**)realloc(d_cresult,bufferSize*sizeof(double*));
 
             for( run1 = oldSize; run1 < bufferSize; run1++ ){
-                result   [run1] = new double[argument.getDim() ];
-                d_result [run1] = new double[argument.getDim() ];
+                result   [run1] = new double[argumentDim ];
+                d_result [run1] = new double[argumentDim ];
                 cresult  [run1] = new double[cFunction.getDim()];
                 d_cresult[run1] = new double[cFunction.getDim()];
             }
         }
 
-        for( run1 = 0; run1 < argument.getDim(); run1++ )
-            argument.element[run1]->AD_forward( number, x, seed, &result[number][run1], &d_result[number][run1] );
+        for( run1 = 0; run1 < argumentDim; run1++ )
+            argument[run1]->AD_forward( number, x, seed, &result[number][run1], &d_result[number][run1] );
         cFunction.AD_forward( number, result[number], d_result[number], cresult[number], d_cresult[number] );
          f[0] =   cresult[number][component];
         df[0] = d_cresult[number][component];
@@ -413,8 +434,8 @@ returnValue COperator::AD_forward( int number, double *seed, double *df ){
         df[0] = seed[idx[component]];
     }
     else{
-        for( run1 = 0; run1 < argument.getDim(); run1++ )
-            argument.element[run1]->AD_forward( number, seed, &d_result[number][run1] );
+        for( run1 = 0; run1 < argumentDim; run1++ )
+            argument[run1]->AD_forward( number, seed, &d_result[number][run1] );
         cFunction.AD_forward( number, d_result[number], d_cresult[number] );
         df[0] = d_cresult[number][component];
         for( run1 = 0; run1 < cFunction.getDim(); run1++ )
@@ -443,14 +464,14 @@ returnValue COperator::AD_forward2( int number, double *seed, double *dseed,
     }
     else{
 
-        double *d_result2  = new double[argument.getDim() ];
+        double *d_result2  = new double[argumentDim ];
         double *d_cresult2 = new double[cFunction.getDim()];
 
-        double *dd_result  = new double[argument.getDim() ];
+        double *dd_result  = new double[argumentDim ];
         double *dd_cresult = new double[cFunction.getDim()];
 
-        for( run1 = 0; run1 < argument.getDim(); run1++ )
-            argument.element[run1]->AD_forward2( number, seed, dseed, &d_result2[run1], &dd_result[run1] );
+        for( run1 = 0; run1 < argumentDim; run1++ )
+            argument[run1]->AD_forward2( number, seed, dseed, &d_result2[run1], &dd_result[run1] );
 
         cFunction.AD_forward2( number, d_result2, dd_result, d_cresult2, dd_cresult );
 
@@ -491,6 +512,22 @@ Operator* COperator::clone() const{
 }
 
 
+returnValue COperator::unshareArguments( OperatorCopyTable &copies ){
+
+    uint run1;
+    Operator *tmp;
+
+    for( run1 = 0; run1 < argumentDim; run1++ ){
+
+        tmp = copyArgument( argument[run1], copies );
+        releaseArgument( argument[run1] );
+        argument[run1] = tmp;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue COperator::clearBuffer(){
 
     if( bufferSize > 1 ){
@@ -509,9 +546,9 @@ returnValue COperator::enumerateVariables( SymbolicIndexList *indexList ){
     uint run1;
     returnValue returnvalue;
 
-    for( run1 = 0; run1 < argument.getDim(); run1++ ){
+    for( run1 = 0; run1 < argumentDim; run1++ ){
 
-        returnvalue = argument.element[run1]->enumerateVariables( indexList );
+        returnvalue = argument[run1]->enumerateVariables( indexList );
         if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
     }
 
@@ -538,8 +575,8 @@ returnValue COperator::loadIndices( SymbolicIndexList *indexList ){
     uint run1;
     returnValue returnvalue;
 
-    for( run1 = 0; run1 < argument.getDim(); run1++ ){
-        returnvalue = argument.element[run1]->loadIndices( indexList );
+    for( run1 = 0; run1 < argumentDim; run1++ ){
+        returnvalue = argument[run1]->loadIndices( indexList );
         if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
     }
 
@@ -95,30 +95,44 @@ returnValue EvaluationPoint::init( const Function &f ,
                                    uint N_                       ){
 
     uint run1;
-    deleteAll();
 
-    nx = acadoMax( nx_, f.getNX ()                 );
-    na = acadoMax( na_, f.getNXA()                 );
-    np = acadoMax( np_, f.getNP ()                 );
-    nu = acadoMax( nu_, f.getNU ()                 );
-    nw = acadoMax( nw_, f.getNW ()                 );
-    nd = acadoMax( nd_, f.getNDX()                 );
-    N  = acadoMax( N_ , f.getNumberOfVariables()+1 );
+    uint nxNew = acadoMax( nx_, f.getNX ()                 );
+    uint naNew = acadoMax( na_, f.getNXA()                 );
+    uint npNew = acadoMax( np_, f.getNP ()                 );
+    uint nuNew = acadoMax( nu_, f.getNU ()                 );
+    uint nwNew = acadoMax( nw_, f.getNW ()                 );
+    uint ndNew = acadoMax( nd_, f.getNDX()                 );
+    uint NNew  = acadoMax( N_ , f.getNumberOfVariables()+1 );
 
-    if( N != 0 ) z = new double[N];
-    else         z = 0            ;
+    // keep the storage if the dimensions do not change:
+    if( idx == 0 || nxNew != nx || naNew != na || npNew != np ||
+        nuNew != nu || nwNew != nw || ndNew != nd || NNew != N ){
 
-	setZero( );
+        deleteAll();
 
-    idx = new int*[7 ];
+        nx = nxNew;
+        na = naNew;
+        np = npNew;
+        nu = nuNew;
+        nw = nwNew;
+        nd = ndNew;
+        N  = NNew ;
+
+        if( N != 0 ) z = new double[N];
+        else         z = 0            ;
+
+        idx = new int*[7 ];
+
+        idx[0] = new int [1 ];
+        idx[1] = new int [nx];
+        idx[2] = new int [na];
+        idx[3] = new int [np];
+        idx[4] = new int [nu];
+        idx[5] = new int [nw];
+        idx[6] = new int [nd];
+    }
 
-    idx[0] = new int [1 ];
-    idx[1] = new int [nx];
-    idx[2] = new int [na];
-    idx[3] = new int [np];
-    idx[4] = new int [nu];
-    idx[5] = new int [nw];
-    idx[6] = new int [nd];
+	setZero( );
 
     idx[0][0] = f.index( VT_TIME, 0 );
 
@@ -179,8 +193,8 @@ void EvaluationPoint::copyIdx( const uint &dim, const int *idx1, int **idx2 ){
 
     uint i;
     *idx2 = new int[dim];
-    for( i = 0; i < N; i++ )
-        *idx2[i] = idx1[i];
+    for( i = 0; i < dim; i++ )
+        (*idx2)[i] = idx1[i];
 }
 
 
@@ -302,6 +302,14 @@ BooleanType Function::isDependingOn( const Expression     &variable ){
     return evaluationTree.isDependingOn( variable );
 }
 
+returnValue Function::getDependencyPattern( int           nVar     ,
+                                            VariableType *varType  ,
+                                            int          *component,
+                                            BooleanType  *pattern    ){
+
+    return evaluationTree.getDependencyPattern( nVar, varType, component, pattern );
+}
+
 BooleanType Function::isLinearIn( const Expression     &variable ){
 
     return evaluationTree.isLinearIn( variable );
@@ -411,6 +419,12 @@ returnValue Function::AD_forward( int number, double *seed, double *df  ){
 }
 
 
+returnValue Function::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    return evaluationTree.AD_forward( number+memoryOffset, nDir, seed, df );
+}
+
+
 returnValue Function::AD_backward( int number, double *seed, double  *df ){
 
     return evaluationTree.AD_backward( number+memoryOffset, seed, df );
@@ -498,6 +512,24 @@ returnValue Function::setScale( double *scale_ ){
 }
 
 
+returnValue Function::useEvaluationTape( BooleanType useTape_ ){
+
+    return evaluationTree.useEvaluationTape( useTape_ );
+}
+
+
+returnValue Function::setExportOptimization( BooleanType optimizeExport_ ){
+
+    return evaluationTree.setExportOptimization( optimizeExport_ );
+}
+
+
+returnValue Function::getNumExportOperations( int &nBefore, int &nAfter ) const{
+
+    return evaluationTree.getNumExportOperations( nBefore, nAfter );
+}
+
+
 Vector Function::evaluate( const EvaluationPoint &x,
                            const int        &number  ){
 
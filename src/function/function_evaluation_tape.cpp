@@ -0,0 +1,1219 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file   src/function/function_evaluation_tape.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date   2013
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/function/function_evaluation_tape.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/* Compares a folded constant exactly (written without == because of
+ * -Wfloat-equal): the simplifications must not change the exported
+ * model, hence no tolerance is used. */
+static inline BooleanType isExactly( double x, double value ){
+
+    if( ( x >= value ) && ( x <= value ) ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+FunctionEvaluationTape::FunctionEvaluationTape( ){
+
+    instructions  = NULL;
+    nInstructions = 0;
+
+    nSegments     = 0;
+    nIS           = 0;
+    segmentEnd    = NULL;
+    segmentResult = NULL;
+    segmentTarget = NULL;
+
+    values        = NULL;
+    dvalues       = NULL;
+    bufferSize    = 0;
+
+    work1         = NULL;
+    work2         = NULL;
+
+    tangents      = NULL;
+    nTangents     = 0;
+}
+
+
+FunctionEvaluationTape::FunctionEvaluationTape( const FunctionEvaluationTape& arg ){
+
+    copy( arg );
+}
+
+
+FunctionEvaluationTape::~FunctionEvaluationTape( ){
+
+    deleteAll( );
+}
+
+
+FunctionEvaluationTape& FunctionEvaluationTape::operator=( const FunctionEvaluationTape& arg ){
+
+    if( this != &arg ){
+
+        deleteAll( );
+        copy( arg );
+    }
+    return *this;
+}
+
+
+returnValue FunctionEvaluationTape::compile( int        n_      ,
+                                             Operator **sub_    ,
+                                             const int *isIndex_,
+                                             int        dim_    ,
+                                             Operator **f_       ){
+
+    int run1, idx;
+
+    clear( );
+
+    if( n_ + dim_ <= 0 )
+        return SUCCESSFUL_RETURN;
+
+    InstructionTable instructions_;
+    NodeTable        nodes;
+
+    segmentEnd    = (int*)calloc( n_+dim_,sizeof(int) );
+    segmentResult = (int*)calloc( n_+dim_,sizeof(int) );
+    segmentTarget = (int*)calloc( n_+dim_,sizeof(int) );
+
+    for( run1 = 0; run1 < n_+dim_; run1++ ){
+
+        if( run1 < n_ ){
+            idx = append( sub_[run1], instructions_, nodes );
+            segmentTarget[run1] = isIndex_[run1];
+        }
+        else{
+            idx = append( f_[run1-n_], instructions_, nodes );
+            segmentTarget[run1] = run1-n_;
+        }
+        if( idx < 0 ){
+            clear( );
+            return RET_INVALID_ARGUMENTS;
+        }
+        segmentEnd   [run1] = nInstructions;
+        segmentResult[run1] = idx;
+    }
+
+    nSegments = n_+dim_;
+    nIS       = n_;
+
+    bufferSize = 1;
+    values     = (double*)calloc( nInstructions,sizeof(double) );
+    dvalues    = (double*)calloc( nInstructions,sizeof(double) );
+    work1      = (double*)calloc( nInstructions,sizeof(double) );
+    work2      = (double*)calloc( nInstructions,sizeof(double) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::clear( ){
+
+    deleteAll( );
+
+    instructions  = NULL;
+    nInstructions = 0;
+    nSegments     = 0;
+    nIS           = 0;
+    segmentEnd    = NULL;
+    segmentResult = NULL;
+    segmentTarget = NULL;
+    values        = NULL;
+    dvalues       = NULL;
+    bufferSize    = 0;
+    work1         = NULL;
+    work2         = NULL;
+    tangents      = NULL;
+    nTangents     = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::evaluate( int number, double *x, double *result ){
+
+    int run1, run2;
+
+    allocateBuffer( number );
+    double *w = &values[number*nInstructions];
+
+    run2 = 0;
+    for( run1 = 0; run1 < nSegments; run1++ ){
+
+        for( ; run2 < segmentEnd[run1]; run2++ )
+            w[run2] = computeValue( run2, w, x );
+
+        if( run1 < nIS ) x     [ segmentTarget[run1] ] = w[ segmentResult[run1] ];
+        else             result[ segmentTarget[run1] ] = w[ segmentResult[run1] ];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward( int number, double *x, double *seed,
+                                                double *f, double *df ){
+
+    int run1, run2;
+
+    allocateBuffer( number );
+    double  *w = &values [number*nInstructions];
+    double *dw = &dvalues[number*nInstructions];
+
+    run2 = 0;
+    for( run1 = 0; run1 < nSegments; run1++ ){
+
+        for( ; run2 < segmentEnd[run1]; run2++ ){
+             w[run2] = computeValue( run2, w, x );
+            dw[run2] = computeTangent( run2, w, dw, seed );
+        }
+
+        if( run1 < nIS ){
+            x   [ segmentTarget[run1] ] =  w[ segmentResult[run1] ];
+            seed[ segmentTarget[run1] ] = dw[ segmentResult[run1] ];
+        }
+        else{
+            f   [ segmentTarget[run1] ] =  w[ segmentResult[run1] ];
+            df  [ segmentTarget[run1] ] = dw[ segmentResult[run1] ];
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward( int number, double *seed, double *df ){
+
+    int run1, run2;
+
+    allocateBuffer( number );
+    double  *w = &values [number*nInstructions];
+    double *dw = &dvalues[number*nInstructions];
+
+    run2 = 0;
+    for( run1 = 0; run1 < nSegments; run1++ ){
+
+        for( ; run2 < segmentEnd[run1]; run2++ )
+            dw[run2] = computeTangent( run2, w, dw, seed );
+
+        if( run1 < nIS ) seed[ segmentTarget[run1] ] = dw[ segmentResult[run1] ];
+        else             df  [ segmentTarget[run1] ] = dw[ segmentResult[run1] ];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1, run2, run3;
+    double pa, pb;
+
+    allocateBuffer( number );
+    double *w = &values[number*nInstructions];
+
+    if( nDir > nTangents ){
+        nTangents = nDir;
+        tangents  = (double*)realloc( tangents,nTangents*nInstructions*sizeof(double) );
+    }
+
+    run2 = 0;
+    for( run1 = 0; run1 < nSegments; run1++ ){
+
+        for( ; run2 < segmentEnd[run1]; run2++ ){
+
+            const Instruction &op = instructions[run2];
+
+            double       *dw = &tangents[run2*nDir];
+            const double *da = 0;
+            const double *db = 0;
+
+            if( op.arg1 >= 0 ) da = &tangents[op.arg1*nDir];
+            if( op.arg2 >= 0 ) db = &tangents[op.arg2*nDir];
+
+            switch( op.name ){
+
+                case ON_VARIABLE:
+                     for( run3 = 0; run3 < nDir; run3++ )
+                         dw[run3] = seed[op.index*nDir+run3];
+                     break;
+
+                case ON_DOUBLE_CONSTANT:
+                     for( run3 = 0; run3 < nDir; run3++ )
+                         dw[run3] = 0.0;
+                     break;
+
+                case ON_ADDITION:
+                     for( run3 = 0; run3 < nDir; run3++ )
+                         dw[run3] = da[run3] + db[run3];
+                     break;
+
+                case ON_SUBTRACTION:
+                     for( run3 = 0; run3 < nDir; run3++ )
+                         dw[run3] = da[run3] - db[run3];
+                     break;
+
+                default:
+                     getPartials( run2, w, pa, pb );
+                     if( op.arg2 < 0 ){
+                         for( run3 = 0; run3 < nDir; run3++ )
+                             dw[run3] = pa*da[run3];
+                     }
+                     else{
+                         for( run3 = 0; run3 < nDir; run3++ )
+                             dw[run3] = pa*da[run3] + pb*db[run3];
+                     }
+                     break;
+            }
+        }
+
+        const double *dw = &tangents[ segmentResult[run1]*nDir ];
+
+        if( run1 < nIS ){
+            for( run3 = 0; run3 < nDir; run3++ )
+                seed[ segmentTarget[run1]*nDir+run3 ] = dw[run3];
+        }
+        else{
+            for( run3 = 0; run3 < nDir; run3++ )
+                df  [ segmentTarget[run1]*nDir+run3 ] = dw[run3];
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_backward( int number, double *seed, double *df ){
+
+    int run1, run2, start;
+    double pa, pb;
+
+    allocateBuffer( number );
+    double *w = &values[number*nInstructions];
+    double *b = work1;
+
+    // segments may refer to the results of earlier segments:
+    for( run2 = 0; run2 < nInstructions; run2++ )
+        b[run2] = 0.0;
+
+    for( run1 = nSegments-1; run1 >= 0; run1-- ){
+
+        start = 0;
+        if( run1 > 0 ) start = segmentEnd[run1-1];
+
+        if( run1 < nIS ) b[ segmentResult[run1] ] += df  [ segmentTarget[run1] ];
+        else             b[ segmentResult[run1] ] += seed[ segmentTarget[run1] ];
+
+        for( run2 = segmentEnd[run1]-1; run2 >= start; run2-- ){
+
+            const Instruction &op = instructions[run2];
+
+            switch( op.name ){
+
+                case ON_VARIABLE:
+                     df[op.index] += b[run2];
+                     break;
+
+                case ON_DOUBLE_CONSTANT:
+                     break;
+
+                case ON_ADDITION:
+                     b[op.arg1] += b[run2];
+                     b[op.arg2] += b[run2];
+                     break;
+
+                case ON_SUBTRACTION:
+                     b[op.arg1] += b[run2];
+                     b[op.arg2] -= b[run2];
+                     break;
+
+                default:
+                     getPartials( run2, w, pa, pb );
+                     b[op.arg1] += pa*b[run2];
+                     if( op.arg2 >= 0 )
+                         b[op.arg2] += pb*b[run2];
+                     break;
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward2( int number, double *seed, double *dseed,
+                                                 double *df, double *ddf ){
+
+    int run1, run2;
+    double pa, pb, paa, pab, pbb;
+
+    allocateBuffer( number );
+    double *w  = &values [number*nInstructions];
+    double *t  = &dvalues[number*nInstructions];
+    double *s  = work1;
+    double *ss = work2;
+
+    run2 = 0;
+    for( run1 = 0; run1 < nSegments; run1++ ){
+
+        for( ; run2 < segmentEnd[run1]; run2++ ){
+
+            const Instruction &op = instructions[run2];
+
+            switch( op.name ){
+
+                case ON_VARIABLE:
+                     s [run2] = seed [op.index];
+                     ss[run2] = dseed[op.index];
+                     break;
+
+                case ON_DOUBLE_CONSTANT:
+                     s [run2] = 0.0;
+                     ss[run2] = 0.0;
+                     break;
+
+                default:
+                     getPartials      ( run2, w, pa, pb );
+                     getSecondPartials( run2, w, paa, pab, pbb );
+
+                     if( op.arg2 < 0 ){
+                         s [run2] = pa*s[op.arg1];
+                         ss[run2] = pa*ss[op.arg1] + paa*t[op.arg1]*s[op.arg1];
+                     }
+                     else{
+                         s [run2] = pa*s[op.arg1] + pb*s[op.arg2];
+                         ss[run2] = pa*ss[op.arg1] + pb*ss[op.arg2]
+                                  + paa*t[op.arg1]*s[op.arg1]
+                                  + pab*( t[op.arg1]*s[op.arg2] + t[op.arg2]*s[op.arg1] )
+                                  + pbb*t[op.arg2]*s[op.arg2];
+                     }
+                     break;
+            }
+        }
+
+        if( run1 < nIS ){
+            seed [ segmentTarget[run1] ] =  s[ segmentResult[run1] ];
+            dseed[ segmentTarget[run1] ] = ss[ segmentResult[run1] ];
+        }
+        else{
+            df   [ segmentTarget[run1] ] =  s[ segmentResult[run1] ];
+            ddf  [ segmentTarget[run1] ] = ss[ segmentResult[run1] ];
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_backward2( int number, double *seed1, double *seed2,
+                                                  double *df, double *ddf ){
+
+    int run1, run2, start;
+    double pa, pb, paa, pab, pbb;
+
+    allocateBuffer( number );
+    double *w  = &values [number*nInstructions];
+    double *t  = &dvalues[number*nInstructions];
+    double *l  = work1;
+    double *m  = work2;
+
+    // segments may refer to the results of earlier segments:
+    for( run2 = 0; run2 < nInstructions; run2++ ){
+        l[run2] = 0.0;
+        m[run2] = 0.0;
+    }
+
+    for( run1 = nSegments-1; run1 >= 0; run1-- ){
+
+        start = 0;
+        if( run1 > 0 ) start = segmentEnd[run1-1];
+
+        if( run1 < nIS ){
+            l[ segmentResult[run1] ] += df   [ segmentTarget[run1] ];
+            m[ segmentResult[run1] ] += ddf  [ segmentTarget[run1] ];
+        }
+        else{
+            l[ segmentResult[run1] ] += seed1[ segmentTarget[run1] ];
+            m[ segmentResult[run1] ] += seed2[ segmentTarget[run1] ];
+        }
+
+        for( run2 = segmentEnd[run1]-1; run2 >= start; run2-- ){
+
+            const Instruction &op = instructions[run2];
+
+            switch( op.name ){
+
+                case ON_VARIABLE:
+                     df [op.index] += l[run2];
+                     ddf[op.index] += m[run2];
+                     break;
+
+                case ON_DOUBLE_CONSTANT:
+                     break;
+
+                default:
+                     getPartials      ( run2, w, pa, pb );
+                     getSecondPartials( run2, w, paa, pab, pbb );
+
+                     if( op.arg2 < 0 ){
+                         l[op.arg1] += pa*l[run2];
+                         m[op.arg1] += pa*m[run2] + l[run2]*paa*t[op.arg1];
+                     }
+                     else{
+                         l[op.arg1] += pa*l[run2];
+                         m[op.arg1] += pa*m[run2] + l[run2]*( paa*t[op.arg1] + pab*t[op.arg2] );
+                         l[op.arg2] += pb*l[run2];
+                         m[op.arg2] += pb*m[run2] + l[run2]*( pab*t[op.arg1] + pbb*t[op.arg2] );
+                     }
+                     break;
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::clearBuffer( ){
+
+    if( bufferSize > 1 ){
+
+        bufferSize = 1;
+        values  = (double*)realloc(  values,nInstructions*sizeof(double) );
+        dvalues = (double*)realloc( dvalues,nInstructions*sizeof(double) );
+    }
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::exportCode( FILE       *file             ,
+                                                const char *realString       ,
+                                                const char *tmpName          ,
+                                                int        &nOperationsBefore,
+                                                int        &nOperationsAfter   ) const{
+
+    int run1, a, b, nTmp;
+
+    nOperationsBefore = 0;
+    nOperationsAfter  = 0;
+
+    if( isCompiled() == BT_FALSE )
+        return RET_INVALID_ARGUMENTS;
+
+    ExportTable table;
+    table.rep        = (int*)        calloc( nInstructions,sizeof(int)         );
+    table.uses       = (int*)        calloc( nInstructions,sizeof(int)         );
+    table.tmp        = (int*)        calloc( nInstructions,sizeof(int)         );
+    table.isConstant = (BooleanType*)calloc( nInstructions,sizeof(BooleanType) );
+    table.constant   = (double*)     calloc( nInstructions,sizeof(double)      );
+
+    double *cost = (double*)calloc( nInstructions,sizeof(double) );
+
+    // the intermediate states are substituted by their expressions:
+    std::map< int, int > isResult;
+    for( run1 = 0; run1 < nIS; run1++ )
+        isResult[ segmentTarget[run1] ] = segmentResult[run1];
+
+    InstructionTable instructions_;
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( run1 = 0; run1 < nInstructions; run1++ ){
+
+        const Instruction &op = instructions[run1];
+
+        table.isConstant[run1] = BT_FALSE;
+        table.tmp       [run1] = -1;
+
+        if( op.name == ON_VARIABLE ){
+
+            std::map< int, int >::const_iterator it = isResult.find( op.index );
+
+            if( it == isResult.end() ){
+                table.rep[run1] = run1;
+            }
+            else{
+                if( it->second >= run1 ){
+                    returnvalue = RET_INVALID_ARGUMENTS;
+                    break;
+                }
+                table.rep[run1] = table.rep[ it->second ];
+            }
+        }
+        else{
+
+            // the printer of the operator trees emits each node as
+            // often as it is reached:
+            if( op.arg1 >= 0 )
+                cost[run1] = 1.0 + cost[op.arg1];
+            if( op.arg2 >= 0 )
+                cost[run1] += cost[op.arg2];
+
+            a = simplify( run1, table );
+
+            if( a != run1 || table.isConstant[run1] == BT_TRUE ){
+                table.rep[run1] = a;
+            }
+            else{
+                Instruction key = op;
+                key.arg1 = table.rep[op.arg1];
+                if( op.arg2 >= 0 )
+                    key.arg2 = table.rep[op.arg2];
+
+                if( ( op.name == ON_ADDITION || op.name == ON_PRODUCT ) && key.arg1 > key.arg2 ){
+                    key.arg1 = key.arg2;
+                    key.arg2 = table.rep[op.arg1];
+                }
+
+                InstructionTable::const_iterator it = instructions_.find( key );
+                if( it != instructions_.end() ){
+                    table.rep[run1] = it->second;
+                }
+                else{
+                    instructions_[key] = run1;
+                    table.rep[run1]    = run1;
+                }
+            }
+        }
+
+        table.isConstant[run1] = table.isConstant[ table.rep[run1] ];
+        table.constant  [run1] = table.constant  [ table.rep[run1] ];
+    }
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        for( run1 = 0; run1 < nSegments; run1++ )
+            nOperationsBefore += (int)cost[ segmentResult[run1] ];
+
+        // count the uses of the remaining instructions, starting from the outputs:
+        for( run1 = nIS; run1 < nSegments; run1++ ){
+            a = table.rep[ segmentResult[run1] ];
+            if( table.isConstant[a] == BT_FALSE )
+                table.uses[a]++;
+        }
+
+        for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+            const Instruction &op = instructions[run1];
+
+            if( table.uses[run1] == 0 || table.rep[run1] != run1 ||
+                table.isConstant[run1] == BT_TRUE || op.name == ON_VARIABLE )
+                continue;
+
+            nOperationsAfter++;
+
+            a = table.rep[op.arg1];
+            if( table.isConstant[a] == BT_FALSE ){
+                if( op.name == ON_POWER_INT && op.index == 2 )
+                    table.uses[a] += 2;
+                else
+                    table.uses[a]++;
+            }
+            if( op.arg2 >= 0 ){
+                b = table.rep[op.arg2];
+                if( table.isConstant[b] == BT_FALSE )
+                    table.uses[b]++;
+            }
+        }
+
+        // results which are used more than once are stored in temporaries:
+        nTmp = 0;
+        for( run1 = 0; run1 < nInstructions; run1++ )
+            if( table.uses[run1] > 1 && table.rep[run1] == run1 &&
+                table.isConstant[run1] == BT_FALSE && instructions[run1].name != ON_VARIABLE )
+                table.tmp[run1] = nTmp++;
+
+        if( file != NULL ){
+
+            acadoFPrintf(file,"/* COMPUTE COMMON SUBEXPRESSIONS: */\n");
+            acadoFPrintf(file,"/* ------------------------------ */\n");
+
+            if( nTmp > 0 )
+                acadoFPrintf(file,"%s %s[%d];\n", realString,tmpName,nTmp );
+
+            for( run1 = 0; run1 < nInstructions; run1++ ){
+                if( table.tmp[run1] >= 0 ){
+                    Stream stream;
+                    stream << tmpName << "[" << table.tmp[run1] << "] = ";
+                    printExpression( stream, run1, table, tmpName, BT_TRUE );
+                    stream << ";\n";
+                    file << stream;
+                }
+            }
+
+            acadoFPrintf(file,"\n");
+            acadoFPrintf(file,"/* COMPUTE OUTPUT: */\n");
+            acadoFPrintf(file,"/* --------------- */\n");
+
+            for( run1 = nIS; run1 < nSegments; run1++ ){
+                Stream stream;
+                stream << "acado_f[" << segmentTarget[run1] << "] = ";
+                printExpression( stream, segmentResult[run1], table, tmpName, BT_FALSE );
+                stream << ";\n";
+                file << stream;
+            }
+        }
+    }
+
+    free( table.rep        );
+    free( table.uses       );
+    free( table.tmp        );
+    free( table.isConstant );
+    free( table.constant   );
+    free( cost );
+
+    return returnvalue;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+bool FunctionEvaluationTape::InstructionLess::operator()( const Instruction &a,
+                                                          const Instruction &b ) const{
+
+    // unary operators are identified by their name, constants by their bits:
+    if( a.name  != b.name  ) return a.name  < b.name ;
+    if( a.arg1  != b.arg1  ) return a.arg1  < b.arg1 ;
+    if( a.arg2  != b.arg2  ) return a.arg2  < b.arg2 ;
+    if( a.index != b.index ) return a.index < b.index;
+    return memcmp( &a.value,&b.value,sizeof(double) ) < 0;
+}
+
+
+int FunctionEvaluationTape::append( Operator         *arg         ,
+                                    InstructionTable &instructions_,
+                                    NodeTable        &nodes         ){
+
+    int a1, a2, idx;
+
+    // only nodes with several owners can be reached twice:
+    if( Operator::isSharedArgument( arg ) == BT_TRUE ){
+        NodeTable::const_iterator it = nodes.find( arg );
+        if( it != nodes.end() )
+            return it->second;
+    }
+
+    Instruction op = emptyInstruction( arg->getName() );
+
+    switch( arg->getName() ){
+
+        case ON_VARIABLE:
+             op.index = ((Projection*)arg)->variableIndex;
+             op.node  = arg;
+             break;
+
+        case ON_DOUBLE_CONSTANT:
+             op.value = arg->getValue();
+             break;
+
+        case ON_SIN:
+        case ON_COS:
+        case ON_TAN:
+        case ON_ASIN:
+        case ON_ACOS:
+        case ON_ATAN:
+        case ON_LOGARITHM:
+        case ON_EXP:
+             a1 = append( ((UnaryOperator*)arg)->argument, instructions_, nodes );
+             if( a1 < 0 ) return -1;
+             op.arg1  = a1;
+             op.fcn   = ((UnaryOperator*)arg)->fcn;
+             op.dfcn  = ((UnaryOperator*)arg)->dfcn;
+             op.ddfcn = ((UnaryOperator*)arg)->ddfcn;
+             break;
+
+        case ON_POWER_INT:
+             a1 = append( ((Power_Int*)arg)->argument, instructions_, nodes );
+             if( a1 < 0 ) return -1;
+             op.arg1  = a1;
+             op.index = ((Power_Int*)arg)->exponent;
+             break;
+
+        case ON_ADDITION:
+        case ON_SUBTRACTION:
+        case ON_PRODUCT:
+        case ON_QUOTIENT:
+        case ON_POWER:
+             a1 = append( ((BinaryOperator*)arg)->argument1, instructions_, nodes );
+             if( a1 < 0 ) return -1;
+             a2 = append( ((BinaryOperator*)arg)->argument2, instructions_, nodes );
+             if( a2 < 0 ) return -1;
+             op.arg1 = a1;
+             op.arg2 = a2;
+             break;
+
+        default:
+             return -1;
+    }
+
+    idx = addInstruction( op, instructions_ );
+    if( Operator::isSharedArgument( arg ) == BT_TRUE )
+        nodes[arg] = idx;
+
+    return idx;
+}
+
+
+int FunctionEvaluationTape::addInstruction( const Instruction &op, InstructionTable &instructions_ ){
+
+    InstructionTable::const_iterator it = instructions_.find( op );
+    if( it != instructions_.end() )
+        return it->second;
+
+    instructions = (Instruction*)realloc( instructions,(nInstructions+1)*sizeof(Instruction) );
+    instructions[nInstructions] = op;
+    instructions_[op] = nInstructions;
+
+    return nInstructions++;
+}
+
+
+FunctionEvaluationTape::Instruction FunctionEvaluationTape::emptyInstruction( OperatorName name_ ){
+
+    Instruction op;
+
+    op.name  = name_;
+    op.arg1  = -1;
+    op.arg2  = -1;
+    op.index = -1;
+    op.value = 0.0;
+    op.fcn   = 0;
+    op.dfcn  = 0;
+    op.ddfcn = 0;
+    op.node  = 0;
+
+    return op;
+}
+
+
+void FunctionEvaluationTape::allocateBuffer( int number ){
+
+    if( number >= bufferSize ){
+
+        bufferSize += number;
+        values  = (double*)realloc(  values,bufferSize*nInstructions*sizeof(double) );
+        dvalues = (double*)realloc( dvalues,bufferSize*nInstructions*sizeof(double) );
+    }
+}
+
+
+double FunctionEvaluationTape::computeValue( int i, const double *w, const double *x ) const{
+
+    const Instruction &op = instructions[i];
+
+    switch( op.name ){
+
+        case ON_VARIABLE:        return x[op.index];
+        case ON_DOUBLE_CONSTANT: return op.value;
+        case ON_ADDITION:        return w[op.arg1] + w[op.arg2];
+        case ON_SUBTRACTION:     return w[op.arg1] - w[op.arg2];
+        case ON_PRODUCT:         return w[op.arg1] * w[op.arg2];
+        case ON_QUOTIENT:        return w[op.arg1] / w[op.arg2];
+        case ON_POWER:           return pow( w[op.arg1],w[op.arg2] );
+        case ON_POWER_INT:       return pow( w[op.arg1],op.index );
+        default:                 return (*op.fcn)( w[op.arg1] );
+    }
+}
+
+
+double FunctionEvaluationTape::computeTangent( int i, const double *w, const double *dw,
+                                               const double *seed ) const{
+
+    double pa, pb;
+    const Instruction &op = instructions[i];
+
+    switch( op.name ){
+
+        case ON_VARIABLE:        return seed[op.index];
+        case ON_DOUBLE_CONSTANT: return 0.0;
+        case ON_ADDITION:        return dw[op.arg1] + dw[op.arg2];
+        case ON_SUBTRACTION:     return dw[op.arg1] - dw[op.arg2];
+        case ON_PRODUCT:         return w[op.arg2]*dw[op.arg1] + w[op.arg1]*dw[op.arg2];
+
+        default:
+             getPartials( i, w, pa, pb );
+             if( op.arg2 < 0 ) return pa*dw[op.arg1];
+             return pa*dw[op.arg1] + pb*dw[op.arg2];
+    }
+}
+
+
+void FunctionEvaluationTape::getPartials( int i, const double *w,
+                                          double &pa, double &pb ) const{
+
+    const Instruction &op = instructions[i];
+
+    pb = 0.0;
+
+    switch( op.name ){
+
+        case ON_VARIABLE:
+        case ON_DOUBLE_CONSTANT:
+             pa = 0.0;
+             break;
+
+        case ON_ADDITION:
+             pa =  1.0;
+             pb =  1.0;
+             break;
+
+        case ON_SUBTRACTION:
+             pa =  1.0;
+             pb = -1.0;
+             break;
+
+        case ON_PRODUCT:
+             pa = w[op.arg2];
+             pb = w[op.arg1];
+             break;
+
+        case ON_QUOTIENT:
+             pa =  1.0/w[op.arg2];
+             pb = -w[op.arg1]/( w[op.arg2]*w[op.arg2] );
+             break;
+
+        case ON_POWER:
+             pa = w[op.arg2]*pow( w[op.arg1],w[op.arg2]-1.0 );
+             pb = w[i]*log( w[op.arg1] );
+             break;
+
+        case ON_POWER_INT:
+             pa = op.index*pow( w[op.arg1],op.index-1 );
+             break;
+
+        default:
+             pa = (*op.dfcn)( w[op.arg1] );
+             break;
+    }
+}
+
+
+void FunctionEvaluationTape::getSecondPartials( int i, const double *w,
+                                                double &paa, double &pab, double &pbb ) const{
+
+    const Instruction &op = instructions[i];
+
+    paa = 0.0;
+    pab = 0.0;
+    pbb = 0.0;
+
+    switch( op.name ){
+
+        case ON_VARIABLE:
+        case ON_DOUBLE_CONSTANT:
+        case ON_ADDITION:
+        case ON_SUBTRACTION:
+             break;
+
+        case ON_PRODUCT:
+             pab = 1.0;
+             break;
+
+        case ON_QUOTIENT:
+             pab = -1.0/( w[op.arg2]*w[op.arg2] );
+             pbb =  2.0*w[op.arg1]/( w[op.arg2]*w[op.arg2]*w[op.arg2] );
+             break;
+
+        case ON_POWER:
+             paa = w[op.arg2]*(w[op.arg2]-1.0)*pow( w[op.arg1],w[op.arg2]-2.0 );
+             pab = pow( w[op.arg1],w[op.arg2]-1.0 )*( w[op.arg2]*log( w[op.arg1] ) + 1.0 );
+             pbb = w[i]*log( w[op.arg1] )*log( w[op.arg1] );
+             break;
+
+        case ON_POWER_INT:
+             paa = op.index*(op.index-1)*pow( w[op.arg1],op.index-2 );
+             break;
+
+        default:
+             paa = (*op.ddfcn)( w[op.arg1] );
+             break;
+    }
+}
+
+
+int FunctionEvaluationTape::simplify( int i, ExportTable &table ) const{
+
+    const Instruction &op = instructions[i];
+
+    if( op.name == ON_DOUBLE_CONSTANT ){
+        table.isConstant[i] = BT_TRUE;
+        table.constant  [i] = op.value;
+        return i;
+    }
+
+    int a = table.rep[op.arg1];
+    int b = -1;
+    if( op.arg2 >= 0 )
+        b = table.rep[op.arg2];
+
+    if( table.isConstant[a] == BT_TRUE && ( b < 0 || table.isConstant[b] == BT_TRUE ) ){
+        table.isConstant[i] = BT_TRUE;
+        table.constant  [i] = computeValue( i, table.constant, 0 );
+        return i;
+    }
+
+    BooleanType isZeroA = BT_FALSE, isOneA = BT_FALSE;
+    BooleanType isZeroB = BT_FALSE, isOneB = BT_FALSE;
+
+    if( table.isConstant[a] == BT_TRUE ){
+        isZeroA = isExactly( table.constant[a],0.0 );
+        isOneA  = isExactly( table.constant[a],1.0 );
+    }
+    if( b >= 0 && table.isConstant[b] == BT_TRUE ){
+        isZeroB = isExactly( table.constant[b],0.0 );
+        isOneB  = isExactly( table.constant[b],1.0 );
+    }
+
+    switch( op.name ){
+
+        case ON_ADDITION:
+             if( isZeroA == BT_TRUE ) return b;
+             if( isZeroB == BT_TRUE ) return a;
+             break;
+
+        case ON_SUBTRACTION:
+             if( isZeroB == BT_TRUE ) return a;
+             break;
+
+        case ON_PRODUCT:
+             if( isZeroA == BT_TRUE || isZeroB == BT_TRUE ){
+                 table.isConstant[i] = BT_TRUE;
+                 table.constant  [i] = 0.0;
+                 return i;
+             }
+             if( isOneA == BT_TRUE ) return b;
+             if( isOneB == BT_TRUE ) return a;
+             break;
+
+        case ON_QUOTIENT:
+        case ON_POWER:
+             if( isOneB == BT_TRUE ) return a;
+             break;
+
+        case ON_POWER_INT:
+             if( op.index == 0 ){
+                 table.isConstant[i] = BT_TRUE;
+                 table.constant  [i] = 1.0;
+                 return i;
+             }
+             if( op.index == 1 ) return a;
+             break;
+
+        default:
+             break;
+    }
+
+    return i;
+}
+
+
+void FunctionEvaluationTape::printExpression( Stream            &stream ,
+                                              int                i      ,
+                                              const ExportTable &table  ,
+                                              const char        *tmpName,
+                                              BooleanType        isTop    ) const{
+
+    int r = table.rep[i];
+
+    if( table.isConstant[r] == BT_TRUE ){
+        stream << "(real_t)(" << table.constant[r] << ")";
+        return;
+    }
+
+    if( isTop == BT_FALSE && table.tmp[r] >= 0 ){
+        stream << tmpName << "[" << table.tmp[r] << "]";
+        return;
+    }
+
+    const Instruction &op = instructions[r];
+    const char *cName = 0;
+
+    switch( op.name ){
+
+        case ON_VARIABLE:
+             op.node->print( stream );
+             return;
+
+        case ON_SIN:       cName = "sin";  break;
+        case ON_COS:       cName = "cos";  break;
+        case ON_TAN:       cName = "tan";  break;
+        case ON_ASIN:      cName = "asin"; break;
+        case ON_ACOS:      cName = "acos"; break;
+        case ON_ATAN:      cName = "atan"; break;
+        case ON_LOGARITHM: cName = "log";  break;
+        case ON_EXP:       cName = "exp";  break;
+
+        case ON_POWER_INT:
+             if( op.index == 2 ){
+                 stream << "((";
+                 printExpression( stream, op.arg1, table, tmpName, BT_FALSE );
+                 stream << ")*(";
+                 printExpression( stream, op.arg1, table, tmpName, BT_FALSE );
+                 stream << "))";
+             }
+             else{
+                 stream << "(pow(";
+                 printExpression( stream, op.arg1, table, tmpName, BT_FALSE );
+                 stream << "," << op.index << "))";
+             }
+             return;
+
+        case ON_POWER:
+             if( table.isConstant[ table.rep[op.arg2] ] == BT_TRUE &&
+                 isExactly( table.constant[ table.rep[op.arg2] ],0.5 ) == BT_TRUE ){
+                 stream << "(sqrt(";
+                 printExpression( stream, op.arg1, table, tmpName, BT_FALSE );
+                 stream << "))";
+             }
+             else{
+                 stream << "(pow(";
+                 printExpression( stream, op.arg1, table, tmpName, BT_FALSE );
+                 stream << ",";
+                 printExpression( stream, op.arg2, table, tmpName, BT_FALSE );
+                 stream << "))";
+             }
+             return;
+
+        case ON_ADDITION:    cName = "+"; break;
+        case ON_SUBTRACTION: cName = "-"; break;
+        case ON_PRODUCT:     cName = "*"; break;
+        case ON_QUOTIENT:    cName = "/"; break;
+
+        default:
+             return;
+    }
+
+    if( op.arg2 < 0 ){
+        stream << "(" << cName << "(";
+        printExpression( stream, op.arg1, table, tmpName, BT_FALSE );
+        stream << "))";
+    }
+    else{
+        stream << "(";
+        printExpression( stream, op.arg1, table, tmpName, BT_FALSE );
+        stream << cName;
+        printExpression( stream, op.arg2, table, tmpName, BT_FALSE );
+        stream << ")";
+    }
+}
+
+
+void FunctionEvaluationTape::copy( const FunctionEvaluationTape& arg ){
+
+    int run1;
+
+    nInstructions = arg.nInstructions;
+    nSegments     = arg.nSegments;
+    nIS           = arg.nIS;
+    bufferSize    = arg.bufferSize;
+
+    if( arg.instructions == NULL ){
+        instructions = NULL;
+    }
+    else{
+        instructions = (Instruction*)calloc( nInstructions,sizeof(Instruction) );
+        for( run1 = 0; run1 < nInstructions; run1++ )
+            instructions[run1] = arg.instructions[run1];
+    }
+
+    if( arg.segmentEnd == NULL ){
+        segmentEnd    = NULL;
+        segmentResult = NULL;
+        segmentTarget = NULL;
+    }
+    else{
+        segmentEnd    = (int*)calloc( nSegments,sizeof(int) );
+        segmentResult = (int*)calloc( nSegments,sizeof(int) );
+        segmentTarget = (int*)calloc( nSegments,sizeof(int) );
+        for( run1 = 0; run1 < nSegments; run1++ ){
+            segmentEnd   [run1] = arg.segmentEnd   [run1];
+            segmentResult[run1] = arg.segmentResult[run1];
+            segmentTarget[run1] = arg.segmentTarget[run1];
+        }
+    }
+
+    if( arg.values == NULL ){
+        values  = NULL;
+        dvalues = NULL;
+        work1   = NULL;
+        work2   = NULL;
+    }
+    else{
+        values  = (double*)calloc( bufferSize*nInstructions,sizeof(double) );
+        dvalues = (double*)calloc( bufferSize*nInstructions,sizeof(double) );
+        for( run1 = 0; run1 < bufferSize*nInstructions; run1++ ){
+             values[run1] = arg. values[run1];
+            dvalues[run1] = arg.dvalues[run1];
+        }
+        work1 = (double*)calloc( nInstructions,sizeof(double) );
+        work2 = (double*)calloc( nInstructions,sizeof(double) );
+    }
+
+    tangents  = NULL;
+    nTangents = 0;
+}
+
+
+void FunctionEvaluationTape::deleteAll( ){
+
+    if( instructions  != NULL ) free( instructions  );
+    if( segmentEnd    != NULL ) free( segmentEnd    );
+    if( segmentResult != NULL ) free( segmentResult );
+    if( segmentTarget != NULL ) free( segmentTarget );
+    if( values        != NULL ) free( values        );
+    if( dvalues       != NULL ) free( dvalues       );
+    if( work1         != NULL ) free( work1         );
+    if( work2         != NULL ) free( work2         );
+    if( tangents      != NULL ) free( tangents      );
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -56,11 +56,16 @@ FunctionEvaluationTree::FunctionEvaluationTree( ){
 
     auxVariableName = "acado_aux";
     auxVariableStructName = "acadoWorkspace";
+
+    useTape        = BT_TRUE ;
+    isTapeUpToDate = BT_FALSE;
+    optimizeExport = BT_FALSE;
 }
 
 FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& arg ){
 
     int run1;
+    OperatorCopyTable copies;
 
     dim = arg.dim;
     n   = arg.n  ;
@@ -75,7 +80,7 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
         f = (Operator**)calloc(dim,sizeof(Operator*));
 
         for( run1 = 0; run1 < dim; run1++ ){
-            f[run1] = arg.f[run1]->clone();
+            f[run1] = arg.f[run1]->cloneUnshared( copies );
         }
     }
 
@@ -90,12 +95,17 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
         lhs_comp = (int*)calloc(n,sizeof(int));
 
         for( run1 = 0; run1 < n; run1++ ){
-            sub[run1] = arg.sub[run1]->clone();
+            sub[run1] = arg.sub[run1]->cloneUnshared( copies );
             lhs_comp[run1] = arg.lhs_comp[run1];
         }
     }
 
     safeCopy = arg.safeCopy;
+
+    tape           = arg.tape          ;
+    useTape        = arg.useTape       ;
+    isTapeUpToDate = arg.isTapeUpToDate;
+    optimizeExport = arg.optimizeExport;
 }
 
 
@@ -130,6 +140,7 @@ FunctionEvaluationTree::~FunctionEvaluationTree( ){
 FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluationTree& arg ){
 
     int run1;
+    OperatorCopyTable copies;
 
     if( this != &arg ){
 
@@ -166,7 +177,7 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
             f = (Operator**)calloc(dim,sizeof(Operator*));
 
             for( run1 = 0; run1 < dim; run1++ ){
-                f[run1] = arg.f[run1]->clone();
+                f[run1] = arg.f[run1]->cloneUnshared( copies );
             }
         }
 
@@ -181,11 +192,16 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
             lhs_comp = (int*)calloc(n,sizeof(int));
 
             for( run1 = 0; run1 < n; run1++ ){
-                sub[run1] = arg.sub[run1]->clone();
+                sub[run1] = arg.sub[run1]->cloneUnshared( copies );
                 lhs_comp[run1] = arg.lhs_comp[run1];
             }
         }
         safeCopy = arg.safeCopy;
+
+        tape           = arg.tape          ;
+        useTape        = arg.useTape       ;
+        isTapeUpToDate = arg.isTapeUpToDate;
+        optimizeExport = arg.optimizeExport;
     }
 
     return *this;
@@ -204,6 +220,7 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
     safeCopy << arg;
 
     uint run1;
+    OperatorCopyTable copies;
 
     for( run1 = 0; run1 < arg.getDim(); run1++ ){
 
@@ -213,7 +230,7 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
         f = (Operator**)realloc(f,(dim+1)*sizeof(Operator*));
 
-        f[dim] = arg.element[run1]->clone();
+        f[dim] = arg.element[run1]->cloneUnshared( copies );
         f[dim]-> loadIndices  ( indexList );
 
         sub       = (Operator**)realloc(sub,
@@ -225,6 +242,7 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
         while( nn < n ){
 
+            sub[nn]-> unshareArguments  ( copies    );
             sub[nn]-> enumerateVariables( indexList );
             nn++;
         }
@@ -233,6 +251,9 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
         dim++;
     }
+
+    isTapeUpToDate = BT_FALSE;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -242,6 +263,9 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result ){
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.evaluate( 0, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
 
         sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
@@ -263,10 +287,16 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result, PrintLe
         acadoPrintf("symbolic expression evaluation:\n");
     }
 
+    BooleanType tapeAvailable = isTapeAvailable();
+
+    if( tapeAvailable == BT_TRUE )
+        tape.evaluate( 0, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
 
-        sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
-                                                     lhs_comp[run1]         ) ] );
+        if( tapeAvailable == BT_FALSE )
+            sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
+                                                         lhs_comp[run1]         ) ] );
         if( printL == HIGH ){
             acadoPrintf("sub[%d]  = %.16e \n", lhs_comp[run1],
                     x[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1]) ] );
@@ -275,7 +305,8 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result, PrintLe
 
     for( run1 = 0; run1 < dim; run1++ ){
 
-        f[run1]->evaluate( 0, x, &result[run1] );
+        if( tapeAvailable == BT_FALSE )
+            f[run1]->evaluate( 0, x, &result[run1] );
 
         if( printL == HIGH ){
             acadoPrintf("f[%d]  = %.16e \n", run1, result[run1] );
@@ -294,6 +325,9 @@ returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *res
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.evaluate( number, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
                                                              lhs_comp[run1]         ) ] );
@@ -399,6 +433,9 @@ FunctionEvaluationTree FunctionEvaluationTree::substitute( VariableType variable
     delete tmp.indexList;
     tmp.indexList = indexList->substitute(variableType_, index_);
 
+    tmp.useTape        = useTape;
+    tmp.optimizeExport = optimizeExport;
+
     return tmp;
 }
 
@@ -495,6 +532,35 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
 }
 
 
+returnValue FunctionEvaluationTree::getDependencyPattern( int           nVar     ,
+                                                         VariableType *varType  ,
+                                                         int          *component,
+                                                         BooleanType  *pattern    ){
+
+    int run1;
+
+    // THE INTERMEDIATE STATES ARE REFERENCED BY THEIR GLOBAL INDEX:
+    // -------------------------------------------------------------
+    int nIS = 0;
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > nIS ) nIS = lhs_comp[run1]+1;
+
+    BooleanType *implicit_dep = new BooleanType[nIS+1];
+
+    for( run1 = 0; run1 < nIS; run1++ )
+        implicit_dep[run1] = BT_FALSE;
+
+    for( run1 = 0; run1 < n; run1++ )
+        implicit_dep[lhs_comp[run1]] = sub[run1]->isDependingOn( nVar, varType, component, implicit_dep );
+
+    for( run1 = 0; run1 < dim; run1++ )
+        pattern[run1] = f[run1]->isDependingOn( nVar, varType, component, implicit_dep );
+
+    delete[] implicit_dep;
+    return SUCCESSFUL_RETURN;
+}
+
+
 BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
     int nn = variable.getDim();
@@ -723,6 +789,9 @@ returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_forward( 0, x, seed, ff, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( 0, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -742,6 +811,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *x, double *s
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_forward( number, x, seed, ff, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -759,6 +831,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_forward( number, seed, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, seed,
                          &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
@@ -771,10 +846,46 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 }
 
 
+returnValue FunctionEvaluationTree::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1, run2;
+
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_forward( number, nDir, seed, df );
+
+    // without a tape the directions are propagated one after another:
+    const int nV = getNumberOfVariables()+1;
+
+    double *seed1 = new double[nV ];
+    double *df1   = new double[dim];
+
+    for( run2 = 0; run2 < nDir; run2++ ){
+
+        for( run1 = 0; run1 < nV; run1++ )
+            seed1[run1] = seed[nDir*run1+run2];
+
+        AD_forward( number, seed1, df1 );
+
+        for( run1 = 0; run1 < nV; run1++ )
+            seed[nDir*run1+run2] = seed1[run1];
+        for( run1 = 0; run1 < dim; run1++ )
+            df[nDir*run1+run2] = df1[run1];
+    }
+
+    delete[] seed1;
+    delete[] df1  ;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_backward( 0, seed, df );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward( 0, seed[run1], df );
     }
@@ -796,6 +907,9 @@ returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, doubl
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_backward( number, seed, df );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward( number, seed[run1], df );
     }
@@ -816,6 +930,9 @@ returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_forward2( number, seed, dseed, df, ddf );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward2( number, seed, dseed,
                          &seed [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -834,6 +951,9 @@ returnValue FunctionEvaluationTree::AD_backward2( int number, double *seed1, dou
 
     int run1;
 
+    if( isTapeAvailable() == BT_TRUE )
+        return tape.AD_backward2( number, seed1, seed2, df, ddf );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward2( number, seed1[run1], seed2[run1], df, ddf );
     }
@@ -968,6 +1088,20 @@ returnValue FunctionEvaluationTree::exportCode(	FILE *file,
         acadoFPrintf(file,"%s *acado_dx = acado_x + %d;\n", realString,numX+numXA+numU+getNUI()+getNP()+getNPI()+getNW() );
     }
     acadoFPrintf(file,"\n");
+
+    if( optimizeExport == BT_TRUE ){
+
+        FunctionEvaluationTape exportTape;
+        int nBefore, nAfter;
+
+        if( ( compileTape( exportTape ) == SUCCESSFUL_RETURN ) &&
+            ( exportTape.exportCode( file,realString,"acado_tmp",nBefore,nAfter ) == SUCCESSFUL_RETURN ) ){
+
+            acadoFPrintf(file,"}\n\n");
+            return SUCCESSFUL_RETURN;
+        }
+    }
+
     acadoFPrintf(file,"/* COMPUTE INTERMEDIATE STATES: */\n");
     acadoFPrintf(file,"/* ---------------------------- */\n");
 
@@ -1053,6 +1187,8 @@ returnValue FunctionEvaluationTree::clearBuffer(){
     int run1;
     returnValue returnvalue;
 
+    tape.clearBuffer();
+
     for( run1 = 0; run1 < n; run1++ ){
         returnvalue = sub[run1]->clearBuffer();
         if( returnvalue != SUCCESSFUL_RETURN ){
@@ -1094,6 +1230,8 @@ returnValue FunctionEvaluationTree::makeImplicit( int dim_ ){
         delete tmp;
     }
 
+    isTapeUpToDate = BT_FALSE;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -1207,6 +1345,72 @@ returnValue FunctionEvaluationTree::setAuxVariableStructName(const String& s)
 	return SUCCESSFUL_RETURN;
 }
 
+returnValue FunctionEvaluationTree::useEvaluationTape( BooleanType useTape_ ){
+
+    useTape = useTape_;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::setExportOptimization( BooleanType optimizeExport_ ){
+
+    optimizeExport = optimizeExport_;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::getNumExportOperations( int &nBefore, int &nAfter ) const{
+
+    FunctionEvaluationTape exportTape;
+
+    nBefore = 0;
+    nAfter  = 0;
+
+    if( compileTape( exportTape ) != SUCCESSFUL_RETURN )
+        return RET_INVALID_ARGUMENTS;
+
+    if( exportTape.isCompiled() == BT_FALSE )
+        return SUCCESSFUL_RETURN;
+
+    return exportTape.exportCode( 0, "real_t", "acado_tmp", nBefore, nAfter );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+BooleanType FunctionEvaluationTree::isTapeAvailable( ){
+
+    if( useTape == BT_FALSE )
+        return BT_FALSE;
+
+    if( isTapeUpToDate == BT_FALSE ){
+
+        compileTape( tape );
+        isTapeUpToDate = BT_TRUE;
+    }
+
+    return tape.isCompiled();
+}
+
+
+returnValue FunctionEvaluationTree::compileTape( FunctionEvaluationTape &tape_ ) const{
+
+    int run1;
+    int *isIndex = new int[n+1];
+
+    for( run1 = 0; run1 < n; run1++ )
+        isIndex[run1] = indexList->index( VT_INTERMEDIATE_STATE, lhs_comp[run1] );
+
+    returnValue returnvalue = tape_.compile( n, sub, isIndex, dim, f );
+
+    delete[] isIndex;
+    return returnvalue;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -88,6 +88,22 @@ OCPiterate& OCPiterate::operator=( const OCPiterate& rhs ){
 }
 
 
+returnValue OCPiterate::copyValues( const OCPiterate& rhs ){
+
+    if ( this != &rhs ){
+
+        copyValues( x , rhs.x  );
+        copyValues( xa, rhs.xa );
+        copyValues( p , rhs.p  );
+        copyValues( u , rhs.u  );
+        copyValues( w , rhs.w  );
+
+        inSimulationMode = rhs.inSimulationMode;
+    }
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue OCPiterate::allocateAll( )
 {
     if ( x == 0 )
@@ -449,6 +465,40 @@ void OCPiterate::copy( const OCPiterate& rhs ){
 }
 
 
+void OCPiterate::copyValues( VariablesGrid*& z, const VariablesGrid* const rhs ){
+
+    uint run1, run2;
+
+    if( rhs == 0 ){
+        if( z != 0 ){ delete z; z = 0; }
+        return;
+    }
+
+    BooleanType hasSameStructure = BT_TRUE;
+
+    if( z == 0 || z->getNumPoints() != rhs->getNumPoints() )
+        hasSameStructure = BT_FALSE;
+    else{
+        for( run1 = 0; run1 < rhs->getNumPoints(); run1++ )
+            if( z->getNumValues(run1) != rhs->getNumValues(run1) )
+                hasSameStructure = BT_FALSE;
+    }
+
+    // re-allocate only if the structure has changed:
+    if( hasSameStructure == BT_FALSE ){
+        if( z != 0 ) delete z;
+        z = new VariablesGrid(*rhs);
+        return;
+    }
+
+    for( run1 = 0; run1 < rhs->getNumPoints(); run1++ ){
+        z->setTime( run1, rhs->getTime(run1) );
+        for( run2 = 0; run2 < rhs->getNumValues(run1); run2++ )
+            z->operator()( run1,run2 ) = rhs->operator()( run1,run2 );
+    }
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -80,6 +80,9 @@ Integrator::Integrator( )
 
     tune  = 0.5      ;
     TOL   = 0.000001 ;
+    ATOL  = 1.0e-8   ;
+
+    printProfile = BT_FALSE;
 
 
     // INTERNAL INDEX LISTS:
@@ -210,8 +213,8 @@ returnValue Integrator::integrate(	double t0_  ,
 									double *u   ,
 									double *w    ){
 
-    Grid t_( t0_, tend_, 2 );
-    return integrate( t_, x0, xa, p, u, w );
+    workGrid.init( t0_, tend_, 2 );
+    return integrate( workGrid, x0, xa, p, u, w );
 }
 
 
@@ -223,15 +226,14 @@ returnValue Integrator::integrate(	const Grid  &t_,
 									double      *w  ){
 
     if( rhs == 0 ) return ACADOERROR( RET_TRIVIAL_RHS );
-    Vector components = rhs->getDifferentialStateComponents();
 
-    Vector tmpX ( components.getDim(), x0 );
-    Vector tmpXA( rhs->getNXA()      , xa );
-    Vector tmpP ( rhs->getNP ()      , p  );
-    Vector tmpU ( rhs->getNU ()      , u  );
-    Vector tmpW ( rhs->getNW ()      , w  );
+    workX0.init( rhs->getNumDynamicEquations(), x0 );
+    workXA.init( rhs->getNXA()                , xa );
+    workP .init( rhs->getNP ()                , p  );
+    workU .init( rhs->getNU ()                , u  );
+    workW .init( rhs->getNW ()                , w  );
 
-    return integrate( t_, tmpX, tmpXA, tmpP, tmpU, tmpW );
+    return integrate( t_, workX0, workXA, workP, workU, workW );
 }
 
 
@@ -244,8 +246,8 @@ returnValue Integrator::integrate(	double       t0_  ,
 									const Vector &u   ,
 									const Vector &w    ){
 
-    Grid t_( t0_, tend_, 2 );
-    return integrate( t_, x0, xa, p, u, w );
+    workGrid.init( t0_, tend_, 2 );
+    return integrate( workGrid, x0, xa, p, u, w );
 }
 
 
@@ -261,23 +263,20 @@ returnValue Integrator::integrate(	const Grid   &t_  ,
     returnValue returnvalue;
     if( rhs == 0 ) return ACADOERROR( RET_TRIVIAL_RHS );
 
-    Vector tmpX;
-
-    Vector components = rhs->getDifferentialStateComponents();
-
-    const int N = components.getDim();
+    const int N = rhs->getNumDynamicEquations();
 
     if( x0.getDim() != 0 ){
-        tmpX.init( components.getDim() );
-        for( run1 = 0; run1 < (int) components.getDim(); run1++ )
-            tmpX(run1) = x0((int) components(run1));
+        workX.init( N );
+        for( run1 = 0; run1 < N; run1++ )
+            workX(run1) = x0( rhs->getDifferentialStateComponent(run1) );
     }
+    else workX.init( 0 );
 
 
 // 	tmpX.print( "integrator x0" );
 // 	u.print( "integrator u0" );
 // 	p.print( "integrator p0" );
-    returnvalue = evaluate( tmpX, xa, p, u, w, t_ );
+    returnvalue = evaluate( workX, xa, p, u, w, t_ );
 
     if( returnvalue != SUCCESSFUL_RETURN )
         return returnvalue;
@@ -285,14 +284,14 @@ returnValue Integrator::integrate(	const Grid   &t_  ,
     xE.init(rhs->getDim());
     xE.setZero();
 
-    Vector tmp(rhs->getDim());
-    getProtectedX(&tmp);
+    workXE.init( rhs->getDim() );
+    getProtectedX( &workXE );
 
     for( run1 = 0; run1 < N; run1++ )
-        xE((int) components(run1)) = tmp(run1);
+        xE( rhs->getDifferentialStateComponent(run1) ) = workXE(run1);
 
     for( run1 = N; run1 < N + ma; run1++ )
-        xE(run1) = tmp(run1);
+        xE(run1) = workXE(run1);
 
     if( transition != 0 )
         returnvalue = evaluateTransition( t_.getLastTime(), xE, xa, p, u, w );
@@ -381,16 +380,15 @@ returnValue Integrator::integrateSensitivities( ){
     int order = 1;
     if( nFDirs2 > 0 ) order = 2;
 
-    Matrix tmp( rhs->getDim(), 1 );
-    returnvalue = getProtectedForwardSensitivities(&tmp,order);
-
-    Vector components = rhs->getDifferentialStateComponents();
+    // the work matrix and dX keep their storage across calls:
+    workDX.init( rhs->getDim(), 1 );
+    returnvalue = getProtectedForwardSensitivities(&workDX,order);
 
     dX.init(rhs->getDim()-ma);
     dX.setZero();
 
-    for( run1 = 0; run1 < components.getDim(); run1++ )
-        dX((int) components(run1)) = tmp(run1,0);
+    for( run1 = 0; run1 < (uint)rhs->getNumDynamicEquations(); run1++ )
+        dX( rhs->getDifferentialStateComponent(run1) ) = workDX(run1,0);
 
     if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
 
@@ -401,6 +399,43 @@ returnValue Integrator::integrateSensitivities( ){
 }
 
 
+returnValue Integrator::integrateForwardSensitivities(	const Matrix &xSeed,
+														const Matrix &pSeed,
+														const Matrix &uSeed,
+														const Matrix &wSeed,
+														Matrix       &D      ){
+
+    int run1;
+    int nDir = 0;
+    returnValue returnvalue;
+
+    nDir = acadoMax( nDir, xSeed.getNumCols() );
+    nDir = acadoMax( nDir, pSeed.getNumCols() );
+    nDir = acadoMax( nDir, uSeed.getNumCols() );
+    nDir = acadoMax( nDir, wSeed.getNumCols() );
+
+    D.init( rhs->getDim()-ma, nDir );
+
+    for( run1 = 0; run1 < nDir; run1++ ){
+
+        Vector tmpX; if( xSeed.isEmpty() == BT_FALSE ) tmpX = xSeed.getCol( run1 );
+        Vector tmpP; if( pSeed.isEmpty() == BT_FALSE ) tmpP = pSeed.getCol( run1 );
+        Vector tmpU; if( uSeed.isEmpty() == BT_FALSE ) tmpU = uSeed.getCol( run1 );
+        Vector tmpW; if( wSeed.isEmpty() == BT_FALSE ) tmpW = wSeed.getCol( run1 );
+
+        returnvalue = setForwardSeed( 1, tmpX, tmpP, tmpU, tmpW );
+        if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+        returnvalue = integrateSensitivities( );
+        if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+        D.setCol( run1, dX );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Integrator::getForwardSensitivities(	Vector &Dx,
 													int order ) const{
 
@@ -586,14 +621,30 @@ void Integrator::initializeOptions(){
 
     get( MAX_NUM_INTEGRATOR_STEPS         , maxNumberOfSteps  );
     get( INTEGRATOR_TOLERANCE  , TOL               );
+    get( ABSOLUTE_TOLERANCE    , ATOL              );
     get( INITIAL_INTEGRATOR_STEPSIZE      , hini              );
     get( MIN_INTEGRATOR_STEPSIZE          , hmin              );
     get( MAX_INTEGRATOR_STEPSIZE          , hmax              );
     get( STEPSIZE_TUNING       , tune              );
     get( INTEGRATOR_PRINTLEVEL , PrintLevel        );
     get( LINEAR_ALGEBRA_SOLVER , las               );
+    get( PRINT_INTEGRATOR_PROFILE, printProfile    );
 }
 
+void Integrator::initializeStorage( VariablesGrid &storage, int nValues ) const{
+
+    if( storage.getNumPoints() != timeInterval.getNumPoints() ||
+        (int) storage.getNumValues() != nValues ){
+
+        storage.init( nValues, timeInterval );
+        return;
+    }
+
+    for( uint run1 = 0; run1 < timeInterval.getNumPoints(); run1++ )
+        storage.setTime( run1, timeInterval.getTime(run1) );
+}
+
+
 returnValue Integrator::setupLogging( ){
 
     LogRecord tmp( LOG_AT_EACH_ITERATION,stdout,PS_DEFAULT );
@@ -607,6 +658,10 @@ returnValue Integrator::setupLogging( ){
     tmp.addItem( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION,      "",     "TIME FOR JACOBIAN EVALUATIONS    :  "," sec.\n", 9, 3 );
     tmp.addItem( LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION,   "",     "TIME FOR JACOBIAN DECOMPOSITIONS :  "," sec.\n", 9, 3 );
 
+    // only the statistics of the last integration are printed, hence the
+    // record neither grows nor allocates with the number of integrate calls
+    tmp.setMaxNumPoints( 1 );
+
     outputLoggingIdx = addLogRecord( tmp );
 
     return SUCCESSFUL_RETURN;
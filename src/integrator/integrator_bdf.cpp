@@ -295,6 +295,8 @@ void IntegratorBDF::allocateMemory( ){
         diff_index[md+run1] = alg_index [run1];
     }
 
+    determineJacobianColoring();
+
     control_index       = new int[mu ];
 
     for( run1 = 0; run1 < mu; run1++ ){
@@ -422,6 +424,9 @@ void IntegratorBDF::initializeVariables(){
     nOfNewtonSteps = 0;
     maxNM = 0; M = 0; M_index = 0; nOfM = 0;
 
+    nColors = 0; colorStart = 0; colorColumns = 0;
+    jacStart = 0; jacRows = 0;
+
     F  = 0; F2 = 0;
 
     initial_guess = 0;
@@ -616,7 +621,7 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
     diff_index = new int[m];
 
     for( run1 = 0; run1 < md; run1++ ){
-        diff_index[run1] = rhs->index( VT_DIFFERENTIAL_STATE, run1 );
+        diff_index[run1] = rhs->getStateEnumerationIndex( run1 );
         if( diff_index[run1] == rhs->getNumberOfVariables() ){
             diff_index[run1] = diff_index[run1] + 1 + run1;
         }
@@ -638,6 +643,8 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
         diff_index[md+run1] = alg_index [run1];
     }
 
+    determineJacobianColoring();
+
     control_index       = new int[mu ];
 
     for( run1 = 0; run1 < mu; run1++ ){
@@ -923,6 +930,11 @@ void IntegratorBDF::deleteAll(){
         free(M_index);
     }
 
+    if( colorStart   != 0 ) delete[] colorStart  ;
+    if( colorColumns != 0 ) delete[] colorColumns;
+    if( jacStart     != 0 ) delete[] jacStart    ;
+    if( jacRows      != 0 ) free(jacRows)        ;
+
     if( F != NULL )
         delete[] F;
     if( F2 != NULL )
@@ -1087,7 +1099,9 @@ returnValue IntegratorBDF::unfreeze(){
         }
     }
 
-    for( run1 = 0; run1 < maxNM; run1++ ){
+    // the first Jacobian is kept, such that its sparsity analysis
+    // can be re-used by the next integration:
+    for( run1 = 1; run1 < maxNM; run1++ ){
          if( M[run1] != 0  )
              delete M[run1];
          M[run1] = 0;
@@ -2404,39 +2418,23 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
                        M[run1] = 0;
                }
                M_index[stepnumber] = nOfM;
-               M[nOfM] = new Matrix(m,m);
+               if( M[nOfM] == 0 ){
+                   // a copy inherits the sparsity analysis of the previous Jacobian:
+                   if( nOfM > 0 ) M[nOfM] = new Matrix(*M[nOfM-1]);
+                   else           M[nOfM] = new Matrix(m,m);
+               }
+               if( M[nOfM]->getNumRows() != (uint) m ) M[nOfM]->init(m,m);
                nOfM++;
            }
            else{
                if( M[0] == 0 ) M[0] = new Matrix(m,m);
                M_index[stepnumber] = 0;
-               M[0]->init(m,m);
+               if( M[0]->getNumRows() != (uint) m ) M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = gamma[stepnumber][4];
-               iseed[ diff_index[run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
-           }
-
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                        k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
+           if( evaluateJacobian( 3*stepnumber+newtonsteps, gamma[stepnumber][4], 1.0,
+                                 *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN ){
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
            }
 
            nJacEvaluations++;
@@ -2911,40 +2909,23 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
                        M[run1] = 0;
                }
                M_index[stepnumber] = nOfM;
-               M[nOfM] = new Matrix(m,m);
+               if( M[nOfM] == 0 ){
+                   // a copy inherits the sparsity analysis of the previous Jacobian:
+                   if( nOfM > 0 ) M[nOfM] = new Matrix(*M[nOfM-1]);
+                   else           M[nOfM] = new Matrix(m,m);
+               }
+               if( M[nOfM]->getNumRows() != (uint) m ) M[nOfM]->init(m,m);
                nOfM++;
            }
            else{
                if( M[0] == 0 ) M[0] = new Matrix(m,m);
                M_index[stepnumber] = 0;
-               M[0]->init(m,m);
+               if( M[0]->getNumRows() != (uint) m ) M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = 1.0;
-               iseed[ diff_index[run1]] = ise;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
-           }
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
+           if( evaluateJacobian( 3*stepnumber+newtonsteps, 1.0, ise,
+                                 *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN ){
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
            }
 
            nJacEvaluations++;
@@ -5095,6 +5076,127 @@ void IntegratorBDF::printRKIntermediateResults(){
 }
 
 
+returnValue IntegratorBDF::determineJacobianColoring(){
+
+    int run1, run2, run3;
+
+
+    // STRUCTURAL PATTERN OF THE ITERATION MATRIX (COLUMN BY COLUMN):
+    // ---------------------------------------------------------------
+    VariableType  varType  [2];
+    int           component[2];
+    BooleanType  *dep = new BooleanType[m];
+
+    Vector xComponents = rhs->getDifferentialStateComponents();
+
+    jacStart    = new int[m+1];
+    jacRows     = 0;
+    jacStart[0] = 0;
+
+    for( run1 = 0; run1 < m; run1++ ){
+
+        if( run1 < md ){
+            varType[0] = VT_DIFFERENTIAL_STATE ; component[0] = (int) xComponents(run1);
+            varType[1] = VT_DDIFFERENTIAL_STATE; component[1] = run1;
+            rhs->getDependencyPattern( 2, varType, component, dep );
+        }
+        else{
+            varType[0] = VT_ALGEBRAIC_STATE; component[0] = run1-md;
+            rhs->getDependencyPattern( 1, varType, component, dep );
+        }
+
+        jacStart[run1+1] = jacStart[run1];
+        for( run2 = 0; run2 < m; run2++ )
+            if( dep[run2] == BT_TRUE ) jacStart[run1+1]++;
+
+        jacRows = (int*)realloc(jacRows,(jacStart[run1+1]+1)*sizeof(int));
+
+        run3 = jacStart[run1];
+        for( run2 = 0; run2 < m; run2++ )
+            if( dep[run2] == BT_TRUE ) jacRows[run3++] = run2;
+    }
+
+
+    // GREEDY COLORING: COLUMNS OF THE SAME COLOR DO NOT SHARE ANY ROW,
+    // SUCH THAT THEY CAN BE EVALUATED WITH A SINGLE FORWARD SWEEP:
+    // ----------------------------------------------------------------
+    int         *color   = new int[m];
+    BooleanType *rowUsed = 0;
+
+    nColors = 0;
+
+    for( run1 = 0; run1 < m; run1++ ){
+
+        color[run1] = 0;
+        while( color[run1] < nColors ){
+            for( run2 = jacStart[run1]; run2 < jacStart[run1+1]; run2++ )
+                if( rowUsed[color[run1]*m+jacRows[run2]] == BT_TRUE ) break;
+            if( run2 == jacStart[run1+1] ) break;
+            color[run1]++;
+        }
+        if( color[run1] == nColors ){
+            rowUsed = (BooleanType*)realloc(rowUsed,(nColors+1)*m*sizeof(BooleanType));
+            for( run2 = 0; run2 < m; run2++ )
+                rowUsed[nColors*m+run2] = BT_FALSE;
+            nColors++;
+        }
+        for( run2 = jacStart[run1]; run2 < jacStart[run1+1]; run2++ )
+            rowUsed[color[run1]*m+jacRows[run2]] = BT_TRUE;
+    }
+
+    colorStart   = new int[nColors+1];
+    colorColumns = new int[m];
+
+    run3 = 0;
+    for( run1 = 0; run1 < nColors; run1++ ){
+        colorStart[run1] = run3;
+        for( run2 = 0; run2 < m; run2++ )
+            if( color[run2] == run1 )
+                colorColumns[run3++] = run2;
+    }
+    colorStart[nColors] = run3;
+
+    free(rowUsed);
+    delete[] color;
+    delete[] dep;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorBDF::evaluateJacobian( int number, double dSeed, double xSeed, Matrix &J ){
+
+    int run1, run2, run3;
+
+    J.setZero();
+
+    for( run1 = 0; run1 < nColors; run1++ ){
+
+        for( run2 = colorStart[run1]; run2 < colorStart[run1+1]; run2++ ){
+            if( colorColumns[run2] < md ){
+                iseed[ddiff_index[colorColumns[run2]]] = dSeed;
+                iseed[ diff_index[colorColumns[run2]]] = xSeed;
+            }
+            else iseed[diff_index[colorColumns[run2]]] = 1.0;
+        }
+
+        if( rhs[0].AD_forward( number, iseed, k2[0][0] ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+
+        for( run2 = colorStart[run1]; run2 < colorStart[run1+1]; run2++ ){
+            for( run3 = jacStart[colorColumns[run2]]; run3 < jacStart[colorColumns[run2]+1]; run3++ )
+                J( jacRows[run3], colorColumns[run2] ) = k2[0][0][jacRows[run3]];
+
+            if( colorColumns[run2] < md )
+                iseed[ddiff_index[colorColumns[run2]]] = 0.0;
+            iseed[diff_index[colorColumns[run2]]] = 0.0;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue IntegratorBDF::decomposeJacobian( Matrix &J ) const{
 
     switch( las ){
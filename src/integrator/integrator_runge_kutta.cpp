@@ -125,6 +125,7 @@ returnValue IntegratorRK::init( const DifferentialEquation &rhs_ ){
     mw  = rhs->getNW  ();
 
     allocateMemory();
+    optionsUpToDate = BT_FALSE;
 
     return SUCCESSFUL_RETURN;
 }
@@ -141,6 +142,9 @@ void IntegratorRK::initializeVariables(){
 
     H = 0; etaH = 0; H2 = 0; H3 = 0;
     etaH2 = 0; etaH3 = 0;
+    etaG_ = 0; etaG3_ = 0;
+
+    optionsUpToDate = BT_FALSE;
 
     maxAlloc  = 0;
     err_power = 1.0;
@@ -182,6 +186,9 @@ void IntegratorRK::allocateMemory( ){
         eta5_[run1] = 0.0;
     }
 
+    etaG_  = new double [m];
+    etaG3_ = new double [m];
+
     k     = new double*[dim];
     k2    = new double*[dim];
     l     = new double*[dim];
@@ -319,6 +326,12 @@ void IntegratorRK::deleteAll(){
     if( eta5_ != NULL ){
         delete[] eta5_;
     }
+    if( etaG_ != NULL ){
+        delete[] etaG_;
+    }
+    if( etaG3_ != NULL ){
+        delete[] etaG3_;
+    }
 
     for( run1 = 0; run1 < dim; run1++ ){
       if( k[run1]  != NULL )
@@ -458,6 +471,9 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
         eta5_[run1] = arg.eta5_[run1];
     }
 
+    etaG_  = new double [m];
+    etaG3_ = new double [m];
+
     k     = new double*[dim];
     k2    = new double*[dim];
     l     = new double*[dim];
@@ -502,6 +518,10 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
 
     tune  = arg.tune;
     TOL   = arg.TOL;
+    ATOL  = arg.ATOL;
+
+    printProfile    = arg.printProfile;
+    optionsUpToDate = arg.optionsUpToDate;
 
     err_power = arg.err_power;
 
@@ -659,12 +679,18 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
         ACADOWARNING(RET_RK45_CAN_NOT_TREAT_DAE);
 
 
-    Integrator::initializeOptions();
+    // the options are only read again after they have been changed:
+    if( optionsUpToDate == BT_FALSE || haveOptionsChanged() == BT_TRUE ){
+        Integrator::initializeOptions();
+        declareOptionsUnchanged();
+        optionsUpToDate = BT_TRUE;
+    }
 
     timeInterval  = t_;
 
-    xStore.init(  m, timeInterval );
-    iStore.init( mn, timeInterval );
+    // the storage is kept as long as the dimensions do not change:
+    initializeStorage( xStore,  m );
+    initializeStorage( iStore, mn );
 
     t             = timeInterval.getFirstTime();
     x[time_index] = timeInterval.getFirstTime();
@@ -737,11 +763,8 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
      // Initialize the scaling based on the initial states:
      // ---------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
+            diff_scale(run1) = fabs(eta4[run1]) + ATOL/TOL;
 
 
      // PRINTING:
@@ -815,10 +838,7 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
             printIntermediateResults();
         }
 	
-	int printIntegratorProfile = 0;
-	get( PRINT_INTEGRATOR_PROFILE,printIntegratorProfile );
-	
-	if ( (BooleanType)printIntegratorProfile == BT_TRUE )
+	if ( (BooleanType)printProfile == BT_TRUE )
 	{
 		printRunTimeProfile( );
 	}
@@ -1089,7 +1109,7 @@ returnValue IntegratorRK::evaluateSensitivities(){
 
     if( nFDirs != 0 ){
         t = timeInterval.getFirstTime();
-        dxStore.init( m, timeInterval );
+        initializeStorage( dxStore, m );
         for( run1 = 0; run1 < m; run1++ ){
             etaG[run1] = fseed(diff_index[run1]);
         }
@@ -1109,7 +1129,7 @@ returnValue IntegratorRK::evaluateSensitivities(){
 
     if( nFDirs2 != 0 ){
         t = timeInterval.getFirstTime();
-        ddxStore.init( m, timeInterval );
+        initializeStorage( ddxStore, m );
         for( run1 = 0; run1 < m; run1++ ){
             etaG2[run1] = fseed2(diff_index[run1]);
             etaG3[run1] = 0.0;
@@ -1192,6 +1212,112 @@ returnValue IntegratorRK::evaluateSensitivities(){
 }
 
 
+returnValue IntegratorRK::integrateForwardSensitivities( const Matrix &xSeed,
+                                                         const Matrix &pSeed,
+                                                         const Matrix &uSeed,
+                                                         const Matrix &wSeed,
+                                                         Matrix       &D      ){
+
+    int run1, run2, run3, run4, run5;
+    int nDir = 0;
+
+    if( rhs == NULL ){
+        return ACADOERROR(RET_TRIVIAL_RHS);
+    }
+
+    if( soa != SOA_EVERYTHING_FROZEN || transition != 0 || ma != 0 ){
+        return Integrator::integrateForwardSensitivities( xSeed, pSeed, uSeed, wSeed, D );
+    }
+
+    nDir = acadoMax( nDir, xSeed.getNumCols() );
+    nDir = acadoMax( nDir, pSeed.getNumCols() );
+    nDir = acadoMax( nDir, uSeed.getNumCols() );
+    nDir = acadoMax( nDir, wSeed.getNumCols() );
+
+    D.init( rhs->getDim()-ma, nDir );
+    D.setZero();
+
+    if( nDir == 0 ){
+        return SUCCESSFUL_RETURN;
+    }
+
+    // the seeds are stored interleaved, i.e. GK[nDir*i+k] belongs to direction k:
+    const int nV = rhs->getNumberOfVariables()+1+m;
+
+    double *GK    = new double[nV*nDir   ];
+    double *etaGK = new double[m*nDir    ];
+    double *kK    = new double[dim*m*nDir];
+
+    for( run2 = 0; run2 < nV*nDir; run2++ )
+        GK[run2] = 0.0;
+
+    for( run1 = 0; run1 < nDir; run1++ ){
+
+        for( run2 = 0; run2 < m; run2++ ){
+            if( xSeed.isEmpty() == BT_FALSE )
+                etaGK[nDir*run2+run1] = xSeed( rhs->getDifferentialStateComponent(run2), run1 );
+            else
+                etaGK[nDir*run2+run1] = 0.0;
+        }
+
+        if( pSeed.isEmpty() == BT_FALSE )
+            for( run2 = 0; run2 < mp; run2++ )
+                GK[nDir*parameter_index[run2]+run1] = pSeed( run2, run1 );
+
+        if( uSeed.isEmpty() == BT_FALSE )
+            for( run2 = 0; run2 < mu; run2++ )
+                GK[nDir*control_index[run2]+run1] = uSeed( run2, run1 );
+
+        if( wSeed.isEmpty() == BT_FALSE )
+            for( run2 = 0; run2 < mw; run2++ )
+                GK[nDir*disturbance_index[run2]+run1] = wSeed( run2, run1 );
+    }
+
+
+    // replay the frozen steps (cf. determineEtaGForward):
+    // ----------------------------------------------------
+
+    for( run4 = 1; run4 < count; run4++ ){
+
+        for( run1 = 0; run1 < dim; run1++ ){
+
+            for( run2 = 0; run2 < m; run2++ ){
+
+                double *g = &GK[nDir*diff_index[run2]];
+
+                for( run3 = 0; run3 < nDir; run3++ )
+                    g[run3] = etaGK[nDir*run2+run3];
+
+                for( run5 = 0; run5 < run1; run5++ ){
+                    const double *kk = &kK[(run5*m+run2)*nDir];
+                    for( run3 = 0; run3 < nDir; run3++ )
+                        g[run3] = g[run3] + A[run1][run5]*h[run4]*kk[run3];
+                }
+            }
+
+            if( rhs[0].AD_forward( dim*run4+run1, nDir, GK, &kK[run1*m*nDir] ) != SUCCESSFUL_RETURN ){
+                delete[] GK; delete[] etaGK; delete[] kK;
+                return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+            }
+        }
+
+        for( run1 = 0; run1 < dim; run1++ )
+            for( run2 = 0; run2 < m*nDir; run2++ )
+                etaGK[run2] = etaGK[run2] + b4[run1]*h[run4]*kK[run1*m*nDir+run2];
+    }
+
+    for( run2 = 0; run2 < m; run2++ )
+        for( run1 = 0; run1 < nDir; run1++ )
+            D( rhs->getDifferentialStateComponent(run2), run1 ) = etaGK[nDir*run2+run1];
+
+    delete[] GK   ;
+    delete[] etaGK;
+    delete[] kK   ;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue IntegratorRK::step(int number_){
 
     int run1;
@@ -1273,10 +1399,6 @@ returnValue IntegratorRK::step(int number_){
     // PROCEED IF THE STEP IS ACCEPTED:
     // --------------------------------
 
-       double *etaG_  = new double[m];
-       double *etaG3_ = new double[m];
-
-
      // compute forward derivatives if requested:
      // ------------------------------------------
 
@@ -1380,9 +1502,6 @@ returnValue IntegratorRK::step(int number_){
              iStore( jj, run1 ) = x[rhs->index( VT_INTERMEDIATE_STATE, run1 )];
      }
 
-     delete[] etaG_ ;
-     delete[] etaG3_;
-
 
      if( nBDirs == 0 || nBDirs2 == 0 ){
 
@@ -1414,11 +1533,8 @@ returnValue IntegratorRK::step(int number_){
      // recompute the scaling based on the actual states:
      // -------------------------------------------------
 
-        double atol;
-        get( ABSOLUTE_TOLERANCE, atol );
-
         for( run1 = 0; run1 < m; run1++ )
-            diff_scale(run1) = fabs(eta4[run1]) + atol/TOL;
+            diff_scale(run1) = fabs(eta4[run1]) + ATOL/TOL;
 
 
 
@@ -155,6 +155,18 @@ BlockMatrix& BlockMatrix::operator=( const BlockMatrix& rhs ){
 
     if ( this != &rhs ){
 
+        // keep the storage if the dimensions do not change:
+        if( elements != 0 && rhs.elements != 0 && nRows == rhs.nRows && nCols == rhs.nCols ){
+
+            for( run1 = 0; run1 < nRows; run1++ ){
+                for( run2 = 0; run2 < nCols; run2++ ){
+                    elements[run1][run2] = rhs.elements[run1][run2];
+                    types   [run1][run2] = rhs.types   [run1][run2];
+                }
+            }
+            return *this;
+        }
+
         if( elements != 0 ){
 
             for( run1 = 0; run1 < nRows; run1++ ){
@@ -313,39 +325,10 @@ BlockMatrix& BlockMatrix::operator+=( const BlockMatrix& arg ){
 
 BlockMatrix BlockMatrix::operator-( const BlockMatrix& arg ) const{
 
-    ASSERT( ( getNumRows( ) == arg.getNumRows( ) ) && ( getNumCols( ) == arg.getNumCols( ) ) );
-
-    uint i,j;
-
-    BlockMatrix tmp( getNumRows(), getNumCols() );
+    BlockMatrix result;
+    result.setDifference( *this, arg );
 
-    for( i=0; i < getNumRows(); i++ ){
-        for( j=0; j < getNumCols(); j++ ){
-
-            if( arg.types[i][j] == SBMT_ZERO ){
-
-                tmp.types    [i][j] = types    [i][j];
-                tmp.elements [i][j] = elements [i][j];
-            }
-            else{
-                if( types[i][j] != SBMT_ZERO ){
-
-                   tmp.types    [i][j]  = SBMT_DENSE;
-                   tmp.elements [i][j]  = elements [i][j] - arg.elements[i][j];
-                }
-                else{
-
-                   Matrix nn(arg.elements[i][j].getNumRows(),arg.elements[i][j].getNumCols());
-                   nn.setZero();
-
-                   tmp.types    [i][j]  = SBMT_DENSE;
-                   tmp.elements [i][j]  = nn - arg.elements[i][j];
-                }
-            }
-        }
-    }
-
-    return tmp;
+    return result;
 }
 
 
@@ -380,65 +363,131 @@ BlockMatrix BlockMatrix::operator*=( double scalar ){
 
 BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
 
-    ASSERT( getNumCols( ) == arg.getNumRows( ) );
+    BlockMatrix result;
+    result.setProduct( *this, arg );
+
+    return result;
+}
+
+
+BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
+
+    BlockMatrix result;
+    result.setTransposedProduct( *this, arg );
+
+	return result;
+}
+
+
+returnValue BlockMatrix::setDifference( const BlockMatrix& A, const BlockMatrix& B ){
+
+    ASSERT( ( A.getNumRows( ) == B.getNumRows( ) ) && ( A.getNumCols( ) == B.getNumCols( ) ) );
+
+    if( this == &A || this == &B ){
+        BlockMatrix tmp;
+        tmp.setDifference( A, B );
+        operator=( tmp );
+        return SUCCESSFUL_RETURN;
+    }
+
+    uint i,j;
+
+    prepareResult( A.getNumRows( ), A.getNumCols( ) );
+
+    for( i=0; i<nRows; ++i ){
+        for( j=0; j<nCols; ++j ){
+
+            if( B.types[i][j] == SBMT_ZERO ){
+
+                types[i][j] = A.types[i][j];
+                if( A.types[i][j] != SBMT_ZERO )
+                    elements[i][j] = A.elements[i][j];
+            }
+            else{
+
+                if( A.types[i][j] != SBMT_ZERO ){
+                    elements[i][j]  = A.elements[i][j];
+                    elements[i][j] -= B.elements[i][j];
+                }
+                else{
+                    elements[i][j]  = B.elements[i][j];
+                    elements[i][j] *= -1.0;
+                }
+                types[i][j] = SBMT_DENSE;
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockMatrix::setProduct( const BlockMatrix& A, const BlockMatrix& B ){
+
+    ASSERT( A.getNumCols( ) == B.getNumRows( ) );
+
+    if( this == &A || this == &B ){
+        BlockMatrix tmp;
+        tmp.setProduct( A, B );
+        operator=( tmp );
+        return SUCCESSFUL_RETURN;
+    }
 
     uint i,j,k;
 
-    uint newNumRows = getNumRows( );
-    uint newNumCols = arg.getNumCols( );
-    BlockMatrix result( newNumRows,newNumCols );
+    prepareResult( A.getNumRows( ), B.getNumCols( ) );
 
-    for( i=0; i<newNumRows; ++i ){
-        for( k=0; k<getNumCols( ); ++k ){
+    for( i=0; i<nRows; ++i ){
+        for( k=0; k<A.getNumCols( ); ++k ){
 
-            switch( types[i][k] ){
+            switch( A.types[i][k] ){
 
                 case SBMT_DENSE:
 
-                    for( j=0; j<newNumCols; ++j ){
+                    for( j=0; j<nCols; ++j ){
 
-                        if( arg.types[k][j] == SBMT_DENSE ){
+                        if( B.types[k][j] == SBMT_DENSE ){
 
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[i][k] * arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[i][k] * arg.elements[k][j];
+                            if( types[i][j] != SBMT_ZERO )
+                                  elements[i][j].addProduct( A.elements[i][k], B.elements[k][j] );
+                            else  elements[i][j].setProduct( A.elements[i][k], B.elements[k][j] );
                         }
 
-                        if( arg.types[k][j] == SBMT_ONE ){
+                        if( B.types[k][j] == SBMT_ONE ){
 
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[i][k];
-                            else  result.elements[i][j]  = elements[i][k];
+                            if( types[i][j] != SBMT_ZERO )
+                                  elements[i][j] += A.elements[i][k];
+                            else  elements[i][j]  = A.elements[i][k];
                         }
 
-                        if( arg.types[k][j] != SBMT_ZERO )
-                            result.types[i][j]  = SBMT_DENSE;
+                        if( B.types[k][j] != SBMT_ZERO )
+                            types[i][j]  = SBMT_DENSE;
                     }
                     break;
 
 
                 case SBMT_ONE:
 
-                    for( j=0; j<newNumCols; ++j ){
+                    for( j=0; j<nCols; ++j ){
 
-                         if( arg.types[k][j] == SBMT_DENSE ){
+                         if( B.types[k][j] == SBMT_DENSE ){
 
-                             if( result.types[i][j] != SBMT_ZERO )
-                                   result.elements[i][j] += arg.elements[k][j];
-                             else  result.elements[i][j]  = arg.elements[k][j];
+                             if( types[i][j] != SBMT_ZERO )
+                                   elements[i][j] += B.elements[k][j];
+                             else  elements[i][j]  = B.elements[k][j];
 
-                             result.types[i][j]  = SBMT_DENSE;
+                             types[i][j]  = SBMT_DENSE;
                          }
 
-                         if( arg.types[k][j] == SBMT_ONE ){
+                         if( B.types[k][j] == SBMT_ONE ){
 
-                             if( result.types[i][j] == SBMT_ZERO ){
-                                   result.elements[i][j]  = elements[i][k];
-                                   result.types   [i][j]  = SBMT_ONE      ;
+                             if( types[i][j] == SBMT_ZERO ){
+                                   elements[i][j]  = A.elements[i][k];
+                                   types   [i][j]  = SBMT_ONE        ;
                              }
                              else{
-                                   result.elements[i][j] += elements[i][k];
-                                   result.types   [i][j]  = SBMT_DENSE    ;
+                                   elements[i][j] += A.elements[i][k];
+                                   types   [i][j]  = SBMT_DENSE      ;
                              }
                          }
                      }
@@ -454,67 +503,72 @@ BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
         }
     }
 
-    return result;
+    return finalizeResult( );
 }
 
 
-BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
+returnValue BlockMatrix::setTransposedProduct( const BlockMatrix& A, const BlockMatrix& B ){
 
-	ASSERT( getNumRows( ) == arg.getNumRows( ) );
+	ASSERT( A.getNumRows( ) == B.getNumRows( ) );
+
+    if( this == &A || this == &B ){
+        BlockMatrix tmp;
+        tmp.setTransposedProduct( A, B );
+        operator=( tmp );
+        return SUCCESSFUL_RETURN;
+    }
 
 	uint i,j,k;
 
-	uint newNumRows = getNumCols( );
-	uint newNumCols = arg.getNumCols( );
-	BlockMatrix result( newNumRows,newNumCols );
+    prepareResult( A.getNumCols( ), B.getNumCols( ) );
 
-    for( i=0; i<newNumRows; ++i ){
-        for( k=0; k<getNumRows( ); ++k ){
+    for( i=0; i<nRows; ++i ){
+        for( k=0; k<A.getNumRows( ); ++k ){
 
-            switch( types[k][i] ){
+            switch( A.types[k][i] ){
 
                 case SBMT_DENSE:
 
-                    for( j=0; j<newNumCols; ++j ){
+                    for( j=0; j<nCols; ++j ){
 
-                        if( arg.types[k][j] == SBMT_DENSE ){
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[k][i]^arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[k][i]^arg.elements[k][j];
+                        if( B.types[k][j] == SBMT_DENSE ){
+                            if( types[i][j] != SBMT_ZERO )
+                                  elements[i][j].addTransposedProduct( A.elements[k][i], B.elements[k][j] );
+                            else  elements[i][j].setTransposedProduct( A.elements[k][i], B.elements[k][j] );
                         }
 
-                        if( arg.types[k][j] == SBMT_ONE ){
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[k][i].transpose();
-                            else  result.elements[i][j]  = elements[k][i].transpose();
+                        if( B.types[k][j] == SBMT_ONE ){
+                            if( types[i][j] != SBMT_ZERO )
+                                  elements[i][j] += A.elements[k][i].transpose();
+                            else  elements[i][j]  = A.elements[k][i].transpose();
                         }
 
-                        if( arg.types[k][j] != SBMT_ZERO )
-                             result.types[i][j]  = SBMT_DENSE;
+                        if( B.types[k][j] != SBMT_ZERO )
+                             types[i][j]  = SBMT_DENSE;
                     }
                     break;
 
 
                 case SBMT_ONE:
 
-                    for( j=0; j<newNumCols; ++j ){
+                    for( j=0; j<nCols; ++j ){
 
-                        if( arg.types[k][j] == SBMT_DENSE ){
-                            if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += arg.elements[k][j];
-                            else  result.elements[i][j]  = arg.elements[k][j];
-                            result.types[i][j]  = SBMT_DENSE;
+                        if( B.types[k][j] == SBMT_DENSE ){
+                            if( types[i][j] != SBMT_ZERO )
+                                  elements[i][j] += B.elements[k][j];
+                            else  elements[i][j]  = B.elements[k][j];
+                            types[i][j]  = SBMT_DENSE;
                         }
 
-                        if( arg.types[k][j] == SBMT_ONE ){
+                        if( B.types[k][j] == SBMT_ONE ){
 
-                            if( result.types[i][j] == SBMT_ZERO ){
-                                  result.elements[i][j]  = elements[k][i];
-                                  result.types   [i][j]  = SBMT_ONE      ;
+                            if( types[i][j] == SBMT_ZERO ){
+                                  elements[i][j]  = A.elements[k][i];
+                                  types   [i][j]  = SBMT_ONE        ;
                             }
                             else{
-                                  result.elements[i][j] += elements[k][i];
-                                  result.types   [i][j]  = SBMT_DENSE    ;
+                                  elements[i][j] += A.elements[k][i];
+                                  types   [i][j]  = SBMT_DENSE      ;
                             }
                         }
                     }
@@ -528,7 +582,8 @@ BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
             }
         }
     }
-	return result;
+
+	return finalizeResult( );
 }
 
 
@@ -645,6 +700,20 @@ returnValue BlockMatrix::setDense( uint rowIdx, uint colIdx, const Matrix& value
 }
 
 
+Matrix& BlockMatrix::getDenseBlock( uint rowIdx, uint colIdx, uint nR, uint nC ){
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    if( elements[rowIdx][colIdx].getNumRows() != nR || elements[rowIdx][colIdx].getNumCols() != nC )
+        elements[rowIdx][colIdx].init( nR, nC );
+
+    types[rowIdx][colIdx] = SBMT_DENSE;
+
+    return elements[rowIdx][colIdx];
+}
+
+
 returnValue BlockMatrix::addDense( uint rowIdx, uint colIdx, const Matrix& value ){
 
 	ASSERT( rowIdx < getNumRows( ) );
@@ -660,6 +729,30 @@ returnValue BlockMatrix::addDense( uint rowIdx, uint colIdx, const Matrix& value
 }
 
 
+returnValue BlockMatrix::setDense( uint rowIdx, uint colIdx, const Matrix& A, const Matrix& B ){
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    types[rowIdx][colIdx] = SBMT_DENSE;
+    return elements[rowIdx][colIdx].setProduct( A, B );
+}
+
+
+returnValue BlockMatrix::addDense( uint rowIdx, uint colIdx, const Matrix& A, const Matrix& B ){
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    if( types[rowIdx][colIdx] == SBMT_DENSE || types[rowIdx][colIdx] == SBMT_ONE ){
+        types[rowIdx][colIdx] = SBMT_DENSE;
+        return elements[rowIdx][colIdx].addProduct( A, B );
+    }
+
+    return setDense( rowIdx, colIdx, A, B );
+}
+
+
 returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx,
                                       Matrix &value, uint nR, uint nC )  const{
 
@@ -688,6 +781,35 @@ returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx,
 //
 
 
+void BlockMatrix::prepareResult( uint _nRows, uint _nCols ){
+
+    uint run1, run2;
+
+    if( elements == 0 || nRows != _nRows || nCols != _nCols ){
+        init( _nRows, _nCols );
+        return;
+    }
+
+    for( run1 = 0; run1 < nRows; run1++ )
+        for( run2 = 0; run2 < nCols; run2++ )
+            types[run1][run2] = SBMT_ZERO;
+}
+
+
+returnValue BlockMatrix::finalizeResult( ){
+
+    uint run1, run2;
+
+    // components that remained zero are empty, as in a new block matrix:
+    for( run1 = 0; run1 < nRows; run1++ )
+        for( run2 = 0; run2 < nCols; run2++ )
+            if( types[run1][run2] == SBMT_ZERO )
+                elements[run1][run2].init( 0, 0 );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 
 
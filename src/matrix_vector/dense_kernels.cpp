@@ -0,0 +1,601 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/matrix_vector/dense_kernels.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2013
+ */
+
+
+#include <acado/matrix_vector/dense_kernels.hpp>
+
+#if defined( __AVX__ )
+	#include <immintrin.h>
+#elif defined( __SSE2__ )
+	#include <emmintrin.h>
+#endif
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+// Number of doubles of B that are kept in the (level 2) cache by denseGemm:
+static const uint DENSE_KERNEL_CACHE_SIZE = 16384;
+
+
+//
+// LOCAL HELPER FUNCTIONS:
+//
+
+/* y[j] += a*x[j] for j < n. */
+static inline void axpy( uint n, double a, const double *x, double *y )
+{
+	uint j = 0;
+
+	#if defined( __AVX__ )
+	__m256d va = _mm256_set1_pd( a );
+	for( ; j+4 <= n; j += 4 )
+		_mm256_storeu_pd( y+j,_mm256_add_pd( _mm256_loadu_pd( y+j ),_mm256_mul_pd( va,_mm256_loadu_pd( x+j ) ) ) );
+	#elif defined( __SSE2__ )
+	__m128d va = _mm_set1_pd( a );
+	for( ; j+2 <= n; j += 2 )
+		_mm_storeu_pd( y+j,_mm_add_pd( _mm_loadu_pd( y+j ),_mm_mul_pd( va,_mm_loadu_pd( x+j ) ) ) );
+	#endif
+
+	for( ; j < n; j++ )
+		y[j] += a*x[j];
+}
+
+
+/* y[j] += a[0]*x0[j] + ... + a[3]*x3[j] for j < n, summed from left to right. */
+static inline void axpy4( uint n, const double *a,
+                          const double *x0, const double *x1, const double *x2, const double *x3,
+                          double *y )
+{
+	uint j = 0;
+
+	#if defined( __AVX__ )
+	__m256d a0 = _mm256_set1_pd( a[0] );
+	__m256d a1 = _mm256_set1_pd( a[1] );
+	__m256d a2 = _mm256_set1_pd( a[2] );
+	__m256d a3 = _mm256_set1_pd( a[3] );
+	__m256d v;
+	for( ; j+4 <= n; j += 4 )
+	{
+		v = _mm256_loadu_pd( y+j );
+		v = _mm256_add_pd( v,_mm256_mul_pd( a0,_mm256_loadu_pd( x0+j ) ) );
+		v = _mm256_add_pd( v,_mm256_mul_pd( a1,_mm256_loadu_pd( x1+j ) ) );
+		v = _mm256_add_pd( v,_mm256_mul_pd( a2,_mm256_loadu_pd( x2+j ) ) );
+		v = _mm256_add_pd( v,_mm256_mul_pd( a3,_mm256_loadu_pd( x3+j ) ) );
+		_mm256_storeu_pd( y+j,v );
+	}
+	#elif defined( __SSE2__ )
+	__m128d a0 = _mm_set1_pd( a[0] );
+	__m128d a1 = _mm_set1_pd( a[1] );
+	__m128d a2 = _mm_set1_pd( a[2] );
+	__m128d a3 = _mm_set1_pd( a[3] );
+	__m128d v;
+	for( ; j+2 <= n; j += 2 )
+	{
+		v = _mm_loadu_pd( y+j );
+		v = _mm_add_pd( v,_mm_mul_pd( a0,_mm_loadu_pd( x0+j ) ) );
+		v = _mm_add_pd( v,_mm_mul_pd( a1,_mm_loadu_pd( x1+j ) ) );
+		v = _mm_add_pd( v,_mm_mul_pd( a2,_mm_loadu_pd( x2+j ) ) );
+		v = _mm_add_pd( v,_mm_mul_pd( a3,_mm_loadu_pd( x3+j ) ) );
+		_mm_storeu_pd( y+j,v );
+	}
+	#endif
+
+	for( ; j < n; j++ )
+		y[j] = y[j] + a[0]*x0[j] + a[1]*x1[j] + a[2]*x2[j] + a[3]*x3[j];
+}
+
+
+/* y[j] += sum_p a[p*aStride]*X[p*ldx+j] for p < np and j < n, summed in the order of p. */
+static void multiAxpy( uint np, uint n, const double *a, uint aStride,
+                       const double *X, uint ldx, double *y )
+{
+	uint p;
+	double coeff[4];
+
+	for( p = 0; p+4 <= np; p += 4 )
+	{
+		coeff[0] = a[ p   *aStride];
+		coeff[1] = a[(p+1)*aStride];
+		coeff[2] = a[(p+2)*aStride];
+		coeff[3] = a[(p+3)*aStride];
+		axpy4( n,coeff,X+p*ldx,X+(p+1)*ldx,X+(p+2)*ldx,X+(p+3)*ldx,y );
+	}
+
+	for( ; p < np; p++ )
+		axpy( n,a[p*aStride],X+p*ldx,y );
+}
+
+
+/* Same as multiAxpy, but subtracts the products. */
+static void multiAxpyNegative( uint np, uint n, const double *a, uint aStride,
+                               const double *X, uint ldx, double *y )
+{
+	uint p;
+	double coeff[4];
+
+	for( p = 0; p+4 <= np; p += 4 )
+	{
+		coeff[0] = -a[ p   *aStride];
+		coeff[1] = -a[(p+1)*aStride];
+		coeff[2] = -a[(p+2)*aStride];
+		coeff[3] = -a[(p+3)*aStride];
+		axpy4( n,coeff,X+p*ldx,X+(p+1)*ldx,X+(p+2)*ldx,X+(p+3)*ldx,y );
+	}
+
+	for( ; p < np; p++ )
+		axpy( n,-a[p*aStride],X+p*ldx,y );
+}
+
+
+/* Register-blocked update of a (4 x 4) block of C, where the
+ * entries of A are given by A[r*aRow+k*aCol]. */
+static inline void gemmKernel4x4( uint kc, const double *A, uint aRow, uint aCol,
+                                  const double *B, uint ldb, double *C, uint ldc )
+{
+	uint k;
+
+	#if defined( __AVX__ )
+	__m256d b, a;
+	__m256d c0 = _mm256_loadu_pd( C       );
+	__m256d c1 = _mm256_loadu_pd( C+  ldc );
+	__m256d c2 = _mm256_loadu_pd( C+2*ldc );
+	__m256d c3 = _mm256_loadu_pd( C+3*ldc );
+
+	for( k = 0; k < kc; k++, A += aCol, B += ldb )
+	{
+		b  = _mm256_loadu_pd( B );
+		a  = _mm256_broadcast_sd( A        ); c0 = _mm256_add_pd( c0,_mm256_mul_pd( a,b ) );
+		a  = _mm256_broadcast_sd( A+  aRow ); c1 = _mm256_add_pd( c1,_mm256_mul_pd( a,b ) );
+		a  = _mm256_broadcast_sd( A+2*aRow ); c2 = _mm256_add_pd( c2,_mm256_mul_pd( a,b ) );
+		a  = _mm256_broadcast_sd( A+3*aRow ); c3 = _mm256_add_pd( c3,_mm256_mul_pd( a,b ) );
+	}
+
+	_mm256_storeu_pd( C      ,c0 );
+	_mm256_storeu_pd( C+  ldc,c1 );
+	_mm256_storeu_pd( C+2*ldc,c2 );
+	_mm256_storeu_pd( C+3*ldc,c3 );
+
+	#elif defined( __SSE2__ )
+	__m128d b0, b1, a;
+	__m128d c00 = _mm_loadu_pd( C        ), c01 = _mm_loadu_pd( C        +2 );
+	__m128d c10 = _mm_loadu_pd( C+  ldc  ), c11 = _mm_loadu_pd( C+  ldc  +2 );
+	__m128d c20 = _mm_loadu_pd( C+2*ldc  ), c21 = _mm_loadu_pd( C+2*ldc  +2 );
+	__m128d c30 = _mm_loadu_pd( C+3*ldc  ), c31 = _mm_loadu_pd( C+3*ldc  +2 );
+
+	for( k = 0; k < kc; k++, A += aCol, B += ldb )
+	{
+		b0 = _mm_loadu_pd( B   );
+		b1 = _mm_loadu_pd( B+2 );
+		a  = _mm_set1_pd( A[0     ] ); c00 = _mm_add_pd( c00,_mm_mul_pd( a,b0 ) ); c01 = _mm_add_pd( c01,_mm_mul_pd( a,b1 ) );
+		a  = _mm_set1_pd( A[  aRow] ); c10 = _mm_add_pd( c10,_mm_mul_pd( a,b0 ) ); c11 = _mm_add_pd( c11,_mm_mul_pd( a,b1 ) );
+		a  = _mm_set1_pd( A[2*aRow] ); c20 = _mm_add_pd( c20,_mm_mul_pd( a,b0 ) ); c21 = _mm_add_pd( c21,_mm_mul_pd( a,b1 ) );
+		a  = _mm_set1_pd( A[3*aRow] ); c30 = _mm_add_pd( c30,_mm_mul_pd( a,b0 ) ); c31 = _mm_add_pd( c31,_mm_mul_pd( a,b1 ) );
+	}
+
+	_mm_storeu_pd( C      ,c00 ); _mm_storeu_pd( C      +2,c01 );
+	_mm_storeu_pd( C+  ldc,c10 ); _mm_storeu_pd( C+  ldc+2,c11 );
+	_mm_storeu_pd( C+2*ldc,c20 ); _mm_storeu_pd( C+2*ldc+2,c21 );
+	_mm_storeu_pd( C+3*ldc,c30 ); _mm_storeu_pd( C+3*ldc+2,c31 );
+
+	#else
+	uint r, j;
+	double c[4][4];
+	double a;
+
+	for( r = 0; r < 4; r++ )
+		for( j = 0; j < 4; j++ )
+			c[r][j] = C[r*ldc+j];
+
+	for( k = 0; k < kc; k++, A += aCol, B += ldb )
+		for( r = 0; r < 4; r++ )
+		{
+			a = A[r*aRow];
+			for( j = 0; j < 4; j++ )
+				c[r][j] += a*B[j];
+		}
+
+	for( r = 0; r < 4; r++ )
+		for( j = 0; j < 4; j++ )
+			C[r*ldc+j] = c[r][j];
+	#endif
+}
+
+
+#if defined( __AVX__ )
+/* Register-blocked update of a (4 x 8) block of C. */
+static inline void gemmKernel4x8( uint kc, const double *A, uint aRow, uint aCol,
+                                  const double *B, uint ldb, double *C, uint ldc )
+{
+	uint k;
+
+	__m256d b0, b1, a;
+	__m256d c00 = _mm256_loadu_pd( C        ), c01 = _mm256_loadu_pd( C      +4 );
+	__m256d c10 = _mm256_loadu_pd( C+  ldc  ), c11 = _mm256_loadu_pd( C+  ldc+4 );
+	__m256d c20 = _mm256_loadu_pd( C+2*ldc  ), c21 = _mm256_loadu_pd( C+2*ldc+4 );
+	__m256d c30 = _mm256_loadu_pd( C+3*ldc  ), c31 = _mm256_loadu_pd( C+3*ldc+4 );
+
+	for( k = 0; k < kc; k++, A += aCol, B += ldb )
+	{
+		b0 = _mm256_loadu_pd( B   );
+		b1 = _mm256_loadu_pd( B+4 );
+		a  = _mm256_broadcast_sd( A        ); c00 = _mm256_add_pd( c00,_mm256_mul_pd( a,b0 ) ); c01 = _mm256_add_pd( c01,_mm256_mul_pd( a,b1 ) );
+		a  = _mm256_broadcast_sd( A+  aRow ); c10 = _mm256_add_pd( c10,_mm256_mul_pd( a,b0 ) ); c11 = _mm256_add_pd( c11,_mm256_mul_pd( a,b1 ) );
+		a  = _mm256_broadcast_sd( A+2*aRow ); c20 = _mm256_add_pd( c20,_mm256_mul_pd( a,b0 ) ); c21 = _mm256_add_pd( c21,_mm256_mul_pd( a,b1 ) );
+		a  = _mm256_broadcast_sd( A+3*aRow ); c30 = _mm256_add_pd( c30,_mm256_mul_pd( a,b0 ) ); c31 = _mm256_add_pd( c31,_mm256_mul_pd( a,b1 ) );
+	}
+
+	_mm256_storeu_pd( C      ,c00 ); _mm256_storeu_pd( C      +4,c01 );
+	_mm256_storeu_pd( C+  ldc,c10 ); _mm256_storeu_pd( C+  ldc+4,c11 );
+	_mm256_storeu_pd( C+2*ldc,c20 ); _mm256_storeu_pd( C+2*ldc+4,c21 );
+	_mm256_storeu_pd( C+3*ldc,c30 ); _mm256_storeu_pd( C+3*ldc+4,c31 );
+}
+#endif
+
+
+/* Update of a (4 x 1) block of C. */
+static inline void gemmKernel4x1( uint kc, const double *A, uint aRow, uint aCol,
+                                  const double *B, uint ldb, double *C, uint ldc )
+{
+	uint k;
+
+	double c0 = C[0], c1 = C[ldc], c2 = C[2*ldc], c3 = C[3*ldc];
+
+	for( k = 0; k < kc; k++, A += aCol, B += ldb )
+	{
+		c0 += A[0     ]*B[0];
+		c1 += A[  aRow]*B[0];
+		c2 += A[2*aRow]*B[0];
+		c3 += A[3*aRow]*B[0];
+	}
+
+	C[0] = c0; C[ldc] = c1; C[2*ldc] = c2; C[3*ldc] = c3;
+}
+
+
+/* Computes C += op(A)*B; if lowerOnly is BT_TRUE, the entries of C
+ * above the diagonal are not needed (some of them may be updated). */
+static void gemm( uint m, uint n, uint l, const double *A, BooleanType transposeA,
+                  const double *B, double *C, BooleanType lowerOnly )
+{
+	uint i, j, k, k0, kc, nc;
+	uint aRow, aCol;
+	const double *Ak;
+	const double *Bk;
+
+	if ( ( m == 0 ) || ( n == 0 ) || ( l == 0 ) )
+		return;
+
+	// entry (i,k) of op(A) is A[i*aRow+k*aCol]:
+	if ( transposeA == BT_TRUE )
+	{
+		aRow = 1;
+		aCol = m;
+	}
+	else
+	{
+		aRow = l;
+		aCol = 1;
+	}
+
+	uint kBlock = DENSE_KERNEL_CACHE_SIZE/n;
+	if ( kBlock < 4 )
+		kBlock = 4;
+
+	// The inner products are accumulated in the order of k, such that the
+	// result coincides with the one of the naive triple loop.
+	for( k0 = 0; k0 < l; k0 += kBlock )
+	{
+		kc = l - k0;
+		if ( kc > kBlock )
+			kc = kBlock;
+
+		Ak = A + k0*aCol;
+		Bk = B + k0*n;
+
+		for( i = 0; i+4 <= m; i += 4 )
+		{
+			nc = n;
+			if ( ( lowerOnly == BT_TRUE ) && ( i+4 < n ) )
+				nc = i+4;
+
+			j = 0;
+			#if defined( __AVX__ )
+			for( ; j+8 <= nc; j += 8 )
+				gemmKernel4x8( kc,Ak+i*aRow,aRow,aCol,Bk+j,n,C+i*n+j,n );
+			#endif
+			for( ; j+4 <= nc; j += 4 )
+				gemmKernel4x4( kc,Ak+i*aRow,aRow,aCol,Bk+j,n,C+i*n+j,n );
+			for( ; j < nc; j++ )
+				gemmKernel4x1( kc,Ak+i*aRow,aRow,aCol,Bk+j,n,C+i*n+j,n );
+		}
+
+		for( ; i < m; i++ )
+		{
+			nc = n;
+			if ( ( lowerOnly == BT_TRUE ) && ( i+1 < n ) )
+				nc = i+1;
+
+			for( k = 0; k < kc; k++ )
+				axpy( nc,Ak[i*aRow+k*aCol],Bk+k*n,C+i*n );
+		}
+	}
+}
+
+
+
+//
+// KERNELS:
+//
+
+void denseGemm( uint m, uint n, uint l, const double *A, BooleanType transposeA,
+                const double *B, double *C )
+{
+	gemm( m,n,l,A,transposeA,B,C,BT_FALSE );
+}
+
+
+void denseGemv( uint m, uint n, const double *A, BooleanType transposeA,
+                const double *x, double *y )
+{
+	uint i, j;
+	double y0, y1, y2, y3;
+	const double *a0;
+	const double *a1;
+	const double *a2;
+	const double *a3;
+
+	if ( ( m == 0 ) || ( n == 0 ) )
+		return;
+
+	if ( transposeA == BT_TRUE )
+	{
+		multiAxpy( m,n,x,1,A,n,y );
+		return;
+	}
+
+	// four independent inner products at a time:
+	for( i = 0; i+4 <= m; i += 4 )
+	{
+		a0 = A + i*n;
+		a1 = a0 + n;
+		a2 = a1 + n;
+		a3 = a2 + n;
+
+		y0 = y[i]; y1 = y[i+1]; y2 = y[i+2]; y3 = y[i+3];
+
+		for( j = 0; j < n; j++ )
+		{
+			y0 += a0[j]*x[j];
+			y1 += a1[j]*x[j];
+			y2 += a2[j]*x[j];
+			y3 += a3[j]*x[j];
+		}
+
+		y[i] = y0; y[i+1] = y1; y[i+2] = y2; y[i+3] = y3;
+	}
+
+	for( ; i < m; i++ )
+	{
+		a0 = A + i*n;
+		y0 = y[i];
+		for( j = 0; j < n; j++ )
+			y0 += a0[j]*x[j];
+		y[i] = y0;
+	}
+}
+
+
+void denseSyrk( uint n, uint l, const double *A, double *C )
+{
+	uint i, j;
+
+	gemm( n,n,l,A,BT_TRUE,A,C,BT_TRUE );
+
+	for( i = 0; i < n; i++ )
+		for( j = i+1; j < n; j++ )
+			C[i*n+j] = C[j*n+i];
+}
+
+
+returnValue denseCholesky( uint n, double *A )
+{
+	uint i, k;
+	double *rowK;
+	double reciprocal;
+
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	// Row k of the upper triangle holds column k of the factor, such that
+	// all updates run over contiguous memory:
+	for( i = 0; i < n; i++ )
+		for( k = 0; k < i; k++ )
+			A[k*n+i] = A[i*n+k];
+
+	for( k = 0; k < n; k++ )
+	{
+		rowK = A + k*n;
+
+		// L(i,k) -= L(i,p)*L(k,p) for i >= k, in the order of p:
+		multiAxpyNegative( k,n-k,A+k,n,A+k,n,rowK+k );
+
+		rowK[k] = sqrt( rowK[k] );
+		if ( !( rowK[k] >= EPS ) )
+			returnvalue = RET_MATRIX_NOT_SPD;
+
+		reciprocal = 1.0 / rowK[k];
+		for( i = k+1; i < n; i++ )
+			rowK[i] *= reciprocal;
+	}
+
+	for( i = 0; i < n; i++ )
+		for( k = 0; k < i; k++ )
+			A[i*n+k] = A[k*n+i];
+
+	return returnvalue;
+}
+
+
+void denseTriangularSolve( uint n, uint nRhs, const double *L, BooleanType transposeL, double *B )
+{
+	uint i, j;
+	double *rowI;
+
+	if ( ( n == 0 ) || ( nRhs == 0 ) )
+		return;
+
+	if ( transposeL == BT_FALSE )
+	{
+		for( i = 0; i < n; i++ )
+		{
+			rowI = B + i*nRhs;
+			multiAxpyNegative( i,nRhs,L+i*n,1,B,nRhs,rowI );
+
+			for( j = 0; j < nRhs; j++ )
+				rowI[j] /= L[i*n+i];
+		}
+	}
+	else
+	{
+		for( i = n; i-- > 0; )
+		{
+			rowI = B + i*nRhs;
+			multiAxpyNegative( n-i-1,nRhs,L+(i+1)*n+i,n,rowI+nRhs,nRhs,rowI );
+
+			for( j = 0; j < nRhs; j++ )
+				rowI[j] /= L[i*n+i];
+		}
+	}
+}
+
+
+returnValue denseLU( uint n, double *A, uint *pivots )
+{
+	uint i, j, k, p;
+	double *rowK;
+	double *rowI;
+	double maxPivot, tmp;
+
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	for( k = 0; k < n; k++ )
+	{
+		p = k;
+		maxPivot = fabs( A[k*n+k] );
+		for( i = k+1; i < n; i++ )
+		{
+			if ( fabs( A[i*n+k] ) > maxPivot )
+			{
+				maxPivot = fabs( A[i*n+k] );
+				p = i;
+			}
+		}
+		pivots[k] = p;
+
+		rowK = A + k*n;
+
+		if ( p != k )
+		{
+			rowI = A + p*n;
+			for( j = 0; j < n; j++ )
+			{
+				tmp     = rowK[j];
+				rowK[j] = rowI[j];
+				rowI[j] = tmp;
+			}
+		}
+
+		if ( maxPivot <= 0.0 )
+		{
+			returnvalue = RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+			continue;
+		}
+
+		for( i = k+1; i < n; i++ )
+		{
+			rowI = A + i*n;
+			rowI[k] /= rowK[k];
+			axpy( n-k-1,-rowI[k],rowK+k+1,rowI+k+1 );
+		}
+	}
+
+	return returnvalue;
+}
+
+
+void denseLUSolve( uint n, uint nRhs, const double *LU, const uint *pivots, double *B )
+{
+	uint i, j;
+	double *rowI;
+	double *rowP;
+	double tmp;
+
+	if ( ( n == 0 ) || ( nRhs == 0 ) )
+		return;
+
+	for( i = 0; i < n; i++ )
+	{
+		if ( pivots[i] != i )
+		{
+			rowI = B + i*nRhs;
+			rowP = B + pivots[i]*nRhs;
+			for( j = 0; j < nRhs; j++ )
+			{
+				tmp     = rowI[j];
+				rowI[j] = rowP[j];
+				rowP[j] = tmp;
+			}
+		}
+	}
+
+	// forward substitution with the unit lower triangle:
+	for( i = 1; i < n; i++ )
+		multiAxpyNegative( i,nRhs,LU+i*n,1,B,nRhs,B+i*nRhs );
+
+	// backward substitution with the upper triangle:
+	for( i = n; i-- > 0; )
+	{
+		rowI = B + i*nRhs;
+		multiAxpyNegative( n-i-1,nRhs,LU+i*n+i+1,1,rowI+nRhs,nRhs,rowI );
+
+		for( j = 0; j < nRhs; j++ )
+			rowI[j] /= LU[i*n+i];
+	}
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
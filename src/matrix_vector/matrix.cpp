@@ -299,6 +299,93 @@ returnValue Matrix::appendCols( const Matrix& arg )
 
 
 
+returnValue Matrix::setProduct(	const Matrix& A,
+								const Matrix& B
+								)
+{
+	if ( A.getNumCols( ) != B.getNumRows( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( ( this == &A ) || ( this == &B ) )
+	{
+		operator=( A*B );
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( ( getNumRows( ) != A.getNumRows( ) ) || ( getNumCols( ) != B.getNumCols( ) ) )
+		init( A.getNumRows( ),B.getNumCols( ) );
+
+	setZero( );
+	denseGemm( A.getNumRows( ),B.getNumCols( ),A.getNumCols( ),A.element,BT_FALSE,B.element,element );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Matrix::addProduct(	const Matrix& A,
+								const Matrix& B
+								)
+{
+	if ( ( A.getNumCols( ) != B.getNumRows( ) ) ||
+		 ( A.getNumRows( ) != getNumRows( ) ) || ( B.getNumCols( ) != getNumCols( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( ( this == &A ) || ( this == &B ) )
+	{
+		operator+=( A*B );
+		return SUCCESSFUL_RETURN;
+	}
+
+	denseGemm( A.getNumRows( ),B.getNumCols( ),A.getNumCols( ),A.element,BT_FALSE,B.element,element );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Matrix::setTransposedProduct(	const Matrix& A,
+											const Matrix& B
+											)
+{
+	if ( A.getNumRows( ) != B.getNumRows( ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( ( this == &A ) || ( this == &B ) )
+	{
+		operator=( A^B );
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( ( getNumRows( ) != A.getNumCols( ) ) || ( getNumCols( ) != B.getNumCols( ) ) )
+		init( A.getNumCols( ),B.getNumCols( ) );
+
+	setZero( );
+	denseGemm( A.getNumCols( ),B.getNumCols( ),A.getNumRows( ),A.element,BT_TRUE,B.element,element );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Matrix::addTransposedProduct(	const Matrix& A,
+											const Matrix& B
+											)
+{
+	if ( ( A.getNumRows( ) != B.getNumRows( ) ) ||
+		 ( A.getNumCols( ) != getNumRows( ) ) || ( B.getNumCols( ) != getNumCols( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( ( this == &A ) || ( this == &B ) )
+	{
+		operator+=( A^B );
+		return SUCCESSFUL_RETURN;
+	}
+
+	denseGemm( A.getNumCols( ),B.getNumCols( ),A.getNumRows( ),A.element,BT_TRUE,B.element,element );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue operator<<( FILE *file, Matrix& arg ){
 
     return arg.printToFile(file);
@@ -852,41 +939,16 @@ Matrix Matrix::getCholeskyDecomposition() const{
     int n = getNumRows();
     ASSERT( n == (int) getNumCols() );
 
-    int i, k, p;
-    double *p_Lk0;
-    double *p_Lkp;
-    double *p_Lkk;
-    double *p_Li0;
-    double reciprocal;
+    int i, k;
 
-    double *A = new double[dim];
-    for( k = 0; k < (int) dim; k++ )
-        A[k] = element[k];
+    Matrix tmp( *this );
 
-    for (k = 0, p_Lk0 = A; k < n; p_Lk0 += n, k++) {
-       p_Lkk = p_Lk0 + k;
-       for (p = 0, p_Lkp = p_Lk0; p < k; p_Lkp += 1,  p++)
-          *p_Lkk -= *p_Lkp * *p_Lkp;
-       *p_Lkk = sqrt( *p_Lkk );
-       ASSERT( *p_Lkk >= EPS );
-       reciprocal = 1.0 / *p_Lkk;
-       p_Li0 = p_Lk0 + n;
-       for (i = k + 1; i < n; p_Li0 += n, i++) {
-          for (p = 0; p < k; p++)
-             *(p_Li0 + k) -= *(p_Li0 + p) * *(p_Lk0 + p);
-          *(p_Li0 + k) *= reciprocal;
-          *(p_Lk0 + i) = *(p_Li0 + k);
-       }
-    }
-
-    Matrix tmp(n,n);
-    tmp.setZero();
+    returnValue returnvalue = denseCholesky( n, tmp.element );
+    ASSERT( returnvalue == SUCCESSFUL_RETURN );
 
     for( i = 0; i < n; i++ )
-        for( k = 0; k <= i; k++ )
-             tmp(i,k) = A[i*n+k];
-
-    delete[] A;
+        for( k = i+1; k < n; k++ )
+             tmp(i,k) = 0.0;
 
     return tmp;
 }
@@ -945,36 +1007,19 @@ Matrix Matrix::getCholeskyInverse() const{
    int n = getNumRows();
    ASSERT( n == (int) getNumCols() );
 
-   int i, j, k;
-   double *p_i, *p_j, *p_k;
-   double sum;
-
-   Matrix cholesky;
-   cholesky = getCholeskyDecomposition();
+   Matrix cholesky( *this );
 
-   double *LU = new double[n*n];
+   if( denseCholesky( n, cholesky.element ) != SUCCESSFUL_RETURN )
+       ACADOWARNING( RET_MATRIX_NOT_SPD );
 
-   for( i = 0; i < n; i++ ){
-       for( k = 0; k <= i; k++ ){
-           LU[i+n*k] = cholesky(i,k);
-           LU[i*n+k] = cholesky(i,k);
-       }
-   }
+   // A^{-1} = L^{-T} L^{-1}:
+   Matrix LInverse( n,n );
+   LInverse.setIdentity();
+   denseTriangularSolve( n, n, cholesky.element, BT_FALSE, LInverse.element );
 
-   lowerTriangularInverse(LU, n);
-
-   for (i = 0, p_i = LU; i < n; i++, p_i += n) {
-      for (j = 0, p_j = LU; j <= i; j++, p_j += n) {
-         sum = 0.0;
-         for (k = i, p_k = p_i; k < n; k++, p_k += n)
-            sum += *(p_k + i) * *(p_k + j);
-         *(p_i + j) = sum;
-         *(p_j + i) = sum;
-      }
-   }
-
-   Matrix tmp(n,n,LU);
-   delete[] LU;
+   Matrix tmp( n,n );
+   tmp.setZero();
+   denseSyrk( n, n, LInverse.element, tmp.element );
 
    return tmp;
 }
@@ -986,6 +1031,42 @@ Matrix Matrix::getInverse() const{
 
     ASSERT( getNumCols() == getNumRows() );
 
+    uint n = getNumRows();
+
+    Matrix LU( *this );
+    uint *pivots = (uint*)calloc( n+1, sizeof(uint) );
+
+    // the LU factors are only used if no pivot is small relative to the
+    // largest one; near-singular matrices are inverted as before:
+    BooleanType useLU = BT_FALSE;
+
+    if( denseLU( n, LU.element, pivots ) == SUCCESSFUL_RETURN ){
+
+        double minPivot = ( n > 0 ) ? fabs( LU.element[0] ) : 0.0;
+        double maxPivot = minPivot;
+
+        for( uint run1 = 1; run1 < n; run1++ ){
+            double pivot = fabs( LU.element[run1*n+run1] );
+            if( pivot < minPivot ) minPivot = pivot;
+            if( pivot > maxPivot ) maxPivot = pivot;
+        }
+
+        if( ( n == 0 ) || ( minPivot > SQRT_EPS*maxPivot ) )
+            useLU = BT_TRUE;
+    }
+
+    if( useLU == BT_TRUE ){
+
+        Matrix tmp( n,n );
+        tmp.setIdentity();
+        denseLUSolve( n, n, LU.element, pivots, tmp.element );
+
+        free( pivots );
+        return tmp;
+    }
+    free( pivots );
+
+    // singular and ill-conditioned matrices are treated via the singular value decomposition:
     Matrix U,V;
     Vector D;
 
@@ -1120,42 +1201,14 @@ Vector Matrix::solveTransposeQR( const Vector &b ) const{
 
 returnValue Matrix::computeSparseLUdecomposition(){
 
-    ASSERT( solver == 0 );
     ASSERT( getNumRows() == getNumCols() );
 
-    solver = new ACADOcsparse();
-
-    int run1,run2;
-    double ZERO_TOL = 1.e-12;
-    const int n = getNumRows();
-
-    double *A    = new double[dim];
-    int    *idx1 = new int   [dim];
-    int    *idx2 = new int   [dim];
-
-    int nDense = 0;
-
-    for( run1 = 0; run1 < n; run1++ ){
-        for( run2 = 0; run2 < n; run2++ ){
-            if( fabs( operator()(run1,run2) ) > ZERO_TOL ){
-                A  [nDense]  = operator()(run1,run2);
-                idx1[nDense] = run1;
-                idx2[nDense] = run2;
-                nDense++;
-            }
-        }
-    }
-
-    solver->setDimension      ( n          );
-    solver->setNumberOfEntries( nDense     );
-    solver->setIndices        ( idx1, idx2 );
-    solver->setMatrix         ( A          );
+    // an existing solver keeps its symbolic analysis and scatters the
+    // values into its pattern as long as no new non-zero entries appear:
+    if( solver == 0 )
+        solver = new ACADOcsparse();
 
-    delete[] A;
-    delete[] idx1;
-    delete[] idx2;
-
-    return SUCCESSFUL_RETURN;
+    return solver->setDenseMatrix( getNumRows(), element, 1.e-12 );
 }
 
 
@@ -1487,28 +1540,6 @@ void Matrix::sortByDecreasingSingularValues( int nrows, int ncols,
 }
 
 
-void Matrix::lowerTriangularInverse(double *L, int n) const{
-
-   int i, j, k;
-   double *p_i, *p_j, *p_k;
-   double sum;
-
-   for (k = 0, p_k = L; k < n; p_k += (n + 1), k++) {
-      ASSERT(*p_k >= EPS);
-      *p_k = 1.0 / *p_k;
-   }
-   for (i = 1, p_i = L + n; i < n; i++, p_i += n) {
-      for (j = 0, p_j = L; j < i; p_j += n, j++) {
-         sum = 0.0;
-         for (k = j, p_k = p_j; k < i; k++, p_k += n)
-            sum += *(p_i + k) * *(p_k + j);
-         *(p_i + j) = - *(p_i + i) * sum;
-      }
-   }
-   return;
-}
-
-
 Matrix operator-(const Matrix &arg){
 
     uint i,j;
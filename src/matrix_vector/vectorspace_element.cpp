@@ -106,11 +106,15 @@ VectorspaceElement& VectorspaceElement::operator=( const VectorspaceElement& rhs
 
     if ( this != &rhs )
     {
-		if ( element != 0 )
-			delete[] element;
+		// keep the storage if the dimension does not change
+		if ( ( rhs.dim != dim ) || ( element == 0 ) )
+		{
+			if ( element != 0 )
+				delete[] element;
 
-		dim = rhs.dim;
-		element = new double[ dim ];
+			dim = rhs.dim;
+			element = new double[ dim ];
+		}
 
 		for( i=0; i<dim; ++i )
 			element[i] = rhs.element[i];
@@ -146,15 +150,19 @@ returnValue VectorspaceElement::init( uint _dim, double* _values )
 {
 	uint i;
 
-	if ( element != 0 )
-		delete[] element;
+	// keep the storage if the dimension does not change
+	if ( ( _dim != dim ) || ( element == 0 ) )
+	{
+		if ( element != 0 )
+			delete[] element;
 
-	dim = _dim;
-	
-	if ( dim > 0 )
-		element = new double[ dim ];
-	else 
-		element = 0;
+		dim = _dim;
+
+		if ( dim > 0 )
+			element = new double[ dim ];
+		else
+			element = 0;
+	}
 
 	if ( _values != 0 )
 		for( i=0; i<dim; ++i )
@@ -513,6 +521,12 @@ double* VectorspaceElement::getDoublePointer( )
 }
 
 
+const double* VectorspaceElement::getDoublePointer( ) const
+{
+	return element;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
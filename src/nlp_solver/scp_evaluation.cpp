@@ -225,81 +225,68 @@ returnValue SCPevaluation::evaluateSensitivities(	const OCPiterate& iter,
     get( CONSTRAINT_SENSITIVITY, conMode );
 
 
-    // COMPUTE THE 1st ORDER DERIVATIVES:
-    // ----------------------------------
+    int parallelIntegration = BT_FALSE;
+    get( PARALLEL_INTEGRATION, parallelIntegration );
 
-    objective->setUnitBackwardSeed( );
-    if( ( (HessianApproximationMode)hessMode == GAUSS_NEWTON ) || ( (HessianApproximationMode)hessMode == GAUSS_NEWTON_WITH_BLOCK_BFGS ) )
-           objective->evaluateSensitivitiesGN( cp.hessian );
-    else{
-        if( (HessianApproximationMode)hessMode == EXACT_HESSIAN ){
-            cp.hessian.setZero();
-            objective->evaluateSensitivities( cp.hessian );
-        }
-        else objective->evaluateSensitivities();
-    }
 
+    // PREPARE THE BUFFERS FOR THE HESSIAN CONTRIBUTIONS:
+    // --------------------------------------------------
+    // (the objective writes directly into cp.hessian, the dynamic
+    //  discretization and the constraints add into their own buffers
+    //  such that all three blocks can be evaluated concurrently)
 
-    objective->getBackwardSensitivities( cp.objectiveGradient, 1 );
+    if( (HessianApproximationMode)dynHessMode == EXACT_HESSIAN )
+        initHessianContribution( cp.hessian, dynamicHessian );
 
-	
-// 	printf("cp.hessian = \n");
-//     cp.hessian.print();
+    if( (HessianApproximationMode)hessMode == EXACT_HESSIAN )
+        initHessianContribution( cp.hessian, constraintHessian );
 
-    if( dynamicDiscretization != 0 ){
 
-        if( (HessianApproximationMode)dynHessMode == EXACT_HESSIAN ){
+    // COMPUTE THE 1st ORDER DERIVATIVES:
+    // ----------------------------------
+    // (if the shooting intervals are already integrated in parallel,
+    //  the three blocks are evaluated one after another as nested
+    //  parallel regions would run the intervals sequentially)
 
-            ACADO_TRY( dynamicDiscretization->setUnitForwardSeed()                                  );
-            ACADO_TRY( dynamicDiscretization->evaluateSensitivities( cp.lambdaDynamic, cp.hessian ) );
-            ACADO_TRY( dynamicDiscretization->getForwardSensitivities( cp.dynGradient )             );
-        }
-        else{
-            if( dynMode == BACKWARD_SENSITIVITY ){
-
-                ACADO_TRY( dynamicDiscretization->setUnitBackwardSeed()                      );
-                ACADO_TRY( dynamicDiscretization->evaluateSensitivities()                    );
-                ACADO_TRY( dynamicDiscretization->getBackwardSensitivities( cp.dynGradient ) );
-            }
-            if( dynMode == FORWARD_SENSITIVITY ){
-
-                ACADO_TRY( dynamicDiscretization->setUnitForwardSeed()                      );
-                ACADO_TRY( dynamicDiscretization->evaluateSensitivities()                   );
-                ACADO_TRY( dynamicDiscretization->getForwardSensitivities( cp.dynGradient ) );
-            }
-            if( dynMode == FORWARD_SENSITIVITY_LIFTED ){
-
-                ACADO_TRY( dynamicDiscretization->setUnitForwardSeed()                      );
-                ACADO_TRY( dynamicDiscretization->evaluateSensitivitiesLifted()             );
-                ACADO_TRY( dynamicDiscretization->getForwardSensitivities( cp.dynGradient ) );
-            }
-        }
+    returnValue returnvalue[3];
+
+    returnvalue[0] = SUCCESSFUL_RETURN;
+    returnvalue[1] = SUCCESSFUL_RETURN;
+    returnvalue[2] = SUCCESSFUL_RETURN;
+
+#ifdef _OPENMP
+    #pragma omp parallel sections if( parallelIntegration == BT_FALSE )
+#endif
+    {
+#ifdef _OPENMP
+        #pragma omp section
+#endif
+        returnvalue[0] = evaluateObjectiveSensitivities( (HessianApproximationMode)hessMode, cp );
+
+#ifdef _OPENMP
+        #pragma omp section
+#endif
+        returnvalue[1] = evaluateDynamicSensitivities( (HessianApproximationMode)dynHessMode, dynMode, cp );
+
+#ifdef _OPENMP
+        #pragma omp section
+#endif
+        returnvalue[2] = evaluateConstraintSensitivities( (HessianApproximationMode)hessMode, conMode, cp );
     }
 
-// 	printf("cp.dynGradient = \n");
-// (cp.dynGradient).print();
+    ACADO_TRY( returnvalue[0] );
+    ACADO_TRY( returnvalue[1] );
+    ACADO_TRY( returnvalue[2] );
 
-    if( constraint != 0 ){
 
-        if( (HessianApproximationMode)hessMode == EXACT_HESSIAN ){
+    // REDUCE THE HESSIAN CONTRIBUTIONS:
+    // ---------------------------------
 
-            constraint->setUnitBackwardSeed();
-            constraint->evaluateSensitivities( cp.lambdaConstraint, cp.hessian );
-            constraint->getBackwardSensitivities( cp.constraintGradient, 1 );
-        }
-        else{
-            if( conMode == BACKWARD_SENSITIVITY ){
-                constraint->setUnitBackwardSeed();
-                constraint->evaluateSensitivities( );
-                constraint->getBackwardSensitivities( cp.constraintGradient, 1 );
-            }
-            if( conMode == FORWARD_SENSITIVITY ){
-                constraint->setUnitForwardSeed();
-                constraint->evaluateSensitivities( );
-                constraint->getForwardSensitivities( cp.constraintGradient, 1 );
-            }
-        }
-    }
+    if( ( dynamicDiscretization != 0 ) && ( (HessianApproximationMode)dynHessMode == EXACT_HESSIAN ) )
+        cp.hessian += dynamicHessian;
+
+    if( ( constraint != 0 ) && ( (HessianApproximationMode)hessMode == EXACT_HESSIAN ) )
+        cp.hessian += constraintHessian;
 
     return SUCCESSFUL_RETURN;
 }
@@ -392,6 +379,79 @@ returnValue SCPevaluation::evaluateLagrangeGradient(	uint N,
 
 
 
+returnValue SCPevaluation::shift(	uint N,
+									BandedCP& cp
+									)
+{
+    uint run1, run2, run3;
+
+    if( ( dynamicDiscretization == 0 ) || ( N < 2 ) )
+        return SUCCESSFUL_RETURN;
+
+
+    // SHIFT THE MULTIPLIERS:
+    // ----------------------
+    // (lambdaBound holds the blocks of x and xa on all N points, the block
+    //  of p, and the blocks of u and w on the first N-1 points)
+
+    shiftBlockRows( cp.lambdaDynamic, 0, N-1 );
+
+    shiftBlockRows( cp.lambdaBound, 0    , N   );
+    shiftBlockRows( cp.lambdaBound, N    , N   );
+    shiftBlockRows( cp.lambdaBound, 2*N+1, N-1 );
+    shiftBlockRows( cp.lambdaBound, 3*N+1, N-1 );
+
+
+    // SHIFT THE LINEARIZATION AT THE PREVIOUS ITERATE:
+    // ------------------------------------------------
+    // (the "old" Lagrange gradient of the next step is evaluated with
+    //  this linearization, it has to be shifted like the iterate)
+
+    shiftBlockRows( cp.dynGradient, 0, N-1 );
+
+    for( run1 = 0; run1 < 5; run1++ ){
+
+        shiftBlockCols( cp.objectiveGradient, run1*N, N );
+        shiftBlockRows( cp.deltaX           , run1*N, N );
+        shiftBlockRows( cp.hessian          , run1*N, N );
+        shiftBlockCols( cp.hessian          , run1*N, N );
+    }
+
+
+    // SHIFT THE BLOCKS OF THE PATH CONSTRAINTS:
+    // -----------------------------------------
+    // (boundary, coupled and point constraints are not shifted)
+
+    if( constraint != 0 ){
+
+        const BooleanType hasGradient = ( ( cp.constraintGradient.getNumRows() == cp.lambdaConstraint.getNumRows() ) &&
+                                          ( cp.constraintGradient.getNumCols() == 5*N ) ) ? BT_TRUE : BT_FALSE;
+
+        for( run1 = 0; run1+1 < cp.lambdaConstraint.getNumRows(); run1++ ){
+
+            int gridIdx = constraint->getBlockGridIndex( run1 );
+
+            if( ( gridIdx < 0 ) || ( constraint->getBlockGridIndex( run1+1 ) != gridIdx+1 ) )
+                continue;
+
+            cp.lambdaConstraint.copySubBlock( run1, 0, run1+1, 0 );
+
+            if( hasGradient == BT_TRUE )
+                for( run2 = 0; run2 < 5; run2++ )
+                    for( run3 = 0; run3 < N-1; run3++ )
+                        cp.constraintGradient.copySubBlock( run1, run2*N+run3, run1+1, run2*N+run3+1 );
+        }
+    }
+
+
+    // KEEP THE SENSITIVITIES OF ALL BUT THE LAST INTERVAL:
+    // ----------------------------------------------------
+
+    return dynamicDiscretization->shiftSensitivities( );
+}
+
+
+
 double SCPevaluation::getKKTtolerance(	const OCPiterate& iter,
         								const BandedCP& cp,
         								double KKTmultiplierRegularisation
@@ -547,6 +607,145 @@ returnValue SCPevaluation::clearDynamicDiscretization( )
 // PROTECTED MEMBER FUNCTIONS:
 //
 
+returnValue SCPevaluation::evaluateObjectiveSensitivities(	HessianApproximationMode hessMode,
+															BandedCP& cp
+															)
+{
+    objective->setUnitBackwardSeed( );
+    if( ( hessMode == GAUSS_NEWTON ) || ( hessMode == GAUSS_NEWTON_WITH_BLOCK_BFGS ) )
+           objective->evaluateSensitivitiesGN( cp.hessian );
+    else{
+        if( hessMode == EXACT_HESSIAN ){
+            cp.hessian.setZero();
+            objective->evaluateSensitivities( cp.hessian );
+        }
+        else objective->evaluateSensitivities();
+    }
+
+    objective->getBackwardSensitivities( cp.objectiveGradient, 1 );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::evaluateDynamicSensitivities(	HessianApproximationMode dynHessMode,
+															int dynMode,
+															BandedCP& cp
+															)
+{
+    if( dynamicDiscretization == 0 )
+        return SUCCESSFUL_RETURN;
+
+    if( dynHessMode == EXACT_HESSIAN ){
+
+        ACADO_TRY( dynamicDiscretization->setUnitForwardSeed()                                      );
+        ACADO_TRY( dynamicDiscretization->evaluateSensitivities( cp.lambdaDynamic, dynamicHessian ) );
+        ACADO_TRY( dynamicDiscretization->getForwardSensitivities( cp.dynGradient )                 );
+    }
+    else{
+        if( dynMode == BACKWARD_SENSITIVITY ){
+
+            ACADO_TRY( dynamicDiscretization->setUnitBackwardSeed()                      );
+            ACADO_TRY( dynamicDiscretization->evaluateSensitivities()                    );
+            ACADO_TRY( dynamicDiscretization->getBackwardSensitivities( cp.dynGradient ) );
+        }
+        if( dynMode == FORWARD_SENSITIVITY ){
+
+            ACADO_TRY( dynamicDiscretization->setUnitForwardSeed()                      );
+            ACADO_TRY( dynamicDiscretization->evaluateSensitivities()                   );
+            ACADO_TRY( dynamicDiscretization->getForwardSensitivities( cp.dynGradient ) );
+        }
+        if( dynMode == FORWARD_SENSITIVITY_LIFTED ){
+
+            ACADO_TRY( dynamicDiscretization->setUnitForwardSeed()                      );
+            ACADO_TRY( dynamicDiscretization->evaluateSensitivitiesLifted()             );
+            ACADO_TRY( dynamicDiscretization->getForwardSensitivities( cp.dynGradient ) );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::evaluateConstraintSensitivities(	HessianApproximationMode hessMode,
+																int conMode,
+																BandedCP& cp
+																)
+{
+    if( constraint == 0 )
+        return SUCCESSFUL_RETURN;
+
+    if( hessMode == EXACT_HESSIAN ){
+
+        constraint->setUnitBackwardSeed();
+        constraint->evaluateSensitivities( cp.lambdaConstraint, constraintHessian );
+        constraint->getBackwardSensitivities( cp.constraintGradient, 1 );
+    }
+    else{
+        if( conMode == BACKWARD_SENSITIVITY ){
+            constraint->setUnitBackwardSeed();
+            constraint->evaluateSensitivities( );
+            constraint->getBackwardSensitivities( cp.constraintGradient, 1 );
+        }
+        if( conMode == FORWARD_SENSITIVITY ){
+            constraint->setUnitForwardSeed();
+            constraint->evaluateSensitivities( );
+            constraint->getForwardSensitivities( cp.constraintGradient, 1 );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::shiftBlockRows(	BlockMatrix& A,
+											uint first,
+											uint n
+											) const
+{
+    uint run1, run2;
+
+    if( A.getNumRows() < first+n )
+        return SUCCESSFUL_RETURN;
+
+    for( run1 = first; run1+1 < first+n; run1++ )
+        for( run2 = 0; run2 < A.getNumCols(); run2++ )
+            A.copySubBlock( run1, run2, run1+1, run2 );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::shiftBlockCols(	BlockMatrix& A,
+											uint first,
+											uint n
+											) const
+{
+    uint run1, run2;
+
+    if( A.getNumCols() < first+n )
+        return SUCCESSFUL_RETURN;
+
+    for( run1 = 0; run1 < A.getNumRows(); run1++ )
+        for( run2 = first; run2+1 < first+n; run2++ )
+            A.copySubBlock( run1, run2, run1, run2+1 );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::initHessianContribution(	const BlockMatrix& hessian,
+													BlockMatrix& contribution
+													) const
+{
+    if( ( contribution.getNumRows( ) != hessian.getNumRows( ) ) ||
+        ( contribution.getNumCols( ) != hessian.getNumCols( ) ) )
+        contribution.init( hessian.getNumRows( ), hessian.getNumCols( ) );
+
+    return contribution.setZero( );
+}
+
+
 returnValue SCPevaluation::setupOptions( )
 {
 	return SUCCESSFUL_RETURN;
@@ -53,6 +53,7 @@ SCPmeritFunction::SCPmeritFunction( UserInteraction* _userInteraction ) : Algori
 
 SCPmeritFunction::SCPmeritFunction( const SCPmeritFunction& rhs ) : AlgorithmicBase( rhs )
 {
+	iterTest = rhs.iterTest;
 }
 
 
@@ -66,6 +67,8 @@ SCPmeritFunction& SCPmeritFunction::operator=( const SCPmeritFunction& rhs )
     if ( this != &rhs )
     {
 		AlgorithmicBase::operator=( rhs );
+
+		iterTest = rhs.iterTest;
     }
 
     return *this;
@@ -91,7 +94,7 @@ returnValue SCPmeritFunction::evaluate(	double alpha,
 
         eval.clearDynamicDiscretization( );
 
-		OCPiterate iterTest = iter;
+		iterTest.copyValues( iter );
 		iterTest.applyStep( cp.deltaX,alpha );
 
 		if ( eval.evaluate( iterTest,cp ) != SUCCESSFUL_RETURN )
@@ -394,7 +394,15 @@ returnValue SCPmethod::performCurrentStep( )
 //     acadoPrintf("bandedCP.lambdaDynamic = \n");
 //     bandedCP.lambdaDynamic.print();
 
-	oldIter = iter;
+    // Keep the current iterate (re-using the storage of the previous one):
+    // ---------------------------------------------------------------------
+	clock.reset( );
+	clock.start( );
+
+	oldIter.copyValues( iter );
+
+	clock.stop( );
+	setLast( LOG_TIME_ITERATE_UPDATE,clock.getTime() );
 
     // Perform a globalized step:
     // --------------------------
@@ -454,9 +462,6 @@ returnValue SCPmethod::prepareNextStep( )
     returnValue returnvalue;
     RealClock clockLG;
 
-	BlockMatrix oldLagrangeGradient;
-	BlockMatrix newLagrangeGradient;
-
 // 	acadoPrintf("bandedCP.dynResiduum (possibly shifted) = \n");
 //     bandedCP.dynResiduum.print();
 // 	acadoPrintf("bandedCP.lambdaDynamic (possibly shifted) = \n");
@@ -535,7 +540,7 @@ returnValue SCPmethod::prepareNextStep( )
 	clock.reset( );
 	clock.start( );
 
-	returnvalue = computeHessianMatrix( oldLagrangeGradient,newLagrangeGradient );
+	returnvalue = computeHessianMatrix( );
 	if( returnvalue != SUCCESSFUL_RETURN )
 		ACADOERROR( RET_NLP_STEP_FAILED );
 
@@ -590,16 +595,35 @@ returnValue SCPmethod::shiftVariables(	double timeShift,
 	if ( acadoIsNegative( timeShift ) == BT_TRUE )
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
-// 	Matrix tmp;
-// 	for( uint i=1; i<iter.getNumPoints()-1; ++i )
-// 	{
-// 		bandedCP.lambdaDynamic.getSubBlock( i,0, tmp );
-// 		bandedCP.lambdaDynamic.setDense( i-1,0, tmp );
-// 	}
+	// shift the iterate first; it rejects shifts that do not match
+	// the first interval of its grid
+	ACADO_TRY( iter.shift( timeShift, lastX, lastXA, lastP, lastU, lastW ) );
 
-// 	printf("shifted!\n");
 	needToReevaluate = BT_TRUE;
-	return iter.shift( timeShift, lastX, lastXA, lastP, lastU, lastW );
+
+	int useShiftedWarmStart = BT_FALSE;
+	get( USE_SHIFTED_WARM_START,useShiftedWarmStart );
+
+	if ( (BooleanType)useShiftedWarmStart == BT_FALSE )
+		return SUCCESSFUL_RETURN;
+
+	// multipliers, linearization and working set can only be reused
+	// if every interval is moved by exactly one interval length
+	Grid shiftGrid = iter.getGrid( );
+
+	if ( ( shiftGrid.isEquidistant( ) == BT_FALSE ) ||
+		 ( shiftGrid.getNumIntervals( ) == 0 ) ||
+		 ( acadoIsEqual( shiftGrid.getIntervalLength( 0 ),timeShift ) == BT_FALSE ) )
+		return SUCCESSFUL_RETURN;
+
+	// shift multipliers and linearization such that the next
+	// preparation step only needs to differentiate the last interval
+	ACADO_TRY( eval->shift( getNumPoints(),bandedCP ) );
+
+	if ( bandedCPsolver != 0 )
+		ACADO_TRY( bandedCPsolver->setWorkingSetGuess( bandedCP ) );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -637,10 +661,11 @@ returnValue SCPmethod::setupLogging( )
 // 	tmp.addItem( LOG_TIME_RELAXED_QP,            "",     "TIME FOR SOLVING RELAXED QP's        :  "," sec.\n", 9, 3 );
 // 	tmp.addItem( LOG_TIME_EXPAND,                "",     "TIME FOR EXPANSION                   :  "," sec.\n", 9, 3 );
 // 	tmp.addItem( LOG_TIME_EVALUATION,            "",     "TIME FOR FUNCTION EVALUATIONS        :  "," sec.\n", 9, 3 );
+	tmp.addItem( LOG_TIME_ITERATE_UPDATE,        "",     "TIME FOR STORING PREVIOUS ITERATE    :  "," sec.\n", 9, 3 );
 	tmp.addItem( LOG_TIME_GLOBALIZATION,         "",     "TIME FOR GLOBALIZATION               :  "," sec.\n", 9, 3 );
 	tmp.addItem( LOG_TIME_SENSITIVITIES,         "",     "TIME FOR SENSITIVITY GENERATION      :  "," sec.\n", 9, 3 );
-// 	tmp.addItem( LOG_TIME_LAGRANGE_GRADIENT,     "",     "TIME FOR COMPUTING LAGRANGE GRADIENT :  "," sec.\n", 9, 3 );
-// 	tmp.addItem( LOG_TIME_HESSIAN_COMPUTATION,   "",     "TIME FOR HESSIAN EVALUATION          :  "," sec.\n", 9, 3 );
+	tmp.addItem( LOG_TIME_LAGRANGE_GRADIENT,     "",     "TIME FOR COMPUTING LAGRANGE GRADIENT :  "," sec.\n", 9, 3 );
+	tmp.addItem( LOG_TIME_HESSIAN_COMPUTATION,   "",     "TIME FOR HESSIAN EVALUATION          :  "," sec.\n", 9, 3 );
 
 	timeLoggingIdx = addLogRecord( tmp );
 
@@ -709,6 +734,14 @@ returnValue SCPmethod::setup( )
 		bandedCPsolver = new CondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
 		bandedCPsolver->init( iter );
 	}
+	else if ( (SparseQPsolutionMethods)sparseQPsolution == SPARSE_SOLVER )
+	{
+    	bandedCP.lambdaConstraint.init( eval->getNumConstraintBlocks(), 1 );
+    	bandedCP.lambdaDynamic.init( getNumPoints()-1, 1 );
+
+		bandedCPsolver = new InteriorPointBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+		bandedCPsolver->init( iter );
+	}
 	else
 	{
 		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
@@ -884,20 +917,21 @@ returnValue SCPmethod::checkForConvergence( )
 }
 
 
-returnValue SCPmethod::computeHessianMatrix(	const BlockMatrix& oldLagrangeGradient,
-												const BlockMatrix& newLagrangeGradient
-												)
+returnValue SCPmethod::computeHessianMatrix( )
 {
 	returnValue returnvalue;
 
+	// the difference is stored in place, re-using the storage of previous iterations
+	deltaLagrangeGradient.setDifference( newLagrangeGradient,oldLagrangeGradient );
+
 	if ( numberOfSteps == 1 )
 	{
-		returnvalue = derivativeApproximation->initScaling( bandedCP.hessian, bandedCP.deltaX, newLagrangeGradient-oldLagrangeGradient );
+		returnvalue = derivativeApproximation->initScaling( bandedCP.hessian, bandedCP.deltaX, deltaLagrangeGradient );
 		if( returnvalue != SUCCESSFUL_RETURN )
 			ACADOERROR( returnvalue );
 	}
 
-	returnvalue = derivativeApproximation->apply( bandedCP.hessian, bandedCP.deltaX, newLagrangeGradient-oldLagrangeGradient );
+	returnvalue = derivativeApproximation->apply( bandedCP.hessian, bandedCP.deltaX, deltaLagrangeGradient );
 	if( returnvalue != SUCCESSFUL_RETURN )
 		ACADOERROR( returnvalue );
 
@@ -31,6 +31,8 @@
 
 #include <acado/noise/noise.hpp>
 
+#include <time.h>
+
 
 
 BEGIN_NAMESPACE_ACADO
@@ -38,12 +40,15 @@ BEGIN_NAMESPACE_ACADO
 
 Noise::Noise( )
 {
+	randomState = deriveSeed( 1,0 );
 }
 
 
 Noise::Noise( const Noise& rhs )
 {
 	w = rhs.w;
+
+	randomState = rhs.randomState;
 }
 
 
@@ -57,12 +62,52 @@ Noise& Noise::operator=( const Noise& rhs )
 	if ( this != &rhs )
 	{
 		w = rhs.w;
+
+		randomState = rhs.randomState;
 	}
 
     return *this;
 }
 
 
+uint Noise::deriveSeed(	uint seed,
+						uint streamIdx
+						)
+{
+	/* mixes seed and stream index with the finalizer of MurmurHash3 */
+	uint hash = seed ^ ( 0x9E3779B9u * ( streamIdx+1 ) );
+
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35u;
+	hash ^= hash >> 16;
+
+	if ( hash == 0 )
+		hash = 0x9E3779B9u;
+
+	return hash;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue Noise::initializeRandomNumberGenerator(	uint seed
+													)
+{
+	/* seeds from the system clock differ between noise blocks */
+	if ( seed == 0 )
+		randomState = deriveSeed( (uint)time(0),(uint)( (size_t)this ) );
+	else
+		randomState = deriveSeed( seed,0 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
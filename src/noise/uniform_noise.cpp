@@ -31,8 +31,6 @@
 
 #include <acado/noise/uniform_noise.hpp>
 
-#include <stdlib.h>
-#include <time.h>
 
 
 
@@ -192,10 +190,7 @@ returnValue UniformNoise::init(	uint seed
 		return ACADOERROR( RET_NO_NOISE_SETTINGS );
 
 	/* initialize random seed: */
-	if ( seed == 0 )
-		srand( (unsigned int)time(0) );
-	else
-		srand( seed );
+	initializeRandomNumberGenerator( seed );
 
 	setStatus( BS_READY );
 
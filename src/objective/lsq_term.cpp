@@ -201,8 +201,6 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
 
     uint run1, run2, run3;
 
-    Vector h_res;
-
     const uint nh = fcn.getDim();
     const uint N  = grid.getNumPoints();
 
@@ -211,7 +209,8 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
     obj = 0.0;
 
 	double currentValue;
-	VariablesGrid allValues( 1,grid );
+
+    h_res.init( nh );
 
     for( run1 = 0; run1 < N; run1++ ){
 
@@ -220,7 +219,7 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
         // EVALUATE THE LSQ-FUCNTION:
         // --------------------------
         z.setZ( run1, x );
-        h_res = fcn.evaluate( z, (int) run1 );
+        fcn.evaluate( (int) run1, z.getEvaluationPointer(), h_res.getDoublePointer() );
 
 	
 	#ifdef SIM_DEBUG
@@ -238,7 +237,8 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
         // -----------------------
 
         if( r != NULL )
-            h_res -= r[run1];
+            for( run2 = 0; run2 < nh; run2++ )
+                h_res(run2) -= r[run1](run2);
 
         if( S != NULL ){
 
@@ -261,13 +261,11 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
             }
         }
 
-		allValues( run1,0 ) = currentValue;
+        // piecewise constant integration over the grid:
+        if( run1+1 < N )
+            obj += grid.getIntervalLength( run1 )*currentValue;
     }
 
-	Vector tmp(1);
-	allValues.getIntegral( IM_CONSTANT,tmp );
-	obj = tmp(0);
-
     return SUCCESSFUL_RETURN;
 }
 
@@ -287,125 +285,52 @@ returnValue LSQTerm::evaluateSensitivities( BlockMatrix *hessian ){
             xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
             return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
 
-        double *bseed   = new double [nh];
-        double **J      = new double*[nh];
-
-        for( run2 = 0; run2 < nh; run2++ )
-             J[run2] = new double[fcn.getNumberOfVariables() +1];
-
         if( bSeed->getNumRows( 0, 0 ) != 1 ) return ACADOWARNING( RET_WRONG_DEFINITION_OF_SEEDS );
 
-        Matrix bseed_;
-        bSeed->getSubBlock( 0, 0, bseed_);
-
-        dBackward.init( 1, 5*N );
+        const double bseed_ = bSeed->getSubBlock( 0, 0 ).operator()( 0,0 );
 
-        Matrix Dx ( 1, nx );
-        Matrix Dxa( 1, na );
-        Matrix Dp ( 1, np );
-        Matrix Du ( 1, nu );
-        Matrix Dw ( 1, nw );
+        h_seed.init( nh );
+        h_jac .init( nh, fcn.getNumberOfVariables()+1 );
 
         for( run1 = 0; run1 < N; run1++ ){
 
-            Dx .setZero();
-            Dxa.setZero();
-            Dp .setZero();
-            Du .setZero();
-            Dw .setZero();
-
-            for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
+            for( run2 = 0; run2 < nh; run2++ ) h_seed(run2) = 0;
 
             for( run2 = 0; run2 < nh; run2++ ){
                  for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
-                     J[run2][run3] = 0.0;
-
-                 bseed[run2] = 1.0;
-                 fcn.AD_backward( run1, bseed, J[run2] );
-                 bseed[run2] = 0.0;
-
-                 for( run3 = 0; run3 < nx; run3++ ){
-                      Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx; run3 < nx+na; run3++ ){
-                      Dxa( 0, run3-nx ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na; run3 < nx+na+np; run3++ ){
-                      Dp( 0, run3-nx-na ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
-                      Du( 0, run3-nx-na-np ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
-                      Dw( 0, run3-nx-na-np-nu ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
+                     h_jac(run2,run3) = 0.0;
+
+                 h_seed(run2) = 1.0;
+                 fcn.AD_backward( run1, h_seed.getDoublePointer(), &h_jac(run2,0) );
+                 h_seed(run2) = 0.0;
             }
-            if( nx > 0 ) dBackward.setDense( 0,     run1, Dx  );
-            if( na > 0 ) dBackward.setDense( 0,   N+run1, Dxa );
-            if( np > 0 ) dBackward.setDense( 0, 2*N+run1, Dp  );
-            if( nu > 0 ) dBackward.setDense( 0, 3*N+run1, Du  );
-            if( nw > 0 ) dBackward.setDense( 0, 4*N+run1, Dw  );
+
+            storeBackwardSensitivities( run1, bseed_ );
 
 
             // COMPUTATION OF THE EXACT HESSIAN:
             // ---------------------------------
 
             const int nnn = nx+na+np+nu+nw;
-            Matrix tmp( nh, nnn );
+            S_h_jac.init( nh, nnn );
 
             for( run3 = 0; run3 < nnn; run3++ ){
                 for( run2 = 0; run2 < nh; run2++ ){
                     if( S != 0 ){
-                        tmp( run2, run3 ) = 0.0;
+                        S_h_jac( run2, run3 ) = 0.0;
                         for( run4 = 0; run4 < nh; run4++ ){
-                            tmp( run2, run3 ) += S[run1].operator()(run2,run4)*J[run4][y_index[run3]];
+                            S_h_jac( run2, run3 ) += S[run1].operator()(run2,run4)*h_jac(run4,y_index[run3]);
                         }
                     }
                     else{
-                        tmp( run2, run3 ) = J[run2][y_index[run3]];
+                        S_h_jac( run2, run3 ) = h_jac(run2,y_index[run3]);
                     }
                 }
             }
-            Matrix tmp2;
-            int i,j;
-            int *Sidx = new int[6];
-            int *Hidx = new int[5];
-
-            Sidx[0] = 0;
-            Sidx[1] = nx;
-            Sidx[2] = nx+na;
-            Sidx[3] = nx+na+np;
-            Sidx[4] = nx+na+np+nu;
-            Sidx[5] = nx+na+np+nu+nw;
-
-            Hidx[0] =     run1;
-            Hidx[1] =   N+run1;
-            Hidx[2] = 2*N+run1;
-            Hidx[3] = 3*N+run1;
-            Hidx[4] = 4*N+run1;
-
-            for( i = 0; i < 5; i++ ){
-                for( j = 0; j < 5; j++ ){
-
-                    tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
-                    tmp2.setZero();
-
-                    for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
-                        for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
-                            for( run2 = 0; run2 < nh; run2++ )
-                                tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
-
-                    if( tmp2.getDim() != 0 ) hessian->addDense(Hidx[i],Hidx[j],tmp2);
-                }
-            }
-            delete[] Sidx;
-            delete[] Hidx;
+
+            addHessianBlocks( run1, hessian );
         }
 
-        for( run2 = 0; run2 < nh; run2++ )
-            delete[] J[run2];
-        delete[] J;
-        delete[] bseed;
         return SUCCESSFUL_RETURN;
     }
     return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
@@ -424,82 +349,46 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
             xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
             return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
 
-        double *bseed   = new double [nh];
-        double **J      = new double*[nh];
-
-        for( run2 = 0; run2 < nh; run2++ )
-             J[run2] = new double[fcn.getNumberOfVariables() +1];
-
         if( bSeed->getNumRows( 0, 0 ) != 1 ) return ACADOWARNING( RET_WRONG_DEFINITION_OF_SEEDS );
 
-        Matrix bseed_;
-        bSeed->getSubBlock( 0, 0, bseed_);
+        const double bseed_ = bSeed->getSubBlock( 0, 0 ).operator()( 0,0 );
 
-        dBackward.init( 1, 5*N );
+        h_seed.init( nh );
+        h_jac .init( nh, fcn.getNumberOfVariables()+1 );
 
-        Matrix Dx ( 1, nx );
-        Matrix Dxa( 1, na );
-        Matrix Dp ( 1, np );
-        Matrix Du ( 1, nu );
-        Matrix Dw ( 1, nw );
+        if( fcn.ADisSupported() == BT_FALSE )
+            f_seed.init( fcn.getNumberOfVariables()+1 );
 
         for( run1 = 0; run1 < N; run1++ ){
 
-            Dx .setZero();
-            Dxa.setZero();
-            Dp .setZero();
-            Du .setZero();
-            Dw .setZero();
-
-            for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
+            for( run2 = 0; run2 < nh; run2++ ) h_seed(run2) = 0;
 
             if( fcn.ADisSupported() == BT_FALSE ){
 
-                double *fseed = new double[fcn.getNumberOfVariables()+1];
                 for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ )
-                     fseed[run3] = 0.0;
+                     f_seed(run3) = 0.0;
 
                 for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ ){
-                     fseed[run3] = 1.0;
-                     fcn.AD_forward( run1, fseed, bseed );
-                     fseed[run3] = 0.0;
+                     f_seed(run3) = 1.0;
+                     fcn.AD_forward( run1, f_seed.getDoublePointer(), h_seed.getDoublePointer() );
+                     f_seed(run3) = 0.0;
                      for( run2 = 0; run2 < nh; run2++ )
-                         J[run2][run3] = bseed[run2];
+                         h_jac(run2,run3) = h_seed(run2);
                 }
-                delete[] fseed;
+                for( run2 = 0; run2 < nh; run2++ ) h_seed(run2) = 0;
             }
+            else{
 
-            for( run2 = 0; run2 < nh; run2++ ){
-
-                 if( fcn.ADisSupported() == BT_TRUE ){
+                for( run2 = 0; run2 < nh; run2++ ){
                      for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
-                         J[run2][run3] = 0.0;
-                     bseed[run2] = 1.0;
-                     fcn.AD_backward( run1, bseed, J[run2] );
-                     bseed[run2] = 0.0;
-                 }
-
-                 for( run3 = 0; run3 < nx; run3++ ){
-                      Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx; run3 < nx+na; run3++ ){
-                      Dxa( 0, run3-nx ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na; run3 < nx+na+np; run3++ ){
-                      Dp( 0, run3-nx-na ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
-                      Du( 0, run3-nx-na-np ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
-                      Dw( 0, run3-nx-na-np-nu ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
+                         h_jac(run2,run3) = 0.0;
+                     h_seed(run2) = 1.0;
+                     fcn.AD_backward( run1, h_seed.getDoublePointer(), &h_jac(run2,0) );
+                     h_seed(run2) = 0.0;
+                }
             }
-            if( nx > 0 ) dBackward.setDense( 0,     run1, Dx  );
-            if( na > 0 ) dBackward.setDense( 0,   N+run1, Dxa );
-            if( np > 0 ) dBackward.setDense( 0, 2*N+run1, Dp  );
-            if( nu > 0 ) dBackward.setDense( 0, 3*N+run1, Du  );
-            if( nw > 0 ) dBackward.setDense( 0, 4*N+run1, Dw  );
+
+            storeBackwardSensitivities( run1, bseed_ );
 
             // COMPUTE GAUSS-NEWTON HESSIAN APPROXIMATION IF REQUESTED:
             // --------------------------------------------------------
@@ -507,68 +396,33 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
             if( GNhessian != 0 ){
 
                 const int nnn = nx+na+np+nu+nw;
-                Matrix tmp( nh, nnn );
+                S_h_jac.init( nh, nnn );
 
                 for( run3 = 0; run3 < nnn; run3++ ){
                     for( run2 = 0; run2 < nh; run2++ ){
                         if( S != 0 ){
-                            tmp( run2, run3 ) = 0.0;
+                            S_h_jac( run2, run3 ) = 0.0;
                             for( run4 = 0; run4 < nh; run4++ ){
-                                tmp( run2, run3 ) += S[run1].operator()(run2,run4)*J[run4][y_index[run3]];
+                                S_h_jac( run2, run3 ) += S[run1].operator()(run2,run4)*h_jac(run4,y_index[run3]);
                             }
                         }
                         else{
-                            tmp( run2, run3 ) = J[run2][y_index[run3]];
+                            S_h_jac( run2, run3 ) = h_jac(run2,y_index[run3]);
                         }
                     }
                 }
-                Matrix tmp2;
-                int i,j;
-                int *Sidx = new int[6];
-                int *Hidx = new int[5];
-
-                Sidx[0] = 0;
-                Sidx[1] = nx;
-                Sidx[2] = nx+na;
-                Sidx[3] = nx+na+np;
-                Sidx[4] = nx+na+np+nu;
-                Sidx[5] = nx+na+np+nu+nw;
-
-                Hidx[0] =     run1;
-                Hidx[1] =   N+run1;
-                Hidx[2] = 2*N+run1;
-                Hidx[3] = 3*N+run1;
-                Hidx[4] = 4*N+run1;
-
-                for( i = 0; i < 5; i++ ){
-                    for( j = 0; j < 5; j++ ){
-
-                        tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
-                        tmp2.setZero();
-
-                        for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
-                            for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
-                                for( run2 = 0; run2 < nh; run2++ )
-                                    tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
-
-                        if( tmp2.getDim() != 0 ) GNhessian->addDense(Hidx[i],Hidx[j],tmp2);
-                    }
-                }
-                delete[] Sidx;
-                delete[] Hidx;
+
+                addHessianBlocks( run1, GNhessian );
             }
         }
 
-        for( run2 = 0; run2 < nh; run2++ )
-            delete[] J[run2];
-        delete[] J;
-        delete[] bseed;
         return SUCCESSFUL_RETURN;
     }
 
     return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
 }
 
+
 returnValue LSQTerm::getWeigthingtMatrix(const unsigned _index, Matrix& _matrix) const
 {
 	if ( S_temp )
@@ -582,6 +436,99 @@ returnValue LSQTerm::getWeigthingtMatrix(const unsigned _index, Matrix& _matrix)
 }
 
 
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue LSQTerm::storeBackwardSensitivities( int pointIdx, double bseed_ ){
+
+    int run2, run3;
+    const int N  = grid.getNumPoints();
+    const int nh = fcn.getDim();
+
+    if( dBackward.getNumRows() != 1 || (int) dBackward.getNumCols() != 5*N )
+        dBackward.init( 1, 5*N );
+
+    // the derivatives of the objective are written into the blocks in place:
+    double *Dx  = nx > 0 ? dBackward.getDenseBlock( 0,     pointIdx, 1, nx ).getDoublePointer() : 0;
+    double *Dxa = na > 0 ? dBackward.getDenseBlock( 0,   N+pointIdx, 1, na ).getDoublePointer() : 0;
+    double *Dp  = np > 0 ? dBackward.getDenseBlock( 0, 2*N+pointIdx, 1, np ).getDoublePointer() : 0;
+    double *Du  = nu > 0 ? dBackward.getDenseBlock( 0, 3*N+pointIdx, 1, nu ).getDoublePointer() : 0;
+    double *Dw  = nw > 0 ? dBackward.getDenseBlock( 0, 4*N+pointIdx, 1, nw ).getDoublePointer() : 0;
+
+    for( run3 = 0; run3 < nx; run3++ ) Dx [run3] = 0.0;
+    for( run3 = 0; run3 < na; run3++ ) Dxa[run3] = 0.0;
+    for( run3 = 0; run3 < np; run3++ ) Dp [run3] = 0.0;
+    for( run3 = 0; run3 < nu; run3++ ) Du [run3] = 0.0;
+    for( run3 = 0; run3 < nw; run3++ ) Dw [run3] = 0.0;
+
+    for( run2 = 0; run2 < nh; run2++ ){
+
+         for( run3 = 0; run3 < nx; run3++ ){
+              Dx[run3] += bseed_*h_jac(run2,y_index[run3])*S_h_res[pointIdx][run2];
+         }
+         for( run3 = nx; run3 < nx+na; run3++ ){
+              Dxa[run3-nx] += bseed_*h_jac(run2,y_index[run3])*S_h_res[pointIdx][run2];
+         }
+         for( run3 = nx+na; run3 < nx+na+np; run3++ ){
+              Dp[run3-nx-na] += bseed_*h_jac(run2,y_index[run3])*S_h_res[pointIdx][run2];
+         }
+         for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
+              Du[run3-nx-na-np] += bseed_*h_jac(run2,y_index[run3])*S_h_res[pointIdx][run2];
+         }
+         for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
+              Dw[run3-nx-na-np-nu] += bseed_*h_jac(run2,y_index[run3])*S_h_res[pointIdx][run2];
+         }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LSQTerm::addHessianBlocks( int pointIdx, BlockMatrix *hessian ){
+
+    int i, j, run2, run3, run4;
+    const int N  = grid.getNumPoints();
+    const int nh = fcn.getDim();
+
+    int Sidx[6];
+    int Hidx[5];
+
+    Sidx[0] = 0;
+    Sidx[1] = nx;
+    Sidx[2] = nx+na;
+    Sidx[3] = nx+na+np;
+    Sidx[4] = nx+na+np+nu;
+    Sidx[5] = nx+na+np+nu+nw;
+
+    Hidx[0] =     pointIdx;
+    Hidx[1] =   N+pointIdx;
+    Hidx[2] = 2*N+pointIdx;
+    Hidx[3] = 3*N+pointIdx;
+    Hidx[4] = 4*N+pointIdx;
+
+    for( i = 0; i < 5; i++ ){
+        for( j = 0; j < 5; j++ ){
+
+            Matrix &tmp = h_hess[i][j];
+
+            tmp.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
+            tmp.setZero();
+
+            for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
+                for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
+                    for( run2 = 0; run2 < nh; run2++ )
+                        tmp(run3-Sidx[i],run4-Sidx[j]) += h_jac(run2,y_index[run3])*S_h_jac(run2,run4);
+
+            if( tmp.getDim() != 0 ) hessian->addDense(Hidx[i],Hidx[j],tmp);
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
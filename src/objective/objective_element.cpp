@@ -262,6 +262,7 @@ ObjectiveElement& ObjectiveElement::operator=( const ObjectiveElement& rhs ){
 returnValue ObjectiveElement::init( const OCPiterate &x ){
 
     int run1;
+    int nyOld = ny;
 
     z.init( fcn, x );
     JJ.init( fcn, x );
@@ -284,8 +285,10 @@ returnValue ObjectiveElement::init( const OCPiterate &x ){
 
     ny = nx+na+nu+np+nw;
 
-    if( y_index != 0 )  delete[] y_index;
+    if( y_index == 0 || ny != nyOld ){
+        if( y_index != 0 )  delete[] y_index;
         y_index       = new      int[ny];
+    }
 
     for( run1 = 0; run1 < nx; run1++ )
         y_index[run1] = fcn.index( VT_DIFFERENTIAL_STATE, run1 );
@@ -415,8 +418,8 @@ returnValue ObjectiveElement::setBackwardSeed( BlockMatrix *seed, int order ){
     if( order == 1 ){
 
         if( seed != 0 ){
-            if( bSeed != 0 ) delete bSeed;
-            bSeed = new BlockMatrix(*seed);
+            if( bSeed != 0 ) *bSeed = *seed;
+            else              bSeed = new BlockMatrix(*seed);
         }
         else{
             if( bSeed != 0 ) delete bSeed;
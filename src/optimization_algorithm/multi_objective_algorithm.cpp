@@ -32,6 +32,9 @@
 
 #include <acado/optimization_algorithm/multi_objective_algorithm.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 BEGIN_NAMESPACE_ACADO
@@ -278,8 +281,7 @@ returnValue MultiObjectiveAlgorithm::solveSingleObjective( const int &number_ ){
 
 returnValue MultiObjectiveAlgorithm::solve( ){
 
-    int           run1,run2;
-    returnValue returnvalue;
+    int           run1,run2,run3;
 
     ASSERT( ocp != 0 );
     ASSERT( m >= 2 );
@@ -297,8 +299,6 @@ returnValue MultiObjectiveAlgorithm::solve( ){
     for( run1 = 0; run1 < m; run1++ )
         ocp->getObjective( run1, &arg[run1] );
 
-    Constraint tmp_con;
-
     double *idx = new double[m];
 
     WeightGeneration generator;
@@ -311,93 +311,161 @@ returnValue MultiObjectiveAlgorithm::solve( ){
 
     generator.getWeights( m, N, lb, ub, Weights, formers );
 
-    result.init( Weights.getNumCols(), m );
+    int nPoints = (int) Weights.getNumCols();
+
+    result.init( nPoints, m );
     count = 0;
 
-    if( xResults  == 0 ) xResults  = new VariablesGrid[Weights.getNumCols()];
-    if( xaResults == 0 ) xaResults = new VariablesGrid[Weights.getNumCols()];
-    if( pResults  == 0 ) pResults  = new VariablesGrid[Weights.getNumCols()];
-    if( uResults  == 0 ) uResults  = new VariablesGrid[Weights.getNumCols()];
-    if( wResults  == 0 ) wResults  = new VariablesGrid[Weights.getNumCols()];
+    if( xResults  == 0 ) xResults  = new VariablesGrid[nPoints];
+    if( xaResults == 0 ) xaResults = new VariablesGrid[nPoints];
+    if( pResults  == 0 ) pResults  = new VariablesGrid[nPoints];
+    if( uResults  == 0 ) uResults  = new VariablesGrid[nPoints];
+    if( wResults  == 0 ) wResults  = new VariablesGrid[nPoints];
 
     totalNumberOfSQPiterations = 0;
     totalCPUtime               = -acadoGetTime();
 
+
+    // DETERMINE THE VERTICES OF THE SIMPLEX, WHOSE RESULTS ARE
+    // EITHER ADOPTED OR CAN SERVE AS INITIALIZATION:
+    // --------------------------------------------------------
+
+    // THIS PART OF THE CODE WILL NOT RUN YET FOR GENERAL WEIGHTS
+
+    int         *vertex    = new int[nPoints];
+    BooleanType *available = new BooleanType[nPoints];
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        vertex[run1] = -1;
+        for( run2 = 0; run2 < m; run2++ ){
+            if( fabs( Weights(run2,run1)-1.0 ) < 100.0*EPS )
+                vertex[run1] = run2;
+        }
+
+        if( vertex[run1] != -1 && xResults[run1].isEmpty() == BT_FALSE ) available[run1] = BT_TRUE ;
+        else                                                             available[run1] = BT_FALSE;
+    }
+    // ----------------------------------------------------------
+
+
+    // THE WEIGHTED PROBLEMS ARE SOLVED IN WAVES OF INDEPENDENT WORKERS,
+    // ONE PER THREAD, EACH OWNING A COPY OF THE OCP AND ITS NLP SOLVER:
+    // -----------------------------------------------------------------
+    int nWorkers = 1;
+#ifdef _OPENMP
+    nWorkers = omp_get_max_threads();
+#endif
+
+    MultiObjectiveAlgorithm **worker       = new MultiObjectiveAlgorithm*[nPoints];
+    returnValue              *returnvalues = new returnValue[nPoints];
+    int                      *tasks        = new int[nWorkers];
+    int                       nTasks, firstPoint;
+
+    for( run1 = 0; run1 < nPoints; run1++ )
+        worker[run1] = 0;
+
     run1 = 0;
-    while( run1 < (int) Weights.getNumCols() ){
+    while( run1 < nPoints ){
 
+        // SET UP THE WORKERS OF THE NEXT WAVE; THE REFORMULATION AND
+        // INITIALIZATION OF THE NLPs IS SYMBOLIC AND THUS DONE SERIALLY:
+        // --------------------------------------------------------------
+        firstPoint = run1;
+        nTasks     = 0;
 
-        // PRINT THE ITERATION NUMBER:
-        // ---------------------------
-        acadoPrintf("\n\n Multi-objective point: %d out of %d \n\n",run1+1, (int) Weights.getNumCols() );
+        while( run1 < nPoints && nTasks < nWorkers ){
 
+            acadoPrintf("\n\n Multi-objective point: %d out of %d \n\n",run1+1, nPoints );
 
-        ocp->getConstraint( tmp_con );
+            if( vertex[run1] == -1 || paretoGeneration == PFG_WEIGHTED_SUM ){
 
-        for( run2 = 0; run2 < (int) Weights.getNumRows(); run2++ )
-            idx[run2] = Weights( run2, run1 );
+                for( run2 = 0; run2 < (int) Weights.getNumRows(); run2++ )
+                    idx[run2] = Weights( run2, run1 );
 
+                worker[run1] = new MultiObjectiveAlgorithm( *this );
+                worker[run1]->formulateOCP( idx, worker[run1]->ocp, arg );
 
-        // THIS PART OF THE CODE WILL NOT RUN YET FOR GENERAL WEIGHTS
+                // START FROM THE NEAREST POINT THAT HAS ALREADY BEEN SOLVED:
+                run3 = -1;
+                if( hotstart == BT_TRUE )
+                    run3 = getNearestPoint( Weights, run1, available );
 
-        int vertex = -1;
-        for( run2 = 0; run2 < m; run2++ ){
-            if( fabs( idx[run2]-1.0 ) < 100.0*EPS )
-                vertex = run2;
+                if( run3 >= 0 ){
+                    if( worker[run1]->userInit.x  != 0 ) *worker[run1]->userInit.x  = xResults [run3];
+                    if( worker[run1]->userInit.xa != 0 ) *worker[run1]->userInit.xa = xaResults[run3];
+                    if( worker[run1]->userInit.p  != 0 ) *worker[run1]->userInit.p  = pResults [run3];
+                    if( worker[run1]->userInit.u  != 0 ) *worker[run1]->userInit.u  = uResults [run3];
+                    if( worker[run1]->userInit.w  != 0 ) *worker[run1]->userInit.w  = wResults [run3];
+                }
+
+                worker[run1]->setStatus( BS_NOT_INITIALIZED );
+                returnvalues[run1] = worker[run1]->init( );
+
+                set( PRINT_COPYRIGHT, BT_FALSE );
+
+                tasks[nTasks] = run1;
+                nTasks++;
+            }
+            else
+                acadoPrintf(" Result from single objective optimization is adopted. \n\n" );
+
+            run1++;
         }
-        // ----------------------------------------------------------
 
 
-        if( vertex == -1 || paretoGeneration == PFG_WEIGHTED_SUM ){
+        // SOLVE THE NLPs OF THIS WAVE IN PARALLEL:
+        // ----------------------------------------
+#ifdef _OPENMP
+        #pragma omp parallel for schedule( dynamic )
+#endif
+        for( run2 = 0; run2 < nTasks; run2++ ){
 
-            formulateOCP( idx, ocp, arg );
-            setStatus( BS_NOT_INITIALIZED );
-            returnvalue = OptimizationAlgorithm::solve();
+            if( returnvalues[tasks[run2]] == SUCCESSFUL_RETURN )
+                returnvalues[tasks[run2]] = worker[tasks[run2]]->OptimizationAlgorithm::solve( );
+        }
 
-            if( nlpSolver != 0 )
-                totalNumberOfSQPiterations += nlpSolver->getNumberOfSteps();
 
-            ocp->setConstraint( tmp_con );
-            set( PRINT_COPYRIGHT, BT_FALSE );
+        // COLLECT THE RESULTS IN THE ORDER OF THE WEIGHTS:
+        // ------------------------------------------------
+        for( run2 = firstPoint; run2 < run1; run2++ ){
 
-            if( returnvalue != SUCCESSFUL_RETURN ){
-                ACADOERROR(returnvalue);
+            if( worker[run2] == 0 ){
+                for( run3 = 0; run3 < m; run3++ )
+                    result(count,run3) = vertices(vertex[run2],run3);
+                count++;
+                continue;
+            }
+
+            if( worker[run2]->nlpSolver != 0 )
+                totalNumberOfSQPiterations += worker[run2]->nlpSolver->getNumberOfSteps();
+
+            if( returnvalues[run2] != SUCCESSFUL_RETURN ){
+                ACADOERROR(returnvalues[run2]);
             }
             else{
 
-               getDifferentialStates( xResults[run1]  );
-               getAlgebraicStates   ( xaResults[run1] );
-               getParameters        ( pResults[run1]  );
-               getControls          ( uResults[run1]  );
-               getDisturbances      ( wResults[run1]  );
-
-               if( hotstart == BT_TRUE ){
-                    getDifferentialStates( *userInit.x );
-                    getAlgebraicStates   ( *userInit.xa );
-                    getParameters        ( *userInit.p  );
-                    getControls          ( *userInit.u );
-                    getDisturbances      ( *userInit.w  );
-                    evaluateObjectives( *userInit.x, *userInit.xa, *userInit.p, *userInit.u, *userInit.w, arg );
+                worker[run2]->getDifferentialStates( xResults[run2]  );
+                worker[run2]->getAlgebraicStates   ( xaResults[run2] );
+                worker[run2]->getParameters        ( pResults[run2]  );
+                worker[run2]->getControls          ( uResults[run2]  );
+                worker[run2]->getDisturbances      ( wResults[run2]  );
+
+                if( hotstart == BT_TRUE ){
+                    *userInit.x  = xResults [run2];
+                    *userInit.xa = xaResults[run2];
+                    *userInit.p  = pResults [run2];
+                    *userInit.u  = uResults [run2];
+                    *userInit.w  = wResults [run2];
                 }
-                else{
-                   VariablesGrid xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp;
-                   getDifferentialStates( xd_tmp );
-                   getAlgebraicStates   ( xa_tmp );
-                   getParameters        ( p_tmp  );
-                   getControls          ( u_tmp  );
-                   getDisturbances      ( w_tmp  );
-                   evaluateObjectives( xd_tmp, xa_tmp, p_tmp, u_tmp, w_tmp, arg );
-               }
-            }
-        }
-        else{
-            acadoPrintf(" Result from single objective optimization is adopted. \n\n" );
-            for( run2 = 0; run2 < m; run2++ ){
-                result(count,run2) = vertices(vertex,run2);
+
+                evaluateObjectives( xResults[run2], xaResults[run2], pResults[run2], uResults[run2], wResults[run2], arg );
+                available[run2] = BT_TRUE;
             }
-            count++;
+
+            delete worker[run2];
+            worker[run2] = 0;
         }
-        run1++;
     }
     totalCPUtime += acadoGetTime();
 
@@ -406,6 +474,11 @@ returnValue MultiObjectiveAlgorithm::solve( ){
     delete[] arg;
 
     delete[] idx;
+    delete[] vertex;
+    delete[] available;
+    delete[] worker;
+    delete[] returnvalues;
+    delete[] tasks;
 
     return SUCCESSFUL_RETURN;
 }
@@ -613,7 +686,7 @@ returnValue MultiObjectiveAlgorithm::formulateOCP( double *idx, OCP *ocp_, Expre
         ocp_->setObjective( tmp );
 
         for( run1 = 0; run1 < m-1; run1++ )
-             ocp->subjectTo( AT_END, *arg[run1] - lambda*X(run1) == V(run1) );
+             ocp_->subjectTo( AT_END, *arg[run1] - lambda*X(run1) == V(run1) );
 
         return SUCCESSFUL_RETURN;
     }
@@ -666,6 +739,40 @@ returnValue MultiObjectiveAlgorithm::evaluateObjectives( VariablesGrid    &xd_ ,
 
 
 
+int MultiObjectiveAlgorithm::getNearestPoint( const Matrix &Weights, int point, const BooleanType *available ) const{
+
+    int    run1, run2;
+    int    nearest = -1;
+    double distance, minDistance = 0.0, predecessorDistance = -1.0;
+
+    for( run1 = 0; run1 < (int) Weights.getNumCols(); run1++ ){
+
+        if( run1 == point || available[run1] == BT_FALSE )
+            continue;
+
+        distance = 0.0;
+        for( run2 = 0; run2 < (int) Weights.getNumRows(); run2++ )
+            distance += ( Weights(run2,run1) - Weights(run2,point) )*( Weights(run2,run1) - Weights(run2,point) );
+
+        if( run1 == point-1 )
+            predecessorDistance = distance;
+
+        if( nearest == -1 || distance < minDistance ){
+            nearest     = run1;
+            minDistance = distance;
+        }
+    }
+
+    // ties are resolved in favour of the predecessor, such that the
+    // sequential hotstart keeps starting from the previous point:
+    if( predecessorDistance >= 0.0 && acadoIsSmaller( predecessorDistance, minDistance ) == BT_TRUE )
+        nearest = point-1;
+
+    return nearest;
+}
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -504,6 +504,7 @@ returnValue RealTimeAlgorithm::setupOptions( )
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling    );
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
 	addOption( USE_REALTIME_SHIFTS         , defaultUseRealtimeShifts       );
+	addOption( USE_SHIFTED_WARM_START      , defaultUseShiftedWarmStart     );
 	addOption( USE_IMMEDIATE_FEEDBACK      , defaultUseImmediateFeedback    );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( SPARSE_QP_SOLUTION          , defaultSparseQPsolution        );
@@ -515,6 +516,7 @@ returnValue RealTimeAlgorithm::setupOptions( )
 	addOption( INTEGRATOR_TYPE             , defaultIntegratorType          );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( PARALLEL_INTEGRATION        , defaultParallelIntegration     );
 	
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -114,8 +114,10 @@ Process::Process( const Process& rhs ) : SimulationBlock( rhs )
 		dynamicSystems = 0;
 	}
 
+	// the integration method logs into its owning process and is thus
+	// not copied, but set up again at the first simulation step
 	if ( rhs.integrationMethod != 0 )
-		integrationMethod = new ShootingMethod( *(rhs.integrationMethod) );
+		integrationMethod = new ShootingMethod( this );
 	else
 		integrationMethod = 0;
 
@@ -136,6 +138,9 @@ Process::Process( const Process& rhs ) : SimulationBlock( rhs )
 
 	y = rhs.y;
 
+	outputFcn      = rhs.outputFcn;
+	integratorType = rhs.integratorType;
+
 	lastTime = rhs.lastTime;
 }
 
@@ -171,7 +176,7 @@ Process& Process::operator=( const Process& rhs )
 		}
 
 		if ( rhs.integrationMethod != 0 )
-			integrationMethod = new ShootingMethod( *(rhs.integrationMethod) );
+			integrationMethod = new ShootingMethod( this );
 		else
 			integrationMethod = 0;
 	
@@ -192,6 +197,9 @@ Process& Process::operator=( const Process& rhs )
 
 		y = rhs.y;
 
+		outputFcn      = rhs.outputFcn;
+		integratorType = rhs.integratorType;
+
 		lastTime = rhs.lastTime;
     }
 
@@ -219,6 +227,7 @@ returnValue Process::setDynamicSystem(	const DynamicSystem& _dynamicSystem,
 
 
 	integratorType = _integratorType;   // weird hack -- make clean later.
+	outputFcn      = _dynamicSystem.getOutputFcn( );
 
 // NOTE: THE "integratorType" can
 //          change during the use of the process, it might be better to load the integrator type from the options
@@ -285,6 +294,29 @@ returnValue Process::setSensor(	const Sensor& _sensor
 
 
 
+returnValue Process::setNoiseSeed(	uint _noiseSeed
+									)
+{
+	uint actuatorSeed = 0;
+	uint sensorSeed   = 0;
+
+	if ( _noiseSeed != 0 )
+	{
+		actuatorSeed = Noise::deriveSeed( _noiseSeed,0 );
+		sensorSeed   = Noise::deriveSeed( _noiseSeed,1 );
+	}
+
+	if ( actuator != 0 )
+		actuator->setNoiseSeed( actuatorSeed );
+
+	if ( sensor != 0 )
+		sensor->setNoiseSeed( sensorSeed );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue Process::setProcessDisturbance(	const Curve& _processDisturbance
 											)
 {
@@ -293,6 +325,8 @@ returnValue Process::setProcessDisturbance(	const Curve& _processDisturbance
 	else
 		processDisturbance = new Curve( _processDisturbance );
 
+	ACADO_TRY( clearIntegrators( ) );
+
 	setStatus( BS_NOT_INITIALIZED );
 
 	return SUCCESSFUL_RETURN;
@@ -360,6 +394,8 @@ returnValue Process::init(	double _startTime,
 	/* 1) Assign values */
 	lastTime = _startTime;
 
+	ACADO_TRY( clearIntegrators( ) );
+
 	if ( _xStart.getDim( ) > 0 )
 		x = _xStart;
 	else
@@ -400,7 +436,7 @@ returnValue Process::init(	double _startTime,
 
 
 	DynamicSystem*  dynSys  = dynamicSystems[0];
-	OutputFcn     outputFcn = dynSys->getOutputFcn( );
+	outputFcn = dynSys->getOutputFcn( );
 	
 	/* 2) Consistency checks. */
 	if ( getNumStages( ) == 0 )
@@ -720,6 +756,7 @@ returnValue Process::setupOptions( )
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( PARALLEL_INTEGRATION        , defaultParallelIntegration     );
 	
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -822,14 +859,29 @@ returnValue Process::clear( )
 
 
 
+returnValue Process::clearIntegrators( )
+{
+	if ( integrationMethod == 0 )
+		return SUCCESSFUL_RETURN;
+
+	returnValue returnvalue;
+
+#ifdef _OPENMP
+	#pragma omp critical( acadoSymbolicSetup )
+#endif
+	returnvalue = integrationMethod->clear( );
+
+	return returnvalue;
+}
+
+
 returnValue Process::simulate(	const VariablesGrid& _u,
 								const VariablesGrid& _p,
 								const VariablesGrid& _w
 								)
 {
-	DynamicSystem*       dynSys    = dynamicSystems[0];
-	DifferentialEquation diffEqn   = dynSys->getDifferentialEquation( );
-	OutputFcn            outputFcn = dynSys->getOutputFcn( );
+	DynamicSystem*              dynSys  = dynamicSystems[0];
+	const DifferentialEquation& diffEqn = dynSys->getDifferentialEquation( );
 
 	Grid currentGrid;
 	_u.getGrid( currentGrid );
@@ -862,11 +914,41 @@ returnValue Process::simulate(	const VariablesGrid& _u,
 
 
 	// simulate process...
+	// (the integrators of the previous call are kept as long as the number
+	//  of intervals and the options do not change, otherwise they are set up again)
+	Grid unionGrid = iter.getUnionGrid( );
+
+	if ( ( integrationMethod->getNumberOfIntervals( ) == (int)unionGrid.getNumIntervals( ) ) &&
+		 ( haveOptionsChanged( ) == BT_FALSE ) )
+	{
+		ACADO_TRY( integrationMethod->setUnionGrid( unionGrid ) );
 
-// 	delete integrationMethod;
-// 	integrationMethod = new ShootingMethod( this );
-	ACADO_TRY( integrationMethod->clear() );
-	ACADO_TRY( integrationMethod->addStage( *dynSys, iter.getUnionGrid(), integratorType ) );
+		int freezeIntegrator;
+		get( FREEZE_INTEGRATOR, freezeIntegrator );
+
+		if ( (BooleanType)freezeIntegrator == BT_TRUE )
+			ACADO_TRY( integrationMethod->unfreeze( ) );
+	}
+	else
+	{
+		// setting up the integrators is symbolic and thus not thread-safe,
+		// which matters if several processes are simulated concurrently
+		returnValue returnvalue;
+
+#ifdef _OPENMP
+		#pragma omp critical( acadoSymbolicSetup )
+#endif
+		{
+			returnvalue = integrationMethod->clear( );
+
+			if ( returnvalue == SUCCESSFUL_RETURN )
+				returnvalue = integrationMethod->addStage( *dynSys, unionGrid, integratorType );
+		}
+
+		ACADO_TRY( returnvalue );
+
+		declareOptionsUnchanged( );
+	}
 
 // 	iter.u->print( "u" );
 	
@@ -0,0 +1,476 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file src/simulation_environment/simulation_ensemble.cpp
+*    \author Hans Joachim Ferreau, Boris Houska
+*/
+
+
+
+#include <acado/simulation_environment/simulation_ensemble.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+SimulationEnsemble::SimulationEnsemble( )
+{
+	seed = 1;
+
+	nScenarios = 0;
+	seeds      = 0;
+
+	returnValues              = 0;
+	sampledProcessOutputs     = 0;
+	processDifferentialStates = 0;
+	feedbackControls          = 0;
+}
+
+
+SimulationEnsemble::SimulationEnsemble(	const SimulationEnvironment& _environment
+										) : environment( _environment )
+{
+	seed = 1;
+
+	nScenarios = 0;
+	seeds      = 0;
+
+	returnValues              = 0;
+	sampledProcessOutputs     = 0;
+	processDifferentialStates = 0;
+	feedbackControls          = 0;
+}
+
+
+SimulationEnsemble::SimulationEnsemble( const SimulationEnsemble& rhs ) : environment( rhs.environment )
+{
+	copy( rhs );
+}
+
+
+SimulationEnsemble::~SimulationEnsemble( )
+{
+	clearScenarios( );
+}
+
+
+SimulationEnsemble& SimulationEnsemble::operator=( const SimulationEnsemble& rhs )
+{
+	if ( this != &rhs )
+	{
+		clearScenarios( );
+
+		environment = rhs.environment;
+
+		copy( rhs );
+	}
+
+	return *this;
+}
+
+
+
+returnValue SimulationEnsemble::setSimulationEnvironment(	const SimulationEnvironment& _environment
+															)
+{
+	clearResults( );
+
+	environment = _environment;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SimulationEnsemble::setSeed(	uint _seed
+											)
+{
+	seed = _seed;
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SimulationEnsemble::addScenario(	const Vector& _x0,
+												const Vector& _p,
+												uint _seed
+												)
+{
+	if ( ( nScenarios > 0 ) && ( _x0.getDim( ) != xStart.getNumCols( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if ( ( nScenarios > 0 ) && ( _p.getDim( ) != pStart.getNumCols( ) ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	clearResults( );
+
+	xStart.appendRows( Matrix( _x0,BT_TRUE ) );
+
+	if ( _p.getDim( ) > 0 )
+		pStart.appendRows( Matrix( _p,BT_TRUE ) );
+
+	++nScenarios;
+
+	seeds = (uint*) realloc( seeds,nScenarios*sizeof(uint) );
+	seeds[ nScenarios-1 ] = _seed;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SimulationEnsemble::clearScenarios( )
+{
+	clearResults( );
+
+	xStart.init( 0,0 );
+	pStart.init( 0,0 );
+
+	if ( seeds != 0 )
+	{
+		free( seeds );
+		seeds = 0;
+	}
+
+	nScenarios = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue SimulationEnsemble::run( )
+{
+	if ( environment.process == 0 )
+		return ACADOERROR( RET_NO_PROCESS_SPECIFIED );
+
+	if ( environment.controller == 0 )
+		return ACADOERROR( RET_NO_CONTROLLER_SPECIFIED );
+
+	clearResults( );
+
+	if ( nScenarios == 0 )
+		return SUCCESSFUL_RETURN;
+
+	returnValues              = new returnValue  [nScenarios];
+	sampledProcessOutputs     = new VariablesGrid[nScenarios];
+	processDifferentialStates = new VariablesGrid[nScenarios];
+	feedbackControls          = new VariablesGrid[nScenarios];
+
+
+	// THE SCENARIOS ARE SIMULATED IN WAVES OF INDEPENDENT WORKERS,
+	// ONE PER THREAD, EACH OWNING A COPY OF PROCESS AND CONTROLLER:
+	// -------------------------------------------------------------
+	int nWorkers = 1;
+#ifdef _OPENMP
+	nWorkers = omp_get_max_threads( );
+#endif
+
+	SimulationEnvironment** worker = new SimulationEnvironment*[nWorkers];
+	int run1, run2, nTasks, firstScenario;
+
+	BooleanType hasFailed = BT_FALSE;
+
+	run1 = 0;
+	while( run1 < (int)nScenarios ){
+
+		// SET UP THE SCENARIOS OF THE NEXT WAVE; COPYING AND
+		// INITIALIZING THE CONTROLLERS IS SYMBOLIC AND THUS SERIAL:
+		// ---------------------------------------------------------
+		firstScenario = run1;
+		nTasks        = 0;
+
+		while( run1 < (int)nScenarios && nTasks < nWorkers ){
+
+			returnValues[run1] = setupScenario( run1,worker[nTasks] );
+
+			nTasks++;
+			run1++;
+		}
+
+
+		// SIMULATE THE SCENARIOS OF THIS WAVE IN PARALLEL:
+		// ------------------------------------------------
+#ifdef _OPENMP
+		#pragma omp parallel for schedule( dynamic )
+#endif
+		for( run2 = 0; run2 < nTasks; run2++ ){
+
+			if( returnValues[firstScenario+run2] == SUCCESSFUL_RETURN )
+				returnValues[firstScenario+run2] = worker[run2]->run( );
+		}
+
+
+		// COLLECT THE RESULTS IN THE ORDER OF THE SCENARIOS:
+		// --------------------------------------------------
+		for( run2 = 0; run2 < nTasks; run2++ ){
+
+			if( returnValues[firstScenario+run2] != SUCCESSFUL_RETURN )
+				hasFailed = BT_TRUE;
+
+			finishScenario( firstScenario+run2,worker[run2] );
+		}
+	}
+
+	delete[] worker;
+
+	if ( hasFailed == BT_TRUE )
+		return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+uint SimulationEnsemble::getScenarioSeed(	uint idx
+											) const
+{
+	if ( idx >= nScenarios )
+		return 0;
+
+	if ( ( seeds[idx] != 0 ) || ( seed == 0 ) )
+		return seeds[idx];
+
+	return Noise::deriveSeed( seed,idx );
+}
+
+
+
+returnValue SimulationEnsemble::getSampledProcessOutput(	VariablesGrid& _sampledProcessOutput
+															) const
+{
+	if ( combineResults( sampledProcessOutputs,_sampledProcessOutput ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	_sampledProcessOutput.setType( VT_OUTPUT );
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SimulationEnsemble::getProcessDifferentialStates(	VariablesGrid& _diffStates
+																) const
+{
+	if ( combineResults( processDifferentialStates,_diffStates ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	_diffStates.setType( VT_DIFFERENTIAL_STATE );
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SimulationEnsemble::getFeedbackControl(	VariablesGrid& _sampledFeedbackControl
+													) const
+{
+	if ( combineResults( feedbackControls,_sampledFeedbackControl ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	_sampledFeedbackControl.setType( VT_CONTROL );
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue SimulationEnsemble::setupScenario(	uint idx,
+												SimulationEnvironment*& scenarioEnvironment
+												)
+{
+	// deep copies of process and controller (the copy constructor of
+	// the controller only copies pointers to its components)
+	Process* process = new Process( *(environment.process) );
+	process->setNoiseSeed( getScenarioSeed( idx ) );
+
+	Controller* controller = new Controller( *(environment.controller) );
+
+	if ( controller->controlLaw != 0 )
+		controller->controlLaw = controller->controlLaw->clone( );
+
+	if ( controller->estimator != 0 )
+		controller->estimator = controller->estimator->clone( );
+
+	if ( controller->referenceTrajectory != 0 )
+		controller->referenceTrajectory = controller->referenceTrajectory->clone( );
+
+	scenarioEnvironment = new SimulationEnvironment( environment );
+	scenarioEnvironment->process    = process;
+	scenarioEnvironment->controller = controller;
+
+
+	// initialize scenario
+	Vector x0 = xStart.getRow( idx );
+	Vector p0;
+
+	if ( pStart.getNumRows( ) > 0 )
+		p0 = pStart.getRow( idx );
+
+	if ( scenarioEnvironment->init( x0,p0 ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_ENVIRONMENT_INIT_FAILED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SimulationEnsemble::finishScenario(	uint idx,
+												SimulationEnvironment*& scenarioEnvironment
+												)
+{
+	if ( returnValues[idx] == SUCCESSFUL_RETURN )
+	{
+		scenarioEnvironment->getSampledProcessOutput( sampledProcessOutputs[idx] );
+		scenarioEnvironment->getProcessDifferentialStates( processDifferentialStates[idx] );
+		scenarioEnvironment->getFeedbackControl( feedbackControls[idx] );
+	}
+
+	Controller* controller = scenarioEnvironment->controller;
+
+	if ( controller->controlLaw != 0 )
+		delete controller->controlLaw;
+
+	if ( controller->estimator != 0 )
+		delete controller->estimator;
+
+	if ( controller->referenceTrajectory != 0 )
+		delete controller->referenceTrajectory;
+
+	delete controller;
+	delete scenarioEnvironment->process;
+
+	delete scenarioEnvironment;
+	scenarioEnvironment = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+void SimulationEnsemble::clearResults( )
+{
+	if ( returnValues != 0 )
+	{
+		delete[] returnValues;
+		returnValues = 0;
+	}
+
+	if ( sampledProcessOutputs != 0 )
+	{
+		delete[] sampledProcessOutputs;
+		sampledProcessOutputs = 0;
+	}
+
+	if ( processDifferentialStates != 0 )
+	{
+		delete[] processDifferentialStates;
+		processDifferentialStates = 0;
+	}
+
+	if ( feedbackControls != 0 )
+	{
+		delete[] feedbackControls;
+		feedbackControls = 0;
+	}
+}
+
+
+void SimulationEnsemble::copy(	const SimulationEnsemble& rhs
+								)
+{
+	uint i;
+
+	seed = rhs.seed;
+
+	nScenarios = rhs.nScenarios;
+	xStart     = rhs.xStart;
+	pStart     = rhs.pStart;
+
+	if ( rhs.seeds != 0 )
+	{
+		seeds = (uint*) calloc( nScenarios,sizeof(uint) );
+		for( i=0; i<nScenarios; ++i )
+			seeds[i] = rhs.seeds[i];
+	}
+	else
+		seeds = 0;
+
+	returnValues              = 0;
+	sampledProcessOutputs     = 0;
+	processDifferentialStates = 0;
+	feedbackControls          = 0;
+
+	if ( rhs.returnValues != 0 )
+	{
+		returnValues              = new returnValue  [nScenarios];
+		sampledProcessOutputs     = new VariablesGrid[nScenarios];
+		processDifferentialStates = new VariablesGrid[nScenarios];
+		feedbackControls          = new VariablesGrid[nScenarios];
+
+		for( i=0; i<nScenarios; ++i )
+		{
+			returnValues[i]              = rhs.returnValues[i];
+			sampledProcessOutputs[i]     = rhs.sampledProcessOutputs[i];
+			processDifferentialStates[i] = rhs.processDifferentialStates[i];
+			feedbackControls[i]          = rhs.feedbackControls[i];
+		}
+	}
+}
+
+
+returnValue SimulationEnsemble::combineResults(	const VariablesGrid* const results,
+												VariablesGrid& combined
+												) const
+{
+	uint i;
+
+	if ( ( results == 0 ) || ( nScenarios == 0 ) )
+		return RET_MEMBER_NOT_INITIALISED;
+
+	combined.init( );
+
+	for( i=0; i<nScenarios; ++i )
+	{
+		if ( returnValues[i] != SUCCESSFUL_RETURN )
+			return RET_MEMBER_NOT_INITIALISED;
+
+		if ( combined.appendValues( results[i] ) != SUCCESSFUL_RETURN )
+			return RET_MEMBER_NOT_INITIALISED;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -318,7 +318,6 @@ returnValue SimulationEnvironment::step( )
 	if ( getNP( ) > 0 )
 		feedbackParameter.evaluate( simulationClock.getTime( ),pPrevious );
 
-	VariablesGrid y;
 	Vector yPrevious;
 
 	if ( getNY( ) > 0 )
@@ -368,6 +367,9 @@ returnValue SimulationEnvironment::step( )
 
 	if ( acadoIsEqual( simulationClock.getTime( ),endTime ) == BT_TRUE )
 	{
+		if ( controller->finishPreparationStep( ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+
 		simulationClock.init( nextSamplingInstant );
 		return SUCCESSFUL_RETURN;
 	}
@@ -375,70 +377,35 @@ returnValue SimulationEnvironment::step( )
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		acadoPrintf( "--> Simulating process ...\n" );
 
-	if ( fabs( compDelay ) < 100.0*EPS )
-	{
-		// step process without computational delay
-// 		if ( process->step( simulationClock.getTime( ),nextSamplingInstant,uPrevious,pPrevious ) != SUCCESSFUL_RETURN )
-// 			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
-		if ( process->step( simulationClock.getTime( ),nextSamplingInstant,u,p ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
-
-		// Obtain current process output
-		if ( process->getY( y ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+	// simulate process; a pending preparation step of the controller
+	// is performed meanwhile as it does not affect the current controls
+	BooleanType isPreparationPending = controller->isPreparationPending( );
 
-// 		y.print("process output y");
+	returnValue returnvalue[2];
+	returnvalue[0] = SUCCESSFUL_RETURN;
 
-		// update history
-// 		if ( getNU( ) > 0 )
-// 			feedbackControl.  add( simulationClock.getTime( ),nextSamplingInstant,uPrevious );
-// 		if ( getNP( ) > 0 )
-// 			feedbackParameter.add( simulationClock.getTime( ),nextSamplingInstant,pPrevious );
-		if ( getNU( ) > 0 )
-			feedbackControl.  add( simulationClock.getTime( ),nextSamplingInstant,u );
-		if ( getNP( ) > 0 )
-			feedbackParameter.add( simulationClock.getTime( ),nextSamplingInstant,p );
-		if ( getNY( ) > 0 )
-			processOutput.    add( y,IM_LINEAR );
-	}
-	else
+#ifdef _OPENMP
+	#pragma omp parallel sections if( isPreparationPending == BT_TRUE )
+#endif
 	{
-		// step process WITH computational delay
-		if ( simulationClock.getTime( )+compDelay > nextSamplingInstant )
-			return ACADOERROR( RET_COMPUTATIONAL_DELAY_TOO_BIG );
-
-		Grid delayGrid( 3 );
-		delayGrid.setTime( simulationClock.getTime( ) );
-		delayGrid.setTime( simulationClock.getTime( )+compDelay );
-		delayGrid.setTime( nextSamplingInstant );
-
-		VariablesGrid uDelayed( u.getDim( ),delayGrid,VT_CONTROL );
-		uDelayed.setVector( 0,uPrevious );
-		uDelayed.setVector( 1,u );
-		uDelayed.setVector( 2,u );
-
-		VariablesGrid pDelayed( p.getDim( ),delayGrid,VT_PARAMETER );
-		pDelayed.setVector( 0,pPrevious );
-		pDelayed.setVector( 1,p );
-		pDelayed.setVector( 2,p );
-
-		if ( process->step( uDelayed,pDelayed ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+#ifdef _OPENMP
+		#pragma omp section
+#endif
+		if ( isPreparationPending == BT_TRUE )
+			returnvalue[0] = controller->finishPreparationStep( );
 
-		// Obtain current process output
-		if ( process->getY( y ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+#ifdef _OPENMP
+		#pragma omp section
+#endif
+		returnvalue[1] = stepProcess( nextSamplingInstant,compDelay,u,p,uPrevious,pPrevious );
+	}
 
-		// update history
-		if ( getNU( ) > 0 )
-			feedbackControl.  add( uDelayed,IM_CONSTANT );
+	if ( returnvalue[0] != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
 
-		if ( getNP( ) > 0 )
-			feedbackParameter.add( pDelayed,IM_CONSTANT );
+	if ( returnvalue[1] != SUCCESSFUL_RETURN )
+		return returnvalue[1];
 
-		if ( getNY( ) > 0 )
-			processOutput.    add( y,IM_LINEAR );
-	}
 	if ( (PrintLevel)printLevel >= HIGH ) 
 		acadoPrintf( "<-- Simulating process done.\n" );
 
@@ -503,6 +470,84 @@ returnValue SimulationEnvironment::setupLogging( )
 }
 
 
+returnValue SimulationEnvironment::stepProcess(	double nextSamplingInstant,
+													double compDelay,
+													const Vector& u,
+													const Vector& p,
+													const Vector& uPrevious,
+													const Vector& pPrevious
+													)
+{
+	VariablesGrid y;
+
+	if ( fabs( compDelay ) < 100.0*EPS )
+	{
+		// step process without computational delay
+// 		if ( process->step( simulationClock.getTime( ),nextSamplingInstant,uPrevious,pPrevious ) != SUCCESSFUL_RETURN )
+// 			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+		if ( process->step( simulationClock.getTime( ),nextSamplingInstant,u,p ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+
+		// Obtain current process output
+		if ( process->getY( y ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+
+// 		y.print("process output y");
+
+		// update history
+// 		if ( getNU( ) > 0 )
+// 			feedbackControl.  add( simulationClock.getTime( ),nextSamplingInstant,uPrevious );
+// 		if ( getNP( ) > 0 )
+// 			feedbackParameter.add( simulationClock.getTime( ),nextSamplingInstant,pPrevious );
+		if ( getNU( ) > 0 )
+			feedbackControl.  add( simulationClock.getTime( ),nextSamplingInstant,u );
+		if ( getNP( ) > 0 )
+			feedbackParameter.add( simulationClock.getTime( ),nextSamplingInstant,p );
+		if ( getNY( ) > 0 )
+			processOutput.    add( y,IM_LINEAR );
+	}
+	else
+	{
+		// step process WITH computational delay
+		if ( simulationClock.getTime( )+compDelay > nextSamplingInstant )
+			return ACADOERROR( RET_COMPUTATIONAL_DELAY_TOO_BIG );
+
+		Grid delayGrid( 3 );
+		delayGrid.setTime( simulationClock.getTime( ) );
+		delayGrid.setTime( simulationClock.getTime( )+compDelay );
+		delayGrid.setTime( nextSamplingInstant );
+
+		VariablesGrid uDelayed( u.getDim( ),delayGrid,VT_CONTROL );
+		uDelayed.setVector( 0,uPrevious );
+		uDelayed.setVector( 1,u );
+		uDelayed.setVector( 2,u );
+
+		VariablesGrid pDelayed( p.getDim( ),delayGrid,VT_PARAMETER );
+		pDelayed.setVector( 0,pPrevious );
+		pDelayed.setVector( 1,p );
+		pDelayed.setVector( 2,p );
+
+		if ( process->step( uDelayed,pDelayed ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+
+		// Obtain current process output
+		if ( process->getY( y ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_ENVIRONMENT_STEP_FAILED );
+
+		// update history
+		if ( getNU( ) > 0 )
+			feedbackControl.  add( uDelayed,IM_CONSTANT );
+
+		if ( getNP( ) > 0 )
+			feedbackParameter.add( pDelayed,IM_CONSTANT );
+
+		if ( getNY( ) > 0 )
+			processOutput.    add( y,IM_LINEAR );
+	}
+	return SUCCESSFUL_RETURN;
+}
+
+
 double SimulationEnvironment::determineComputationalDelay(	double controllerRuntime
 															) const
 {
@@ -60,6 +60,41 @@ returnValue SparseSolver::solveTranspose( double *b ){
 }
 
 
+returnValue SparseSolver::setDenseMatrix( const int &n, const double *A_, double zeroTol ){
+
+    int run1,run2;
+
+    double *A    = new double[n*n];
+    int    *idx1 = new int   [n*n];
+    int    *idx2 = new int   [n*n];
+
+    int nDense = 0;
+
+    for( run1 = 0; run1 < n; run1++ ){
+        for( run2 = 0; run2 < n; run2++ ){
+            if( fabs( A_[run1*n+run2] ) > zeroTol ){
+                A  [nDense]  = A_[run1*n+run2];
+                idx1[nDense] = run1;
+                idx2[nDense] = run2;
+                nDense++;
+            }
+        }
+    }
+
+    setDimension      ( n          );
+    setNumberOfEntries( nDense     );
+    setIndices        ( idx1, idx2 );
+
+    returnValue returnvalue = setMatrix( A );
+
+    delete[] A;
+    delete[] idx1;
+    delete[] idx2;
+
+    return returnvalue;
+}
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
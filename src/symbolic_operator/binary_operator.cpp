@@ -63,8 +63,12 @@ BinaryOperator::BinaryOperator( Operator *_argument1, Operator *_argument2 ) : S
 
 BinaryOperator::BinaryOperator( const BinaryOperator &arg ){
 
-	argument1  = arg.argument1->clone();
-    argument2  = arg.argument2->clone();
+    argument1 = arg.argument1;
+    argument2 = arg.argument2;
+
+    retainArgument( argument1 );
+    retainArgument( argument2 );
+
     copy( arg );
 }
 
@@ -78,7 +82,15 @@ BinaryOperator::~BinaryOperator(){
 BinaryOperator& BinaryOperator::operator=( const BinaryOperator &arg ){
 
     if( this != &arg ){
+
+        retainArgument( arg.argument1 );
+        retainArgument( arg.argument2 );
+
         deleteAll();
+
+        argument1 = arg.argument1;
+        argument2 = arg.argument2;
+
         copy( arg );
     }
     return *this;
@@ -222,15 +234,13 @@ void BinaryOperator::copy( const BinaryOperator &arg ){
     }
     curvature         = arg.curvature   ;
     monotonicity      = arg.monotonicity;
-
-    nCount = 0;
 }
 
 
 void BinaryOperator::deleteAll(){
 
-    if( argument1 != 0 ) delete argument1;
-    if( argument2 != 0 ) delete argument2;
+    releaseArgument( argument1 );
+    releaseArgument( argument2 );
 
     if( dargument1 != NULL ){
         delete dargument1;
@@ -245,6 +255,21 @@ void BinaryOperator::deleteAll(){
     free( dargument2_result );
 }
 
+returnValue BinaryOperator::unshareArguments( OperatorCopyTable &copies ){
+
+    Operator *tmp1 = copyArgument( argument1, copies );
+    Operator *tmp2 = copyArgument( argument2, copies );
+
+    releaseArgument( argument1 );
+    releaseArgument( argument2 );
+
+    argument1 = tmp1;
+    argument2 = tmp2;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue BinaryOperator::setVariableExportName( const VariableType &type, const Stream *name )
 {
 	argument1->setVariableExportName(type, name);
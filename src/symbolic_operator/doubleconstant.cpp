@@ -86,8 +86,6 @@ DoubleConstant& DoubleConstant::operator=( const DoubleConstant &arg ){
 
         value           = arg.value          ;
         neutralElement  = arg.neutralElement ;
-
-        nCount = 0;
     }
 
     return *this;
@@ -241,6 +241,84 @@ returnValue Operator::setVariableExportName( const VariableType &_type, const St
 }
 
 
+Operator* Operator::cloneUnshared( OperatorCopyTable &copies ) const{
+
+    Operator *tmp = clone();
+    tmp->unshareArguments( copies );
+
+    return tmp;
+}
+
+
+returnValue Operator::unshareArguments( OperatorCopyTable &copies ){
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void Operator::retainArgument( Operator *arg ){
+
+    if( arg == 0 ) return;
+
+#ifdef _OPENMP
+    #pragma omp atomic
+#endif
+    arg->nCount++;
+}
+
+
+void Operator::releaseArgument( Operator *arg ){
+
+    if( arg == 0 ) return;
+
+    // the decrement and the test whether the caller was the last owner
+    // have to be a single step, otherwise two threads releasing the
+    // last two references could both miss (or both perform) the delete
+    int nOthers;
+
+#ifdef _OPENMP
+    #pragma omp atomic capture
+#endif
+    nOthers = arg->nCount--;
+
+    if( nOthers == 0 ) delete arg;
+}
+
+
+BooleanType Operator::isSharedArgument( const Operator *arg ){
+
+    int nOthers;
+
+#ifdef _OPENMP
+    #pragma omp atomic read
+#endif
+    nOthers = arg->nCount;
+
+    if( nOthers > 0 ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+Operator* Operator::copyArgument( const Operator *arg, OperatorCopyTable &copies ){
+
+    // a node with a single owner can not be reached twice:
+    if( isSharedArgument( arg ) == BT_FALSE )
+        return arg->cloneUnshared( copies );
+
+    OperatorCopyTable::iterator it = copies.find( arg );
+
+    if( it != copies.end() ){
+        retainArgument( it->second );
+        return it->second;
+    }
+
+    Operator *tmp = arg->cloneUnshared( copies );
+    copies[arg] = tmp;
+
+    return tmp;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -68,10 +68,8 @@ Power_Int::Power_Int( const Power_Int &arg ){
     bufferSize       = arg.bufferSize;
     exponent         = arg.exponent;
 
-	argument         = arg.argument->clone();
-	
-// 	argument         = arg.argument;
-// 	argument->nCount++;
+    argument         = arg.argument;
+    retainArgument( argument );
 
     if( arg.dargument == NULL ){
         dargument = NULL;
@@ -98,17 +96,7 @@ Power_Int::Power_Int( const Power_Int &arg ){
 
 Power_Int::~Power_Int(){
 
- delete argument;
-//     if( argument != 0 ){
-// 
-//         if( argument->nCount == 0 ){
-//             delete argument;
-//             argument = 0;
-//         }
-//         else{
-//             argument->nCount--;
-//         }
-//     }
+    releaseArgument( argument );
 
     if( dargument != NULL ){
         delete dargument;
@@ -123,18 +111,8 @@ Power_Int& Power_Int::operator=( const Power_Int &arg ){
 
     if( this != &arg ){
 
-	 
-	 delete argument;
-//         if( argument != 0 ){
-// 
-//             if( argument->nCount == 0 ){
-//                 delete argument;
-//                 argument = 0;
-//             }
-//             else{
-//                 argument->nCount--;
-//             }
-//         }
+        retainArgument( arg.argument );
+        releaseArgument( argument );
 
         if( dargument != NULL ){
             delete dargument;
@@ -143,10 +121,7 @@ Power_Int& Power_Int::operator=( const Power_Int &arg ){
         free(  argument_result );
         free( dargument_result );
 
-        argument = arg.argument->clone();
-		
-//         argument = arg.argument;
-// 		argument->nCount++;
+        argument = arg.argument;
 
         exponent          = arg.exponent                       ;
         dargument         = NULL                               ;
@@ -156,8 +131,6 @@ Power_Int& Power_Int::operator=( const Power_Int &arg ){
 
         curvature         = arg.curvature   ;
         monotonicity      = arg.monotonicity;
-
-        nCount = 0;
     }
 
     return *this;
@@ -609,6 +582,17 @@ Operator* Power_Int::clone() const{
 }
 
 
+returnValue Power_Int::unshareArguments( OperatorCopyTable &copies ){
+
+    Operator *tmp = copyArgument( argument, copies );
+
+    releaseArgument( argument );
+    argument = tmp;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Power_Int::clearBuffer(){
 
     if( bufferSize > 1 ){
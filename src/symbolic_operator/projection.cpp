@@ -150,8 +150,6 @@ void Projection::copy( const Projection &arg ){
         operatorName   = arg.operatorName ;
         curvature      = arg.curvature    ;
         monotonicity   = arg.monotonicity ;
-
-        nCount = 0;
     }
 }
 
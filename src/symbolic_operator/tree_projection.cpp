@@ -76,7 +76,7 @@ TreeProjection::TreeProjection( const TreeProjection &arg )
     }
     else{
         argument = arg.argument;
-        argument->nCount++;
+        retainArgument( argument );
     }
 
     ne = arg.ne;
@@ -87,13 +87,8 @@ TreeProjection::~TreeProjection(){
  
     if( argument != 0 ){
 
-        if( argument->nCount == 0 ){
-            delete argument;
-            argument = 0;
-        }
-        else{
-            argument->nCount--;
-        }
+        releaseArgument( argument );
+        argument = 0;
     }
 }
 
@@ -104,13 +99,8 @@ TreeProjection& TreeProjection::operator=( const Operator &arg ){
     if( this != &arg ){
 
         if( argument != 0 ){
-            if( argument->nCount == 0 ){
-                delete argument;
-                argument = 0;
-            }
-            else{
-                argument->nCount--;
-            }
+            releaseArgument( argument );
+            argument = 0;
         }
 
         Operator *tmp = arg.passArgument();
@@ -139,13 +129,8 @@ TreeProjection& TreeProjection::operator=( const Expression &arg ){
     ASSERT( arg.getDim() == 1 );
 
     if( argument != 0 ){
-        if( argument->nCount == 0 ){
-            delete argument;
-            argument = 0;
-        }
-        else{
-            argument->nCount--;
-        }
+        releaseArgument( argument );
+        argument = 0;
     }
 
     argument = arg.getOperatorClone(0);
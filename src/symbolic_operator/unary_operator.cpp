@@ -74,10 +74,8 @@ UnaryOperator::UnaryOperator( const UnaryOperator &arg ){
 
     bufferSize = arg.bufferSize;
 
- 	argument   = arg.argument->clone();
-	
-// 	argument   = arg.argument;
-//     argument->nCount++;
+    argument   = arg.argument;
+    retainArgument( argument );
 
     if( arg.dargument == 0 ) dargument = 0;
     else                     dargument = arg.dargument->clone();
@@ -100,19 +98,8 @@ UnaryOperator::UnaryOperator( const UnaryOperator &arg ){
 
 
 UnaryOperator::~UnaryOperator(){
- 
- 
-//  delete argument;
-    if( argument != 0 ){
-
-        if( argument->nCount == 0 ){
-            delete argument;
-            argument = 0;
-        }
-        else{
-            argument->nCount--;
-        }
-    }
+
+    releaseArgument( argument );
     if( dargument != 0 ) delete dargument;
 
     free(  argument_result );
@@ -124,29 +111,15 @@ UnaryOperator& UnaryOperator::operator=( const UnaryOperator &arg ){
 
     if( this != &arg ){
 
-	 
-	 
-// 	 delete argument;
-	 
-        if( argument != 0 ){
-
-            if( argument->nCount == 0 ){
-                delete argument;
-                argument = 0;
-            }
-            else{
-                argument->nCount--;
-            }
-        }
+        retainArgument( arg.argument );
+
+        releaseArgument( argument );
         if( dargument != 0 ) delete dargument;
 
         free(  argument_result );
         free( dargument_result );
 
- 		argument = arg.argument->clone();
-		
-//         argument = arg.argument;
-// 		argument->nCount++;
+        argument = arg.argument;
 
         dargument         = NULL                               ;
         bufferSize        = arg.bufferSize                     ;
@@ -156,8 +129,6 @@ UnaryOperator& UnaryOperator::operator=( const UnaryOperator &arg ){
         curvature    = arg.curvature   ;
         monotonicity = arg.monotonicity;
         cName        = arg.cName       ;
-
-        nCount = 0;
     }
     return *this;
 }
@@ -369,6 +340,17 @@ BooleanType UnaryOperator::isVariable( VariableType &varType, int &component ) c
     return BT_FALSE;
 }
 
+returnValue UnaryOperator::unshareArguments( OperatorCopyTable &copies ){
+
+    Operator *tmp = copyArgument( argument, copies );
+
+    releaseArgument( argument );
+    argument = tmp;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue UnaryOperator::clearBuffer(){
 
     if( bufferSize > 1 ){
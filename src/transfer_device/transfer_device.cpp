@@ -45,6 +45,7 @@ BEGIN_NAMESPACE_ACADO
 TransferDevice::TransferDevice( ) : SimulationBlock( )
 {
 	additiveNoise = 0;
+	noiseSeed     = 0;
 
 	setStatus( BS_NOT_INITIALIZED );
 }
@@ -67,6 +68,8 @@ TransferDevice::TransferDevice(	uint _dim,
 	deadTimes.init( _dim );
 	deadTimes.setAll( 0.0 );
 
+	noiseSeed = 0;
+
 	setStatus( BS_NOT_INITIALIZED );
 }
 
@@ -91,6 +94,8 @@ TransferDevice::TransferDevice( const TransferDevice& rhs ) : SimulationBlock( r
 	noiseSamplingTimes = rhs.noiseSamplingTimes;
 	
 	deadTimes = rhs.deadTimes;
+
+	noiseSeed = rhs.noiseSeed;
 }
 
 
@@ -141,6 +146,8 @@ TransferDevice& TransferDevice::operator=( const TransferDevice& rhs )
 		noiseSamplingTimes = rhs.noiseSamplingTimes;
 
 		deadTimes = rhs.deadTimes;
+
+		noiseSeed = rhs.noiseSeed;
 	}
 
 	return *this;
@@ -174,13 +181,18 @@ returnValue TransferDevice::init(	double _startTime,
 		lastSignal.setVector( 0,tmp );
 	}
 
-	// initialise additive noise
+	// initialise additive noise (each component with its own seed)
 	if ( additiveNoise != 0 )
 	{
 		for( uint i=0; i<getDim( ); ++i )
 		{
 			if ( additiveNoise[i] != 0 )
-				additiveNoise[i]->init( );
+			{
+				if ( noiseSeed == 0 )
+					additiveNoise[i]->init( );
+				else
+					additiveNoise[i]->init( Noise::deriveSeed( noiseSeed,i ) );
+			}
 		}
 	}
 
@@ -49,6 +49,11 @@ LogCollection::LogCollection( )
 	last  = 0;
 
 	number = 0;
+
+	nSlotNames  = 0;
+	slotStart   = 0;
+	slotItems   = 0;
+	slotRecords = 0;
 }
 
 
@@ -59,6 +64,11 @@ LogCollection::LogCollection( const LogCollection& rhs )
 
 	number = 0;
 
+	nSlotNames  = 0;
+	slotStart   = 0;
+	slotItems   = 0;
+	slotRecords = 0;
+
 	/* if rhs logging list is not empty, add all logging records... */
 	LogRecord* current = rhs.first;
 
@@ -130,6 +140,8 @@ int LogCollection::addLogRecord(	LogRecord& record
 
 	++number;
 
+	updateSlots( );
+
 	return (number-1);
 }
 
@@ -152,7 +164,7 @@ returnValue LogCollection::clearAllRecords( )
 	last  = 0;
 	number = 0;
 
-	return SUCCESSFUL_RETURN;
+	return clearSlots( );
 }
 
 
@@ -276,16 +288,30 @@ returnValue LogCollection::setAll(	uint _name,
 									const MatrixVariablesGrid& values
 									)
 {
-	LogRecord* record = first;
-
-	while ( record != 0 )
+	if ( _type == LRT_ENUM )
 	{
-		if ( record->hasItem( _name,_type ) == BT_TRUE )
+		if ( _name >= nSlotNames )
+			return SUCCESSFUL_RETURN;
+
+		for( uint i=slotStart[_name]; i<slotStart[_name+1]; ++i )
 		{
-			if ( record->setAll( _name,_type,values ) != SUCCESSFUL_RETURN )
+			if ( slotItems[i]->isWriteProtected( ) == BT_TRUE )
+				continue;
+
+			if ( slotItems[i]->setAllValues( slotRecords[i]->getLogFrequency( ),values ) != SUCCESSFUL_RETURN )
 				return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
 		}
 
+		return SUCCESSFUL_RETURN;
+	}
+
+	LogRecord* record = first;
+
+	while ( record != 0 )
+	{
+		if ( record->setAll( _name,_type,values ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
+
 		record = record->getNext( );
 	}
 
@@ -299,16 +325,96 @@ returnValue LogCollection::setLast(	uint _name,
 									double time
 									)
 {
-	LogRecord* record = first;
+	returnValue returnvalue;
 
-	while ( record != 0 )
+	// sensitivities may be evaluated concurrently (see SCPevaluation),
+	// hence all writes into log items are serialised
+#ifdef _OPENMP
+	#pragma omp critical( acadoLogCollection )
+#endif
+	returnvalue = writeLast( _name,_type,value,time );
+
+	return returnvalue;
+}
+
+
+returnValue LogCollection::setLastScalar(	uint _name,
+											LogRecordItemType _type,
+											double lastValue,
+											double time
+											)
+{
+	returnValue returnvalue;
+
+#ifdef _OPENMP
+	#pragma omp critical( acadoLogCollection )
+#endif
 	{
-		if ( record->hasItem( _name,_type ) == BT_TRUE )
+		scalarBuffer.init( 1,1 );
+		scalarBuffer( 0,0 ) = lastValue;
+
+		returnvalue = writeLast( _name,_type,scalarBuffer,time );
+	}
+
+	return returnvalue;
+}
+
+
+returnValue LogCollection::setLastVector(	uint _name,
+											LogRecordItemType _type,
+											const Vector& lastValue,
+											double time
+											)
+{
+	returnValue returnvalue;
+
+#ifdef _OPENMP
+	#pragma omp critical( acadoLogCollection )
+#endif
+	{
+		vectorBuffer.init( lastValue.getDim( ),1 );
+		for( uint i=0; i<lastValue.getDim( ); ++i )
+			vectorBuffer( i,0 ) = lastValue( i );
+
+		returnvalue = writeLast( _name,_type,vectorBuffer,time );
+	}
+
+	return returnvalue;
+}
+
+
+returnValue LogCollection::writeLast(	uint _name,
+										LogRecordItemType _type,
+										const Matrix& value,
+										double time
+										)
+{
+	// items identified by a LogName are directly accessed via their slots
+	if ( _type == LRT_ENUM )
+	{
+		if ( _name >= nSlotNames )
+			return SUCCESSFUL_RETURN;
+
+		for( uint i=slotStart[_name]; i<slotStart[_name+1]; ++i )
 		{
-			if ( record->setLast( _name,_type,value,time ) != SUCCESSFUL_RETURN )
+			if ( slotItems[i]->isWriteProtected( ) == BT_TRUE )
+				continue;
+
+			if ( slotItems[i]->setValue( slotRecords[i]->getLogFrequency( ),value,time ) != SUCCESSFUL_RETURN )
 				return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
 		}
 
+		return SUCCESSFUL_RETURN;
+	}
+
+	// records silently ignore items they do not contain
+	LogRecord* record = first;
+
+	while ( record != 0 )
+	{
+		if ( record->setLast( _name,_type,value,time ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
+
 		record = record->getNext( );
 	}
 
@@ -367,6 +473,91 @@ LogRecord* LogCollection::findNonEmpty(	uint _name,
 }
 
 
+returnValue LogCollection::updateSlots( )
+{
+	uint i;
+	uint nSlots = 0;
+
+	LogRecord* record;
+	LogRecordItem* item;
+
+	clearSlots( );
+
+	// determine range of LogNames and number of slots...
+	for( record=first; record!=0; record=record->getNext( ) )
+	{
+		for( item=record->first; item!=0; item=item->getNext( ) )
+		{
+			if ( item->getType( ) != LRT_ENUM )
+				continue;
+
+			if ( (uint)item->getName( ) >= nSlotNames )
+				nSlotNames = item->getName( )+1;
+
+			++nSlots;
+		}
+	}
+
+	if ( nSlots == 0 )
+		return SUCCESSFUL_RETURN;
+
+	slotStart   = (uint*) calloc( nSlotNames+1,sizeof(uint) );
+	slotItems   = (LogRecordItem**) calloc( nSlots,sizeof(LogRecordItem*) );
+	slotRecords = (LogRecord**) calloc( nSlots,sizeof(LogRecord*) );
+
+	// ... count items per LogName...
+	for( record=first; record!=0; record=record->getNext( ) )
+		for( item=record->first; item!=0; item=item->getNext( ) )
+			if ( item->getType( ) == LRT_ENUM )
+				++slotStart[ item->getName( )+1 ];
+
+	for( i=0; i<nSlotNames; ++i )
+		slotStart[i+1] += slotStart[i];
+
+	// ... and fill slots in the order of the records
+	uint* nFilled = (uint*) calloc( nSlotNames,sizeof(uint) );
+
+	for( record=first; record!=0; record=record->getNext( ) )
+	{
+		for( item=record->first; item!=0; item=item->getNext( ) )
+		{
+			if ( item->getType( ) != LRT_ENUM )
+				continue;
+
+			i = slotStart[ item->getName( ) ] + nFilled[ item->getName( ) ];
+			++nFilled[ item->getName( ) ];
+
+			slotItems[i]   = item;
+			slotRecords[i] = record;
+		}
+	}
+
+	free( nFilled );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LogCollection::clearSlots( )
+{
+	if ( slotStart != 0 )
+		free( slotStart );
+
+	if ( slotItems != 0 )
+		free( slotItems );
+
+	if ( slotRecords != 0 )
+		free( slotRecords );
+
+	nSlotNames  = 0;
+	slotStart   = 0;
+	slotItems   = 0;
+	slotRecords = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 
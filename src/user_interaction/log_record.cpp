@@ -53,6 +53,7 @@ LogRecord::LogRecord( )
 	outputFile     = stdout;
 	outputFileName = 0;
 	printScheme    = PS_DEFAULT;
+	maxNumPoints   = 0;
 
 	first = 0;
 	last  = 0;
@@ -73,6 +74,7 @@ LogRecord::LogRecord(	LogFrequency _frequency,
 	outputFile     = _outputFile;
 	outputFileName = 0;
 	printScheme    = _printScheme;
+	maxNumPoints   = 0;
 
 	first = 0;
 	last  = 0;
@@ -94,6 +96,7 @@ LogRecord::LogRecord(	LogFrequency _frequency,
 	outputFileName = 0;
 	acadoAssignString( &outputFileName,_outputFileName,"default.log" );
 	printScheme    = _printScheme;
+	maxNumPoints   = 0;
 
 	first = 0;
 	last  = 0;
@@ -112,6 +115,7 @@ LogRecord::LogRecord( const LogRecord& rhs )
 	outputFileName = 0;
 	acadoAssignString( &outputFileName,rhs.outputFileName,"default.log" );
 	printScheme    = rhs.printScheme;
+	maxNumPoints   = rhs.maxNumPoints;
 
 	first = 0;
 	last  = 0;
@@ -155,6 +159,7 @@ LogRecord& LogRecord::operator=( const LogRecord& rhs )
 		outputFileName = 0;
 		acadoAssignString( &outputFileName,rhs.outputFileName,"default.log" );
 		printScheme    = rhs.printScheme;
+		maxNumPoints   = rhs.maxNumPoints;
 
 		/* if rhs log_record list is not empty, add all option items... */
 		LogRecordItem* current = rhs.first;
@@ -188,6 +193,9 @@ BooleanType LogRecord::operator==(	const LogRecord& rhs
 	if ( printScheme != rhs.printScheme )
 		return BT_FALSE;
 
+	if ( maxNumPoints != rhs.maxNumPoints )
+		return BT_FALSE;
+
 
 	if ( number != rhs.number )
 		return BT_FALSE;
@@ -324,6 +332,7 @@ returnValue LogRecord::addItem(	LogName _name,
 	// create new item
 	LogRecordItem* newItem = new LogRecordItem( _name,_label,_startString,_endString,
 												_width,_precision,_colSeparator,_rowSeparator );
+	newItem->setMaxNumPoints( maxNumPoints );
 
 	if ( number == 0 )
 	{
@@ -399,6 +408,7 @@ returnValue LogRecord::addItem(	const Expression& _name,
 	// create new item
 	LogRecordItem* newItem = new LogRecordItem( _name,_label,_startString,_endString,
 												_width,_precision,_colSeparator,_rowSeparator );
+	newItem->setMaxNumPoints( maxNumPoints );
 
 	if ( number == 0 )
 	{
@@ -445,7 +455,7 @@ returnValue LogRecord::clearAllItems( )
 returnValue LogRecord::print(	LogPrintMode _mode
 								) const
 {
-	uint stringLength = determineRecordStringLength( )+1;
+	uint stringLength = determineRecordStringLength( _mode )+1;
 
 	char* string      = new char[stringLength];
 	for( uint i=0; i<stringLength; ++i )
@@ -567,6 +577,23 @@ returnValue LogRecord::printInfo( ) const
 }
 
 
+returnValue LogRecord::setMaxNumPoints(	uint _maxNumPoints
+										)
+{
+	maxNumPoints = _maxNumPoints;
+
+	LogRecordItem* current = first;
+
+	while ( current != 0 )
+	{
+		current->setMaxNumPoints( maxNumPoints );
+		current = current->getNext( );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 uint LogRecord::getMaxNumMatrices( ) const
 {
 	uint maxNumMatrices = 0;
@@ -732,16 +759,34 @@ LogRecordItem* LogRecord::findNonEmpty(	uint _name,
 }
 
 
-uint LogRecord::determineRecordStringLength( ) const
+uint LogRecord::determineRecordStringLength(	LogPrintMode _mode
+												) const
 {
 	uint stringLength = 0;
 
 	LogRecordItem* current = first;
 
-	while ( current != 0 )
+	// only the values to be printed are taken into account, such that
+	// printing the last iteration does not depend on the length of the run
+	switch( _mode )
 	{
-		stringLength += current->determineStringLength( );
-		current = current->getNext( );
+		case PRINT_ITEM_BY_ITEM:
+		case PRINT_ITER_BY_ITER:
+			while ( current != 0 )
+			{
+				stringLength += current->determineStringLength( );
+				current = current->getNext( );
+			}
+			break;
+
+		case PRINT_LAST_ITER:
+			while ( current != 0 )
+			{
+				stringLength += current->determineStringLength( getMaxNumMatrices( )-1 );
+				current = current->getNext( );
+			}
+			stringLength += 1;
+			break;
 	}
 
 	return stringLength;
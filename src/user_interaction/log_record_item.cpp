@@ -44,6 +44,15 @@ BEGIN_NAMESPACE_ACADO
 
 LogRecordItem::LogRecordItem( )
 {
+	values = 0;
+	times  = 0;
+
+	bufferSize   = 0;
+	maxNumPoints = 0;
+	firstSlot    = 0;
+	nPoints      = 0;
+	nWritten     = 0;
+
 	name = -1;
 	type = LRT_UNKNOWN;
 	
@@ -73,6 +82,15 @@ LogRecordItem::LogRecordItem(	LogName _name,
 								const char* const _rowSeparator
 								)
 {
+	values = 0;
+	times  = 0;
+
+	bufferSize   = 0;
+	maxNumPoints = 0;
+	firstSlot    = 0;
+	nPoints      = 0;
+	nWritten     = 0;
+
 	name = (int) _name;
 	type  = LRT_ENUM;
 
@@ -109,6 +127,15 @@ LogRecordItem::LogRecordItem(	const Expression& _name,
 								const char* const _rowSeparator
 								)
 {
+	values = 0;
+	times  = 0;
+
+	bufferSize   = 0;
+	maxNumPoints = 0;
+	firstSlot    = 0;
+	nPoints      = 0;
+	nWritten     = 0;
+
 	name = _name.getComponent( 0 );
 	type  = LRT_VARIABLE;
 
@@ -137,7 +164,16 @@ LogRecordItem::LogRecordItem(	const Expression& _name,
 
 LogRecordItem::LogRecordItem( const LogRecordItem& rhs )
 {
-	values = rhs.values;
+	values = 0;
+	times  = 0;
+
+	bufferSize   = 0;
+	maxNumPoints = 0;
+	firstSlot    = 0;
+	nPoints      = 0;
+	nWritten     = 0;
+
+	copyValues( rhs );
 
 	name  = rhs.name;
 	type  = rhs.type;
@@ -167,6 +203,8 @@ LogRecordItem::LogRecordItem( const LogRecordItem& rhs )
 
 LogRecordItem::~LogRecordItem( )
 {
+	clearValues( );
+
 	if ( label != 0 )
 		delete[] label;
 
@@ -204,7 +242,8 @@ LogRecordItem& LogRecordItem::operator=( const LogRecordItem& rhs )
 			delete[] rowSeparator;
 
 
-		values = rhs.values;
+		clearValues( );
+		copyValues( rhs );
 	
 		name  = rhs.name;
 		type  = rhs.type;
@@ -281,29 +320,67 @@ BooleanType LogRecordItem::operator!=(	const LogRecordItem& rhs
 }
 
 
+MatrixVariablesGrid LogRecordItem::getAllValues( ) const
+{
+	MatrixVariablesGrid allValues;
+	allValues.reserve( getNumPoints( ) );
+
+	for( uint i=0; i<getNumPoints( ); ++i )
+		allValues.addMatrix( *(values[getSlot( i )]),times[getSlot( i )] );
+
+	return allValues;
+}
+
+
 returnValue LogRecordItem::setAllValues(	LogFrequency _frequency,
 											const MatrixVariablesGrid& _values
 											)
 {
+	uint slot;
+
 	if ( _values.getNumPoints( ) <= 0 )
-		return values.init( );
+	{
+		firstSlot = 0;
+		nPoints   = 0;
+		nWritten  = 0;
+		return SUCCESSFUL_RETURN;
+	}
 
 	switch( _frequency )
 	{
 		case LOG_AT_START:
-			values.init();
-			values.addMatrix( _values.getFirstMatrix( ),_values.getFirstTime( ) );
+			firstSlot = 0;
+			nPoints   = 0;
+
+			slot = getNewSlot( );
+			*(values[slot]) = _values.getFirstMatrix( );
+			times[slot] = _values.getFirstTime( );
 			break;
 
 		case LOG_AT_END:
-			values.init();
-			values.addMatrix( _values.getLastMatrix( ),_values.getFirstTime( ) );
+			firstSlot = 0;
+			nPoints   = 0;
+
+			slot = getNewSlot( );
+			*(values[slot]) = _values.getLastMatrix( );
+			times[slot] = _values.getFirstTime( );
 			break;
 
 		case LOG_AT_EACH_ITERATION:
-			values = _values;
+			firstSlot = 0;
+			nPoints   = 0;
+
+			for( uint i=0; i<_values.getNumPoints( ); ++i )
+			{
+				slot = getNewSlot( );
+				*(values[slot]) = _values.getMatrix( i );
+				times[slot] = _values.getTime( i );
+			}
 			break;
 	}
+
+	nWritten = _values.getNumPoints( );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -314,6 +391,7 @@ returnValue LogRecordItem::setValue(	LogFrequency _frequency,
 										)
 {
 	double logTime = _time;
+	uint slot;
 	
 	switch( _frequency )
 	{
@@ -324,32 +402,88 @@ returnValue LogRecordItem::setValue(	LogFrequency _frequency,
 				if ( acadoIsEqual( logTime,-INFTY ) == BT_TRUE )
 					logTime = 0.0;
 				
-				values.addMatrix( _value,logTime );
+				slot = getNewSlot( );
+				*(values[slot]) = _value;
+				times[slot] = logTime;
 			}
 			break;
 
 		case LOG_AT_END:
-			// always overwrite existing matrices in order to keep only the last one
-			values.init();
+			// always overwrite the existing matrix in order to keep only the last one
+			firstSlot = 0;
+			nPoints   = 0;
 			
 			if ( acadoIsEqual( logTime,-INFTY ) == BT_TRUE )
 				logTime = 0.0;
 			
-			values.addMatrix( _value,logTime );
+			slot = getNewSlot( );
+			*(values[slot]) = _value;
+			times[slot] = logTime;
 			break;
 
 		case LOG_AT_EACH_ITERATION:
 			// add matrix to list
 			if ( acadoIsEqual( logTime,-INFTY ) == BT_TRUE )
-				logTime = (double)getNumPoints() + 1.0;
+				logTime = (double)nWritten + 1.0;
 
-			values.addMatrix( _value,logTime );
+			// time labels have to be strictly increasing
+			if ( ( getNumPoints( ) > 0 ) && ( acadoIsGreater( logTime,getTime( getNumPoints( )-1 ) ) == BT_FALSE ) )
+				return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+			slot = getNewSlot( );
+			*(values[slot]) = _value;
+			times[slot] = logTime;
+
+			++nWritten;
 			break;
 	}
+
 	return SUCCESSFUL_RETURN;
 }
 
 
+returnValue LogRecordItem::getValueString( char** valueString ) const
+{
+	Matrix tmp;
+	getStackedValues( tmp );
+
+	return tmp.printToString( valueString, label,startString,endString,
+							  width,precision,colSeparator,rowSeparator );
+}
+
+
+uint LogRecordItem::determineStringLength( ) const
+{
+	Matrix tmp;
+	getStackedValues( tmp );
+
+	return tmp.determineStringLength( label,startString,endString,
+									  width,precision,colSeparator,rowSeparator );
+}
+
+
+returnValue LogRecordItem::setMaxNumPoints(	uint _maxNumPoints
+											)
+{
+	maxNumPoints = _maxNumPoints;
+
+	if ( ( maxNumPoints > 0 ) && ( bufferSize > maxNumPoints ) )
+		return resizeBuffer( maxNumPoints );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+uint LogRecordItem::getNumDoubles( ) const
+{
+	uint nDoubles = 0;
+
+	for( uint i=0; i<getNumPoints( ); ++i )
+		nDoubles += values[getSlot( i )]->getDim( );
+
+	return nDoubles;
+}
+
 
 
 //
@@ -370,6 +504,193 @@ returnValue LogRecordItem::assignDigits(	uint& toDigit,
 }
 
 
+uint LogRecordItem::getNewSlot( )
+{
+	uint slot;
+
+	if ( nPoints == bufferSize )
+	{
+		if ( ( maxNumPoints > 0 ) && ( bufferSize >= maxNumPoints ) )
+		{
+			// buffer is full, overwrite oldest value
+			slot = firstSlot;
+			firstSlot = getSlot( 1 );
+			return slot;
+		}
+
+		// grow geometrically such that logging takes amortised constant time
+		if ( ( maxNumPoints > 0 ) && ( 2*bufferSize+1 > maxNumPoints ) )
+			resizeBuffer( maxNumPoints );
+		else
+			resizeBuffer( 2*bufferSize+1 );
+	}
+
+	slot = getSlot( nPoints );
+	++nPoints;
+
+	if ( values[slot] == 0 )
+		values[slot] = new Matrix;
+
+	return slot;
+}
+
+
+returnValue LogRecordItem::resizeBuffer(	uint _bufferSize
+											)
+{
+	uint i;
+	uint nKept = nPoints;
+
+	if ( nKept > _bufferSize )
+		nKept = _bufferSize;
+
+	Matrix** newValues = (Matrix**) calloc( _bufferSize,sizeof(Matrix*) );
+	double*  newTimes  = (double*)  calloc( _bufferSize,sizeof(double) );
+
+	// keep the newest values in chronological order...
+	for( i=0; i<nKept; ++i )
+	{
+		newValues[i] = values[getSlot( nPoints-nKept+i )];
+		newTimes[i]  = times[getSlot( nPoints-nKept+i )];
+	}
+
+	// ... and re-use the storage of unused slots as far as possible
+	uint nReused = nKept;
+
+	for( i=0; i<bufferSize; ++i )
+	{
+		uint idx = ( i + bufferSize - firstSlot ) % bufferSize;
+
+		if ( ( idx >= nPoints-nKept ) && ( idx < nPoints ) )
+			continue;
+
+		if ( values[i] == 0 )
+			continue;
+
+		if ( nReused < _bufferSize )
+			newValues[nReused++] = values[i];
+		else
+			delete values[i];
+	}
+
+	if ( values != 0 )
+		free( values );
+
+	if ( times != 0 )
+		free( times );
+
+	values = newValues;
+	times  = newTimes;
+
+	bufferSize = _bufferSize;
+	firstSlot  = 0;
+	nPoints    = nKept;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LogRecordItem::clearValues( )
+{
+	for( uint i=0; i<bufferSize; ++i )
+		if ( values[i] != 0 )
+			delete values[i];
+
+	if ( values != 0 )
+		free( values );
+
+	if ( times != 0 )
+		free( times );
+
+	values = 0;
+	times  = 0;
+
+	bufferSize = 0;
+	firstSlot  = 0;
+	nPoints    = 0;
+	nWritten   = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LogRecordItem::copyValues(	const LogRecordItem& rhs
+										)
+{
+	maxNumPoints = rhs.maxNumPoints;
+	nWritten     = rhs.nWritten;
+
+	if ( rhs.nPoints == 0 )
+		return SUCCESSFUL_RETURN;
+
+	values = (Matrix**) calloc( rhs.nPoints,sizeof(Matrix*) );
+	times  = (double*)  calloc( rhs.nPoints,sizeof(double) );
+
+	for( uint i=0; i<rhs.nPoints; ++i )
+	{
+		values[i] = new Matrix( *(rhs.values[rhs.getSlot( i )]) );
+		times[i]  = rhs.times[rhs.getSlot( i )];
+	}
+
+	bufferSize = rhs.nPoints;
+	firstSlot  = 0;
+	nPoints    = rhs.nPoints;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LogRecordItem::getStackedValues(	Matrix& stackedValues
+												) const
+{
+	uint i, j, k;
+	uint nRows = 0;
+	uint nCols = 0;
+	BooleanType hasEqualCols = BT_TRUE;
+
+	for( i=0; i<getNumPoints( ); ++i )
+	{
+		const Matrix& current = *(values[getSlot( i )]);
+
+		if ( current.getNumRows( ) == 0 )
+			continue;
+
+		if ( ( nRows > 0 ) && ( current.getNumCols( ) != nCols ) )
+			hasEqualCols = BT_FALSE;
+
+		nRows += current.getNumRows( );
+		nCols  = current.getNumCols( );
+	}
+
+	// fall back to appending row by row if dimensions do not match
+	if ( hasEqualCols == BT_FALSE )
+	{
+		stackedValues.init( 0,0 );
+
+		for( i=0; i<getNumPoints( ); ++i )
+			stackedValues.appendRows( *(values[getSlot( i )]) );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	stackedValues.init( nRows,nCols );
+
+	nRows = 0;
+	for( i=0; i<getNumPoints( ); ++i )
+	{
+		const Matrix& current = *(values[getSlot( i )]);
+
+		for( j=0; j<current.getNumRows( ); ++j )
+			for( k=0; k<current.getNumCols( ); ++k )
+				stackedValues( nRows+j,k ) = current( j,k );
+
+		nRows += current.getNumRows( );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -190,6 +190,11 @@ returnValue Options::setOptions(	const Options &arg
 									)
 {
 	operator=( arg );
+
+	// assigning new options counts as a change
+	for( uint i=0; i<getNumOptionsLists( ); ++i )
+		optionsList[i]->optionsHaveChanged = BT_TRUE;
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -205,6 +210,7 @@ returnValue Options::setOptions(	uint idx,
 		delete optionsList[idx];
 
 	optionsList[idx] = new OptionsList( *(arg.optionsList[idx]) );
+	optionsList[idx]->optionsHaveChanged = BT_TRUE;
 
 	return SUCCESSFUL_RETURN;
 }
@@ -341,7 +341,7 @@ ReturnValueList returnValueList[] =
 { RET_ONLY_ODE_FOR_CODE_EXPORT,					"Only ODEs supported for code generation", VS_VISIBLE },
 { RET_ONLY_STATES_AND_CONTROLS_FOR_CODE_EXPORT,	"No parameters, disturbances or algebraic states supported for code generation", VS_VISIBLE },
 { RET_ONLY_EQUIDISTANT_GRID_FOR_CODE_EXPORT,	"Only equidistant evaluation grids supported for code generation", VS_VISIBLE },
-{ RET_ONLY_BOUNDS_FOR_CODE_EXPORT,				"Only state and control bounds supported for code generation", VS_VISIBLE },
+{ RET_ONLY_BOUNDS_FOR_CODE_EXPORT,				"Only bounds and path constraints supported for code generation", VS_VISIBLE },
 { RET_QPOASES_EMBEDDED_NOT_FOUND,				"Embedded qpOASES code not found", VS_VISIBLE },
 { RET_UNABLE_TO_EXPORT_STATEMENT,				"Unable to export statement due to incomplete definition", VS_VISIBLE },
 { RET_INVALID_CALL_TO_EXPORTED_FUNCTION,		"Invalid call to export functions (check number of calling arguments)", VS_VISIBLE },
@@ -44,8 +44,9 @@ BEGIN_NAMESPACE_ACADO
 
 Grid::Grid( )
 {
-	nPoints = 0;
-	times   = 0;
+	nPoints  = 0;
+	times    = 0;
+	capacity = 0;
 }
 
 
@@ -53,7 +54,8 @@ Grid::Grid(	uint nPoints_,
 			double *times_
 			)
 {
-	times = 0;
+	times    = 0;
+	capacity = 0;
 	init( nPoints_,times_ );
 }
 
@@ -61,7 +63,8 @@ Grid::Grid(	uint nPoints_,
 Grid::Grid(	const Vector& times_
 			)
 {
-	times = 0;
+	times    = 0;
+	capacity = 0;
 	init( times_ );
 }
 
@@ -71,7 +74,8 @@ Grid::Grid(	double _firstTime,
 			uint _nPoints
 			)
 {
-	times = 0;
+	times    = 0;
+	capacity = 0;
 	init( _firstTime,_lastTime,_nPoints );
 }
 
@@ -79,19 +83,13 @@ Grid::Grid(	double _firstTime,
 
 Grid::Grid( const Grid& rhs )
 {
-	nPoints = rhs.nPoints;
+	times    = 0;
+	capacity = 0;
 
-	if ( rhs.times != 0 )
-	{
-		times = (double*) calloc( nPoints,sizeof(double) );
+	allocateTimes( rhs.nPoints );
 
-		for( uint i=0; i<nPoints; ++i )
-			times[i] = rhs.times[i];
-	}
-	else
-	{
-		times = 0;
-	}
+	for( uint i=0; i<nPoints; ++i )
+		times[i] = rhs.times[i];
 }
 
 
@@ -106,15 +104,7 @@ returnValue Grid::init( uint _nPoints,
 						const double* const _times
 						)
 {
-	nPoints = _nPoints;
-
-	if ( times != 0 )
-		free( times );
-
-	if ( nPoints > 0 )
-		times = (double*) calloc( nPoints,sizeof(double) );
-	else
-		times = 0;
+	allocateTimes( _nPoints );
 
 	if ( _times != 0 )
 	{
@@ -134,15 +124,7 @@ returnValue Grid::init( uint _nPoints,
 returnValue Grid::init(	const Vector& times_
 						)
 {
-	nPoints = times_.getDim();
-
-	if ( times != 0 )
-		free( times );
-
-	if ( nPoints > 0 )
-		times = (double*) calloc( nPoints,sizeof(double) );
-	else
-		times = 0;
+	allocateTimes( times_.getDim() );
 
 	for( uint i=0; i<nPoints; ++i )
 		times[i] = times_(i);
@@ -156,15 +138,7 @@ returnValue Grid::init(	double _firstTime,
 						uint _nPoints
 						)
 {
-	nPoints = _nPoints;
-
-	if ( times != 0 )
-		free( times );
-
-	if ( nPoints > 0 )
-		times = (double*) calloc( nPoints,sizeof(double) );
-	else
-		times = 0;
+	allocateTimes( _nPoints );
 
 	return setupEquidistant( _firstTime,_lastTime );
 }
@@ -184,23 +158,10 @@ Grid& Grid::operator=( const Grid& rhs )
 {
     if ( this != &rhs )
     {
-		if ( times != 0 )
-			free( times );
-
-
-		nPoints = rhs.nPoints;
-
-		if ( rhs.times != 0 )
-		{
-			times = (double*) calloc( nPoints,sizeof(double) );
+		allocateTimes( rhs.nPoints );
 
-			for( uint i=0; i<nPoints; ++i )
-				times[i] = rhs.times[i];
-		}
-		else
-		{
-			times = 0;
-		}
+		for( uint i=0; i<nPoints; ++i )
+			times[i] = rhs.times[i];
 	}
 
 	return *this;
@@ -343,16 +304,31 @@ returnValue Grid::addTime(	double _time
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 	}
 
+	// grow geometrically such that appending takes amortised constant time
+	if ( nPoints == capacity )
+		reserve( 2*capacity+1 );
+
+	times[nPoints] = _time;
 	++nPoints;
 
-	times = (double*) realloc( times,nPoints*sizeof(double) );
-	times[nPoints-1] = _time;
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Grid::reserve(	uint _capacity
+							)
+{
+	if ( _capacity <= capacity )
+		return SUCCESSFUL_RETURN;
+
+	times = (double*) realloc( times,_capacity*sizeof(double) );
+	capacity = _capacity;
 
 	return SUCCESSFUL_RETURN;
 }
 
 
-// uses a simple O(n^2) algorithm for sorting
+// merges both ordered grids in linear time
 returnValue Grid::merge(	const Grid& arg,
 							MergeMethod _mergeMethod,
 							BooleanType keepOverlap
@@ -374,6 +350,7 @@ returnValue Grid::merge(	const Grid& arg,
 
 	// construct merged grid
 	Grid mergedGrid;
+	mergedGrid.reserve( getNumPoints( )+arg.getNumPoints( ) );
 	uint j = 0;
 	BooleanType overlapping = BT_FALSE;
 
@@ -397,7 +374,8 @@ returnValue Grid::merge(	const Grid& arg,
 		}
 
 		// merge current grid points if they are at equal times
-		if ( acadoIsEqual( arg.getTime( j ),getTime( i ) ) == BT_TRUE )
+		if ( ( j < arg.getNumPoints( ) ) &&
+			 ( acadoIsEqual( arg.getTime( j ),getTime( i ) ) == BT_TRUE ) )
 		{
 			switch ( _mergeMethod )
 			{
@@ -491,7 +469,8 @@ returnValue Grid::refineGrid(	uint factor
 	newTimes[ getNumIntervals( )*factor ] = getLastTime( );
 
 	/* assign new time array and deallocate old one */
-	nPoints = getNumIntervals( )*factor + 1;
+	nPoints  = getNumIntervals( )*factor + 1;
+	capacity = nPoints;
 
 	double* tmp = times;
 	times = newTimes;
@@ -538,19 +517,28 @@ int Grid::findFirstTime(	double _time,
 							uint startIdx
 							) const
 {
-	if ( times == 0 )
+	if ( nPoints == 0 )
 		return -1;
 
-	for( uint i=startIdx; i<getNumPoints( ); ++i )
+	/* as grid point times are ordered, bisect for the first grid point */
+	/* which either equals the given time or lies behind it */
+	uint lowerIdx = startIdx;
+	uint upperIdx = getNumPoints( );
+	uint idx;
+
+	while ( lowerIdx < upperIdx )
 	{
-		if ( acadoIsEqual( times[i] ,_time ) == BT_TRUE )
-			return i;
+		idx = lowerIdx + ( upperIdx - lowerIdx ) / 2;
 
-		/* stop here as grid point times are ordered! */
-		if ( times[i] > _time )
-			return -1;
+		if ( ( times[idx] > _time ) || ( acadoIsEqual( times[idx] ,_time ) == BT_TRUE ) )
+			upperIdx = idx;
+		else
+			lowerIdx = idx+1;
 	}
 
+	if ( ( lowerIdx < getNumPoints( ) ) && ( acadoIsEqual( times[lowerIdx] ,_time ) == BT_TRUE ) )
+		return lowerIdx;
+
 	/* no grid point with given time found */
 	return -1;
 }
@@ -560,30 +548,19 @@ int Grid::findLastTime(	double _time,
 						uint startIdx
 						) const
 {
-	if ( times == 0 )
-		return -1;
+	int i = findFirstTime( _time,startIdx );
 
-	for( uint i=startIdx; i<getNumPoints( ); ++i )
-	{
-		if ( acadoIsEqual( times[i] ,_time ) == BT_TRUE )
-		{
-			uint j = i;
-
-			while( ( j<getNumPoints( ) ) && ( acadoIsEqual( times[j] , _time ) == BT_TRUE ) )
-			{
-				++j;
-			}
+	if ( i < 0 )
+		return -1;
 
-			return j-1;
-		}
+	uint j = i;
 
-		/* stop here as grid point times are ordered! */
-		if ( times[i] > _time )
-			return -1;
+	while( ( j<getNumPoints( ) ) && ( acadoIsEqual( times[j] , _time ) == BT_TRUE ) )
+	{
+		++j;
 	}
 
-	/* no grid point with given time found */
-	return -1;
+	return j-1;
 }
 
 
@@ -739,7 +716,7 @@ returnValue Grid::setupEquidistant(	double _firstTime,
 
 int Grid::findNextIndex( ) const
 {
-	if ( times == 0 )
+	if ( nPoints == 0 )
 		return -1;
 
 	for( uint i=0; i<getNumPoints( ); ++i )
@@ -751,6 +728,27 @@ int Grid::findNextIndex( ) const
 }
 
 
+void Grid::allocateTimes(	uint _nPoints
+							)
+{
+	nPoints = _nPoints;
+
+	// keep the storage if it is large enough
+	if ( ( nPoints > 0 ) && ( nPoints <= capacity ) )
+		return;
+
+	if ( times != 0 )
+		free( times );
+
+	if ( nPoints > 0 )
+		times = (double*) calloc( nPoints,sizeof(double) );
+	else
+		times = 0;
+
+	capacity = nPoints;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -45,6 +45,7 @@ BEGIN_NAMESPACE_ACADO
 MatrixVariablesGrid::MatrixVariablesGrid( ) : Grid( )
 {
 	values = 0;
+	valuesCapacity = 0;
 }
 
 
@@ -61,6 +62,7 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											) : Grid( )
 {
 	values = 0;
+	valuesCapacity = 0;
 	init( _nRows,_nCols,_grid,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -78,6 +80,7 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											) : Grid( )
 {
 	values = 0;
+	valuesCapacity = 0;
 	init( _nRows,_nCols,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -97,6 +100,7 @@ MatrixVariablesGrid::MatrixVariablesGrid(	uint _nRows,
 											) : Grid( )
 {
 	values = 0;
+	valuesCapacity = 0;
 	init( _nRows,_nCols,_firstTime,_lastTime,_nPoints,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
 
@@ -107,6 +111,7 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const Matrix& arg,
 											) : Grid( )
 {
 	values = 0;
+	valuesCapacity = 0;
 	init( arg,_grid,_type );
 }
 
@@ -116,6 +121,7 @@ MatrixVariablesGrid::MatrixVariablesGrid(	FILE *file
 											) : Grid( )
 {
 	values = 0;
+	valuesCapacity = 0;
 	operator=( file );
 }
 
@@ -124,6 +130,7 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const char* filename
 											) : Grid( )
 {
 	values = 0;
+	valuesCapacity = 0;
 
 	FILE* file = fopen( filename,"r" );
 	
@@ -143,10 +150,7 @@ MatrixVariablesGrid::MatrixVariablesGrid(	const char* filename
 MatrixVariablesGrid::MatrixVariablesGrid(	const MatrixVariablesGrid& rhs
 											) : Grid( rhs )
 {
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	allocateValues( );
 
 	for( uint i=0; i<nPoints; ++i )
 		values[i] = new MatrixVariable( *(rhs.values[i]) );
@@ -169,10 +173,7 @@ MatrixVariablesGrid& MatrixVariablesGrid::operator=(	const MatrixVariablesGrid&
 
 		Grid::operator=( rhs );
 
-		if ( nPoints > 0 )
-			values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-		else
-			values = 0;
+		allocateValues( );
 	
 		for( uint i=0; i<nPoints; ++i )
 			values[i] = new MatrixVariable( *(rhs.values[i]) );
@@ -253,10 +254,7 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	allocateValues( );
 
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
@@ -277,10 +275,7 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _nPoints );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	allocateValues( );
 
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
@@ -303,10 +298,7 @@ returnValue MatrixVariablesGrid::init(	uint _nRows,
 	clearValues( );
 	Grid::init( _firstTime,_lastTime,_nPoints );
 	
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	allocateValues( );
 
 	return initMatrixVariables( _nRows,_nCols,_type,_names,_units,_scaling,_lb,_ub,_autoInit );
 }
@@ -320,10 +312,7 @@ returnValue MatrixVariablesGrid::init(	const Matrix& arg,
 	clearValues( );
 	Grid::operator=( _grid );
 
-	if ( nPoints > 0 )
-		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
-	else
-		values = 0;
+	allocateValues( );
 
 	for( uint i=0; i<nPoints; ++i )
 		values[i] = new MatrixVariable( arg );
@@ -342,6 +331,21 @@ returnValue MatrixVariablesGrid::addMatrix(	const Matrix& newMatrix,
 
 
 
+returnValue MatrixVariablesGrid::reserve(	uint _capacity
+											)
+{
+	Grid::reserve( _capacity );
+
+	if ( _capacity > valuesCapacity )
+	{
+		values = (MatrixVariable**) realloc( values,_capacity*sizeof(MatrixVariable*) );
+		valuesCapacity = _capacity;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue MatrixVariablesGrid::setMatrix(	uint pointIdx,
 											const Matrix& _value
 											) const
@@ -408,6 +412,8 @@ returnValue MatrixVariablesGrid::appendTimes(	const MatrixVariablesGrid& arg,
 	if ( acadoIsGreater( getLastTime( ),arg.getFirstTime( ) ) == BT_TRUE )
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
+	reserve( getNumPoints( )+arg.getNumPoints( ) );
+
 	if ( acadoIsEqual( getLastTime( ),arg.getFirstTime( ) ) == BT_FALSE )
 	{
 		// simply append
@@ -457,7 +463,7 @@ returnValue MatrixVariablesGrid::appendValues( const MatrixVariablesGrid& arg )
 }
 
 
-// uses a simple O(n^2) algorithm for sorting
+// merges both ordered grids in linear time
 returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 										MergeMethod _mergeMethod,
 										BooleanType keepOverlap
@@ -483,6 +489,7 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 
 	// construct merged grid
 	MatrixVariablesGrid mergedGrid;
+	mergedGrid.reserve( getNumPoints( )+arg.getNumPoints( ) );
 	uint j = 0;
 	BooleanType overlapping = BT_FALSE;
 
@@ -506,7 +513,8 @@ returnValue MatrixVariablesGrid::merge(	const MatrixVariablesGrid& arg,
 		}
 
 		// merge current grid points if they are at equal times
-		if ( acadoIsEqual( arg.getTime( j ),getTime( i ) ) == BT_TRUE )
+		if ( ( j < arg.getNumPoints( ) ) &&
+			 ( acadoIsEqual( arg.getTime( j ),getTime( i ) ) == BT_TRUE ) )
 		{
 			switch ( _mergeMethod )
 			{
@@ -1045,7 +1053,7 @@ int MatrixVariablesGrid::sprintf( char* buffer )
 
     double *tmp = new double[getNumPoints()*(getNumRows()+1)];
 
-    if( times == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+    if( nPoints == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
     for( run1 = 0; run1 < getNumPoints(); run1++ ){
         tmp[run1*(getNumValues()+1)] = getTime(run1);
@@ -1083,6 +1091,21 @@ returnValue MatrixVariablesGrid::clearValues( )
 		values = 0;
 	}
 
+	valuesCapacity = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixVariablesGrid::allocateValues( )
+{
+	valuesCapacity = nPoints;
+
+	if ( nPoints > 0 )
+		values = (MatrixVariable**) calloc( nPoints,sizeof(MatrixVariable*) );
+	else
+		values = 0;
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -1134,7 +1157,10 @@ returnValue MatrixVariablesGrid::addMatrix(	const MatrixVariable& newMatrix,
 	if ( Grid::addTime( newTime ) != SUCCESSFUL_RETURN )
 		return RET_INVALID_ARGUMENTS;
 
-	values = (MatrixVariable**) realloc( values,nPoints*sizeof(MatrixVariable*) );
+	// the pointer array grows together with the time array
+	if ( nPoints > valuesCapacity )
+		reserve( capacity );
+
 	values[nPoints-1] = new MatrixVariable( newMatrix );
 
 	return SUCCESSFUL_RETURN;
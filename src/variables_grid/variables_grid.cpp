@@ -388,6 +388,8 @@ returnValue VariablesGrid::appendTimes(	const VariablesGrid& arg,
 	if ( acadoIsGreater( arg.getFirstTime( ),getLastTime( ) ) == BT_FALSE )
 		return ACADOERROR( RET_INVALID_ARGUMENTS );
 
+	reserve( getNumPoints( )+arg.getNumPoints( ) );
+
 	if ( acadoIsEqual( getLastTime( ),arg.getFirstTime( ) ) == BT_FALSE )
 	{
 		// simply append
@@ -453,7 +455,7 @@ returnValue VariablesGrid::appendValues( const VariablesGrid& arg )
 }
 
 
-// uses a simple O(n^2) algorithm for sorting
+// merges both ordered grids in linear time
 returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 									MergeMethod _mergeMethod,
 									BooleanType keepOverlap
@@ -479,6 +481,7 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 
 	// construct merged grid
 	VariablesGrid mergedGrid;
+	mergedGrid.reserve( getNumPoints( )+arg.getNumPoints( ) );
 	uint j = 0;
 	BooleanType overlapping = BT_FALSE;
 
@@ -502,7 +505,8 @@ returnValue VariablesGrid::merge(	const VariablesGrid& arg,
 		}
 
 		// merge current grid points if they are at equal times
-		if ( acadoIsEqual( arg.getTime( j ),getTime( i ) ) == BT_TRUE )
+		if ( ( j < arg.getNumPoints( ) ) &&
+			 ( acadoIsEqual( arg.getTime( j ),getTime( i ) ) == BT_TRUE ) )
 		{
 			switch ( _mergeMethod )
 			{